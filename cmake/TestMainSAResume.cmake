@@ -0,0 +1,72 @@
+# Copyright (c) 2025, RTE (http://www.rte-france.com)
+# See AUTHORS.txt
+# All rights reserved.
+# This Source Code Form is subject to the terms of the Mozilla Public
+# License, v. 2.0. If a copy of the MPL was not distributed with this
+# file, you can obtain one at http://mozilla.org/MPL/2.0/.
+# SPDX-License-Identifier: MPL-2.0
+#
+
+# A security analysis stopped after its first checkpoint and resumed must give the same aggregated results as an uninterrupted one
+
+set(_output_dir ${CMAKE_CURRENT_SOURCE_DIR}/resultsTestsTmp/${TEST_NAME})
+set(_journal ${_output_dir}/scenarioJournal.jsonl)
+set(_dfl_cmd ${EXE} --network=res/TestIIDM_${INPUT_NAME}.iidm --config=res/config_${TEST_NAME}.json --contingencies=res/contingencies_${INPUT_NAME}.json --checkpoint=4)
+if(NOT DEFINED USE_MPI OR USE_MPI STREQUAL "")
+  message(FATAL_ERROR "USE_MPI is not defined")
+endif()
+if(${USE_MPI} STREQUAL "YES")
+  if(NOT DEFINED MPI_RUN OR MPI_RUN STREQUAL "")
+    message(FATAL_ERROR "mpirun is not found")
+  endif()
+  set(_command ${MPI_RUN} -np 4 ${_dfl_cmd})
+else()
+  set(_command ${_dfl_cmd})
+endif()
+
+file(REMOVE_RECURSE ${_output_dir})
+message(STATUS "Execute process: ${_command}")
+execute_process(COMMAND ${_command} RESULT_VARIABLE _result)
+if(_result)
+  message(FATAL_ERROR "Execution failed: ${_command}")
+endif()
+file(RENAME ${_output_dir}/aggregatedResults.xml ${_output_dir}/aggregatedResults_uninterrupted.xml)
+file(REMOVE ${_output_dir}/results_sa.json)
+
+# a run killed as soon as its first batch is checkpointed leaves the journal of this batch only, and no results
+file(READ ${_journal} _journal_content)
+string(LENGTH "${_journal_content}" _journal_length)
+set(_checkpointed_length 0)
+set(_nb_checkpointed 0)
+while(_nb_checkpointed LESS 4)
+  string(SUBSTRING "${_journal_content}" ${_checkpointed_length} -1 _remaining)
+  string(FIND "${_remaining}" "\n" _end)
+  if(_end EQUAL -1)
+    break()
+  endif()
+  math(EXPR _checkpointed_length "${_checkpointed_length} + ${_end} + 1")
+  math(EXPR _nb_checkpointed "${_nb_checkpointed} + 1")
+endwhile()
+if(NOT _checkpointed_length LESS _journal_length)
+  message(FATAL_ERROR "resultsTestsTmp/${TEST_NAME}/scenarioJournal.jsonl holds no more than the scenarios of the first checkpoint")
+endif()
+string(SUBSTRING "${_journal_content}" 0 ${_checkpointed_length} _checkpointed_journal)
+file(WRITE ${_journal} "${_checkpointed_journal}")
+
+set(_command ${_command} --resume)
+message(STATUS "Execute process: ${_command}")
+execute_process(COMMAND ${_command} RESULT_VARIABLE _result)
+if(_result)
+  message(FATAL_ERROR "Execution failed: ${_command}")
+endif()
+
+execute_process(COMMAND ${CMAKE_COMMAND} -E compare_files ${_output_dir}/aggregatedResults.xml ${_output_dir}/aggregatedResults_uninterrupted.xml
+                RESULT_VARIABLE _result)
+if(_result)
+  message(FATAL_ERROR "resultsTestsTmp/${TEST_NAME}/aggregatedResults.xml of the resumed run differs from the one of the uninterrupted run")
+endif()
+file(READ ${_output_dir}/results_sa.json _results)
+string(FIND "${_results}" "resumedScenarios" _found)
+if(_found EQUAL -1)
+  message(FATAL_ERROR "resultsTestsTmp/${TEST_NAME}/results_sa.json does not list the resumed scenarios")
+endif()
@@ -71,6 +71,7 @@ def check_contingencies(contingencies_file, results_folder, input_iidm_name):
         if os.path.isdir(os.path.join(results_folder , contingency_id)):
             # This is a valid contingency, check that every file exists and
             # conforms to what we expect
+            par_file = referenced_par_file(results_folder, dyd_file, par_file)
             for element in contingency_elements:
                 all_ok = all_ok and check_element(element, contingency_id, dyd_file, par_file, timeline_file, constraints_file, finalState_file)
         else:
@@ -88,6 +89,16 @@ def check_contingencies(contingencies_file, results_folder, input_iidm_name):
     else:
         return 1 # We had some problems
 
+def referenced_par_file(results_folder, dyd_file, par_file):
+    """Returns the PAR file the events of a contingency refer to: the parameter
+       sets of the events of all the contingencies may be written in a single file"""
+    if os.path.isfile(par_file) or not os.path.isfile(dyd_file):
+        return par_file
+    e = xml_find(dyd_file, "{http://www.rte-france.com/dynawo}blackBoxModel[@parFile]")
+    if e is None:
+        return par_file
+    return os.path.join(results_folder, e.get("parFile"))
+
 def load_contingencies(contingencies_file):
     """Returns a list like: list(id, list(elements))  with one item
        per contingency"""
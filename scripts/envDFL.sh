@@ -273,6 +273,7 @@ set_environment() {
     fi
 
     export_var_env DYNAFLOW_LAUNCHER_BUILD_TESTS=ON # same default value as cmakelist
+    export_var_env DYNAFLOW_LAUNCHER_BUILD_BENCHMARKS=OFF # same default value as cmakelist
     export_var_env DYNAFLOW_LAUNCHER_CMAKE_GENERATOR="Unix Makefiles"
     export_var_env DYNAFLOW_LAUNCHER_PROCESSORS_USED=1
     export DYNAWO_NB_PROCESSORS_USED=$DYNAFLOW_LAUNCHER_PROCESSORS_USED
@@ -353,6 +354,7 @@ cmake_configure() {
         -DBOOST_ROOT:STRING=$DYNAWO_HOME \
         -DDYNAFLOW_LAUNCHER_LOCALE:STRING=$DYNAFLOW_LAUNCHER_LOCALE \
         -DDYNAFLOW_LAUNCHER_BUILD_TESTS:BOOL=$DYNAFLOW_LAUNCHER_BUILD_TESTS \
+        -DDYNAFLOW_LAUNCHER_BUILD_BENCHMARKS:BOOL=$DYNAFLOW_LAUNCHER_BUILD_BENCHMARKS \
         -DUSE_MPI=$DYNAWO_USE_MPI \
         $CMAKE_OPTIONAL
     RETURN_CODE=$?
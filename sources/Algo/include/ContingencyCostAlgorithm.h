@@ -0,0 +1,111 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  ContingencyCostAlgorithm.h
+ *
+ * @brief Contingency cost estimation algorithm header file
+ *
+ */
+
+#pragma once
+
+#include "AlgorithmsResults.h"
+#include "Contingencies.h"
+#include "NetworkGraph.h"
+#include "Node.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace dfl {
+
+using NodePtr = std::shared_ptr<inputs::Node>;  ///< Alias for pointer to node
+
+namespace algo {
+
+/**
+ * @brief Estimated costs of the simulations of the contingencies
+ *
+ * The cost of a contingency is the sum of the costs of its elements. The cost of an element depends on its type, tripping a generator
+ * or an HVDC line usually taking longer to simulate than tripping a load, and on the size of the network around it, measured as
+ * the number of branches and injections connected to its nodes. Costs are relative: they only serve to dispatch the contingencies.
+ */
+class ContingencyCosts {
+ public:
+  using ElementId = std::string;  ///< Alias for element identifier in contingency
+
+  /**
+   * @brief Constructor
+   * @param contingencies The list of contingencies given in the inputs
+   */
+  explicit ContingencyCosts(const std::vector<inputs::Contingency> &contingencies);
+
+  /**
+   * @brief Record the size of the network around an element
+   *
+   * Elements that are not referred by a contingency are ignored. An element connected to several nodes keeps the largest size.
+   *
+   * @param id the id of the element found in the network
+   * @param localSize the number of branches and injections connected to the node of the element
+   */
+  void setLocalSize(const ElementId &id, std::size_t localSize);
+
+  /**
+   * @brief Estimate the cost of the simulation of a contingency
+   *
+   * @param contingency the contingency
+   * @returns the estimated cost, in arbitrary units
+   */
+  double estimate(const inputs::Contingency &contingency) const;
+
+  /**
+   * @brief Relative cost of the simulation of a contingency element, by type
+   *
+   * @param type the type of the element
+   * @returns the relative cost
+   */
+  static double typeWeight(inputs::ContingencyElement::Type type);
+
+ private:
+  std::unordered_map<ElementId, std::size_t> localSizes_;  ///< size of the network around each element referred by a contingency
+};
+
+/**
+ * @brief Algorithm measuring the size of the network around the contingency elements
+ */
+class ContingencyCostAlgorithm {
+ public:
+  /**
+   * @brief Constructor
+   * @param costs the costs of the contingencies to update
+   * @param graph the network graph the processed nodes belong to
+   */
+  explicit ContingencyCostAlgorithm(ContingencyCosts &costs, const inputs::NetworkGraph &graph = inputs::NetworkGraph::empty())
+      : costs_(costs), graph_(graph) {}
+
+  /**
+   * @brief Application operator.
+   *
+   * Records the size of the network around the elements of the node
+   *
+   * @param node the node to process
+   * @param algoRes pointer to algorithms results class
+   */
+  void operator()(const NodePtr &node, std::shared_ptr<AlgorithmsResults> &algoRes);
+
+ private:
+  ContingencyCosts &costs_;            ///< the costs of the contingencies updated by the algorithm
+  const inputs::NetworkGraph &graph_;  ///< network graph the processed nodes belong to
+};
+
+}  // namespace algo
+}  // namespace dfl
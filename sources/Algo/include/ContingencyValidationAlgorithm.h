@@ -22,9 +22,15 @@
 #include "GeneratorDefinitionAlgorithm.h"
 #include "HvdcLine.h"
 #include "LoadDefinitionAlgorithm.h"
+#include "NetworkGraph.h"
 #include "Node.h"
 #include "SVarCDefinitionAlgorithm.h"
 
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 namespace dfl {
 
 using NodePtr = std::shared_ptr<inputs::Node>;  ///< Alias for pointer to node
@@ -33,12 +39,15 @@ namespace algo {
 
 /**
  * @brief Contingencies valid for simulation
+ *
+ * Element ids are interned once, at construction, and each contingency is stored as a range of slots, one per element. The
+ * references of each element to the contingencies are kept in a compressed list, and the validity of each reference in a bitset,
+ * so that memory and time are linear in the total number of elements references.
  */
 class ValidContingencies {
  public:
   using ContingencyId = std::string;                                         ///< Alias for contingency identifier
   using ElementId = std::string;                                             ///< Alias for element identifier in contingency
-  using ContingencyRef = std::reference_wrapper<const inputs::Contingency>;  ///< Alias for reference to contingency
 
   /**
    * @brief Constructor
@@ -64,7 +73,7 @@ class ValidContingencies {
    * @brief All valid contigencies
    * @return valid contingencies
    */
-  const std::vector<dfl::inputs::Contingency> &get() { return validContingencies_; }
+  const std::vector<dfl::inputs::Contingency> &get() const { return validContingencies_; }
 
   /**
    * @brief Get the networkElements_ object
@@ -74,16 +83,29 @@ class ValidContingencies {
   const std::unordered_set<ElementId> &getNetworkElements() const { return networkElements_; }
 
  private:
-  using ContingenciesRef = std::reference_wrapper<const std::vector<inputs::Contingency>>;     ///< Alias for a reference to the list of contingencies
-  using ElementContingenciesMap = std::unordered_map<ElementId, std::vector<ContingencyRef>>;  ///< Alias for map of element contingencies
-  using ElementIds = std::unordered_set<ElementId>;                                            ///< Alias for set of element ids
-  using ValidatingContingenciesMap = std::unordered_map<ContingencyId, ElementIds>;            ///< Alias for map of contingencies with valid elements found
-
-  ContingenciesRef contingencies_;                            ///< Contingencies requested in the inputs
-  ElementContingenciesMap elementContingencies_;              ///< For each element identifier, all the contingencies where it is referenced
-  ValidatingContingenciesMap validatingContingencies_;        ///< All contingencies with valid elements found, indexed by contingencyId
-  std::vector<dfl::inputs::Contingency> validContingencies_;  ///< Only valid contingencies
-  ElementIds networkElements_;                                ///< Set containing contingencies elements id using network model
+  using ContingenciesRef = std::reference_wrapper<const std::vector<inputs::Contingency>>;  ///< Alias for a reference to the list of contingencies
+  using ElementIds = std::unordered_set<ElementId>;                                         ///< Alias for set of element ids
+  using ElementIndex = std::uint32_t;                                                       ///< Alias for interned element identifier
+  using ContingencyIndex = std::uint32_t;                                                   ///< Alias for position of a contingency in the inputs
+  using SlotIndex = std::size_t;                                                            ///< Alias for position of an element among all contingencies
+
+  /**
+   * @brief Reference of an element by a contingency
+   */
+  struct Reference {
+    ContingencyIndex contingency;  ///< the referencing contingency
+    SlotIndex slot;                ///< the slot of the first occurrence of the element in the contingency
+  };
+
+  ContingenciesRef contingencies_;                              ///< Contingencies requested in the inputs
+  std::unordered_map<ElementId, ElementIndex> elementIndexes_;  ///< Interned element identifiers
+  std::vector<SlotIndex> contingencySlots_;                     ///< First slot of each contingency, plus the total number of slots
+  std::vector<std::size_t> elementReferenceOffsets_;            ///< First reference of each element, plus the total number of references
+  std::vector<Reference> references_;                           ///< References of the contingencies, element after element
+  std::vector<std::size_t> slotReferences_;                     ///< Reference of the element of each slot
+  std::vector<bool> validReferences_;                           ///< Bitset of the references found valid in the network
+  std::vector<dfl::inputs::Contingency> validContingencies_;    ///< Only valid contingencies
+  ElementIds networkElements_;                                  ///< Set containing contingencies elements id using network model
 };
 
 /**
@@ -94,8 +116,10 @@ class ContingencyValidationAlgorithmOnNodes {
   /**
    * @brief Constructor
    * @param validContingencies The class keeping track of valid contingencies
+   * @param graph the network graph the processed nodes belong to
    */
-  explicit ContingencyValidationAlgorithmOnNodes(ValidContingencies &validContingencies) : validContingencies_(validContingencies) {}
+  explicit ContingencyValidationAlgorithmOnNodes(ValidContingencies &validContingencies, const inputs::NetworkGraph &graph = inputs::NetworkGraph::empty())
+      : validContingencies_(validContingencies), graph_(graph) {}
 
   /**
    * @brief Application operator.
@@ -109,6 +133,7 @@ class ContingencyValidationAlgorithmOnNodes {
 
  private:
   ValidContingencies &validContingencies_;  ///< the contingencies being validated by the algorithm
+  const inputs::NetworkGraph &graph_;       ///< network graph the processed nodes belong to
 };
 
 /**
@@ -0,0 +1,139 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  DefinitionsIndex.h
+ *
+ * @brief Index of the algorithms definitions by id header file
+ *
+ */
+
+#pragma once
+
+#include "GeneratorDefinitionAlgorithm.h"
+#include "HVDCDefinitionAlgorithm.h"
+#include "LineDefinitionAlgorithm.h"
+#include "LoadDefinitionAlgorithm.h"
+#include "SVarCDefinitionAlgorithm.h"
+#include "TransfoDefinitionAlgorithm.h"
+
+#include <boost/optional.hpp>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace dfl {
+namespace algo {
+
+/**
+ * @brief Index of the definitions computed by the algorithms, by element id
+ *
+ * Built once all the nodes of the main connex component are processed, and shared by the filters and the writers. Generators,
+ * loads and static var compensators are retrieved by their position in their definitions list, so that the lists can still be
+ * updated in place. HVDC lines, lines and transformers are retrieved from the definitions they are indexed in, without copy.
+ *
+ * The definitions must outlive the index, and the lists must not be reordered or resized once the index is built.
+ */
+class DefinitionsIndex {
+ public:
+  using Index = std::size_t;  ///< alias for the position of a definition in its list
+
+  /**
+   * @brief Default constructor, building an empty index
+   */
+  DefinitionsIndex() = default;
+
+  /**
+   * @brief Constructor
+   *
+   * @param generators the generators definitions
+   * @param loads the loads definitions
+   * @param staticVarCompensators the static var compensators definitions
+   * @param hvdcLineDefinitions the HVDC lines definitions
+   * @param linesById the lines by id definitions
+   * @param tfosById the transformers by id definitions
+   */
+  DefinitionsIndex(const std::vector<GeneratorDefinition> &generators, const std::vector<LoadDefinition> &loads,
+                   const std::vector<StaticVarCompensatorDefinition> &staticVarCompensators, const HVDCLineDefinitions &hvdcLineDefinitions,
+                   const LinesByIdDefinitions &linesById, const TransformersByIdDefinitions &tfosById);
+
+  /**
+   * @brief Retrieve the position of a generator
+   * @param id the generator id
+   * @returns the position of the generator in the generators definitions, nullopt if not found
+   */
+  boost::optional<Index> generator(const std::string &id) const { return find(generators_, id); }
+
+  /**
+   * @brief Retrieve the position of a load
+   * @param id the load id
+   * @returns the position of the load in the loads definitions, nullopt if not found
+   */
+  boost::optional<Index> load(const std::string &id) const { return find(loads_, id); }
+
+  /**
+   * @brief Retrieve the position of a static var compensator
+   * @param id the static var compensator id
+   * @returns the position of the static var compensator in the static var compensators definitions, nullopt if not found
+   */
+  boost::optional<Index> staticVarCompensator(const std::string &id) const { return find(staticVarCompensators_, id); }
+
+  /**
+   * @brief Retrieve a HVDC line
+   * @param id the HVDC line id
+   * @returns the HVDC line definition, nullptr if not found
+   */
+  const HVDCDefinition *hvdcLine(const std::string &id) const;
+
+  /**
+   * @brief Retrieve a line
+   * @param id the line id
+   * @returns the line, nullptr if not found
+   */
+  const inputs::Line *line(const std::string &id) const;
+
+  /**
+   * @brief Retrieve a transformer
+   * @param id the transformer id
+   * @returns the transformer, nullptr if not found
+   */
+  const inputs::Tfo *tfo(const std::string &id) const;
+
+ private:
+  using IdToIndex = std::unordered_map<std::string, Index>;  ///< alias for map of ids to positions
+
+  /**
+   * @brief Build the map of ids to positions of a list of definitions
+   * @param definitions the list of definitions
+   * @returns the map of ids to positions
+   */
+  template<class Definition>
+  static IdToIndex buildIndex(const std::vector<Definition> &definitions);
+
+  /**
+   * @brief Retrieve a position by id
+   * @param idToIndex the map of ids to positions
+   * @param id the id
+   * @returns the position, nullopt if not found
+   */
+  static boost::optional<Index> find(const IdToIndex &idToIndex, const std::string &id);
+
+ private:
+  IdToIndex generators_;                                      ///< positions of the generators definitions by id
+  IdToIndex loads_;                                           ///< positions of the loads definitions by id
+  IdToIndex staticVarCompensators_;                           ///< positions of the static var compensators definitions by id
+  const HVDCLineDefinitions *hvdcLineDefinitions_ = nullptr;  ///< HVDC lines definitions, by id
+  const LinesByIdDefinitions *linesById_ = nullptr;           ///< lines, by id
+  const TransformersByIdDefinitions *tfosById_ = nullptr;     ///< transformers, by id
+};
+
+}  // namespace algo
+}  // namespace dfl
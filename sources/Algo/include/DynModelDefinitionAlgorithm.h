@@ -27,6 +27,7 @@
 #include <boost/optional.hpp>
 #include <functional>
 #include <map>
+#include <memory>
 #include <set>
 #include <unordered_map>
 #include <unordered_set>
@@ -157,8 +158,21 @@ class DynModelAlgorithm {
    * @param models the models to update
    * @param manager the dynamic data base manager to use
    * @param shuntRegulationOn whether the shunt regulation is activated or not
+   * @param graph the network graph the processed nodes belong to
    */
-  DynModelAlgorithm(DynamicModelDefinitions &models, const inputs::DynamicDataBaseManager &manager, bool shuntRegulationOn);
+  DynModelAlgorithm(DynamicModelDefinitions &models, const inputs::DynamicDataBaseManager &manager, bool shuntRegulationOn,
+                    const inputs::NetworkGraph &graph = inputs::NetworkGraph::empty());
+
+  /**
+   * @brief Constructor from an already built algorithm
+   *
+   * Shares the macro connections pre-processed by @p other without copying them, to run the algorithm on several sets of nodes concurrently,
+   * each one updating its own models. The shared macro connections are only read afterwards
+   *
+   * @param other the algorithm whose pre-processed data are reused
+   * @param models the models to update
+   */
+  DynModelAlgorithm(const DynModelAlgorithm &other, DynamicModelDefinitions &models);
 
   /**
    * @brief Perform the algorithm
@@ -284,7 +298,7 @@ class DynModelAlgorithm {
    * @brief Process node in case of dynamic automaton line connection
    * @param line line to process
    */
-  void connectMacroConnectionForLine(const std::shared_ptr<inputs::Line> &line);
+  void connectMacroConnectionForLine(const inputs::Line &line);
 
   /**
    * @brief Process node in case of dynamic automaton shunt connection
@@ -296,7 +310,7 @@ class DynModelAlgorithm {
    * @brief Process node in case of dynamic automaton transformer connection
    * @param tfo transformer to process
    */
-  void connectMacroConnectionForTfo(const std::shared_ptr<inputs::Tfo> &tfo);
+  void connectMacroConnectionForTfo(const inputs::Tfo &tfo);
 
   /**
    * @brief Process node in case of dynamic automaton generator connection
@@ -329,21 +343,27 @@ class DynModelAlgorithm {
                                             const DynamicModelDefinition::MacroConnection &macroConnection);
 
  private:
+  /// @brief Macro connections extracted from the configuration, indexed by the network elements they connect to
+  struct MacroConnectIndex {
+    std::unordered_map<inputs::VoltageLevel::VoltageLevelId, std::unordered_set<MacroConnect, MacroConnectHash>>
+        macroConnectByVlForBusesId;  ///< macro connections for buses, by voltage level
+    std::unordered_map<inputs::VoltageLevel::VoltageLevelId, std::vector<MacroConnect>>
+        macroConnectByVlForShuntsId;                                                                ///< macro connections for shunts, by voltage level
+    std::unordered_map<inputs::Line::LineId, std::vector<MacroConnect>> macroConnectByLineName;     ///< macro connections for lines, by line id
+    std::unordered_map<inputs::Shunt::ShuntId, std::vector<MacroConnect>> macroConnectByShuntName;  ///< macro connections for shunts, by shunt id
+    std::unordered_map<inputs::Tfo::TfoId, std::vector<MacroConnect>> macroConnectByTfoName;        ///< macro connections for transformer, by transformer id
+    std::unordered_map<inputs::Generator::GeneratorId, std::vector<MacroConnect>>
+        macroConnectByGeneratorName;                                                                     ///< macro connections for generators, by generator id
+    std::unordered_map<inputs::Load::LoadId, std::vector<MacroConnect>> macroConnectByLoadName;          ///< macro connections for loads, by load id
+    std::unordered_map<inputs::HvdcLine::HvdcLineId, std::vector<MacroConnect>> macroConnectByHvdcName;  ///< macro connections for hvdc lines, by hvdc line id
+  };
+
   DynamicModelDefinitions &dynamicModels_;  ///< Dynamic model definitions to update
 
-  std::unordered_map<inputs::VoltageLevel::VoltageLevelId, std::unordered_set<MacroConnect, MacroConnectHash>>
-      macroConnectByVlForBusesId_;  ///< macro connections for buses, by voltage level
-  std::unordered_map<inputs::VoltageLevel::VoltageLevelId, std::vector<MacroConnect>>
-      macroConnectByVlForShuntsId_;                                                                ///< macro connections for shunts, by voltage level
-  std::unordered_map<inputs::Line::LineId, std::vector<MacroConnect>> macroConnectByLineName_;     ///< macro connections for lines, by line id
-  std::unordered_map<inputs::Shunt::ShuntId, std::vector<MacroConnect>> macroConnectByShuntName_;  ///< macro connections for shunts, by shunt id
-  std::unordered_map<inputs::Tfo::TfoId, std::vector<MacroConnect>> macroConnectByTfoName_;        ///< macro connections for transformer, by transformer id
-  std::unordered_map<inputs::Generator::GeneratorId, std::vector<MacroConnect>>
-      macroConnectByGeneratorName_;                                                                     ///< macro connections for generators, by generator id
-  std::unordered_map<inputs::Load::LoadId, std::vector<MacroConnect>> macroConnectByLoadName_;          ///< macro connections for loads, by load id
-  std::unordered_map<inputs::HvdcLine::HvdcLineId, std::vector<MacroConnect>> macroConnectByHvdcName_;  ///< macro connections for hvdc lines, by hvdc line id
+  std::shared_ptr<MacroConnectIndex> index_;  ///< macro connections, shared read-only by the algorithms built from this one
 
   const inputs::DynamicDataBaseManager &manager_;  ///< dynamic database config manager
+  const inputs::NetworkGraph &graph_;              ///< network graph the processed nodes belong to
 };
 }  // namespace algo
 }  // namespace dfl
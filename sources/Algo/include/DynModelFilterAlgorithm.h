@@ -18,6 +18,7 @@
 #pragma once
 
 #include "AssemblingDataBase.h"
+#include "DefinitionsIndex.h"
 #include "DynModelDefinitionAlgorithm.h"
 #include "GeneratorDefinitionAlgorithm.h"
 #include "HVDCDefinitionAlgorithm.h"
@@ -35,15 +36,18 @@ class DynModelFilterAlgorithm {
    *
    * @param assembling assembling database
    * @param generators the generators list to update
+   * @param definitionsIndex the index of the definitions, built on the generators list
    * @param hvdcLineDefinitions the HVDC lines list
    * @param dynamicModelsToFilter dynamic models by model id
    */
   DynModelFilterAlgorithm(const inputs::AssemblingDataBase& assembling,
                           GeneratorDefinitionAlgorithm::Generators& generators,
+                          const DefinitionsIndex& definitionsIndex,
                           HVDCLineDefinitions& hvdcLineDefinitions,
                           std::map<DynamicModelDefinition::DynModelId, DynamicModelDefinition>& dynamicModelsToFilter) :
     assembling_(assembling),
     generators_(generators),
+    definitionsIndex_(definitionsIndex),
     hvdcLineDefinitions_(hvdcLineDefinitions),
     dynamicModelsToFilter_(dynamicModelsToFilter) {}
 
@@ -77,6 +81,7 @@ class DynModelFilterAlgorithm {
 
   const inputs::AssemblingDataBase& assembling_;                                         ///< assembling database
   GeneratorDefinitionAlgorithm::Generators& generators_;                                 ///< the generators list to update
+  const DefinitionsIndex& definitionsIndex_;                                             ///< index of the definitions
   HVDCLineDefinitions& hvdcLineDefinitions_;                                                  ///< the hvdclines list
   std::map<DynamicModelDefinition::DynModelId, DynamicModelDefinition>& dynamicModelsToFilter_;  ///< models by dynamic model id
 };
@@ -22,12 +22,95 @@
 #include "NetworkManager.h"
 #include "Node.h"
 
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 namespace dfl {
 
 using NodePtr = std::shared_ptr<inputs::Node>;  ///< Alias for pointer to node
 
 namespace algo {
 
+/**
+ * @brief Reactive capability diagram of generators
+ *
+ * Diagrams are immutable, so that a diagram is shared by all the generators with the same reactive capabilities, see ReactiveDiagramPool
+ */
+struct ReactiveDiagram {
+  using ReactiveCurvePoint = inputs::Generator::ReactiveCurvePoint;  ///< Alias for reactive curve point
+
+  /**
+   * @brief Constructor
+   *
+   * The points are sorted by increasing active power. The limits are only used by a diagram without points: they are set to zero otherwise
+   *
+   * @param curvePoints the list of reactive capabilities curve points
+   * @param diagramQmin minimum reactive power of the generator
+   * @param diagramQmax maximum reactive power of the generator
+   * @param diagramPmin minimum active power of the generator
+   * @param diagramPmax maximum active power of the generator
+   */
+  ReactiveDiagram(std::vector<ReactiveCurvePoint> &&curvePoints, double diagramQmin, double diagramQmax, double diagramPmin, double diagramPmax);
+
+  /**
+   * @brief Compute the hash of the content of the diagram
+   * @returns the hash of the diagram
+   */
+  std::size_t hash() const;
+
+  /**
+   * @brief Equality operator
+   *
+   * Diagrams are equal if their points and limits are exactly the same
+   *
+   * @param other the diagram to compare to
+   * @returns true if the diagrams are the same, false otherwise
+   */
+  bool operator==(const ReactiveDiagram &other) const;
+
+  const std::vector<ReactiveCurvePoint> points;  ///< curve points, sorted by increasing active power
+  const double qmin;                             ///< minimum reactive power, for a diagram without points
+  const double qmax;                             ///< maximum reactive power, for a diagram without points
+  const double pmin;                             ///< minimum active power, for a diagram without points
+  const double pmax;                             ///< maximum active power, for a diagram without points
+};
+
+/**
+ * @brief Pool of the reactive capability diagrams of the generators
+ *
+ * The pool keeps one diagram per distinct content, so that generators with the same reactive capabilities (for example the units of a wind farm)
+ * share their diagram. Diagrams may be retrieved from several threads at once.
+ */
+class ReactiveDiagramPool {
+ public:
+  using ReactiveCurvePoint = ReactiveDiagram::ReactiveCurvePoint;  ///< Alias for reactive curve point
+
+  /**
+   * @brief Retrieve the diagram with the given content, adding it to the pool if needed
+   *
+   * @param curvePoints the list of reactive capabilities curve points
+   * @param qmin minimum reactive power of the generator
+   * @param qmax maximum reactive power of the generator
+   * @param pmin minimum active power of the generator
+   * @param pmax maximum active power of the generator
+   * @returns the diagram of the pool with this content
+   */
+  std::shared_ptr<const ReactiveDiagram> get(const std::vector<ReactiveCurvePoint> &curvePoints, double qmin, double qmax, double pmin, double pmax);
+
+  /**
+   * @brief Retrieve the number of distinct diagrams in the pool
+   * @returns the number of diagrams
+   */
+  std::size_t size() const;
+
+ private:
+  mutable std::mutex mutex_;                                                               ///< mutex protecting the diagrams
+  std::unordered_multimap<std::size_t, std::shared_ptr<const ReactiveDiagram>> diagrams_;  ///< diagrams by hash of their content
+};
+
 /**
  * @brief Generation definition for algorithm
  */
@@ -153,6 +236,8 @@ class GeneratorDefinition {
   /**
    * @brief Constructor
    *
+   * The generator gets a diagram of its own, not shared with other generators
+   *
    * @param genId generator id
    * @param type the model to use
    * @param nodeId the node id connected to the generator
@@ -170,24 +255,61 @@ class GeneratorDefinition {
   GeneratorDefinition(const inputs::Generator::GeneratorId &genId, ModelType type, const inputs::Node::NodeId &nodeId,
                       const std::vector<ReactiveCurvePoint> &curvePoints, double qmin, double qmax, double pmin, double pmax, double q, double targetP,
                       const BusId &regulatedBusId, bool isNuclear = false, bool hasActivePowerControl = false)
-      : id{genId}, model{type}, nodeId{nodeId}, points(curvePoints), qmin{qmin}, qmax{qmax}, pmin{pmin}, pmax{pmax}, q{q}, targetP{targetP},
+      : GeneratorDefinition(genId, type, nodeId, std::make_shared<const ReactiveDiagram>(std::vector<ReactiveCurvePoint>(curvePoints), qmin, qmax, pmin, pmax),
+                            qmin, qmax, pmin, pmax, q, targetP, regulatedBusId, isNuclear, hasActivePowerControl) {}
+
+  /**
+   * @brief Constructor
+   *
+   * @param genId generator id
+   * @param type the model to use
+   * @param nodeId the node id connected to the generator
+   * @param diagram the reactive capabilities diagram of the generator, possibly shared with other generators
+   * @param qmin minimum reactive power for the generator
+   * @param qmax maximum reactive power for the generator
+   * @param pmin minimum active power for the generator
+   * @param pmax maximum active power for the generator
+   * @param q reactive power of the generator
+   * @param targetP target active power of the generator
+   * @param regulatedBusId the Bus Id this generator is regulating
+   * @param isNuclear true if the energy source of this generator is nuclear
+   * @param hasActivePowerControl true if the generator has active power control information
+   */
+  GeneratorDefinition(const inputs::Generator::GeneratorId &genId, ModelType type, const inputs::Node::NodeId &nodeId,
+                      const std::shared_ptr<const ReactiveDiagram> &diagram, double qmin, double qmax, double pmin, double pmax, double q, double targetP,
+                      const BusId &regulatedBusId, bool isNuclear = false, bool hasActivePowerControl = false)
+      : id{genId}, model{type}, nodeId{nodeId}, diagram(diagram), qmin{qmin}, qmax{qmax}, pmin{pmin}, pmax{pmax}, q{q}, targetP{targetP},
         regulatedBusId{regulatedBusId}, isNuclear{isNuclear}, hasActivePowerControl{hasActivePowerControl} {}
 
-  inputs::Generator::GeneratorId id;       ///< generator id
-  ModelType model;                         ///< model
-  inputs::Node::NodeId nodeId;             ///< connected node id
-  std::vector<ReactiveCurvePoint> points;  ///< curve points
-  double qmin;                             ///< minimum reactive power
-  double qmax;                             ///< maximum reactive power
-  double pmin;                             ///< minimum active power
-  double pmax;                             ///< maximum active power
-  double q;                                ///< initial reactive power
-  double targetP;                          ///< target active power of the generator
-  const BusId regulatedBusId;              ///< regulated Bus Id
-  const bool isNuclear;                    ///< true if the energy source of this generator is nuclear
-  const bool hasActivePowerControl;        ///< true if the generator has active power control information
+  inputs::Generator::GeneratorId id;               ///< generator id
+  ModelType model;                                 ///< model
+  inputs::Node::NodeId nodeId;                     ///< connected node id
+  std::shared_ptr<const ReactiveDiagram> diagram;  ///< reactive capabilities diagram
+  double qmin;                                     ///< minimum reactive power
+  double qmax;                                     ///< maximum reactive power
+  double pmin;                                     ///< minimum active power
+  double pmax;                                     ///< maximum active power
+  double q;                                        ///< initial reactive power
+  double targetP;                                  ///< target active power of the generator
+  const BusId regulatedBusId;                      ///< regulated Bus Id
+  const bool isNuclear;                            ///< true if the energy source of this generator is nuclear
+  const bool hasActivePowerControl;                ///< true if the generator has active power control information
 };
 
+using ReactiveDiagramNames = std::unordered_map<const ReactiveDiagram *, std::string>;  ///< alias for the names of the diagrams written to files
+
+/**
+ * @brief Name the reactive diagrams of the generators written to files
+ *
+ * A diagram shared by several generators is written once, so that it is named after one of them: the one with the smallest id among the
+ * generators using a finite and not rectangular diagram. The name of a diagram does not depend on the order of the generators, and is the id
+ * of the generator for a diagram used by a single generator.
+ *
+ * @param generators the generators definitions
+ * @returns the names of the diagrams written to files
+ */
+ReactiveDiagramNames nameReactiveDiagrams(const std::vector<GeneratorDefinition> &generators);
+
 /**
  * @brief Algorithm to find generators
  */
@@ -206,9 +328,11 @@ class GeneratorDefinitionAlgorithm {
    * @param manager the dynamic data base manager to use
    * @param infinitereactivelimits parameter to determine if infinite reactive limits are used
    * @param tfoVoltageLevel maximum voltage level for which we assume that generator's transformers are already described in the static description
+   * @param diagrams the pool of the reactive diagrams shared by the generators
    */
   GeneratorDefinitionAlgorithm(Generators &gens, const inputs::NetworkManager::BusMapRegulating &busesToNumberOfRegulationMap,
-                               const inputs::DynamicDataBaseManager &manager, bool infinitereactivelimits, double tfoVoltageLevel);
+                               const inputs::DynamicDataBaseManager &manager, bool infinitereactivelimits, double tfoVoltageLevel,
+                               ReactiveDiagramPool &diagrams);
 
   /**
    * @brief Perform algorithm
@@ -267,6 +391,7 @@ class GeneratorDefinitionAlgorithm {
                                                           // if the associated bool is true then it uses a reactive power control loop 2
   bool useInfiniteReactivelimits_;                        ///< determine if infinite reactive limits are used,
   double tfoVoltageLevel_;  ///< Maximum voltage level for which we assume that generator's transformers are already described in the static description
+  ReactiveDiagramPool &diagrams_;  ///< pool of the reactive diagrams shared by the generators
 };
 }  // namespace algo
 }  // namespace dfl
@@ -20,6 +20,7 @@
 #include "AlgorithmsResults.h"
 #include "DynamicDataBaseManager.h"
 #include "HvdcLine.h"
+#include "NetworkGraph.h"
 #include "NetworkManager.h"
 #include "Node.h"
 
@@ -297,10 +298,11 @@ class HVDCDefinitionAlgorithm {
    * @param infiniteReactiveLimits the configuration data of whether we use infinite reactive limits
    * @param vscConverters list of VSC converters
    * @param manager the dynamic data base manager to use
+   * @param graph the network graph the processed nodes belong to
    */
   HVDCDefinitionAlgorithm(HVDCLineDefinitions &hvdcLinesDefinitions, const inputs::NetworkManager::BusMapRegulating &busesToNumberOfRegulationMap,
                           bool infiniteReactiveLimits, const std::unordered_set<std::shared_ptr<inputs::Converter>> &vscConverters,
-                          const inputs::DynamicDataBaseManager &manager);
+                          const inputs::DynamicDataBaseManager &manager, const inputs::NetworkGraph &graph = inputs::NetworkGraph::empty());
 
   /**
    * @brief Perform the algorithm
@@ -359,7 +361,8 @@ class HVDCDefinitionAlgorithm {
   const bool infiniteReactiveLimits_;                                             ///< whether we use infinite reactive limits
   std::unordered_map<inputs::Converter::ConverterId, std::shared_ptr<inputs::Converter>> vscConverters_;  ///< List of VSC converters to use
   std::unordered_map<std::string, inputs::AssemblingDataBase::HvdcLineConverterSide>
-      hvdcLinesInSVC_;  ///< If a hvdc line id is in this map then it belongs to a secondary voltage control area
+      hvdcLinesInSVC_;                 ///< If a hvdc line id is in this map then it belongs to a secondary voltage control area
+  const inputs::NetworkGraph &graph_;  ///< network graph the processed nodes belong to
 };
 
 }  // namespace algo
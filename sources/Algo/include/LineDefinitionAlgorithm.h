@@ -29,7 +29,7 @@ namespace algo {
  * @brief Lines by ids definitions
  */
 struct LinesByIdDefinitions {
-  std::unordered_map<inputs::Line::LineId, inputs::Line> linesMap;  ///< map of the input lines by line id
+  std::unordered_map<inputs::Line::LineId, const inputs::Line *> linesMap;  ///< map of the input lines by line id, owned by the network
 };
 
 /**
@@ -40,8 +40,9 @@ class LinesByIdAlgorithm {
   /**
    * @brief Constructor
    * @param linesByIdDefinition lines by id definitions to update
+   * @param graph the network graph the processed nodes belong to
    */
-  explicit LinesByIdAlgorithm(LinesByIdDefinitions& linesByIdDefinition);
+  explicit LinesByIdAlgorithm(LinesByIdDefinitions& linesByIdDefinition, const inputs::NetworkGraph& graph = inputs::NetworkGraph::empty());
 
   /**
    * @brief Performs the algorithm
@@ -54,6 +55,7 @@ class LinesByIdAlgorithm {
 
  private:
   LinesByIdDefinitions& linesByIdDefinition_;  ///< lines by id definitions to update
+  const inputs::NetworkGraph& graph_;          ///< network graph the processed nodes belong to
 };
 
 }  // namespace algo
@@ -17,73 +17,99 @@
 
 #pragma once
 
+#include "NetworkGraph.h"
 #include "NetworkManager.h"
 #include "Node.h"
 
+#include <cstdint>
+#include <vector>
+
 namespace dfl {
 
 using NodePtr = std::shared_ptr<inputs::Node>;  ///< Alias for pointer to node
 namespace algo {
 
 /**
- * @brief Algorithm to determine largest connex component
+ * @brief Connex components of a network graph
+ *
+ * All the connex components are computed at once with a union-find structure on the node indexes, optionally splitting the nodes
+ * between several threads. The component of each node is then retrieved in constant time. As for the network, the neighbour
+ * relation between nodes is expected to be symmetric.
+ *
+ * Components are numbered following the index of their first node. The main connex component is the largest one, ties being
+ * resolved in favour of the component met first when walking the nodes of the graph.
  */
-class MainConnexComponentAlgorithm {
+class ConnexComponents {
  public:
-  using ConnexGroup = std::vector<NodePtr>;  ///< Alias for group of nodes
+  using ComponentId = inputs::NetworkGraph::Index;  ///< Alias for the id of a connex component
 
  public:
   /**
    * @brief Constructor
    *
-   * @param mainConnexity main connex component to update
+   * @param graph the network graph
+   * @param nbThreads the number of threads to use to compute the components
    */
-  explicit MainConnexComponentAlgorithm(ConnexGroup& mainConnexity);
+  explicit ConnexComponents(const inputs::NetworkGraph& graph, unsigned int nbThreads = 1);
 
   /**
-   * @brief Perform algorithm
-   *
-   * For each node, we determine, by going through its neighbours, which other nodes are connexs
-   * and we mark the ones we already processed to avoid processing them again.
-   *
-   * @param node the node to process
+   * @brief Retrieve the number of connex components
+   * @returns the number of connex components
    */
-  void operator()(const NodePtr& node);
+  std::size_t nbComponents() const {
+    return componentSizes_.size();
+  }
+
+  /**
+   * @brief Retrieve the connex component of a node
+   * @param node the node, which must belong to the graph
+   * @returns the id of the connex component of the node
+   */
+  ComponentId component(const inputs::Node& node) const {
+    return components_[node.index];
+  }
+
+  /**
+   * @brief Retrieve the number of nodes of a connex component
+   * @param component the id of the connex component
+   * @returns the number of nodes of the connex component
+   */
+  std::size_t size(ComponentId component) const {
+    return componentSizes_[component];
+  }
+
+  /**
+   * @brief Determines if a node belongs to the main connex component
+   * @param node the node
+   * @returns true if the node belongs to the graph and to its main connex component, false otherwise
+   */
+  bool isInMainComponent(const inputs::Node& node) const {
+    return graph_.contains(node) && components_[node.index] == mainComponent_;
+  }
 
- private:
   /**
-  * @brief Equality Comparator for nodes
-  */
-  struct EqualCompareNode {
-    /**
-     * @brief invocable operator
-     *
-     * performs @p lhs == @p rhs by relying on Node equality operator
-     *
-     * @param lhs first node
-     * @param rhs second node
-     *
-     * @returns comparaison status
-     */
-    bool operator()(const NodePtr& lhs, const NodePtr& rhs) const {
-      return (*lhs) == (*rhs);
-    }
-  };
+   * @brief Retrieve the nodes of the main connex component
+   *
+   * The nodes are given in depth-first order from the first node of the component
+   *
+   * @returns the nodes of the main connex component, empty if the graph has no node
+   */
+  std::vector<NodePtr> mainComponentNodes() const;
 
  private:
   /**
-  * @brief Update connexity group recursively
-  *
-  * Update group with all nodes in inputs and their neighbours
-  *
-  * @param group the group to update
-  * @param nodes the nodes to add to the group
-  */
-  void updateConnexGroup(ConnexGroup& group, const std::vector<NodePtr>& nodes);
+   * @brief Gather the nodes of the graph in sets of connex nodes
+   *
+   * @param nbThreads the number of threads to use
+   * @returns the parent of each node in the union-find structure
+   */
+  std::vector<inputs::NetworkGraph::Index> gatherNodes(unsigned int nbThreads) const;
 
  private:
-  std::unordered_set<NodePtr, std::hash<NodePtr>, EqualCompareNode> markedNodes_;  ///< the set of marked nodes for the algorithm
-  ConnexGroup& mainConnexity_;                                                     ///< the main connex component to update
+  const inputs::NetworkGraph& graph_;        ///< network graph
+  std::vector<ComponentId> components_;      ///< connex component of each node, by node index
+  std::vector<std::size_t> componentSizes_;  ///< number of nodes of each connex component
+  ComponentId mainComponent_;                ///< id of the main connex component
 };
 }  // namespace algo
 }  // namespace dfl
@@ -0,0 +1,142 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  NodeVisitor.h
+ *
+ * @brief Fused node visitor header file
+ *
+ */
+
+#pragma once
+
+#include "Node.h"
+
+#include <boost/optional.hpp>
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace dfl {
+
+using NodePtr = std::shared_ptr<inputs::Node>;  ///< Alias for pointer to node
+namespace algo {
+
+/**
+ * @brief Algorithm enabled or disabled at runtime
+ *
+ * Wraps an algorithm of a node visitor whose activation depends on the configuration: the algorithm is only built when enabled
+ * and a disabled algorithm costs a single branch per node.
+ */
+template<class Algorithm>
+class OptionalAlgorithm {
+ public:
+  /**
+   * @brief Build the algorithm, enabling it
+   *
+   * @param args the arguments of the constructor of the algorithm
+   */
+  template<class... Args>
+  void emplace(Args &&...args) {
+    algorithm_.emplace(std::forward<Args>(args)...);
+  }
+
+  /**
+   * @brief Determines if the algorithm is enabled
+   * @returns true if the algorithm was built, false otherwise
+   */
+  bool enabled() const { return static_cast<bool>(algorithm_); }
+
+  /**
+   * @brief Perform the algorithm on a node, if enabled
+   *
+   * @param node the node to process
+   * @param args the other arguments of the algorithm
+   */
+  template<class... Args>
+  void operator()(const NodePtr &node, Args &...args) {
+    if (algorithm_) {
+      (*algorithm_)(node, args...);
+    }
+  }
+
+ private:
+  boost::optional<Algorithm> algorithm_;  ///< the algorithm, if enabled
+};
+
+/**
+ * @brief Pipeline of algorithms applied in one pass on each node
+ *
+ * The algorithms are known at compile time and called in declaration order, without any type erasure, so that each call can be
+ * inlined in the loop on the nodes. Every algorithm is called with the node and the same additional arguments.
+ */
+template<class... Algorithms>
+class NodeVisitor;
+
+/**
+ * @brief Empty pipeline, ending the recursion
+ */
+template<>
+class NodeVisitor<> {
+ public:
+  /**
+   * @brief Perform no algorithm on a node
+   */
+  template<class... Args>
+  void operator()(const NodePtr &, Args &...) {}
+};
+
+/**
+ * @brief Pipeline of algorithms applied in one pass on each node
+ *
+ * The first algorithm is applied before the other ones
+ */
+template<class Algorithm, class... Others>
+class NodeVisitor<Algorithm, Others...> {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param algorithm the first algorithm of the pipeline
+   * @param others the other algorithms of the pipeline
+   */
+  explicit NodeVisitor(Algorithm algorithm, Others... others) : algorithm_(std::move(algorithm)), others_(std::move(others)...) {}
+
+  /**
+   * @brief Perform all the algorithms of the pipeline on a node
+   *
+   * @param node the node to process
+   * @param args the other arguments of the algorithms
+   */
+  template<class... Args>
+  void operator()(const NodePtr &node, Args &...args) {
+    algorithm_(node, args...);
+    others_(node, args...);
+  }
+
+ private:
+  Algorithm algorithm_;            ///< the first algorithm
+  NodeVisitor<Others...> others_;  ///< the other algorithms
+};
+
+/**
+ * @brief Build a pipeline of algorithms applied in one pass on each node
+ *
+ * @param algorithms the algorithms, in application order
+ * @returns the pipeline
+ */
+template<class... Algorithms>
+NodeVisitor<typename std::decay<Algorithms>::type...> makeNodeVisitor(Algorithms &&...algorithms) {
+  return NodeVisitor<typename std::decay<Algorithms>::type...>(std::forward<Algorithms>(algorithms)...);
+}
+
+}  // namespace algo
+}  // namespace dfl
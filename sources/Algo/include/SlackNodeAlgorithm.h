@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include "NetworkGraph.h"
 #include "NetworkManager.h"
 #include "Node.h"
 
@@ -34,8 +35,9 @@ class SlackNodeAlgorithm {
    * @brief Constructor
    *
    * @param slackNode the slack node to update with the algorithm
+   * @param graph the network graph the processed nodes belong to
    */
-  explicit SlackNodeAlgorithm(NodePtr& slackNode);
+  explicit SlackNodeAlgorithm(NodePtr& slackNode, const inputs::NetworkGraph& graph = inputs::NetworkGraph::empty());
 
   /**
   * @brief Perform elementary step to determine the slack node
@@ -47,7 +49,8 @@ class SlackNodeAlgorithm {
   void operator()(const NodePtr& node);
 
  private:
-  NodePtr& slackNode_;  ///< The slack node to update
+  NodePtr& slackNode_;                 ///< The slack node to update
+  const inputs::NetworkGraph& graph_;  ///< network graph the processed nodes belong to
 };
 }  // namespace algo
 }  // namespace dfl
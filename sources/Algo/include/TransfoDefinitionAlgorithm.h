@@ -29,7 +29,7 @@ namespace algo {
  * @brief Transformers by ids definitions
  */
 struct TransformersByIdDefinitions {
-  std::unordered_map<inputs::Tfo::TfoId, inputs::Tfo> tfosMap;  ///< map of the input transformers by transformer id
+  std::unordered_map<inputs::Tfo::TfoId, const inputs::Tfo *> tfosMap;  ///< map of the input transformers by transformer id, owned by the network
 };
 
 /**
@@ -40,8 +40,9 @@ class TransformersByIdAlgorithm {
   /**
    * @brief Constructor
    * @param tfosByIdDefinition transformers by id definitions to update
+   * @param graph the network graph the processed nodes belong to
    */
-  explicit TransformersByIdAlgorithm(TransformersByIdDefinitions& tfosByIdDefinition);
+  explicit TransformersByIdAlgorithm(TransformersByIdDefinitions& tfosByIdDefinition, const inputs::NetworkGraph& graph = inputs::NetworkGraph::empty());
 
   /**
    * @brief Performs the algorithm
@@ -54,6 +55,7 @@ class TransformersByIdAlgorithm {
 
  private:
   TransformersByIdDefinitions& tfosByIdDefinition_;  ///< transformers by id definitions to update
+  const inputs::NetworkGraph& graph_;                ///< network graph the processed nodes belong to
 };
 
 }  // namespace algo
@@ -0,0 +1,96 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "ContingencyCostAlgorithm.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace dfl {
+namespace algo {
+
+ContingencyCosts::ContingencyCosts(const std::vector<inputs::Contingency> &contingencies) {
+  for (const auto &contingency : contingencies) {
+    for (const auto &element : contingency.elements) {
+      localSizes_.insert({element.id, 0});
+    }
+  }
+}
+
+void ContingencyCosts::setLocalSize(const ElementId &id, std::size_t localSize) {
+  auto found = localSizes_.find(id);
+  if (found != localSizes_.end()) {
+    found->second = std::max(found->second, localSize);
+  }
+}
+
+double ContingencyCosts::typeWeight(inputs::ContingencyElement::Type type) {
+  using Type = inputs::ContingencyElement::Type;
+  switch (type) {
+  case Type::GENERATOR:
+  case Type::HVDC_LINE:
+    return 4.;
+  case Type::BUSBAR_SECTION:
+    return 3.;
+  case Type::STATIC_VAR_COMPENSATOR:
+  case Type::THREE_WINDINGS_TRANSFORMER:
+    return 2.;
+  case Type::BRANCH:
+  case Type::LINE:
+  case Type::TWO_WINDINGS_TRANSFORMER:
+    return 1.5;
+  default:
+    return 1.;
+  }
+}
+
+double ContingencyCosts::estimate(const inputs::Contingency &contingency) const {
+  double cost = 0.;
+  for (const auto &element : contingency.elements) {
+    auto found = localSizes_.find(element.id);
+    const std::size_t localSize = (found != localSizes_.end()) ? found->second : 0;
+    cost += typeWeight(element.type) * (1. + std::log1p(static_cast<double>(localSize)));
+  }
+  return cost;
+}
+
+void ContingencyCostAlgorithm::operator()(const NodePtr &node, std::shared_ptr<AlgorithmsResults> &) {
+  std::vector<std::string> elements;
+  graph_.forEachLine(*node, [&elements](const inputs::Line &line) { elements.push_back(line.id); });
+  graph_.forEachTfo(*node, [&elements](const inputs::Tfo &tfo) { elements.push_back(tfo.id); });
+  graph_.forEachConverter(*node, [&elements](const inputs::Converter &converter) { elements.push_back(converter.hvdcLine->id); });
+  for (const auto &load : node->loads) {
+    elements.push_back(load.id);
+  }
+  for (const auto &generator : node->generators) {
+    elements.push_back(generator.id);
+  }
+  for (const auto &svarc : node->svarcs) {
+    elements.push_back(svarc.id);
+  }
+  for (const auto &shunt : node->shunts) {
+    elements.push_back(shunt.id);
+  }
+  for (const auto &danglingLine : node->danglingLines) {
+    elements.push_back(danglingLine.id);
+  }
+
+  // a bus bar section disconnects everything connected to its node
+  const std::size_t localSize = elements.size();
+  for (const auto &busBarSection : node->busBarSections) {
+    elements.push_back(busBarSection.id);
+  }
+  for (const auto &element : elements) {
+    costs_.setLocalSize(element, localSize);
+  }
+}
+
+}  // namespace algo
+}  // namespace dfl
@@ -14,29 +14,28 @@
 
 #include <DYNCommon.h>
 
+#include <limits>
+
 namespace dfl {
 namespace algo {
 void ContingencyValidationAlgorithmOnNodes::operator()(const NodePtr &node, std::shared_ptr<AlgorithmsResults> &) {
   using Type = inputs::ContingencyElement::Type;
   const bool notInNetwork_ = false;  ///< boolean determining the component is not modelled as network
 
-  for (const auto &line : node->lines) {
-    validContingencies_.markElementValid(line.lock()->id, Type::LINE, notInNetwork_);
-  }
-  for (const auto &tfoPtr : node->tfos) {
-    const auto &tfo = tfoPtr.lock();
-    switch (tfo->nodes.size()) {
+  graph_.forEachLine(*node, [this, notInNetwork_](const inputs::Line &line) { validContingencies_.markElementValid(line.id, Type::LINE, notInNetwork_); });
+  graph_.forEachTfo(*node, [this, notInNetwork_](const inputs::Tfo &tfo) {
+    switch (tfo.nodes.size()) {
     case 2:
-      validContingencies_.markElementValid(tfo->id, Type::TWO_WINDINGS_TRANSFORMER, notInNetwork_);
+      validContingencies_.markElementValid(tfo.id, Type::TWO_WINDINGS_TRANSFORMER, notInNetwork_);
       break;
     case 3:
-      validContingencies_.markElementValid(tfo->id, Type::THREE_WINDINGS_TRANSFORMER, notInNetwork_);
+      validContingencies_.markElementValid(tfo.id, Type::THREE_WINDINGS_TRANSFORMER, notInNetwork_);
       break;
     }
-  }
-  for (const auto &converter : node->converters) {
-    validContingencies_.markElementValid(converter.lock()->hvdcLine->id, Type::HVDC_LINE, notInNetwork_);
-  }
+  });
+  graph_.forEachConverter(*node, [this, notInNetwork_](const inputs::Converter &converter) {
+    validContingencies_.markElementValid(converter.hvdcLine->id, Type::HVDC_LINE, notInNetwork_);
+  });
   for (const auto &shunt : node->shunts) {
     validContingencies_.markElementValid(shunt.id, Type::SHUNT_COMPENSATOR, notInNetwork_);
   }
@@ -49,58 +48,107 @@ void ContingencyValidationAlgorithmOnNodes::operator()(const NodePtr &node, std:
 }
 
 ValidContingencies::ValidContingencies(const std::vector<inputs::Contingency> &contingencies) : contingencies_(std::ref(contingencies)) {
-  for (const auto &contingency : contingencies_.get()) {
+  // Intern the element ids and give a slot to each element of each contingency
+  std::vector<ElementIndex> slotElements;
+  contingencySlots_.reserve(contingencies.size() + 1);
+  contingencySlots_.push_back(0);
+  for (const auto &contingency : contingencies) {
     for (const auto &element : contingency.elements) {
-      elementContingencies_[element.id].push_back(std::ref(contingency));
+      auto inserted = elementIndexes_.insert({element.id, static_cast<ElementIndex>(elementIndexes_.size())});
+      slotElements.push_back(inserted.first->second);
+    }
+    contingencySlots_.push_back(slotElements.size());
+  }
+
+  // Count the contingencies referencing each element, an element given several times in a contingency being referenced once
+  const auto nbElements = elementIndexes_.size();
+  const auto noContingency = std::numeric_limits<ContingencyIndex>::max();
+  std::vector<ContingencyIndex> lastContingency(nbElements, noContingency);
+  elementReferenceOffsets_.assign(nbElements + 1, 0);
+  for (ContingencyIndex c = 0; c < contingencies.size(); ++c) {
+    for (auto slot = contingencySlots_[c]; slot < contingencySlots_[c + 1]; ++slot) {
+      const auto element = slotElements[slot];
+      if (lastContingency[element] != c) {
+        lastContingency[element] = c;
+        ++elementReferenceOffsets_[element + 1];
+      }
+    }
+  }
+  for (std::size_t i = 0; i < nbElements; ++i) {
+    elementReferenceOffsets_[i + 1] += elementReferenceOffsets_[i];
+  }
+
+  // Fill the references, element after element, with the slot of the first occurrence of the element in the contingency
+  std::vector<std::size_t> positions(elementReferenceOffsets_.begin(), elementReferenceOffsets_.end() - 1);
+  std::vector<std::size_t> lastReference(nbElements, 0);
+  lastContingency.assign(nbElements, noContingency);
+  references_.resize(elementReferenceOffsets_.back());
+  slotReferences_.resize(slotElements.size());
+  for (ContingencyIndex c = 0; c < contingencies.size(); ++c) {
+    for (auto slot = contingencySlots_[c]; slot < contingencySlots_[c + 1]; ++slot) {
+      const auto element = slotElements[slot];
+      if (lastContingency[element] != c) {
+        lastContingency[element] = c;
+        lastReference[element] = positions[element]++;
+        references_[lastReference[element]] = Reference{c, slot};
+      }
+      slotReferences_[slot] = lastReference[element];
     }
   }
+  validReferences_.assign(references_.size(), false);
 }
 
 void ValidContingencies::markElementValid(const ElementId &elementId, inputs::ContingencyElement::Type elementType, const bool isNetwork) {
-  const auto &elementContingencies = elementContingencies_.find(elementId);
-  if (elementContingencies != elementContingencies_.end()) {
-    // For all contingencies where the element is referred ...
-    for (const auto &contingencyRef : elementContingencies->second) {
-      const auto &contingency = contingencyRef.get();
-      // Find the element inside the input contingency ...
-      auto contingencyElementIt =
-          std::find_if(contingency.elements.begin(), contingency.elements.end(),
-                       [&elementId](const inputs::ContingencyElement &contingencyElement) { return contingencyElement.id == elementId; });
-      // And check it has been given with a valid type,
-      // according to the reference type found in the network
-      if (contingencyElementIt != contingency.elements.end() && inputs::ContingencyElement::isCompatible((*contingencyElementIt).type, elementType)) {
-        // If type is compatible, add the element to the list of valid elements found for the contingency
-        validatingContingencies_[contingency.id].insert(elementId);
-        if (isNetwork) {
-          networkElements_.insert(elementId);
-        }
+  const auto &elementIndex = elementIndexes_.find(elementId);
+  if (elementIndex == elementIndexes_.end()) {
+    return;
+  }
+  const auto &contingencies = contingencies_.get();
+  // For all contingencies where the element is referred ...
+  for (auto reference = elementReferenceOffsets_[elementIndex->second]; reference < elementReferenceOffsets_[elementIndex->second + 1]; ++reference) {
+    const auto &contingency = references_[reference].contingency;
+    const auto &contingencyElement = contingencies[contingency].elements[references_[reference].slot - contingencySlots_[contingency]];
+    // check it has been given with a valid type, according to the reference type found in the network
+    if (inputs::ContingencyElement::isCompatible(contingencyElement.type, elementType)) {
+      // If type is compatible, mark the element as valid for the contingency
+      validReferences_[reference] = true;
+      if (isNetwork) {
+        networkElements_.insert(elementId);
       }
     }
   }
 }
 
 void ValidContingencies::keepContingenciesWithAllElementsValid() {
+  const auto &contingencies = contingencies_.get();
   // A contingency is valid for simulation if it contains at least one valid element
-  for (const auto &contingency : contingencies_.get()) {
-    auto validatingContingency = validatingContingencies_.find(contingency.id);
-    if (validatingContingency == validatingContingencies_.end()) {
+  for (ContingencyIndex c = 0; c < contingencies.size(); ++c) {
+    const auto &contingency = contingencies[c];
+    const auto firstSlot = contingencySlots_[c];
+    const auto lastSlot = contingencySlots_[c + 1];
+    bool hasValidElement = false;
+    for (auto slot = firstSlot; slot < lastSlot && !hasValidElement; ++slot) {
+      hasValidElement = validReferences_[slotReferences_[slot]];
+    }
+    if (!hasValidElement) {
       // For this contingency we have not found any valid element
       LOG(warn, ContingencyInvalidForSimulationNoValidElements, contingency.id);
-    } else {
-      dfl::inputs::Contingency filteredContingency(contingency.id);
-      // Iterate over all the elements in the input contingency
-      for (const auto &element : contingency.elements) {
-        // Check that the element has been marked as valid
-        if ((*validatingContingency).second.find(element.id) == (*validatingContingency).second.end()) {
-          LOG(warn, ContingencyInvalidForSimulation, element.id, contingency.id);
-        } else {
-          filteredContingency.elements.push_back(element);
-        }
-      }
-      if (!filteredContingency.elements.empty()) {
-        validContingencies_.push_back(filteredContingency);
+      continue;
+    }
+
+    dfl::inputs::Contingency filteredContingency(contingency.id);
+    filteredContingency.elements.reserve(lastSlot - firstSlot);
+    // Iterate over all the elements in the input contingency
+    for (auto slot = firstSlot; slot < lastSlot; ++slot) {
+      const auto &element = contingency.elements[slot - firstSlot];
+      // Check that the element has been marked as valid
+      if (validReferences_[slotReferences_[slot]]) {
+        filteredContingency.elements.push_back(element);
+      } else {
+        LOG(warn, ContingencyInvalidForSimulation, element.id, contingency.id);
       }
     }
+    validContingencies_.push_back(std::move(filteredContingency));
   }
 }
 
@@ -0,0 +1,78 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  DefinitionsIndex.cpp
+ *
+ * @brief Index of the algorithms definitions by id implementation file
+ *
+ */
+
+#include "DefinitionsIndex.h"
+
+namespace dfl {
+namespace algo {
+
+DefinitionsIndex::DefinitionsIndex(const std::vector<GeneratorDefinition> &generators, const std::vector<LoadDefinition> &loads,
+                                   const std::vector<StaticVarCompensatorDefinition> &staticVarCompensators, const HVDCLineDefinitions &hvdcLineDefinitions,
+                                   const LinesByIdDefinitions &linesById, const TransformersByIdDefinitions &tfosById)
+    : generators_(buildIndex(generators)), loads_(buildIndex(loads)), staticVarCompensators_(buildIndex(staticVarCompensators)),
+      hvdcLineDefinitions_(&hvdcLineDefinitions), linesById_(&linesById), tfosById_(&tfosById) {}
+
+template<class Definition>
+DefinitionsIndex::IdToIndex
+DefinitionsIndex::buildIndex(const std::vector<Definition> &definitions) {
+  IdToIndex ret;
+  ret.reserve(definitions.size());
+  for (Index i = 0; i < definitions.size(); ++i) {
+    // the first definition is kept in case of duplicated id, as a search in the list would do
+    ret.insert({definitions[i].id, i});
+  }
+  return ret;
+}
+
+boost::optional<DefinitionsIndex::Index>
+DefinitionsIndex::find(const IdToIndex &idToIndex, const std::string &id) {
+  auto found = idToIndex.find(id);
+  if (found == idToIndex.end()) {
+    return boost::none;
+  }
+  return found->second;
+}
+
+const HVDCDefinition *
+DefinitionsIndex::hvdcLine(const std::string &id) const {
+  if (!hvdcLineDefinitions_) {
+    return nullptr;
+  }
+  auto found = hvdcLineDefinitions_->hvdcLines.find(id);
+  return (found == hvdcLineDefinitions_->hvdcLines.end()) ? nullptr : &found->second;
+}
+
+const inputs::Line *
+DefinitionsIndex::line(const std::string &id) const {
+  if (!linesById_) {
+    return nullptr;
+  }
+  auto found = linesById_->linesMap.find(id);
+  return (found == linesById_->linesMap.end()) ? nullptr : found->second;
+}
+
+const inputs::Tfo *
+DefinitionsIndex::tfo(const std::string &id) const {
+  if (!tfosById_) {
+    return nullptr;
+  }
+  auto found = tfosById_->tfosMap.find(id);
+  return (found == tfosById_->tfosMap.end()) ? nullptr : found->second;
+}
+
+}  // namespace algo
+}  // namespace dfl
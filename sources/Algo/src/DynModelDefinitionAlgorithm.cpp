@@ -22,11 +22,15 @@
 namespace dfl {
 namespace algo {
 
-DynModelAlgorithm::DynModelAlgorithm(DynamicModelDefinitions &models, const inputs::DynamicDataBaseManager &manager, bool shuntRegulationOn)
-    : dynamicModels_(models), manager_(manager) {
+DynModelAlgorithm::DynModelAlgorithm(DynamicModelDefinitions &models, const inputs::DynamicDataBaseManager &manager, bool shuntRegulationOn,
+                                     const inputs::NetworkGraph &graph)
+    : dynamicModels_(models), index_(std::make_shared<MacroConnectIndex>()), manager_(manager), graph_(graph) {
   extractDynModels(shuntRegulationOn);
 }
 
+DynModelAlgorithm::DynModelAlgorithm(const DynModelAlgorithm &other, DynamicModelDefinitions &models)
+    : dynamicModels_(models), index_(other.index_), manager_(other.manager_), graph_(other.graph_) {}
+
 boost::optional<boost::filesystem::path> DynModelAlgorithm::findLibraryPath(const std::string &lib) {
   static auto dflLibEnv = getenv("DYNAFLOW_LAUNCHER_LIBRARIES");
 
@@ -72,7 +76,7 @@ void DynModelAlgorithm::extractMultiAssociationInfo(const inputs::AssemblingData
   auto &multiAssoc = manager_.assembling().getMultipleAssociation(macro.id);
   if (shuntRegulationOn && multiAssoc.shunt) {
     const auto &vlid = multiAssoc.shunt->voltageLevel;
-    macroConnectByVlForShuntsId_[vlid].push_back(connection);
+    index_->macroConnectByVlForShuntsId[vlid].push_back(connection);
   }
 }
 
@@ -81,21 +85,21 @@ void DynModelAlgorithm::extractSingleAssociationInfo(const inputs::AssemblingDat
   MacroConnect connection(automaton.id, macro.macroConnection);
   auto &singleAssoc = manager_.assembling().getSingleAssociation(macro.id);
   for (const auto &generator : singleAssoc.generators) {
-    macroConnectByGeneratorName_[generator.name].push_back(connection);
+    index_->macroConnectByGeneratorName[generator.name].push_back(connection);
   }
   for (const auto &load : singleAssoc.loads) {
-    macroConnectByLoadName_[load.name].push_back(connection);
+    index_->macroConnectByLoadName[load.name].push_back(connection);
   }
   if (singleAssoc.bus) {
-    macroConnectByVlForBusesId_[singleAssoc.bus->voltageLevel].insert(connection);
+    index_->macroConnectByVlForBusesId[singleAssoc.bus->voltageLevel].insert(connection);
   } else if (singleAssoc.line) {
-    macroConnectByLineName_[singleAssoc.line->name].push_back(connection);
+    index_->macroConnectByLineName[singleAssoc.line->name].push_back(connection);
   } else if (singleAssoc.hvdcLine) {
-    macroConnectByHvdcName_[singleAssoc.hvdcLine->name].push_back(connection);
+    index_->macroConnectByHvdcName[singleAssoc.hvdcLine->name].push_back(connection);
   } else if (singleAssoc.tfo) {
-    macroConnectByTfoName_[singleAssoc.tfo->name].push_back(connection);
+    index_->macroConnectByTfoName[singleAssoc.tfo->name].push_back(connection);
   } else if (singleAssoc.shunt) {
-    macroConnectByShuntName_[singleAssoc.shunt->name].push_back(connection);
+    index_->macroConnectByShuntName[singleAssoc.shunt->name].push_back(connection);
   }
 }
 
@@ -156,11 +160,11 @@ void DynModelAlgorithm::connectMacroConnectionForDynAutomaton(const inputs::Asse
 void DynModelAlgorithm::connectMacroConnectionForMultipleShunts(const NodePtr &node) {
   // Connect all nodes of voltage level
   auto vl = node->voltageLevel.lock();
-  const auto &macroConnections = macroConnectByVlForShuntsId_.at(vl->id);
+  const auto &macroConnections = index_->macroConnectByVlForShuntsId.at(vl->id);
 
   for (const auto &macroConnection : macroConnections) {
     dynamicModels_.usedMacroConnections.insert(macroConnection.macroConnectionId);
-    // dynamic model id is present in the map as for now macroConnectByVlForShuntsId_ is filled only by dynamic automatons data
+    // dynamic model id is present in the map as for now the macro connections for shunts are filled only by dynamic automatons data
     assert(manager_.assembling().dynamicAutomatons().count(macroConnection.dynModelId) > 0);
     const auto &automaton = manager_.assembling().dynamicAutomatons().at(macroConnection.dynModelId);
     const auto &macroConn = manager_.assembling().getMacroConnection(macroConnection.macroConnectionId);
@@ -173,8 +177,8 @@ void DynModelAlgorithm::connectMacroConnectionForMultipleShunts(const NodePtr &n
   }
 }
 
-void DynModelAlgorithm::connectMacroConnectionForLine(const std::shared_ptr<inputs::Line> &line) {
-  const auto &macroConnections = macroConnectByLineName_.at(line->id);
+void DynModelAlgorithm::connectMacroConnectionForLine(const inputs::Line &line) {
+  const auto &macroConnections = index_->macroConnectByLineName.at(line.id);
   for (const auto &macroConnection : macroConnections) {
     dynamicModels_.usedMacroConnections.insert(macroConnection.macroConnectionId);
     const auto &automaton = manager_.assembling().dynamicAutomatons().at(macroConnection.dynModelId);
@@ -182,12 +186,12 @@ void DynModelAlgorithm::connectMacroConnectionForLine(const std::shared_ptr<inpu
 
     addMacroConnectionToModelDefinitions(automaton, DynamicModelDefinition::MacroConnection(macroConnection.macroConnectionId,
                                                                                             DynamicModelDefinition::MacroConnection::ElementType::LINE,
-                                                                                            line->id, macroConn.indexId));
+                                                                                            line.id, macroConn.indexId));
   }
 }
 
 void DynModelAlgorithm::connectMacroConnectionForSingleShunt(const inputs::Shunt &shunt) {
-  const auto &macroConnections = macroConnectByShuntName_.at(shunt.id);
+  const auto &macroConnections = index_->macroConnectByShuntName.at(shunt.id);
   for (const auto &macroConnection : macroConnections) {
     dynamicModels_.usedMacroConnections.insert(macroConnection.macroConnectionId);
     const auto &automaton = manager_.assembling().dynamicAutomatons().at(macroConnection.dynModelId);
@@ -201,19 +205,14 @@ void DynModelAlgorithm::connectMacroConnectionForSingleShunt(const inputs::Shunt
 
 void DynModelAlgorithm::connectMacroConnectionForBus(const NodePtr &node) {
   auto vl = node->voltageLevel.lock();
-  const auto &macroConnections = macroConnectByVlForBusesId_.at(vl->id);
+  const auto &macroConnections = index_->macroConnectByVlForBusesId.at(vl->id);
 
-  for (const auto &macroConnection : macroConnections) {
-    dfl::inputs::Node::NodeId nodeId;
-    for (const auto &nodeVL : vl->nodes) {
-      if (nodeVL->isBusConnected()) {
-        nodeId = nodeVL->id;
-        break;
-      }
-    }
-    if (nodeId.empty())
-      return;  // ignore this connection
+  // all the macro connections of the voltage level are connected to its representative bus, computed once for all its nodes
+  const auto &nodeId = vl->representativeConnectedBus();
+  if (nodeId.empty())
+    return;  // ignore these connections
 
+  for (const auto &macroConnection : macroConnections) {
     dynamicModels_.usedMacroConnections.insert(macroConnection.macroConnectionId);  // Tag the used macro connection
     const auto &macroConn = manager_.assembling().getMacroConnection(macroConnection.macroConnectionId);
 
@@ -224,21 +223,21 @@ void DynModelAlgorithm::connectMacroConnectionForBus(const NodePtr &node) {
   }
 }
 
-void DynModelAlgorithm::connectMacroConnectionForTfo(const std::shared_ptr<inputs::Tfo> &tfo) {
-  const auto &macroConnections = macroConnectByTfoName_.at(tfo->id);
+void DynModelAlgorithm::connectMacroConnectionForTfo(const inputs::Tfo &tfo) {
+  const auto &macroConnections = index_->macroConnectByTfoName.at(tfo.id);
   for (const auto &macroConnection : macroConnections) {
     dynamicModels_.usedMacroConnections.insert(macroConnection.macroConnectionId);
     const auto &automaton = manager_.assembling().dynamicAutomatons().at(macroConnection.dynModelId);
     const auto &macroConn = manager_.assembling().getMacroConnection(macroConnection.macroConnectionId);
 
     addMacroConnectionToModelDefinitions(automaton, DynamicModelDefinition::MacroConnection(macroConnection.macroConnectionId,
-                                                                                            DynamicModelDefinition::MacroConnection::ElementType::TFO, tfo->id,
+                                                                                            DynamicModelDefinition::MacroConnection::ElementType::TFO, tfo.id,
                                                                                             macroConn.indexId));
   }
 }
 
 void DynModelAlgorithm::connectMacroConnectionForGenerator(const inputs::Generator &generator) {
-  const auto &macroConnections = macroConnectByGeneratorName_.at(generator.id);
+  const auto &macroConnections = index_->macroConnectByGeneratorName.at(generator.id);
   for (const auto &macroConnection : macroConnections) {
     dynamicModels_.usedMacroConnections.insert(macroConnection.macroConnectionId);
     const auto &automaton = manager_.assembling().dynamicAutomatons().at(macroConnection.dynModelId);
@@ -249,7 +248,7 @@ void DynModelAlgorithm::connectMacroConnectionForGenerator(const inputs::Generat
   }
 }
 void DynModelAlgorithm::connectMacroConnectionForLoad(const inputs::Load &load) {
-  const auto &macroConnections = macroConnectByLoadName_.at(load.id);
+  const auto &macroConnections = index_->macroConnectByLoadName.at(load.id);
   for (const auto &macroConnection : macroConnections) {
     dynamicModels_.usedMacroConnections.insert(macroConnection.macroConnectionId);
     const auto &automaton = manager_.assembling().dynamicAutomatons().at(macroConnection.dynModelId);
@@ -261,7 +260,7 @@ void DynModelAlgorithm::connectMacroConnectionForLoad(const inputs::Load &load)
 }
 
 void DynModelAlgorithm::connectMacroConnectionForHvdc(const inputs::HvdcLine &hvdcLine) {
-  const auto &macroConnections = macroConnectByHvdcName_.at(hvdcLine.id);
+  const auto &macroConnections = index_->macroConnectByHvdcName.at(hvdcLine.id);
   for (const auto &macroConnection : macroConnections) {
     dynamicModels_.usedMacroConnections.insert(macroConnection.macroConnectionId);
     const auto &automaton = manager_.assembling().dynamicAutomatons().at(macroConnection.dynModelId);
@@ -290,44 +289,42 @@ void DynModelAlgorithm::operator()(const NodePtr &node, std::shared_ptr<Algorith
   DYN::Timer timer("DFL::DynModelAlgorithm::operator()");
 #endif
   auto vl = node->voltageLevel.lock();
-  if (macroConnectByVlForBusesId_.count(vl->id) > 0) {
+  if (index_->macroConnectByVlForBusesId.count(vl->id) > 0) {
     connectMacroConnectionForBus(node);
   }
-  if (macroConnectByVlForShuntsId_.count(vl->id) > 0) {
+  if (index_->macroConnectByVlForShuntsId.count(vl->id) > 0) {
     connectMacroConnectionForMultipleShunts(node);
   }
   for (const auto &shunt : node->shunts) {
-    if (macroConnectByShuntName_.count(shunt.id) > 0) {
+    if (index_->macroConnectByShuntName.count(shunt.id) > 0) {
       connectMacroConnectionForSingleShunt(shunt);
     }
   }
-  for (const auto &line_ptr : node->lines) {
-    auto line = line_ptr.lock();
-    if (macroConnectByLineName_.count(line->id) > 0) {
+  graph_.forEachLine(*node, [this](const inputs::Line &line) {
+    if (index_->macroConnectByLineName.count(line.id) > 0) {
       connectMacroConnectionForLine(line);
     }
-  }
-  for (const auto &tfo_ptr : node->tfos) {
-    auto tfo = tfo_ptr.lock();
-    if (macroConnectByTfoName_.count(tfo->id) > 0) {
+  });
+  graph_.forEachTfo(*node, [this](const inputs::Tfo &tfo) {
+    if (index_->macroConnectByTfoName.count(tfo.id) > 0) {
       connectMacroConnectionForTfo(tfo);
     }
-  }
+  });
   for (const auto &gen : node->generators) {
-    if (macroConnectByGeneratorName_.count(gen.id) > 0) {
+    if (index_->macroConnectByGeneratorName.count(gen.id) > 0) {
       connectMacroConnectionForGenerator(gen);
     }
   }
   for (const auto &load : node->loads) {
-    if (macroConnectByLoadName_.count(load.id) > 0) {
+    if (index_->macroConnectByLoadName.count(load.id) > 0) {
       connectMacroConnectionForLoad(load);
     }
   }
-  for (const auto &converter : node->converters) {
-    if (macroConnectByHvdcName_.count(converter.lock()->hvdcLine->id) > 0) {
-      connectMacroConnectionForHvdc(*converter.lock()->hvdcLine);
+  graph_.forEachConverter(*node, [this](const inputs::Converter &converter) {
+    if (index_->macroConnectByHvdcName.count(converter.hvdcLine->id) > 0) {
+      connectMacroConnectionForHvdc(*converter.hvdcLine);
     }
-  }
+  });
 }
 
 std::size_t DynModelAlgorithm::MacroConnectHash::operator()(const MacroConnect &connect) const noexcept {
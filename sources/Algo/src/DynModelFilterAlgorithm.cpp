@@ -31,12 +31,9 @@ DynModelFilterAlgorithm::removeRpclInGeneratorsAndSvcIfMissingConnexionToSvc() {
         svcToRemove.push_back(dynamicModel.second.id);
         for (const DynamicModelDefinition::MacroConnection& generatorConnectedToSVC : dynamicModel.second.nodeConnections) {
           const DynamicModelDefinition::MacroConnection::ElementId& genId = generatorConnectedToSVC.connectedElementId;
-          auto foundGen = std::find_if(generators_.begin(), generators_.end(),
-                                        [&genId](const algo::GeneratorDefinition& genDefinition) {
-                                          return genDefinition.id == genId;
-                                        });
-          if (foundGen != generators_.end()) {
-            foundGen->removeRpclFromModel();
+          auto genIndex = definitionsIndex_.generator(genId);
+          if (genIndex) {
+            generators_[*genIndex].removeRpclFromModel();
           }
         }
       }
@@ -87,13 +84,12 @@ DynModelFilterAlgorithm::filterPartiallyConnectedDynamicModels() {
       auto &hvdcLines = hvdcLineDefinitions_.hvdcLines;
       for (const DynamicModelDefinition::MacroConnection& connection : modelDef.nodeConnections) {
         DynamicModelDefinition::MacroConnection::ElementId compId = connection.connectedElementId;
-        auto foundGen = std::find_if(generators_.begin(), generators_.end(),
-                                  [&compId](const algo::GeneratorDefinition& genDefinition) { return genDefinition.id == compId; });
+        auto genIndex = definitionsIndex_.generator(compId);
         auto foundHvdc = hvdcLines.find(compId);
-        if (foundGen != generators_.end() && foundGen->isNetwork()) {
+        if (genIndex && generators_[*genIndex].isNetwork()) {
           LOG(debug, SVCConnectedToDefaultGen, connection.connectedElementId, automaton.second.id);
           toRemove.push_back(connection);
-        } else if (foundGen != generators_.end() && !foundGen->hasRpcl()) {
+        } else if (genIndex && !generators_[*genIndex].hasRpcl()) {
           LOG(debug, SVCConnectedToGenRegulatingNode, connection.connectedElementId, automaton.second.id);
           toRemove.push_back(connection);
         }
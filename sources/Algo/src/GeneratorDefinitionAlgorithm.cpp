@@ -16,9 +16,97 @@
 #include <DYNCommon.h>
 #include <DYNTimer.h>
 
+#include <algorithm>
+#include <functional>
+
 namespace dfl {
 namespace algo {
 
+namespace {
+
+/**
+ * @brief Sort reactive curve points by increasing active power
+ * @param points the points to sort
+ * @returns the sorted points
+ */
+std::vector<ReactiveDiagram::ReactiveCurvePoint> sortPoints(std::vector<ReactiveDiagram::ReactiveCurvePoint> points) {
+  std::sort(points.begin(), points.end(),
+            [](const ReactiveDiagram::ReactiveCurvePoint &lhs, const ReactiveDiagram::ReactiveCurvePoint &rhs) { return lhs.p < rhs.p; });
+  return points;
+}
+
+/**
+ * @brief Combine a value into a hash
+ * @param hash the hash to update
+ * @param value the value to combine
+ */
+void hashCombine(std::size_t &hash, double value) {
+  hash ^= std::hash<double>()(value) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+}
+
+}  // namespace
+
+ReactiveDiagram::ReactiveDiagram(std::vector<ReactiveCurvePoint> &&curvePoints, double diagramQmin, double diagramQmax, double diagramPmin,
+                                 double diagramPmax)
+    : points(sortPoints(std::move(curvePoints))), qmin{points.empty() ? diagramQmin : 0.}, qmax{points.empty() ? diagramQmax : 0.},
+      pmin{points.empty() ? diagramPmin : 0.}, pmax{points.empty() ? diagramPmax : 0.} {}
+
+std::size_t ReactiveDiagram::hash() const {
+  std::size_t hash = points.size();
+  for (const auto &point : points) {
+    hashCombine(hash, point.p);
+    hashCombine(hash, point.qmin);
+    hashCombine(hash, point.qmax);
+  }
+  hashCombine(hash, qmin);
+  hashCombine(hash, qmax);
+  hashCombine(hash, pmin);
+  hashCombine(hash, pmax);
+  return hash;
+}
+
+bool ReactiveDiagram::operator==(const ReactiveDiagram &other) const {
+  return qmin == other.qmin && qmax == other.qmax && pmin == other.pmin && pmax == other.pmax && points.size() == other.points.size() &&
+         std::equal(points.begin(), points.end(), other.points.begin(), [](const ReactiveCurvePoint &lhs, const ReactiveCurvePoint &rhs) {
+           return lhs.p == rhs.p && lhs.qmin == rhs.qmin && lhs.qmax == rhs.qmax;
+         });
+}
+
+std::shared_ptr<const ReactiveDiagram> ReactiveDiagramPool::get(const std::vector<ReactiveCurvePoint> &curvePoints, double qmin, double qmax, double pmin,
+                                                                double pmax) {
+  auto diagram = std::make_shared<const ReactiveDiagram>(std::vector<ReactiveCurvePoint>(curvePoints), qmin, qmax, pmin, pmax);
+  const std::size_t hash = diagram->hash();
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto range = diagrams_.equal_range(hash);
+  for (auto it = range.first; it != range.second; ++it) {
+    if (*it->second == *diagram) {
+      return it->second;
+    }
+  }
+  diagrams_.emplace(hash, diagram);
+  return diagram;
+}
+
+std::size_t ReactiveDiagramPool::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return diagrams_.size();
+}
+
+ReactiveDiagramNames nameReactiveDiagrams(const std::vector<GeneratorDefinition> &generators) {
+  ReactiveDiagramNames names;
+  for (const auto &generator : generators) {
+    if (!generator.isUsingDiagram() || generator.isUsingRectangularDiagram()) {
+      continue;
+    }
+    auto it = names.emplace(generator.diagram.get(), generator.id).first;
+    if (generator.id < it->second) {
+      it->second = generator.id;
+    }
+  }
+  return names;
+}
+
 void GeneratorDefinition::removeRpclFromModel() {
   switch (model) {
   case algo::GeneratorDefinition::ModelType::SIGNALN_RPCL_INFINITE:
@@ -51,9 +139,10 @@ void GeneratorDefinition::removeRpclFromModel() {
 }
 
 GeneratorDefinitionAlgorithm::GeneratorDefinitionAlgorithm(Generators &gens, const inputs::NetworkManager::BusMapRegulating &busesToNumberOfRegulationMap,
-                                                           const inputs::DynamicDataBaseManager &manager, bool infinitereactivelimits, double tfoVoltageLevel)
+                                                           const inputs::DynamicDataBaseManager &manager, bool infinitereactivelimits, double tfoVoltageLevel,
+                                                           ReactiveDiagramPool &diagrams)
     : generators_(gens), busesToNumberOfRegulationMap_(busesToNumberOfRegulationMap), useInfiniteReactivelimits_{infinitereactivelimits},
-      tfoVoltageLevel_(tfoVoltageLevel) {
+      tfoVoltageLevel_(tfoVoltageLevel), diagrams_(diagrams) {
   for (const auto &automaton : manager.assembling().dynamicAutomatons()) {
     if (automaton.second.lib == dfl::common::constants::svcModelName) {
       for (const auto &macroConn : automaton.second.macroConnects) {
@@ -143,8 +232,9 @@ void GeneratorDefinitionAlgorithm::operator()(const NodePtr &node, std::shared_p
         }
       }
     }
-    generators_.emplace_back(generator.id, model, node->id, generator.points, generator.qmin, generator.qmax, generator.pmin, generator.pmax, generator.q,
-                             generator.targetP, generator.regulatedBusId, generator.isNuclear, generator.hasActivePowerControl);
+    generators_.emplace_back(generator.id, model, node->id, diagrams_.get(generator.points, generator.qmin, generator.qmax, generator.pmin, generator.pmax),
+                             generator.qmin, generator.qmax, generator.pmin, generator.pmax, generator.q, generator.targetP, generator.regulatedBusId,
+                             generator.isNuclear, generator.hasActivePowerControl);
   }
 }
 
@@ -22,9 +22,9 @@ namespace algo {
 HVDCDefinitionAlgorithm::HVDCDefinitionAlgorithm(HVDCLineDefinitions &hvdcLinesDefinitions,
                                                  const inputs::NetworkManager::BusMapRegulating &busesToNumberOfRegulationMap, bool infiniteReactiveLimits,
                                                  const std::unordered_set<std::shared_ptr<inputs::Converter>> &converters,
-                                                 const inputs::DynamicDataBaseManager &manager)
+                                                 const inputs::DynamicDataBaseManager &manager, const inputs::NetworkGraph &graph)
     : hvdcLinesDefinitions_(hvdcLinesDefinitions), busesToNumberOfRegulationMap_(busesToNumberOfRegulationMap),
-      infiniteReactiveLimits_(infiniteReactiveLimits) {
+      infiniteReactiveLimits_(infiniteReactiveLimits), graph_(graph) {
   std::transform(converters.begin(), converters.end(), std::inserter(vscConverters_, vscConverters_.begin()),
                  [](const std::shared_ptr<inputs::Converter> &converter) { return std::make_pair(converter->busId, converter); });
   for (const auto &automaton : manager.assembling().dynamicAutomatons()) {
@@ -220,9 +220,8 @@ void HVDCDefinitionAlgorithm::operator()(const NodePtr &node, std::shared_ptr<Al
 #if defined(_DEBUG_) || defined(PRINT_TIMERS)
   DYN::Timer timer("DFL::HVDCDefinitionAlgorithm::operator()");
 #endif
-  for (const auto &converterPtr : node->converters) {
-    auto converter = converterPtr.lock();
-    const auto &hvdcLine = converter->hvdcLine;
+  graph_.forEachConverter(*node, [this](const inputs::Converter &converter) {
+    const auto &hvdcLine = converter.hvdcLine;
     auto hvdcLineDefPair = getOrCreateHvdcLineDefinition(*hvdcLine);
     auto &hvdcLineDefinition = hvdcLineDefPair.first.get();
 
@@ -230,18 +229,18 @@ void HVDCDefinitionAlgorithm::operator()(const NodePtr &node, std::shared_ptr<Al
       // If we meet twice the same HVDC line with two different converters in nodes, it means that both extremities are
       // in the component: it is assumed that the algorithm is performed on main connex component
       hvdcLineDefinition.position = HVDCDefinition::Position::BOTH_IN_MAIN_COMPONENT;
-    } else if (converter->converterId == hvdcLine->converter1->converterId) {
+    } else if (converter.converterId == hvdcLine->converter1->converterId) {
       hvdcLineDefinition.position = HVDCDefinition::Position::FIRST_IN_MAIN_COMPONENT;
-    } else if (converter->converterId == hvdcLine->converter2->converterId) {
+    } else if (converter.converterId == hvdcLine->converter2->converterId) {
       hvdcLineDefinition.position = HVDCDefinition::Position::SECOND_IN_MAIN_COMPONENT;
     } else {
       LOG(warn, HvdcLineBadInitialization, hvdcLine->id);
-      continue;
+      return;
     }
 
     auto modelDef = computeModel(*hvdcLine, hvdcLineDefinition.position, hvdcLineDefinition.converterType);
     hvdcLineDefinition.model = modelDef.model;
-  }
+  });
 }
 
 }  // namespace algo
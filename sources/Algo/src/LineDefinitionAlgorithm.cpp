@@ -13,19 +13,18 @@
 namespace dfl {
 namespace algo {
 
-LinesByIdAlgorithm::LinesByIdAlgorithm(LinesByIdDefinitions& linesByIdDefinition) : linesByIdDefinition_(linesByIdDefinition) {}
+LinesByIdAlgorithm::LinesByIdAlgorithm(LinesByIdDefinitions& linesByIdDefinition, const inputs::NetworkGraph& graph)
+    : linesByIdDefinition_(linesByIdDefinition), graph_(graph) {}
 
 void
 LinesByIdAlgorithm::operator()(const NodePtr& node) {
-  const auto& lines = node->lines;
-  for (const auto& line_ptr : lines) {
-    auto line = line_ptr.lock();
-    if (linesByIdDefinition_.linesMap.count(line->id) > 0) {
-      continue;
+  graph_.forEachLine(*node, [this](const inputs::Line& line) {
+    if (linesByIdDefinition_.linesMap.count(line.id) > 0) {
+      return;
     }
 
-    linesByIdDefinition_.linesMap.insert({line->id, *line});
-  }
+    linesByIdDefinition_.linesMap.insert({line.id, &line});
+  });
 }
 
 }  // namespace algo
@@ -10,37 +10,161 @@
 
 #include "MainConnexComponentAlgorithm.h"
 
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <thread>
+#include <utility>
+
 namespace dfl {
 namespace algo {
 
-MainConnexComponentAlgorithm::MainConnexComponentAlgorithm(ConnexGroup& mainConnexity) : markedNodes_{}, mainConnexity_(mainConnexity) {}
+namespace helper {
+
+/**
+ * @brief Retrieve the representative of the set of a node, compressing the path to it
+ *
+ * @param parents the parent of each node in the union-find structure
+ * @param index the index of the node
+ * @returns the index of the representative node
+ */
+static inputs::NetworkGraph::Index
+findRoot(std::vector<inputs::NetworkGraph::Index>& parents, inputs::NetworkGraph::Index index) {
+  while (parents[index] != index) {
+    parents[index] = parents[parents[index]];
+    index = parents[index];
+  }
+  return index;
+}
+
+/**
+ * @brief Merge the sets of two nodes
+ *
+ * The representative of the merged set is the node with the lowest index
+ *
+ * @param parents the parent of each node in the union-find structure
+ * @param index1 the index of the first node
+ * @param index2 the index of the second node
+ */
+static void
+merge(std::vector<inputs::NetworkGraph::Index>& parents, inputs::NetworkGraph::Index index1, inputs::NetworkGraph::Index index2) {
+  auto root1 = findRoot(parents, index1);
+  auto root2 = findRoot(parents, index2);
+  if (root1 < root2) {
+    parents[root2] = root1;
+  } else if (root2 < root1) {
+    parents[root1] = root2;
+  }
+}
+
+}  // namespace helper
+
+ConnexComponents::ConnexComponents(const inputs::NetworkGraph& graph, unsigned int nbThreads)
+    : graph_(graph), components_(graph.nbNodes()), componentSizes_{}, mainComponent_(std::numeric_limits<ComponentId>::max()) {
+  auto parents = gatherNodes(nbThreads);
+
+  // components are numbered following the index of their first node: as representatives are the nodes with the lowest index,
+  // the representative of a node is always numbered before the node itself
+  for (inputs::NetworkGraph::Index i = 0; i < graph_.nbNodes(); ++i) {
+    auto root = helper::findRoot(parents, i);
+    if (root == i) {
+      components_[i] = static_cast<ComponentId>(componentSizes_.size());
+      componentSizes_.push_back(0);
+    } else {
+      components_[i] = components_[root];
+    }
+    ++componentSizes_[components_[i]];
+  }
+
+  // ties are resolved in favour of the component met first
+  if (!componentSizes_.empty()) {
+    mainComponent_ = static_cast<ComponentId>(std::distance(componentSizes_.begin(), std::max_element(componentSizes_.begin(), componentSizes_.end())));
+  }
+}
+
+std::vector<inputs::NetworkGraph::Index>
+ConnexComponents::gatherNodes(unsigned int nbThreads) const {
+  using Index = inputs::NetworkGraph::Index;
+  const Index nbNodes = graph_.nbNodes();
+  std::vector<Index> parents(nbNodes);
+  for (Index i = 0; i < nbNodes; ++i) {
+    parents[i] = i;
+  }
 
-void
-MainConnexComponentAlgorithm::updateConnexGroup(ConnexGroup& group, const std::vector<NodePtr>& nodes) {
-  for (const auto& node : nodes) {
-    if (markedNodes_.count(node) == 0) {
-      markedNodes_.insert(node);
-      group.push_back(node);
-      updateConnexGroup(group, node->neighbours);
+  // each thread gathers the nodes of a contiguous range of indexes, only touching the parents inside its range, and keeps
+  // the connections leaving its range to be merged afterwards
+  const Index nbRanges = std::max(1U, std::min(nbThreads, nbNodes));
+  const Index rangeSize = nbNodes / nbRanges + (nbNodes % nbRanges == 0 ? 0 : 1);
+  std::vector<std::vector<std::pair<Index, Index>>> crossingConnections(nbRanges);
+  auto gatherRange = [this, &parents, &crossingConnections, nbNodes, rangeSize](Index range) {
+    const Index first = range * rangeSize;
+    const Index last = std::min(nbNodes, first + rangeSize);
+    for (Index i = first; i < last; ++i) {
+      for (auto neighbour : graph_.neighbours(i)) {
+        if (neighbour < first || neighbour >= last) {
+          crossingConnections[range].push_back(std::make_pair(i, neighbour));
+        } else {
+          helper::merge(parents, i, neighbour);
+        }
+      }
+    }
+  };
+
+  if (nbRanges == 1) {
+    gatherRange(0);
+  } else {
+    std::vector<std::thread> threads;
+    threads.reserve(nbRanges);
+    for (Index range = 0; range < nbRanges; ++range) {
+      threads.emplace_back(gatherRange, range);
+    }
+    for (auto& thread : threads) {
+      thread.join();
     }
   }
+
+  for (const auto& connections : crossingConnections) {
+    for (const auto& connection : connections) {
+      helper::merge(parents, connection.first, connection.second);
+    }
+  }
+  return parents;
 }
 
-void
-MainConnexComponentAlgorithm::operator()(const NodePtr& node) {
-  if (markedNodes_.count(node) > 0) {
-    // already processed
-    return;
+std::vector<NodePtr>
+ConnexComponents::mainComponentNodes() const {
+  using Index = inputs::NetworkGraph::Index;
+  std::vector<NodePtr> ret;
+  if (componentSizes_.empty()) {
+    return ret;
   }
+  ret.reserve(componentSizes_[mainComponent_]);
 
-  ConnexGroup group;
-  markedNodes_.insert(node);
-  group.push_back(node);
-  updateConnexGroup(group, node->neighbours);
+  Index first = 0;
+  while (components_[first] != mainComponent_) {
+    ++first;
+  }
 
-  if (mainConnexity_.size() < group.size()) {
-    mainConnexity_.swap(group);
+  // depth-first traversal with an explicit stack, each level holding a node and the position of its next neighbour to process
+  std::vector<bool> marked(graph_.nbNodes(), false);
+  std::vector<std::pair<Index, std::size_t>> stack(1, std::make_pair(first, 0));
+  marked[first] = true;
+  ret.push_back(graph_.node(first));
+  while (!stack.empty()) {
+    auto& level = stack.back();
+    auto neighbours = graph_.neighbours(level.first);
+    if (level.second == neighbours.size()) {
+      stack.pop_back();
+      continue;
+    }
+    auto neighbour = neighbours[level.second++];
+    if (!marked[neighbour]) {
+      marked[neighbour] = true;
+      ret.push_back(graph_.node(neighbour));
+      stack.push_back(std::make_pair(neighbour, 0));
+    }
   }
+  return ret;
 }
 
 }  // namespace algo
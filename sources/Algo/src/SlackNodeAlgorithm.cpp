@@ -15,7 +15,7 @@
 namespace dfl {
 namespace algo {
 
-SlackNodeAlgorithm::SlackNodeAlgorithm(NodePtr& slackNode) : slackNode_(slackNode) {}
+SlackNodeAlgorithm::SlackNodeAlgorithm(NodePtr& slackNode, const inputs::NetworkGraph& graph) : slackNode_(slackNode), graph_(graph) {}
 
 void
 SlackNodeAlgorithm::operator()(const NodePtr& node) {
@@ -25,8 +25,8 @@ SlackNodeAlgorithm::operator()(const NodePtr& node) {
   if (!slackNode_) {
     slackNode_ = node;
   } else {
-    if (std::forward_as_tuple(slackNode_->nominalVoltage, slackNode_->neighbours.size()) <
-        std::forward_as_tuple(node->nominalVoltage, node->neighbours.size())) {
+    if (std::forward_as_tuple(slackNode_->nominalVoltage, graph_.nbNeighbours(*slackNode_)) <
+        std::forward_as_tuple(node->nominalVoltage, graph_.nbNeighbours(*node))) {
       slackNode_ = node;
     }
   }
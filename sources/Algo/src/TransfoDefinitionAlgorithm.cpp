@@ -13,19 +13,18 @@
 namespace dfl {
 namespace algo {
 
-TransformersByIdAlgorithm::TransformersByIdAlgorithm(TransformersByIdDefinitions& tfosByIdDefinition) : tfosByIdDefinition_(tfosByIdDefinition) {}
+TransformersByIdAlgorithm::TransformersByIdAlgorithm(TransformersByIdDefinitions& tfosByIdDefinition, const inputs::NetworkGraph& graph)
+    : tfosByIdDefinition_(tfosByIdDefinition), graph_(graph) {}
 
 void
 TransformersByIdAlgorithm::operator()(const NodePtr& node) {
-  const auto& tfos = node->tfos;
-  for (const auto& tfo_ptr : tfos) {
-    auto tfo = tfo_ptr.lock();
-    if (tfosByIdDefinition_.tfosMap.count(tfo->id) > 0) {
-      continue;
+  graph_.forEachTfo(*node, [this](const inputs::Tfo& tfo) {
+    if (tfosByIdDefinition_.tfosMap.count(tfo.id) > 0) {
+      return;
     }
 
-    tfosByIdDefinition_.tfosMap.insert({tfo->id, *tfo});
-  }
+    tfosByIdDefinition_.tfosMap.insert({tfo.id, &tfo});
+  });
 }
 
 }  // namespace algo
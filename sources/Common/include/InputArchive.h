@@ -0,0 +1,117 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  InputArchive.h
+ *
+ * @brief Input archive decoded in memory header file
+ *
+ */
+
+#pragma once
+
+#include <boost/filesystem.hpp>
+
+#include <istream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace dfl {
+namespace common {
+
+/**
+ * @brief Input files of an archive, decoded in memory
+ *
+ * The entries of the archive are kept in a virtual file table, located as if the archive was extracted next to it. Input files
+ * are opened from this table when they belong to the archive and from the disk otherwise, so that the readers of the launcher
+ * do not need any temporary extraction. Only the files opened by Dynawo itself have to be extracted.
+ */
+class InputArchive {
+ public:
+  /**
+   * @brief Default constructor, building an empty archive: all the files are read from the disk
+   */
+  InputArchive() = default;
+
+  /**
+   * @brief Constructor
+   *
+   * Decode all the entries of the archive in memory
+   *
+   * @param archivePath the path of the zip archive
+   */
+  explicit InputArchive(const boost::filesystem::path &archivePath);
+
+  /**
+   * @brief Retrieve an empty archive, shared by the readers not given any archive
+   * @returns the empty archive
+   */
+  static const InputArchive &empty();
+
+  /**
+   * @brief Determines if a file belongs to the archive
+   * @param filepath the path of the file, as if the archive was extracted
+   * @returns true if the file is an entry of the archive, false otherwise
+   */
+  bool contains(const boost::filesystem::path &filepath) const;
+
+  /**
+   * @brief Determines if a file exists, either in the archive or on the disk
+   * @param filepath the path of the file
+   * @returns true if the file exists, false otherwise
+   */
+  bool exists(const boost::filesystem::path &filepath) const;
+
+  /**
+   * @brief Open a file for reading
+   *
+   * The content of an entry of the archive is read in place, without copy. Other files are opened from the disk and the
+   * returned stream is in a failed state if the file cannot be opened.
+   *
+   * @param filepath the path of the file
+   * @returns the stream on the content of the file, which must not outlive the archive
+   */
+  std::unique_ptr<std::istream> open(const boost::filesystem::path &filepath) const;
+
+  /**
+   * @brief Write an entry of the archive on the disk, for files opened by path outside of the launcher
+   *
+   * The entry is dropped from the archive once written: the file is then read from the disk.
+   * Files that do not belong to the archive are left untouched
+   *
+   * @param filepath the path of the file
+   * @throws DFLError if the file cannot be written, the entry being kept in the archive
+   */
+  void extract(const boost::filesystem::path &filepath);
+
+  /**
+   * @brief Drop an entry of the archive, to release its memory
+   *
+   * Used by the processes reading a file extracted by another process
+   *
+   * @param filepath the path of the file
+   */
+  void release(const boost::filesystem::path &filepath);
+
+ private:
+  /**
+   * @brief Build the key of a file in the virtual file table
+   * @param filepath the path of the file
+   * @returns the normalized absolute path of the file
+   */
+  static std::string key(const boost::filesystem::path &filepath);
+
+ private:
+  std::unordered_map<std::string, std::string> files_;  ///< content of the entries, by normalized absolute path
+};
+
+}  // namespace common
+}  // namespace dfl
@@ -23,6 +23,11 @@
 #include <DYNMessage.h>
 #include <DYNMultiProcessingContext.h>
 #include <DYNTrace.h>
+#include <boost/optional.hpp>
+#include <exception>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 namespace dfl {
 namespace common {
@@ -32,6 +37,28 @@ namespace common {
  */
 class Log {
  public:
+  using TraceFunction = DYN::TraceStream (*)(const std::string &);  ///< function opening a trace stream of a level, as DYN::Trace::info
+
+  /**
+   * @brief Log performed by a task run with its logs deferred
+   */
+  struct DeferredLog {
+    TraceFunction trace;  ///< function opening a trace stream of the level of the log
+    std::string message;  ///< message of the log
+  };
+
+  /**
+   * @brief Result of a task run with its logs deferred
+   *
+   * @tparam T the type of the value returned by the task
+   */
+  template<class T>
+  struct Deferred {
+    boost::optional<T> value;       ///< value returned by the task, if it did not throw
+    std::exception_ptr error;       ///< exception thrown by the task, if any
+    std::vector<DeferredLog> logs;  ///< logs performed by the task, in order
+  };
+
   /**
    * @brief Get the tag for dynaflow launcher log
    *
@@ -62,6 +89,73 @@ class Log {
    */
   static void addLogFileContentInMapData(const std::string &logFileRelativePath, const std::string &logFileAbsolutePath,
                                          std::unordered_map<std::string, std::string> &mapOutputFilesData);
+
+  /**
+   * @brief Perform a log, or record it if the logs of the current thread are deferred
+   *
+   * Only the root process logs
+   *
+   * @param trace function opening a trace stream of the level of the log
+   * @param message the message of the log
+   */
+  static void log(TraceFunction trace, const DYN::Message &message);
+
+  /**
+   * @brief Run a task on the current thread with its logs deferred
+   *
+   * The logs of a task run in the background are recorded instead of being performed, so that they can be performed once its result
+   * is retrieved, see replayLogs: the order of the logs then does not depend on the scheduling of the threads.
+   *
+   * @param task the task to run
+   * @returns the value returned by the task or the exception it threw, with the logs it performed
+   */
+  template<class F>
+  static Deferred<typename std::result_of<F()>::type> deferLogs(F &&task) {
+    Deferred<typename std::result_of<F()>::type> result;
+    std::vector<DeferredLog> *const previousLogs = deferredLogs();
+    deferredLogs() = &result.logs;
+    try {
+      result.value = task();
+    } catch (...) {
+      result.error = std::current_exception();
+    }
+    deferredLogs() = previousLogs;
+    return result;
+  }
+
+  /**
+   * @brief Perform the logs of a task run with its logs deferred, and retrieve its result
+   *
+   * @param result the result of the task
+   * @returns the value returned by the task
+   * @throws the exception thrown by the task, once its logs are performed
+   */
+  template<class T>
+  static T replayLogs(Deferred<T> &&result) {
+    for (const auto &deferredLog : result.logs) {
+      perform(deferredLog.trace, deferredLog.message);
+    }
+    if (result.error) {
+      std::rethrow_exception(result.error);
+    }
+    return std::move(*result.value);
+  }
+
+ private:
+  /**
+   * @brief Logs of the current thread being deferred
+   *
+   * @returns the logs being deferred, null if the logs of the current thread are performed directly
+   */
+  static std::vector<DeferredLog> *&deferredLogs();
+
+  /**
+   * @brief Perform a log or record it if the logs of the current thread are deferred
+   *
+   * @param trace function opening a trace stream of the level of the log
+   * @param message the formatted message of the log
+   */
+  static void perform(TraceFunction trace, const std::string &message);
 };
 
 }  // namespace common
@@ -70,14 +164,13 @@ class Log {
 /**
  * @brief Perform a log
  *
- * This performs a log with the tag relative to dynaflow launcher
+ * This performs a log with the tag relative to dynaflow launcher, or records it if the logs of the current thread are deferred
  *
  * @param level the level of the log: must be "error", "warn", "info" or "debug"
  * @param key the log key from the dictionary
  */
 #define LOG(level, key, ...)                                                                                                                                   \
-  (DYNAlgorithms::multiprocessing::context().isRootProc() ? DYN::Trace::level(dfl::common::Log::getTag()) : DYN::TraceStream())                                \
-      << (DYN::Message("DFLLOG", dfl::KeyLog_t::names(dfl::KeyLog_t::key)), ##__VA_ARGS__) << DYN::Trace::endline
+  dfl::common::Log::log(&DYN::Trace::level, (DYN::Message("DFLLOG", dfl::KeyLog_t::names(dfl::KeyLog_t::key)), ##__VA_ARGS__))
 
 /**
  * @brief Macro description to have a shortcut.
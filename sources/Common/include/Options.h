@@ -44,6 +44,13 @@ class Options {
     std::string configPath;             ///< Launcher configuration filepath
     std::string zipArchivePath;         ///< zip archive path to unzip to get input files
     std::string dynawoLogLevel;         ///< chosen log level
+    std::string snapshotCacheDir;       ///< directory of the input snapshots, empty if the snapshot cache is disabled
+    unsigned int nbThreads;             ///< number of threads to use to process the network, 0 to keep the value of the configuration file
+    std::string resultCacheDir;         ///< directory of the cached results of the security analysis scenarios, empty if the result cache is disabled
+    unsigned int resultCacheMaxSize;    ///< maximum size of the result cache, in megabytes
+    bool resultCacheDryRun;             ///< true to only report the scenarios found in the result cache, without reusing their results
+    unsigned int checkpointInterval;    ///< number of security analysis scenarios simulated between two checkpoints, 0 if checkpointing is disabled
+    bool resume;                        ///< true to resume an interrupted security analysis from its checkpoints
   };
 
   /**
@@ -106,7 +113,8 @@ class Options {
   static std::string basename(const std::string& filepath);
 
  private:
-  static const std::string defaultLogLevel_;  ///< Default log level
+  static const std::string defaultLogLevel_;             ///< Default log level
+  static const unsigned int defaultResultCacheMaxSize_;  ///< Default maximum size of the result cache, in megabytes
 
  private:
   boost::program_options::options_description desc_;  ///< options description
@@ -0,0 +1,52 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  Tasks.h
+ *
+ * @brief Parallel execution of independent tasks header file
+ *
+ */
+
+#pragma once
+
+#include <functional>
+#include <vector>
+
+namespace dfl {
+namespace common {
+
+/**
+ * @brief Run independent tasks on a pool of threads
+ *
+ * The threads pick the tasks in the order of the list, the calling thread being one of them, and the function returns once all the tasks
+ * ended. If some tasks throw, the other ones still run and the exception of the first failing task in the order of the list is rethrown.
+ *
+ * @param tasks the tasks to run
+ * @param nbThreads the maximum number of threads running the tasks, including the calling thread
+ * @returns the wall-time of each task in seconds, in the order of the list
+ */
+std::vector<double> runTasks(const std::vector<std::function<void()>> &tasks, unsigned int nbThreads);
+
+/**
+ * @brief Dispatch independent tasks of known costs to processes that run them in turn
+ *
+ * The task submitted at position k is run by the process k modulo the number of processes. The tasks are dispatched by rounds of one task
+ * per process, the most expensive ones first: in each round, the most expensive task goes to the process with the lowest load so far,
+ * so that the processes end at about the same time. Tasks of equal cost keep their order, so that the dispatch only depends on the costs.
+ *
+ * @param costs the estimated costs of the tasks
+ * @param nbProcesses the number of processes running the tasks
+ * @returns the positions of the tasks, in submission order
+ */
+std::vector<std::size_t> dispatchTasks(const std::vector<double> &costs, unsigned int nbProcesses);
+
+}  // namespace common
+}  // namespace dfl
@@ -0,0 +1,160 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  InputArchive.cpp
+ *
+ * @brief Input archive decoded in memory implementation file
+ *
+ */
+
+#include "InputArchive.h"
+
+#include "Log.h"
+
+#include <libzip/ZipEntry.h>
+#include <libzip/ZipException.h>
+#include <libzip/ZipFile.h>
+#include <libzip/ZipInputStream.h>
+
+#include <fstream>
+#include <streambuf>
+
+namespace dfl {
+namespace common {
+
+namespace {
+
+/**
+ * @brief Read-only stream buffer on a memory area
+ */
+class MemoryBuffer : public std::streambuf {
+ public:
+  /**
+   * @brief Constructor
+   * @param data the memory area, which must outlive the buffer
+   */
+  explicit MemoryBuffer(const std::string &data) {
+    // the get area is never written through, the const_cast is only required by the streambuf interface
+    char *begin = const_cast<char *>(data.data());
+    setg(begin, begin, begin + data.size());
+  }
+
+ protected:
+  pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+    if (!(which & std::ios_base::in)) {
+      return pos_type(off_type(-1));
+    }
+    char *base = dir == std::ios_base::beg ? eback() : (dir == std::ios_base::cur ? gptr() : egptr());
+    char *position = base + off;
+    if (position < eback() || position > egptr()) {
+      return pos_type(off_type(-1));
+    }
+    setg(eback(), position, egptr());
+    return pos_type(position - eback());
+  }
+
+  pos_type seekpos(pos_type pos, std::ios_base::openmode which) override { return seekoff(off_type(pos), std::ios_base::beg, which); }
+};
+
+/**
+ * @brief Input stream on a memory area
+ */
+class MemoryStream : public std::istream {
+ public:
+  /**
+   * @brief Constructor
+   * @param data the memory area, which must outlive the stream
+   */
+  explicit MemoryStream(const std::string &data) : std::istream(nullptr), buffer_(data) { rdbuf(&buffer_); }
+
+ private:
+  MemoryBuffer buffer_;  ///< buffer on the memory area
+};
+
+}  // namespace
+
+InputArchive::InputArchive(const boost::filesystem::path &archivePath) {
+  boost::shared_ptr<zip::ZipFile> archive;
+  try {
+    archive = zip::ZipInputStream::read(archivePath.generic_string());
+  } catch (const zip::ZipException &e) {
+    switch (e.getErrorCode()) {
+    case zip::Error::Code::LIBARCHIVE_INTERNAL_ERROR:
+      throw DFLError(LibZipError, archivePath.generic_string(), e.what());
+    case zip::Error::Code::FILE_NOT_FOUND:
+      throw DFLError(FileNotFound, e.what());
+    default:
+      // other libzip errors
+      throw;
+    }
+  }
+
+  const auto archiveParentPath = boost::filesystem::absolute(archivePath).parent_path();
+  files_.reserve(archive->getEntries().size());
+  for (const auto &entry : archive->getEntries()) {
+    files_[key(archiveParentPath / entry.first)] = entry.second->getData();
+  }
+}
+
+const InputArchive &InputArchive::empty() {
+  static const InputArchive emptyArchive;
+  return emptyArchive;
+}
+
+std::string InputArchive::key(const boost::filesystem::path &filepath) {
+  return boost::filesystem::absolute(filepath).lexically_normal().generic_string();
+}
+
+bool InputArchive::contains(const boost::filesystem::path &filepath) const {
+  return !files_.empty() && files_.count(key(filepath)) > 0;
+}
+
+bool InputArchive::exists(const boost::filesystem::path &filepath) const {
+  return contains(filepath) || boost::filesystem::exists(filepath);
+}
+
+std::unique_ptr<std::istream> InputArchive::open(const boost::filesystem::path &filepath) const {
+  if (!files_.empty()) {
+    const auto it = files_.find(key(filepath));
+    if (it != files_.end()) {
+      return std::unique_ptr<std::istream>(new MemoryStream(it->second));
+    }
+  }
+  return std::unique_ptr<std::istream>(new std::ifstream(filepath.c_str(), std::ios::binary));
+}
+
+void InputArchive::extract(const boost::filesystem::path &filepath) {
+  if (files_.empty()) {
+    return;
+  }
+  const auto it = files_.find(key(filepath));
+  if (it == files_.end()) {
+    return;
+  }
+  boost::system::error_code error;
+  boost::filesystem::create_directories(filepath.parent_path(), error);
+  std::ofstream file(filepath.c_str(), std::ios::binary);
+  file.write(it->second.data(), static_cast<std::streamsize>(it->second.size()));
+  file.close();
+  if (!file) {
+    throw DFLError(FileCreationFailed, filepath.generic_string());
+  }
+  files_.erase(it);
+}
+
+void InputArchive::release(const boost::filesystem::path &filepath) {
+  if (!files_.empty()) {
+    files_.erase(key(filepath));
+  }
+}
+
+}  // namespace common
+}  // namespace dfl
@@ -67,5 +67,25 @@ void Log::addLogFileContentInMapData(const std::string &logFileRelativePath, con
   }
 }
 
+void Log::log(TraceFunction trace, const DYN::Message &message) {
+  if (DYNAlgorithms::multiprocessing::context().isRootProc()) {
+    perform(trace, message.str());
+  }
+}
+
+void Log::perform(TraceFunction trace, const std::string &message) {
+  std::vector<DeferredLog> *const logs = deferredLogs();
+  if (logs) {
+    logs->push_back(DeferredLog{trace, message});
+  } else {
+    trace(getTag()) << message << DYN::Trace::endline;
+  }
+}
+
+std::vector<Log::DeferredLog> *&Log::deferredLogs() {
+  static thread_local std::vector<DeferredLog> *logs = nullptr;
+  return logs;
+}
+
 }  // namespace common
 }  // namespace dfl
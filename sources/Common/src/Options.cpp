@@ -31,6 +31,8 @@ const std::string Options::defaultLogLevel_ = "DEBUG";
 const std::string Options::defaultLogLevel_ = "INFO";
 #endif
 
+const unsigned int Options::defaultResultCacheMaxSize_ = 1024;
+
 namespace po = boost::program_options;
 
 /**
@@ -79,7 +81,7 @@ std::string Options::basename(const std::string &filepath) {
   return path.filename().replace_extension().generic_string();
 }
 
-Options::Options() : desc_{}, config_{"", "", "", "", "", defaultLogLevel_} {
+Options::Options() : desc_{}, config_{"", "", "", "", "", defaultLogLevel_, "", 0, "", defaultResultCacheMaxSize_, false, 0, false} {
   desc_.add_options()("help,h", "Display help message")("version,v", "Display version")(
       "log-level", po::value<ParsedLogLevel>(),
       (std::string("Dynawo logger level (allowed values are ERROR, WARN, INFO, DEBUG): default is ") + defaultLogLevel_).c_str())(
@@ -88,7 +90,19 @@ Options::Options() : desc_{}, config_{"", "", "", "", "", defaultLogLevel_} {
       "contingencies", po::value<std::string>(&config_.contingenciesFilePath), "Contingencies file path to process (Security Analysis)")(
       "nsa", "Run steady state calculation followed by security analysis. Requires contingencies file to be defined.")(
       "input-archive", po::value<std::string>(&config_.zipArchivePath),
-      "Path to a ZIP archive containing input files for '--network', '--config', and '--contingencies'.");
+      "Path to a ZIP archive containing input files for '--network', '--config', and '--contingencies'.")(
+      "snapshot-cache", po::value<std::string>(&config_.snapshotCacheDir),
+      "Directory where the snapshots of the processed network, setting and assembling files are stored, to avoid processing them again")(
+      "nb-threads", po::value<unsigned int>(&config_.nbThreads),
+      "Number of threads to use to process the network, overriding the NbThreads value of the configuration file")(
+      "result-cache", po::value<std::string>(&config_.resultCacheDir),
+      "Directory where the results of the security analysis scenarios are cached, to avoid simulating again the scenarios whose inputs did not change")(
+      "result-cache-size", po::value<unsigned int>(&config_.resultCacheMaxSize),
+      (std::string("Maximum size of the result cache in megabytes: default is ") + std::to_string(defaultResultCacheMaxSize_)).c_str())(
+      "result-cache-dry-run", "Only report the scenarios whose results are found in the result cache, simulating all the scenarios")(
+      "checkpoint", po::value<unsigned int>(&config_.checkpointInterval),
+      "Number of security analysis scenarios simulated between two checkpoints of their results in the output directory: default is 0, no checkpoint")(
+      "resume", "Resume an interrupted security analysis, skipping the scenarios whose results were checkpointed in the output directory");
 }
 
 Options::Request Options::parse(int argc, char *argv[]) {
@@ -112,6 +126,9 @@ Options::Request Options::parse(int argc, char *argv[]) {
       config_.dynawoLogLevel = vm["log-level"].as<ParsedLogLevel>().logLevelDefinition;
     }
 
+    config_.resultCacheDryRun = vm.count("result-cache-dry-run") > 0;
+    config_.resume = vm.count("resume") > 0;
+
     if (vm.count("nsa") > 0) {
       if (vm.count("contingencies") > 0) {
         return Request::RUN_SIMULATION_NSA;
@@ -0,0 +1,96 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  Tasks.cpp
+ *
+ * @brief Parallel execution of independent tasks implementation file
+ *
+ */
+
+#include "Tasks.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <numeric>
+#include <thread>
+
+namespace dfl {
+namespace common {
+
+std::vector<double>
+runTasks(const std::vector<std::function<void()>> &tasks, unsigned int nbThreads) {
+  std::vector<double> durations(tasks.size(), 0.);
+  std::vector<std::exception_ptr> errors(tasks.size());
+  std::atomic<std::size_t> next(0);
+
+  // each slot of the results is only written by the thread running the corresponding task
+  auto worker = [&tasks, &durations, &errors, &next]() {
+    for (std::size_t index = next++; index < tasks.size(); index = next++) {
+      const auto start = std::chrono::steady_clock::now();
+      try {
+        tasks[index]();
+      } catch (...) {
+        errors[index] = std::current_exception();
+      }
+      durations[index] = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+  };
+
+  const std::size_t nbWorkers = std::max<std::size_t>(1, std::min<std::size_t>(nbThreads, tasks.size()));
+  std::vector<std::thread> threads;
+  threads.reserve(nbWorkers - 1);
+  for (std::size_t i = 1; i < nbWorkers; ++i) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  for (const auto &error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+  return durations;
+}
+
+std::vector<std::size_t>
+dispatchTasks(const std::vector<double> &costs, unsigned int nbProcesses) {
+  const std::size_t nbTasks = costs.size();
+  nbProcesses = std::max(nbProcesses, 1U);
+
+  std::vector<std::size_t> tasksByCost(nbTasks);
+  std::iota(tasksByCost.begin(), tasksByCost.end(), 0);
+  std::stable_sort(tasksByCost.begin(), tasksByCost.end(), [&costs](std::size_t lhs, std::size_t rhs) { return costs[lhs] > costs[rhs]; });
+
+  std::vector<std::size_t> order(nbTasks);
+  std::vector<double> loads(nbProcesses, 0.);
+  std::vector<unsigned int> processes;
+  for (std::size_t roundStart = 0; roundStart < nbTasks; roundStart += nbProcesses) {
+    // the last round only reaches the first processes
+    const std::size_t roundSize = std::min<std::size_t>(nbProcesses, nbTasks - roundStart);
+    processes.resize(roundSize);
+    std::iota(processes.begin(), processes.end(), 0);
+    std::stable_sort(processes.begin(), processes.end(), [&loads](unsigned int lhs, unsigned int rhs) { return loads[lhs] < loads[rhs]; });
+    for (std::size_t i = 0; i < roundSize; ++i) {
+      const std::size_t task = tasksByCost[roundStart + i];
+      loads[processes[i]] += costs[task];
+      order[roundStart + processes[i]] = task;
+    }
+  }
+  return order;
+}
+
+}  // namespace common
+}  // namespace dfl
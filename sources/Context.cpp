@@ -21,14 +21,15 @@
 #include "Contingencies.h"
 #include "Diagram.h"
 #include "Dyd.h"
-#include "DydEvent.h"
 #include "DynModelFilterAlgorithm.h"
 #include "Job.h"
 #include "Log.h"
 #include "Network.h"
+#include "OutputsConstants.h"
 #include "Par.h"
-#include "ParEvent.h"
+#include "ScenarioKeys.h"
 #include "Solver.h"
+#include "Tasks.h"
 
 #include <DYNMultiProcessingContext.h>
 #include <DYNMultipleJobsFactory.h>
@@ -43,17 +44,53 @@
 #include <boost/make_shared.hpp>
 #include <boost/property_tree/json_parser.hpp>
 #include <fstream>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <libxml/parser.h>
+#include <libxml/tree.h>
+#include <memory>
 #include <sstream>
+#include <thread>
 #include <tuple>
+#include <unordered_set>
+
+#if defined(_MPI_)
+#include <mpi.h>
+#endif
 
 namespace file = boost::filesystem;
 
 namespace dfl {
+Context::PendingManagers Context::launchManagers(const ContextDef &def, const inputs::Configuration &config) {
+  // libxml2 must be initialized once before documents are parsed on several threads
+  xmlInitParser();
+
+  const auto policy = config.getNbThreads() > 1 ? std::launch::async : std::launch::deferred;
+  const common::InputArchive *inputArchive = def.inputArchive ? def.inputArchive : &common::InputArchive::empty();
+  PendingManagers pendingManagers;
+  // the logs of the managers are deferred until they are retrieved, so that their order does not depend on the threads
+  pendingManagers.dynamicDataBaseManager = std::async(policy, [&def, inputArchive]() {
+    return common::Log::deferLogs([&def, inputArchive]() {
+      return inputs::DynamicDataBaseManager(def.settingFilePaths, def.assemblingFilePaths, *inputArchive, def.snapshotCacheDir);
+    });
+  });
+  pendingManagers.contingenciesManager = std::async(policy, [&def, inputArchive]() {
+    return common::Log::deferLogs([&def, inputArchive]() { return inputs::ContingenciesManager(def.contingenciesFilePath, *inputArchive); });
+  });
+  return pendingManagers;
+}
+
 Context::Context(const ContextDef &def, inputs::Configuration &config, std::unordered_map<std::string, std::string> &mapOutputFilesData)
-    : def_(def), networkManager_(def.networkFilepath), dynamicDataBaseManager_(def.settingFilePaths, def.assemblingFilePaths),
-      contingenciesManager_(def.contingenciesFilePath), config_(config), mapOutputFilesData_(mapOutputFilesData), basename_{}, slackNode_{},
-      slackNodeOrigin_{SlackNodeOrigin::ALGORITHM}, generators_{}, loads_{}, staticVarCompensators_{},
-      algoResults_(new algo::AlgorithmsResults()), jobEntry_{}, jobsEvents_{} {
+    : Context(def, config, mapOutputFilesData, launchManagers(def, config)) {}
+
+Context::Context(const ContextDef &def, inputs::Configuration &config, std::unordered_map<std::string, std::string> &mapOutputFilesData,
+                 PendingManagers &&pendingManagers)
+    : def_(def), networkManager_(def.networkFilepath, config.getNbThreads(), def.snapshotCacheDir),
+      dynamicDataBaseManager_(common::Log::replayLogs(pendingManagers.dynamicDataBaseManager.get())),
+      contingenciesManager_(common::Log::replayLogs(pendingManagers.contingenciesManager.get())), config_(config),
+      mapOutputFilesData_(mapOutputFilesData), basename_{}, slackNode_{}, slackNodeOrigin_{SlackNodeOrigin::ALGORITHM}, generators_{}, loads_{},
+      staticVarCompensators_{}, algoResults_(new algo::AlgorithmsResults()), jobEntry_{}, jobsEvents_{} {
   file::path path(def.networkFilepath);
   basename_ = path.filename().replace_extension().generic_string();
 
@@ -68,13 +105,8 @@ Context::Context(const ContextDef &def, inputs::Configuration &config, std::unor
       // case slack node is requested to be extracted from IIDM but is not present in IIDM: we will compute it internally but a warning is sent
       LOG(warn, NetworkSlackNodeNotFound, def.networkFilepath);
     }
-    networkManager_.onNode(algo::SlackNodeAlgorithm(slackNode_));
   }
 
-  networkManager_.onNode(algo::MainConnexComponentAlgorithm(mainConnexNodes_));
-  networkManager_.onNode(algo::LinesByIdAlgorithm(linesById_));
-  networkManager_.onNode(algo::TransformersByIdAlgorithm(tfosById_));
-
   if (dynamicDataBaseAssemblingContainsSVC()) {
     if (!config_.defaultValueModified("StopTime"))
       config_.setStopTime(config_.getStartTime() + 2000);
@@ -83,10 +115,96 @@ Context::Context(const ContextDef &def, inputs::Configuration &config, std::unor
   }
 }
 
+template<class Visitor>
+void Context::walkNodesMain(Visitor &&visitor) {
+#if defined(_DEBUG_) || defined(PRINT_TIMERS)
+  DYN::Timer timer("DFL::Context::walkNodesMain()");
+#endif
+  for (const auto &node : mainConnexNodes_) {
+    visitor(node, algoResults_);
+  }
+}
+
+void Context::walkNodesMainDefinitions(algo::DynModelAlgorithm &dynModelAlgorithm) {
+#if defined(_DEBUG_) || defined(PRINT_TIMERS)
+  DYN::Timer timer("DFL::Context::walkNodesMainDefinitions()");
+#endif
+  const std::size_t nbNodes = mainConnexNodes_.size();
+  const std::size_t nbChunks = std::max<std::size_t>(1, std::min<std::size_t>(config_.getNbThreads(), nbNodes));
+  const std::size_t chunkSize = nbNodes / nbChunks + (nbNodes % nbChunks == 0 ? 0 : 1);
+
+  // the first chunk of nodes directly updates the definitions of the context, the other ones fill their own definitions
+  // generators with the same reactive diagram share it, whatever the chunk they belong to
+  // workers only read the network tree, whose bus connections are resolved while it is built, and the macro connections shared by the algorithms
+  algo::ReactiveDiagramPool diagrams;
+  std::vector<MainComponentDefinitions> chunksDefinitions(nbChunks - 1);
+  std::vector<std::thread> workers;
+  workers.reserve(chunksDefinitions.size());
+  for (std::size_t chunk = 1; chunk < nbChunks; ++chunk) {
+    workers.emplace_back([this, &chunksDefinitions, &diagrams, &dynModelAlgorithm, chunk, chunkSize, nbNodes]() {
+      auto &definitions = chunksDefinitions[chunk - 1];
+      algo::DynModelAlgorithm chunkDynModelAlgorithm(dynModelAlgorithm, definitions.dynamicModels);
+      walkNodesMainRange(chunk * chunkSize, std::min(nbNodes, (chunk + 1) * chunkSize), definitions.generators, definitions.loads,
+                         definitions.staticVarCompensators, definitions.counters, diagrams, chunkDynModelAlgorithm, definitions.algoResults);
+    });
+  }
+  walkNodesMainRange(0, std::min(nbNodes, chunkSize), generators_, loads_, staticVarCompensators_, counters_, diagrams, dynModelAlgorithm, algoResults_);
+  for (auto &worker : workers) {
+    worker.join();
+  }
+
+  // definitions are merged following the order of the nodes, so that they are the same whatever the number of threads
+  for (const auto &definitions : chunksDefinitions) {
+    // definitions are not assignable: they are appended one by one
+    std::copy(definitions.generators.begin(), definitions.generators.end(), std::back_inserter(generators_));
+    std::copy(definitions.loads.begin(), definitions.loads.end(), std::back_inserter(loads_));
+    std::copy(definitions.staticVarCompensators.begin(), definitions.staticVarCompensators.end(), std::back_inserter(staticVarCompensators_));
+    for (const auto &nbShunts : definitions.counters.nbShunts) {
+      counters_.nbShunts[nbShunts.first] += nbShunts.second;
+    }
+    for (const auto &model : definitions.dynamicModels.models) {
+      auto found = dynamicModels_.models.find(model.first);
+      if (found == dynamicModels_.models.end()) {
+        dynamicModels_.models.insert(model);
+      } else {
+        found->second.nodeConnections.insert(model.second.nodeConnections.begin(), model.second.nodeConnections.end());
+      }
+    }
+    // macro connectors are exported sorted by id, whatever the order of this set
+    const auto &usedMacroConnections = definitions.dynamicModels.usedMacroConnections;
+    dynamicModels_.usedMacroConnections.insert(usedMacroConnections.begin(), usedMacroConnections.end());
+    if (definitions.algoResults->isAtLeastOneGeneratorRegulating) {
+      algoResults_->isAtLeastOneGeneratorRegulating = true;
+    }
+  }
+}
+
+void Context::walkNodesMainRange(std::size_t first, std::size_t last, std::vector<algo::GeneratorDefinition> &generators,
+                                 std::vector<algo::LoadDefinition> &loads, std::vector<algo::StaticVarCompensatorDefinition> &staticVarCompensators,
+                                 algo::ShuntCounterDefinitions &counters, algo::ReactiveDiagramPool &diagrams,
+                                 algo::DynModelAlgorithm &dynModelAlgorithm, std::shared_ptr<algo::AlgorithmsResults> &algoResults) const {
+  algo::OptionalAlgorithm<algo::ShuntCounterAlgorithm> shuntCounterAlgorithm;
+  if (config_.isShuntRegulationOn()) {
+    shuntCounterAlgorithm.emplace(counters);
+  }
+  algo::OptionalAlgorithm<algo::StaticVarCompensatorAlgorithm> staticVarCompensatorAlgorithm;
+  if (config_.isSVarCRegulationOn()) {
+    staticVarCompensatorAlgorithm.emplace(staticVarCompensators);
+  }
+  // the algorithms are applied on each node in the order of the pipeline
+  auto visitor = algo::makeNodeVisitor(shuntCounterAlgorithm,
+                                       algo::GeneratorDefinitionAlgorithm(generators, networkManager_.getBusRegulationMap(), dynamicDataBaseManager_,
+                                                                          config_.useInfiniteReactiveLimits(), config_.getTfoVoltageLevel(), diagrams),
+                                       algo::LoadDefinitionAlgorithm(loads, config_.getDsoVoltageLevel(), config_.isRestorativeFictitiousLoads()),
+                                       std::ref(dynModelAlgorithm), staticVarCompensatorAlgorithm);
+  for (auto i = first; i < last; ++i) {
+    visitor(mainConnexNodes_[i], algoResults);
+  }
+}
+
 bool Context::checkConnexity() const {
   // The slack node must be in the main connex component
-  return std::find_if(mainConnexNodes_.begin(), mainConnexNodes_.end(),
-                      [this](const std::shared_ptr<inputs::Node> &node) { return node->id == slackNode_->id; }) != mainConnexNodes_.end();
+  return connexComponents_->isInMainComponent(*slackNode_);
 }
 
 bool Context::process() {
@@ -94,7 +212,14 @@ bool Context::process() {
   DYN::Timer timer("DFL::Context::process()");
 #endif
   // Process all algorithms on nodes
-  networkManager_.walkNodes();
+  algo::OptionalAlgorithm<algo::SlackNodeAlgorithm> slackNodeAlgorithm;
+  if (slackNodeOrigin_ == SlackNodeOrigin::ALGORITHM) {
+    slackNodeAlgorithm.emplace(slackNode_, networkManager_.graph());
+  }
+  networkManager_.walkNodes(algo::makeNodeVisitor(slackNodeAlgorithm, algo::LinesByIdAlgorithm(linesById_, networkManager_.graph()),
+                                                  algo::TransformersByIdAlgorithm(tfosById_, networkManager_.graph())));
+  connexComponents_.emplace(networkManager_.graph(), config_.getNbThreads());
+  mainConnexNodes_ = connexComponents_->mainComponentNodes();
 
   if (!slackNode_) {
     throw DFLError(SlackNodeNotFound, basename_);
@@ -108,37 +233,35 @@ bool Context::process() {
       LOG(warn, ConnexityErrorReCompute, slackNode_->id);
       // Compute slack node only on main connex component
       slackNode_.reset();
-      std::for_each(mainConnexNodes_.begin(), mainConnexNodes_.end(), algo::SlackNodeAlgorithm(slackNode_));
+      std::for_each(mainConnexNodes_.begin(), mainConnexNodes_.end(), algo::SlackNodeAlgorithm(slackNode_, networkManager_.graph()));
 
       // By construction, the new slack node is in the main connex component
       LOG(info, SlackNode, slackNode_->id, static_cast<unsigned int>(slackNodeOrigin_));
     }
   }
 
-  if (config_.isShuntRegulationOn()) {
-    onNodeOnMainConnexComponent(algo::ShuntCounterAlgorithm(counters_));
-  }
-  onNodeOnMainConnexComponent(algo::GeneratorDefinitionAlgorithm(generators_, networkManager_.getBusRegulationMap(), dynamicDataBaseManager_,
-                                                                 config_.useInfiniteReactiveLimits(), config_.getTfoVoltageLevel()));
-  onNodeOnMainConnexComponent(algo::LoadDefinitionAlgorithm(loads_, config_.getDsoVoltageLevel(), config_.isRestorativeFictitiousLoads()));
-  onNodeOnMainConnexComponent(algo::HVDCDefinitionAlgorithm(hvdcLineDefinitions_, networkManager_.getBusRegulationMap(), config_.useInfiniteReactiveLimits(),
-                                                            networkManager_.computeVSCConverters(), dynamicDataBaseManager_));
-  onNodeOnMainConnexComponent(algo::DynModelAlgorithm(dynamicModels_, dynamicDataBaseManager_, config_.isShuntRegulationOn()));
-
-  if (config_.isSVarCRegulationOn()) {
-    onNodeOnMainConnexComponent(algo::StaticVarCompensatorAlgorithm(staticVarCompensators_));
-  }
-
+  algo::OptionalAlgorithm<algo::ContingencyValidationAlgorithmOnNodes> contingencyValidationAlgorithm;
+  algo::OptionalAlgorithm<algo::ContingencyCostAlgorithm> contingencyCostAlgorithm;
   if (def_.simulationKind == dfl::inputs::Configuration::SimulationKind::SECURITY_ANALYSIS) {
     const auto &contingencies = contingenciesManager_.get();
     if (!contingencies.empty()) {
       validContingencies_ = boost::make_optional(algo::ValidContingencies(contingencies));
-      onNodeOnMainConnexComponent(algo::ContingencyValidationAlgorithmOnNodes(*validContingencies_));
+      contingencyValidationAlgorithm.emplace(*validContingencies_, networkManager_.graph());
+      contingencyCosts_ = boost::make_optional(algo::ContingencyCosts(contingencies));
+      contingencyCostAlgorithm.emplace(*contingencyCosts_, networkManager_.graph());
     }
   }
-  walkNodesMain();
-
-  algo::DynModelFilterAlgorithm dynModelFilterAlgorithm(dynamicDataBaseManager_.assembling(), generators_, hvdcLineDefinitions_, dynamicModels_.models);
+  // HVDC lines and contingencies definitions gather information from several nodes: these algorithms always run on a single thread
+  walkNodesMain(algo::makeNodeVisitor(algo::HVDCDefinitionAlgorithm(hvdcLineDefinitions_, networkManager_.getBusRegulationMap(),
+                                                                    config_.useInfiniteReactiveLimits(), networkManager_.computeVSCConverters(),
+                                                                    dynamicDataBaseManager_, networkManager_.graph()),
+                                      contingencyValidationAlgorithm, contingencyCostAlgorithm));
+  algo::DynModelAlgorithm dynModelAlgorithm(dynamicModels_, dynamicDataBaseManager_, config_.isShuntRegulationOn(), networkManager_.graph());
+  walkNodesMainDefinitions(dynModelAlgorithm);
+  definitionsIndex_ = algo::DefinitionsIndex(generators_, loads_, staticVarCompensators_, hvdcLineDefinitions_, linesById_, tfosById_);
+
+  algo::DynModelFilterAlgorithm dynModelFilterAlgorithm(dynamicDataBaseManager_.assembling(), generators_, definitionsIndex_, hvdcLineDefinitions_,
+                                                        dynamicModels_.models);
   dynModelFilterAlgorithm.filter();
 
   // the validation of contingencies on algorithm definitions must be done after walking all nodes
@@ -165,44 +288,70 @@ void Context::exportOutputs() {
 #endif
   LOG(info, ExportInfo, basename_);
 
-  // Job
-  exportOutputJob();
-
   // Only the root process is allowed to export files
   auto &mpiContext = DYNAlgorithms::multiprocessing::context();
+  if (mpiContext.isRootProc()) {
+    // the writers do not depend on each other: they are run concurrently, each one only reading the definitions of the context
+    std::vector<std::pair<std::string, std::function<void()>>> writers;
+
+    // Dyd
+    file::path dydOutput(config_.outputDir());
+    dydOutput.append(basename_ + ".dyd");
+    writers.emplace_back(dydOutput.filename().generic_string(), [this, &dydOutput]() {
+      outputs::Dyd dydWriter(outputs::Dyd::DydDefinition(basename_, dydOutput.generic_string(), generators_, loads_, slackNode_, hvdcLineDefinitions_,
+                                                         networkManager_.getBusRegulationMap(), dynamicDataBaseManager_, dynamicModels_,
+                                                         staticVarCompensators_));
+      dydWriter.write();
+    });
+
+    // create Network.par
+    file::path networkOutput(config_.outputDir());
+    networkOutput.append("Network.par");
+    writers.emplace_back(networkOutput.filename().generic_string(), [this, &networkOutput]() {
+      outputs::Network networkWriter(outputs::Network::NetworkDefinition(networkOutput, config_.getStartingPointMode()));
+      networkWriter.write();
+    });
+
+    // create specific par
+    file::path parOutput(config_.outputDir());
+    parOutput.append(basename_ + ".par");
+    writers.emplace_back(parOutput.filename().generic_string(), [this, &parOutput]() {
+      outputs::Par parWriter(outputs::Par::ParDefinition(basename_, config_, parOutput, generators_, hvdcLineDefinitions_,
+                                                         networkManager_.getBusRegulationMap(), dynamicDataBaseManager_, counters_, dynamicModels_,
+                                                         definitionsIndex_, staticVarCompensators_, loads_));
+      parWriter.write();
+    });
+
+    // Diagram
+    file::path diagramDirectory(config_.outputDir());
+    diagramDirectory.append(basename_ + common::constants::diagramDirectorySuffix);
+    writers.emplace_back(diagramDirectory.filename().generic_string(), [this, &diagramDirectory]() {
+      outputs::Diagram diagramWriter(
+          outputs::Diagram::DiagramDefinition(basename_, diagramDirectory.generic_string(), generators_, hvdcLineDefinitions_, config_.useSingleDiagramFile()));
+      diagramWriter.write();
+    });
+
+    writers.emplace_back(outputs::constants::solverParFileName, [this]() {
+      outputs::Solver solverWriter{dfl::outputs::Solver::SolverDefinition(config_)};
+      solverWriter.write();
+    });
+
+    std::vector<std::function<void()>> tasks;
+    for (const auto &writer : writers) {
+      tasks.push_back(writer.second);
+    }
+    // all the files are written before the job refers to them, timings are logged in the order of the writers whatever the threads
+    const auto durations = common::runTasks(tasks, config_.getNbThreads());
+    for (std::size_t i = 0; i < writers.size(); ++i) {
+      LOG(debug, ExportFileEnd, writers[i].first, durations[i]);
+    }
+  }
+
+  // Job
+  exportOutputJob();
   if (!mpiContext.isRootProc())
     return;
 
-  // Dyd
-  file::path dydOutput(config_.outputDir());
-  dydOutput.append(basename_ + ".dyd");
-  outputs::Dyd dydWriter(outputs::Dyd::DydDefinition(basename_, dydOutput.generic_string(), generators_, loads_, slackNode_, hvdcLineDefinitions_,
-                                                     networkManager_.getBusRegulationMap(), dynamicDataBaseManager_, dynamicModels_, staticVarCompensators_));
-  dydWriter.write();
-
-  // create Network.par
-  file::path networkOutput(config_.outputDir());
-  networkOutput.append("Network.par");
-  outputs::Network networkWriter(outputs::Network::NetworkDefinition(networkOutput, config_.getStartingPointMode()));
-  networkWriter.write();
-
-  // create specific par
-  file::path parOutput(config_.outputDir());
-  parOutput.append(basename_ + ".par");
-  outputs::Par parWriter(outputs::Par::ParDefinition(basename_, config_, parOutput, generators_, hvdcLineDefinitions_, networkManager_.getBusRegulationMap(),
-                                                     dynamicDataBaseManager_, counters_, dynamicModels_, linesById_, tfosById_, staticVarCompensators_,
-                                                     loads_));
-  parWriter.write();
-
-  // Diagram
-  file::path diagramDirectory(config_.outputDir());
-  diagramDirectory.append(basename_ + common::constants::diagramDirectorySuffix);
-  outputs::Diagram diagramWriter(outputs::Diagram::DiagramDefinition(basename_, diagramDirectory.generic_string(), generators_, hvdcLineDefinitions_));
-  diagramWriter.write();
-
-  outputs::Solver solverWriter{dfl::outputs::Solver::SolverDefinition(config_)};
-  solverWriter.write();
-
   if (def_.simulationKind == dfl::inputs::Configuration::SimulationKind::SECURITY_ANALYSIS) {
     exportOutputsContingencies();
   }
@@ -234,39 +383,58 @@ void Context::exportOutputJob() {
 
 void Context::exportOutputsContingencies() {
   if (validContingencies_) {
-    for (const auto &contingency : validContingencies_->get()) {
-      exportOutputsContingency(contingency, validContingencies_->getNetworkElements());
+    // the event files of all the contingencies are stamped from the same templates, built once
+    const outputs::EventTemplates eventTemplates(config_.getTimeOfEvent());
+    const auto &networkElements = validContingencies_->getNetworkElements();
+    const auto &contingencies = validContingencies_->get();
+    std::vector<std::function<void()>> tasks;
+    tasks.reserve(contingencies.size() + 1);
+    if (config_.useSingleEventsParFile()) {
+      // the parameter sets of the events of all the contingencies are gathered in a single PAR file, referred to by every DYD
+      file::path eventsPar(config_.outputDir());
+      eventsPar.append(basename_ + outputs::constants::eventsParSuffix + ".par");
+      tasks.push_back([&eventTemplates, eventsPar, &contingencies, &networkElements]() {
+        eventTemplates.writeEventsPar(eventsPar.generic_string(), contingencies, networkElements);
+      });
     }
+    for (const auto &contingency : contingencies) {
+      tasks.push_back([this, &eventTemplates, &contingency, &networkElements]() { exportOutputsContingency(contingency, networkElements, eventTemplates); });
+    }
+    common::runTasks(tasks, config_.getNbThreads());
+
+#if _DEBUG_
+    // A JOBS file for every contingency is produced only in DEBUG mode
+    for (const auto &contingency : contingencies) {
+      const auto &basenameEvent = basename_ + "-" + contingency.id;
+      outputs::Job jobEventWriter(outputs::Job::JobDefinition(basenameEvent, def_.dynawoLogLevel, config_, contingency.id, basename_));
+      std::shared_ptr<job::JobEntry> jobEvent = jobEventWriter.write();
+      jobsEvents_.emplace_back(jobEvent);
+      outputs::Job::exportJob(jobEvent, absolute(def_.networkFilepath), config_);
+    }
+#endif
   }
 }
 
-void Context::exportOutputsContingency(const inputs::Contingency &contingency, const std::unordered_set<std::string> &networkElements) {
-  // Prepare a DYD, PAR and JOBS for every contingency
+void Context::exportOutputsContingency(const inputs::Contingency &contingency, const std::unordered_set<std::string> &networkElements,
+                                       const outputs::EventTemplates &eventTemplates) const {
+  // Prepare a DYD and a PAR for every contingency
   // The DYD and PAR contain the definition of the events of the contingency
 
   // Basename of event-related DYD, PAR and JOBS files
   const auto &basenameEvent = basename_ + "-" + contingency.id;
 
   // Specific DYD for contingency
+  const std::string parBasename = config_.useSingleEventsParFile() ? basename_ + outputs::constants::eventsParSuffix : basenameEvent;
   file::path dydEvent(config_.outputDir());
   dydEvent.append(basenameEvent + ".dyd");
-  outputs::DydEvent dydEventWriter(outputs::DydEvent::DydEventDefinition(basenameEvent, dydEvent.generic_string(), contingency, networkElements));
-  dydEventWriter.write();
+  eventTemplates.writeDyd(parBasename, dydEvent.generic_string(), contingency, networkElements);
 
-  // Specific PAR for contingency
-  file::path parEvent(config_.outputDir());
-  parEvent.append(basenameEvent + ".par");
-  outputs::ParEvent parEventWriter(
-      outputs::ParEvent::ParEventDefinition(basenameEvent, parEvent.generic_string(), contingency, networkElements, config_.getTimeOfEvent()));
-  parEventWriter.write();
-
-#if _DEBUG_
-  // A JOBS file for every contingency is produced only in DEBUG mode
-  outputs::Job jobEventWriter(outputs::Job::JobDefinition(basenameEvent, def_.dynawoLogLevel, config_, contingency.id, basename_));
-  std::shared_ptr<job::JobEntry> jobEvent = jobEventWriter.write();
-  jobsEvents_.emplace_back(jobEvent);
-  outputs::Job::exportJob(jobEvent, absolute(def_.networkFilepath), config_);
-#endif
+  // Specific PAR for contingency, unless the parameter sets of all the contingencies are written in a single file
+  if (!config_.useSingleEventsParFile()) {
+    file::path parEvent(config_.outputDir());
+    parEvent.append(basenameEvent + ".par");
+    eventTemplates.writePar(parEvent.generic_string(), contingency, networkElements);
+  }
 }
 
 void Context::execute() {
@@ -338,12 +506,76 @@ void Context::execute() {
 }
 
 void Context::executeSecurityAnalysis() {
+  // results of scenarios are only reused or checkpointed when the outputs are written in the output directory
+  const bool useResultCache = validContingencies_ && !def_.resultCacheDir.empty();
+  const bool useJournal = validContingencies_ && (def_.checkpointInterval > 0 || def_.resume);
+  if (def_.outputIsZip) {
+    if (useResultCache) {
+      LOG(warn, ResultCacheDisabledWithArchive);
+    }
+    if (useJournal) {
+      LOG(warn, CheckpointDisabledWithArchive);
+    }
+  } else if (useResultCache || useJournal) {
+    reuseScenarioResults(useResultCache);
+  }
+
+  auto &mpiContext = DYNAlgorithms::multiprocessing::context();
+  const bool checkpoint = useJournal && !def_.outputIsZip;
+  boost::optional<outputs::ScenarioJournal> journal;
+  if (mpiContext.isRootProc() && !def_.outputIsZip) {
+    const file::path journalPath = file::path(config_.outputDir()) / outputs::constants::journalFileName;
+    if (checkpoint) {
+      journal.emplace(journalPath);
+      // the results reused are journaled again, so that this run can be resumed as well
+      const auto &contingencies = validContingencies_->get();
+      for (std::size_t i = 0; i < contingencies.size(); ++i) {
+        if (scenarioStatuses_[i] == ScenarioStatus::CACHE_RESTORED || scenarioStatuses_[i] == ScenarioStatus::RESUMED) {
+          journal->append({contingencies[i].id, scenarioKeys_[i], scenarioResults_[i]});
+        }
+      }
+    } else {
+      // the journal of a previous run no longer matches the outputs of this run
+      file::remove(journalPath);
+    }
+  }
+
+  const auto order = scenariosOrder();
+  // batches of whole rounds keep the scenario submitted at position k on the process k modulo the number of processes
+  const std::size_t nbProcs = mpiContext.nbProcs();
+  std::size_t batchSize = order.size();
+  if (checkpoint && def_.checkpointInterval > 0) {
+    batchSize = (def_.checkpointInterval + nbProcs - 1) / nbProcs * nbProcs;
+  }
+  std::size_t first = 0;
+  do {
+    const std::size_t last = std::min(first + batchSize, order.size());
+    launchScenarios(order, first, last);
+    if (journal && last > first) {
+      checkpointScenarios(*journal, order, first, last);
+    }
+    first = last;
+  } while (first < order.size());
+
+  if (mpiContext.isRootProc()) {
+    if (std::any_of(scenarioResults_.begin(), scenarioResults_.end(), [](const std::string &result) { return !result.empty(); })) {
+      mergeScenarioResults();
+    }
+    if (resultCache_) {
+      updateResultCache();
+    }
+  }
+}
+
+void Context::launchScenarios(const std::vector<std::size_t> &order, std::size_t first, std::size_t last) {
   // For security analysis we run multiple simulations using dynawo-algorithms
   // Create one scenario for the base case and one scenario for each contingency
   auto scenarios = boost::make_shared<DYNAlgorithms::Scenarios>();
   scenarios->setJobsFile(jobEntry_->getName() + ".jobs");
   if (validContingencies_) {
-    for (const auto &contingencyRef : validContingencies_->get()) {
+    const auto &contingencies = validContingencies_->get();
+    for (std::size_t i = first; i < last; ++i) {
+      const auto &contingencyRef = contingencies[order[i]];
       auto scenario = boost::make_shared<DYNAlgorithms::Scenario>();
       scenario->setId(contingencyRef.id);
       scenario->setDydFile(basename_ + "-" + contingencyRef.id + ".dyd");
@@ -367,6 +599,296 @@ void Context::executeSecurityAnalysis() {
   saLauncher->writeResults();
 }
 
+void Context::reuseScenarioResults(bool useResultCache) {
+  const auto &contingencies = validContingencies_->get();
+  scenarioStatuses_.assign(contingencies.size(), ScenarioStatus::SIMULATED);
+  auto &mpiContext = DYNAlgorithms::multiprocessing::context();
+  if (mpiContext.isRootProc()) {
+    scenarioResults_.assign(contingencies.size(), "");
+    computeScenarioKeys();
+    if (def_.resume) {
+      resumeScenarios();
+    }
+    if (useResultCache) {
+      restoreCachedScenarios();
+    }
+  }
+#if defined(_MPI_)
+  // the scenarios resumed or restored by the root process are not submitted by any process
+  MPI_Bcast(scenarioStatuses_.data(), static_cast<int>(scenarioStatuses_.size()), MPI_CHAR, 0, MPI_COMM_WORLD);
+#endif
+}
+
+void Context::computeScenarioKeys() {
+  const auto &contingencies = validContingencies_->get();
+  // the result of a scenario depends on the whole network and on all the dynamic models, parameters and simulation settings
+  const file::path outputDir(config_.outputDir());
+  std::vector<file::path> commonInputs{def_.networkFilepath};
+  for (const auto &filepath : {config_.startingDumpFilePath(), config_.criteriaFilePath()}) {
+    if (!filepath.empty()) {
+      commonInputs.push_back(filepath);
+    }
+  }
+  std::vector<file::path> commonGeneratedInputs{outputDir / (basename_ + ".dyd"), outputDir / (basename_ + ".par"), outputDir / "Network.par",
+                                                outputDir / outputs::constants::solverParFileName, outputDir / (jobEntry_->getName() + ".jobs")};
+  const file::path diagramDirectory = outputDir / (basename_ + common::constants::diagramDirectorySuffix);
+  if (file::is_directory(diagramDirectory)) {
+    std::vector<file::path> diagrams((file::directory_iterator(diagramDirectory)), file::directory_iterator());
+    std::sort(diagrams.begin(), diagrams.end());
+    commonGeneratedInputs.insert(commonGeneratedInputs.end(), diagrams.begin(), diagrams.end());
+  }
+  if (config_.useSingleEventsParFile()) {
+    commonGeneratedInputs.push_back(outputDir / (basename_ + outputs::constants::eventsParSuffix + ".par"));
+  }
+  // the generated files refer to these paths, which may change between runs whose scenarios have the same results
+  const std::vector<std::string> locations{outputDir.generic_string(), file::absolute(outputDir).generic_string(),
+                                           file::absolute(def_.networkFilepath).generic_string(), config_.startingDumpFilePath().generic_string(),
+                                           config_.criteriaFilePath().generic_string()};
+  const outputs::ScenarioKeys keys(commonInputs, commonGeneratedInputs, locations);
+
+  scenarioKeys_.clear();
+  scenarioKeys_.reserve(contingencies.size());
+  for (const auto &contingency : contingencies) {
+    const auto &basenameEvent = basename_ + "-" + contingency.id;
+    std::vector<file::path> scenarioInputs{outputDir / (basenameEvent + ".dyd")};
+    if (!config_.useSingleEventsParFile()) {
+      scenarioInputs.push_back(outputDir / (basenameEvent + ".par"));
+    }
+    scenarioKeys_.push_back(keys.compute(scenarioInputs));
+  }
+}
+
+void Context::resumeScenarios() {
+  const auto &contingencies = validContingencies_->get();
+  const file::path journalPath = file::path(config_.outputDir()) / outputs::constants::journalFileName;
+  if (!file::exists(journalPath)) {
+    LOG(warn, ScenarioJournalNotFound, journalPath.generic_string());
+    return;
+  }
+  std::unordered_map<std::string, std::size_t> positions;
+  for (std::size_t i = 0; i < contingencies.size(); ++i) {
+    positions[contingencies[i].id] = i;
+  }
+  std::size_t nbResumed = 0;
+  for (const auto &entry : outputs::ScenarioJournal::read(journalPath)) {
+    auto found = positions.find(entry.id);
+    // the result of a scenario whose inputs changed since the interrupted run is not reused
+    if (found == positions.end() || scenarioKeys_[found->second] != entry.key || scenarioStatuses_[found->second] != ScenarioStatus::SIMULATED) {
+      continue;
+    }
+    scenarioStatuses_[found->second] = ScenarioStatus::RESUMED;
+    scenarioResults_[found->second] = entry.result;
+    ++nbResumed;
+  }
+  LOG(info, ScenariosResumed, nbResumed, contingencies.size(), journalPath.generic_string());
+}
+
+void Context::restoreCachedScenarios() {
+  const auto &contingencies = validContingencies_->get();
+  const file::path outputDir(config_.outputDir());
+  resultCache_.emplace(def_.resultCacheDir, def_.resultCacheMaxSize);
+  for (std::size_t i = 0; i < contingencies.size(); ++i) {
+    if (scenarioStatuses_[i] != ScenarioStatus::SIMULATED || !resultCache_->contains(scenarioKeys_[i])) {
+      continue;
+    }
+    scenarioStatuses_[i] = ScenarioStatus::CACHE_FOUND;
+    if (!def_.resultCacheDryRun && resultCache_->restore(scenarioKeys_[i], outputDir, contingencies[i].id, scenarioResults_[i])) {
+      scenarioStatuses_[i] = ScenarioStatus::CACHE_RESTORED;
+    }
+  }
+
+  const auto nbFound = std::count_if(scenarioStatuses_.begin(), scenarioStatuses_.end(), [](ScenarioStatus status) {
+    return status == ScenarioStatus::CACHE_FOUND || status == ScenarioStatus::CACHE_RESTORED;
+  });
+  if (def_.resultCacheDryRun) {
+    const double hitRate = contingencies.empty() ? 0. : static_cast<double>(nbFound) * 100. / static_cast<double>(contingencies.size());
+    LOG(info, ResultCacheDryRun, nbFound, contingencies.size(), def_.resultCacheDir.generic_string(), hitRate);
+  } else {
+    const auto nbRestored = std::count(scenarioStatuses_.begin(), scenarioStatuses_.end(), ScenarioStatus::CACHE_RESTORED);
+    LOG(info, ResultCacheHits, nbRestored, contingencies.size(), def_.resultCacheDir.generic_string());
+  }
+}
+
+/**
+ * @brief Read an attribute of an XML element
+ *
+ * @param node the element
+ * @param name the name of the attribute
+ * @returns the value of the attribute, empty if the element has no such attribute
+ */
+static std::string
+xmlAttribute(xmlNodePtr node, const char *name) {
+  xmlChar *value = xmlGetProp(node, reinterpret_cast<const xmlChar *>(name));
+  if (!value) {
+    return "";
+  }
+  std::string result(reinterpret_cast<const char *>(value));
+  xmlFree(value);
+  return result;
+}
+
+/**
+ * @brief Write an XML element and its descendants
+ *
+ * @param doc the document of the element
+ * @param node the element
+ * @returns the element, as XML text
+ */
+static std::string
+xmlElementText(xmlDocPtr doc, xmlNodePtr node) {
+  std::unique_ptr<xmlBuffer, void (*)(xmlBufferPtr)> buffer(xmlBufferCreate(), &xmlBufferFree);
+  xmlNodeDump(buffer.get(), doc, node, 0, 1);
+  return reinterpret_cast<const char *>(xmlBufferContent(buffer.get()));
+}
+
+/// @brief Aggregated results of the security analysis written by dynawo-algorithms
+struct AggregatedResults {
+  std::unique_ptr<xmlDoc, void (*)(xmlDocPtr)> doc;           ///< document of the aggregated results
+  std::unordered_map<std::string, xmlNodePtr> scenarioNodes;  ///< elements of the results of the scenarios by scenario id
+};
+
+/**
+ * @brief Read the aggregated results of the security analysis
+ *
+ * @param filepath the aggregated results file path
+ * @returns the aggregated results
+ */
+static AggregatedResults
+readAggregatedResults(const std::string &filepath) {
+  AggregatedResults aggregatedResults{std::unique_ptr<xmlDoc, void (*)(xmlDocPtr)>(xmlReadFile(filepath.c_str(), nullptr, XML_PARSE_NOBLANKS), &xmlFreeDoc),
+                                      {}};
+  xmlNodePtr root = aggregatedResults.doc ? xmlDocGetRootElement(aggregatedResults.doc.get()) : nullptr;
+  if (!root) {
+    throw DFLError(AggregatedResultsReadFailed, filepath);
+  }
+  for (xmlNodePtr node = root->children; node; node = node->next) {
+    if (node->type == XML_ELEMENT_NODE && xmlStrEqual(node->name, reinterpret_cast<const xmlChar *>("scenarioResults"))) {
+      aggregatedResults.scenarioNodes[xmlAttribute(node, "id")] = node;
+    }
+  }
+  return aggregatedResults;
+}
+
+void Context::checkpointScenarios(outputs::ScenarioJournal &journal, const std::vector<std::size_t> &order, std::size_t first, std::size_t last) {
+  const auto &contingencies = validContingencies_->get();
+  const file::path outputDir(config_.outputDir());
+  const auto aggregatedResults = readAggregatedResults((outputDir / "aggregatedResults.xml").generic_string());
+  for (std::size_t i = first; i < last; ++i) {
+    const std::size_t position = order[i];
+    auto found = aggregatedResults.scenarioNodes.find(contingencies[position].id);
+    if (found == aggregatedResults.scenarioNodes.end()) {
+      continue;
+    }
+    scenarioResults_[position] = xmlElementText(aggregatedResults.doc.get(), found->second);
+    // a scenario whose simulation could not be run is simulated again when resuming
+    if (xmlAttribute(found->second, "status") != "EXECUTION_PROBLEM") {
+      journal.append({contingencies[position].id, scenarioKeys_[position], scenarioResults_[position]});
+    }
+  }
+  LOG(info, ScenariosCheckpointed, last, order.size(), (outputDir / outputs::constants::journalFileName).generic_string());
+}
+
+void Context::mergeScenarioResults() {
+  const auto &contingencies = validContingencies_->get();
+  const std::string aggregatedResultsPath = (file::path(config_.outputDir()) / "aggregatedResults.xml").generic_string();
+  auto aggregatedResults = readAggregatedResults(aggregatedResultsPath);
+  xmlDocPtr doc = aggregatedResults.doc.get();
+  auto &resultNodes = aggregatedResults.scenarioNodes;
+  for (std::size_t i = 0; i < contingencies.size(); ++i) {
+    const std::string &result = scenarioResults_[i];
+    if (result.empty() || resultNodes.count(contingencies[i].id) > 0) {
+      continue;
+    }
+    std::unique_ptr<xmlDoc, void (*)(xmlDocPtr)> reused(xmlReadMemory(result.data(), static_cast<int>(result.size()), nullptr, nullptr, XML_PARSE_NOBLANKS),
+                                                        &xmlFreeDoc);
+    xmlNodePtr reusedRoot = reused ? xmlDocGetRootElement(reused.get()) : nullptr;
+    if (!reusedRoot) {
+      throw DFLError(ScenarioResultReadFailed, contingencies[i].id);
+    }
+    xmlNodePtr node = xmlDocCopyNode(reusedRoot, doc, 1);
+    // a result restored from the result cache may come from another scenario of the same inputs
+    xmlSetProp(node, reinterpret_cast<const xmlChar *>("id"), reinterpret_cast<const xmlChar *>(contingencies[i].id.c_str()));
+    resultNodes[contingencies[i].id] = node;
+  }
+  // the results are written in the order of the contingencies, whatever the scenarios simulated, restored or resumed
+  xmlNodePtr root = xmlDocGetRootElement(doc);
+  for (const auto &contingency : contingencies) {
+    auto found = resultNodes.find(contingency.id);
+    if (found != resultNodes.end()) {
+      xmlUnlinkNode(found->second);
+      xmlAddChild(root, found->second);
+    }
+  }
+  if (xmlSaveFormatFileEnc(aggregatedResultsPath.c_str(), doc, "ISO-8859-1", 1) < 0) {
+    throw DFLError(FileCreationFailed, aggregatedResultsPath);
+  }
+}
+
+void Context::updateResultCache() {
+  const auto &contingencies = validContingencies_->get();
+  const file::path outputDir(config_.outputDir());
+  const auto aggregatedResults = readAggregatedResults((outputDir / "aggregatedResults.xml").generic_string());
+  const auto &resultNodes = aggregatedResults.scenarioNodes;
+
+  // the results of the simulated scenarios are stored, unless their simulation could not be run
+  std::unordered_set<std::string> storedIds;
+  for (std::size_t i = 0; i < contingencies.size(); ++i) {
+    auto found = resultNodes.find(contingencies[i].id);
+    if (scenarioStatuses_[i] == ScenarioStatus::SIMULATED && found != resultNodes.end() && xmlAttribute(found->second, "status") != "EXECUTION_PROBLEM") {
+      storedIds.insert(contingencies[i].id);
+    }
+  }
+  const auto outputFiles = outputs::ScenarioResultCache::listOutputFiles(outputDir, storedIds);
+  for (std::size_t i = 0; i < contingencies.size(); ++i) {
+    if (storedIds.count(contingencies[i].id) == 0) {
+      continue;
+    }
+    auto files = outputFiles.find(contingencies[i].id);
+    resultCache_->store(scenarioKeys_[i], xmlElementText(aggregatedResults.doc.get(), resultNodes.at(contingencies[i].id)), outputDir, contingencies[i].id,
+                        files != outputFiles.end() ? files->second : std::vector<file::path>());
+  }
+  resultCache_->evict();
+}
+
+std::vector<std::size_t> Context::scenariosOrder() const {
+  std::vector<std::size_t> order;
+  if (!validContingencies_) {
+    return order;
+  }
+  const auto &contingencies = validContingencies_->get();
+  std::vector<std::size_t> simulated;
+  for (std::size_t i = 0; i < contingencies.size(); ++i) {
+    if (scenarioStatuses_.empty() || scenarioStatuses_[i] == ScenarioStatus::SIMULATED || scenarioStatuses_[i] == ScenarioStatus::CACHE_FOUND) {
+      simulated.push_back(i);
+    }
+  }
+  if (!config_.isCostBasedScenarioOrderingOn()) {
+    return simulated;
+  }
+
+  order.resize(simulated.size());
+  auto &mpiContext = DYNAlgorithms::multiprocessing::context();
+  if (mpiContext.isRootProc()) {
+    std::vector<double> simulatedCosts;
+    simulatedCosts.reserve(simulated.size());
+    for (auto position : simulated) {
+      simulatedCosts.push_back(contingencyCosts_->estimate(contingencies[position]));
+    }
+    order = common::dispatchTasks(simulatedCosts, mpiContext.nbProcs());
+    for (auto &position : order) {
+      position = simulated[position];
+    }
+    LOG(info, ScenariosOrderedByCost, simulated.size(), mpiContext.nbProcs());
+  }
+#if defined(_MPI_)
+  // the dispatch decided by the root process is followed by all the processes
+  std::vector<unsigned long> positions(order.begin(), order.end());
+  MPI_Bcast(positions.data(), static_cast<int>(positions.size()), MPI_UNSIGNED_LONG, 0, MPI_COMM_WORLD);
+  order.assign(positions.begin(), positions.end());
+#endif
+  return order;
+}
+
 void Context::exportResults(bool simulationOk) {
   boost::property_tree::ptree resultsTree;
   boost::property_tree::ptree componentResultsTree;
@@ -388,6 +910,33 @@ void Context::exportResults(bool simulationOk) {
   componentResultsChild.put("slackBusActivePowerMismatch", 0);
   componentResultsTree.push_back(std::make_pair("", componentResultsChild));
   resultsTree.add_child("componentResults", componentResultsTree);
+  if (!scenarioStatuses_.empty()) {
+    const auto &contingencies = validContingencies_->get();
+    if (!def_.resultCacheDir.empty()) {
+      const auto nbFound = std::count_if(scenarioStatuses_.begin(), scenarioStatuses_.end(), [](ScenarioStatus status) {
+        return status == ScenarioStatus::CACHE_FOUND || status == ScenarioStatus::CACHE_RESTORED;
+      });
+      resultsTree.put("metrics.resultCacheHitRate", static_cast<double>(nbFound) / static_cast<double>(contingencies.size()));
+    }
+    // scenarios whose result was reused instead of simulated
+    boost::property_tree::ptree cachedScenariosTree;
+    boost::property_tree::ptree resumedScenariosTree;
+    for (std::size_t i = 0; i < contingencies.size(); ++i) {
+      boost::property_tree::ptree scenarioTree;
+      scenarioTree.put("", contingencies[i].id);
+      if (scenarioStatuses_[i] == ScenarioStatus::CACHE_RESTORED) {
+        cachedScenariosTree.push_back(std::make_pair("", scenarioTree));
+      } else if (scenarioStatuses_[i] == ScenarioStatus::RESUMED) {
+        resumedScenariosTree.push_back(std::make_pair("", scenarioTree));
+      }
+    }
+    if (!cachedScenariosTree.empty()) {
+      resultsTree.add_child("cachedScenarios", cachedScenariosTree);
+    }
+    if (!resumedScenariosTree.empty()) {
+      resultsTree.add_child("resumedScenarios", resumedScenariosTree);
+    }
+  }
 
   std::string fileName = "results.json";
   if (def_.simulationKind == dfl::inputs::Configuration::SimulationKind::SECURITY_ANALYSIS)
@@ -451,14 +1000,4 @@ void Context::populateOutputsMapWithSimulationOutputs(const boost::shared_ptr<DY
   }
 }
 
-void Context::walkNodesMain() {
-#if defined(_DEBUG_) || defined(PRINT_TIMERS)
-  DYN::Timer timer("DFL::Context::walkNodesMain()");
-#endif
-  for (const auto &node : mainConnexNodes_) {
-    for (const auto &cbk : callbacksMainConnexComponent_) {
-      cbk(node, algoResults_);
-    }
-  }
-}
 }  // namespace dfl
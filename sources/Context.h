@@ -20,22 +20,31 @@
 #include "AlgorithmsResults.h"
 #include "Configuration.h"
 #include "ContingenciesManager.h"
+#include "ContingencyCostAlgorithm.h"
 #include "ContingencyValidationAlgorithm.h"
+#include "DefinitionsIndex.h"
 #include "DynModelDefinitionAlgorithm.h"
 #include "DynamicDataBaseManager.h"
+#include "EventTemplates.h"
 #include "GeneratorDefinitionAlgorithm.h"
 #include "HVDCDefinitionAlgorithm.h"
+#include "InputArchive.h"
 #include "LineDefinitionAlgorithm.h"
+#include "Log.h"
 #include "LoadDefinitionAlgorithm.h"
 #include "MainConnexComponentAlgorithm.h"
 #include "NetworkManager.h"
+#include "NodeVisitor.h"
 #include "SVarCDefinitionAlgorithm.h"
+#include "ScenarioJournal.h"
+#include "ScenarioResultCache.h"
 #include "ShuntDefinitionAlgorithm.h"
 #include "SlackNodeAlgorithm.h"
 #include "TransfoDefinitionAlgorithm.h"
 
 #include <JOBJobEntry.h>
 #include <boost/filesystem.hpp>
+#include <future>
 #include <memory>
 
 namespace DYN {
@@ -54,10 +63,6 @@ namespace dfl {
  */
 class Context {
  public:
-  using ProcessNodeCallBackMainComponent =
-      std::function<void(const std::shared_ptr<inputs::Node> &,
-                         std::shared_ptr<dfl::algo::AlgorithmsResults> &)>;  ///< Callback for node algorithm on main topological island
-
   /**
    * @brief Context definition
    */
@@ -72,6 +77,13 @@ class Context {
     std::string dynawoLogLevel;                                       ///< string representation of the dynawo log level
     boost::filesystem::path dynawoResDir;                             ///< DYNAWO resources
     std::string locale;                                               ///< localization
+    boost::filesystem::path snapshotCacheDir;                         ///< directory of the input snapshots, empty if the snapshot cache is disabled
+    boost::filesystem::path resultCacheDir;                           ///< directory of the cached results of the scenarios, empty if the cache is disabled
+    std::uintmax_t resultCacheMaxSize;                                ///< maximum size of the result cache, in bytes
+    bool resultCacheDryRun;                                           ///< true to only report the scenarios found in the result cache
+    unsigned int checkpointInterval;                                  ///< number of scenarios simulated between two checkpoints, 0 to disable them
+    bool resume;                                                      ///< true to skip the scenarios checkpointed by an interrupted run
+    const common::InputArchive* inputArchive;                         ///< input archive decoded in memory, nullptr to read all the inputs from disk
   };
 
  public:
@@ -160,20 +172,120 @@ class Context {
   bool checkConnexity() const;
 
   /**
-   * @brief Register a callback to call at each node of the main topological island
+   * @brief Walk through all nodes in main connex components and apply a visitor
    *
-   * @param cbk the callback to register
+   * @param visitor the visitor, taking the node and the algorithms results
    */
-  void onNodeOnMainConnexComponent(ProcessNodeCallBackMainComponent &&cbk) { callbacksMainConnexComponent_.push_back(std::move(cbk)); }
+  template<class Visitor>
+  void walkNodesMain(Visitor &&visitor);
 
   /**
-   * @brief Walk through all nodes in main connex components and apply callbacks
+   * @brief Walk through all nodes in main connex components to fill the definitions of the network elements
+   *
+   * The nodes are split in contiguous chunks processed concurrently, following the number of threads of the configuration.
+   * The definitions of each chunk are then merged in the order of the nodes, so that they do not depend on the number of threads.
+   *
+   * @param dynModelAlgorithm the dynamic models algorithm, updating the dynamic models of the context
    */
-  void walkNodesMain();
+  void walkNodesMainDefinitions(algo::DynModelAlgorithm &dynModelAlgorithm);
+
+  /**
+   * @brief Walk through a range of nodes of the main connex component to fill definitions of the network elements
+   *
+   * @param first the position of the first node of the range in the main connex component
+   * @param last the position past the last node of the range in the main connex component
+   * @param generators the generators definitions to update
+   * @param loads the loads definitions to update
+   * @param staticVarCompensators the static var compensators definitions to update
+   * @param counters the shunt counters definitions to update
+   * @param diagrams the pool of the reactive diagrams shared by the generators
+   * @param dynModelAlgorithm the dynamic models algorithm to apply
+   * @param algoResults the algorithms results to update
+   */
+  void walkNodesMainRange(std::size_t first, std::size_t last, std::vector<algo::GeneratorDefinition> &generators, std::vector<algo::LoadDefinition> &loads,
+                          std::vector<algo::StaticVarCompensatorDefinition> &staticVarCompensators, algo::ShuntCounterDefinitions &counters,
+                          algo::ReactiveDiagramPool &diagrams, algo::DynModelAlgorithm &dynModelAlgorithm,
+                          std::shared_ptr<algo::AlgorithmsResults> &algoResults) const;
 
   /// @brief Execute security analysis by running simulations for the base case and all the valid contingencies
   void executeSecurityAnalysis();
 
+  /// @brief Origin of the result of a scenario
+  enum class ScenarioStatus : char {
+    SIMULATED = 0,   ///< result of the simulation of the scenario
+    CACHE_FOUND,     ///< result found in the result cache during a dry run, the scenario is simulated
+    CACHE_RESTORED,  ///< result restored from the result cache, the scenario is not simulated
+    RESUMED          ///< result checkpointed by an interrupted run, the scenario is not simulated
+  };
+
+  /**
+   * @brief Look for the results of the scenarios of the valid contingencies that do not need to be simulated
+   *
+   * The root process computes the keys of the scenarios, reads the results checkpointed by an interrupted run when resuming and
+   * restores the results found in the result cache. The other processes follow its decision.
+   *
+   * @param useResultCache true to look for the results in the result cache
+   */
+  void reuseScenarioResults(bool useResultCache);
+
+  /// @brief Compute the keys of the inputs of the scenarios of the valid contingencies, on the root process
+  void computeScenarioKeys();
+
+  /// @brief Reuse the results checkpointed by an interrupted run whose scenario inputs did not change, on the root process
+  void resumeScenarios();
+
+  /**
+   * @brief Look for the results of the scenarios not resumed in the result cache, on the root process
+   *
+   * The results found in the cache are restored, unless during a dry run where they are only counted.
+   */
+  void restoreCachedScenarios();
+
+  /**
+   * @brief Simulate a batch of scenarios with dynawo-algorithms
+   *
+   * @param order the positions of the valid contingencies to simulate, in submission order
+   * @param first the submission position of the first scenario of the batch
+   * @param last the submission position past the last scenario of the batch
+   */
+  void launchScenarios(const std::vector<std::size_t>& order, std::size_t first, std::size_t last);
+
+  /**
+   * @brief Append the results of a batch of simulated scenarios to the journal, on the root process
+   *
+   * The results are also kept to be merged with the results of the following batches at the end of the security analysis.
+   *
+   * @param journal the journal of the results of the scenarios
+   * @param order the positions of the simulated valid contingencies, in submission order
+   * @param first the submission position of the first scenario of the batch
+   * @param last the submission position past the last scenario of the batch
+   */
+  void checkpointScenarios(outputs::ScenarioJournal& journal, const std::vector<std::size_t>& order, std::size_t first, std::size_t last);
+
+  /**
+   * @brief Merge the results missing from the aggregated results written by the last batch, on the root process
+   *
+   * The results restored, resumed or simulated by a previous batch are added to the aggregated results, then the results of the
+   * scenarios are sorted in the order of the contingencies.
+   */
+  void mergeScenarioResults();
+
+  /// @brief Store the results of the simulated scenarios in the result cache, on the root process
+  void updateResultCache();
+
+  /**
+   * @brief Compute the order in which the scenarios of the valid contingencies are submitted
+   *
+   * dynawo-algorithms runs the scenario submitted at position k on the process k modulo the number of processes. If required by
+   * the configuration, the root process dispatches the scenarios by decreasing cost to the least loaded processes, so that the processes
+   * end at about the same time, and the other processes follow its dispatch
+   *
+   * Scenarios whose result was restored from the result cache or resumed from the checkpoints are not submitted.
+   *
+   * @returns the positions of the valid contingencies to simulate, in submission order
+   */
+  std::vector<std::size_t> scenariosOrder() const;
+
   /// @brief Prepare the job file
   void exportOutputJob();
 
@@ -183,7 +295,9 @@ class Context {
   /// @brief Prepare the output files required to simulate a given contingency
   /// @param contingency the contingency
   /// @param elementsNetworkType ids of network elements with a network type
-  void exportOutputsContingency(const inputs::Contingency &contingency, const std::unordered_set<std::string> &elementsNetworkType);
+  /// @param eventTemplates the templates the event files are stamped from
+  void exportOutputsContingency(const inputs::Contingency &contingency, const std::unordered_set<std::string> &elementsNetworkType,
+                                const outputs::EventTemplates &eventTemplates) const;
 
   /**
    * @brief Populate the map with the file paths and corresponding data from the simulation outputs
@@ -192,6 +306,54 @@ class Context {
    */
   void populateOutputsMapWithSimulationOutputs(const boost::shared_ptr<DYN::Simulation>& simulation) const;
 
+ private:
+  /**
+   * @brief Definitions filled by the algorithms on a chunk of nodes of the main connex component
+   */
+  struct MainComponentDefinitions {
+    std::vector<algo::GeneratorDefinition> generators;                                                   ///< generators found
+    std::vector<algo::LoadDefinition> loads;                                                             ///< loads found
+    std::vector<algo::StaticVarCompensatorDefinition> staticVarCompensators;                             ///< svarcs definitions
+    algo::DynamicModelDefinitions dynamicModels;                                                         ///< model definitions
+    algo::ShuntCounterDefinitions counters;                                                              ///< shunt counters definitions
+    std::shared_ptr<algo::AlgorithmsResults> algoResults = std::make_shared<algo::AlgorithmsResults>();  ///< algorithms results
+  };
+
+ private:
+  /**
+   * @brief Input managers built in the background while the network manager is built
+   */
+  struct PendingManagers {
+    std::future<common::Log::Deferred<inputs::DynamicDataBaseManager>> dynamicDataBaseManager;  ///< dynamic model configuration manager being built
+    std::future<common::Log::Deferred<inputs::ContingenciesManager>> contingenciesManager;      ///< contingencies manager being built
+  };
+
+  /**
+   * @brief Start building the input managers that do not depend on the network
+   *
+   * They are built on their own threads if the configuration allows several threads, and when they are retrieved otherwise. Their logs
+   * are deferred until they are retrieved.
+   *
+   * @param def The context definition
+   * @param config configuration to use
+   * @returns the input managers being built
+   */
+  static PendingManagers launchManagers(const ContextDef& def, const inputs::Configuration& config);
+
+  /**
+   * @brief Constructor, retrieving the input managers once the network manager is built
+   *
+   * The managers are retrieved in the order they were built in sequentially, with their logs, so that the logs and the first error are
+   * always the same
+   *
+   * @param def The context definition
+   * @param config configuration to use
+   * @param mapOutputFilesData map associating the simulation output file names to the data contained in these files
+   * @param pendingManagers the input managers being built
+   */
+  Context(const ContextDef& def, inputs::Configuration& config, std::unordered_map<std::string, std::string>& mapOutputFilesData,
+          PendingManagers&& pendingManagers);
+
  private:
   ContextDef def_;                                         ///< context definition
   inputs::NetworkManager networkManager_;                  ///< network manager
@@ -200,11 +362,11 @@ class Context {
   inputs::Configuration& config_;                          ///< configuration
   std::unordered_map<std::string, std::string>& mapOutputFilesData_;  ///< map associating the simulation output file names to the data contained in these files
 
-  std::string basename_;                                                        ///< basename for all files
-  std::vector<ProcessNodeCallBackMainComponent> callbacksMainConnexComponent_;  ///< List of algorithms to run in main components
+  std::string basename_;  ///< basename for all files
 
   std::shared_ptr<inputs::Node> slackNode_;                                  ///< computed slack node
   SlackNodeOrigin slackNodeOrigin_;                                          ///< slack node origin
+  boost::optional<algo::ConnexComponents> connexComponents_;                 ///< connex components of the network
   std::vector<std::shared_ptr<inputs::Node>> mainConnexNodes_;               ///< main connex component
   std::vector<algo::GeneratorDefinition> generators_;                        ///< generators found
   std::vector<algo::LoadDefinition> loads_;                                  ///< loads found
@@ -214,7 +376,13 @@ class Context {
   algo::ShuntCounterDefinitions counters_;                                   ///< shunt counters definitions
   algo::LinesByIdDefinitions linesById_;                                     ///< Lines by ids definition
   algo::TransformersByIdDefinitions tfosById_;                               ///< Transformers by ids definition
+  algo::DefinitionsIndex definitionsIndex_;                                  ///< Index of the definitions by id
   boost::optional<algo::ValidContingencies> validContingencies_;             ///< contingencies accepted for simulation in a Security Analyasis
+  boost::optional<algo::ContingencyCosts> contingencyCosts_;                 ///< estimated costs of the simulations of the contingencies
+  boost::optional<outputs::ScenarioResultCache> resultCache_;                ///< cache of the results of the scenarios, on the root process
+  std::vector<std::string> scenarioKeys_;                                    ///< keys of the inputs of the valid contingencies, on the root process
+  std::vector<std::string> scenarioResults_;                                 ///< results reused or checkpointed by valid contingency, on the root process
+  std::vector<ScenarioStatus> scenarioStatuses_;                             ///< origin of the results of the valid contingencies
   std::shared_ptr<algo::AlgorithmsResults> algoResults_;                     ///< reference to algorithms results class
 
   std::shared_ptr<job::JobEntry> jobEntry_;                  ///< Dynawo job entry
@@ -15,6 +15,8 @@
 
 #pragma once
 
+#include "InputArchive.h"
+
 #include <boost/filesystem.hpp>
 #include <boost/optional.hpp>
 #include <string>
@@ -426,8 +428,12 @@ class AssemblingDataBase {
   /**
    * @brief Constructor
    * @param assemblingFilePaths the assembling documents file paths
+   * @param inputArchive the input archive the assembling documents may belong to
+   * @param snapshotCacheDirectory directory of the data base snapshots, empty to disable the snapshot cache
    */
-  explicit AssemblingDataBase(const std::vector<boost::filesystem::path> & assemblingFilePaths);
+  explicit AssemblingDataBase(const std::vector<boost::filesystem::path> & assemblingFilePaths,
+                              const common::InputArchive & inputArchive = common::InputArchive::empty(),
+                              const boost::filesystem::path & snapshotCacheDirectory = boost::filesystem::path());
 
   /**
    * @brief Retrieve a macro connection with its id
@@ -513,6 +519,8 @@ class AssemblingDataBase {
   bool isProperty(const std::string &id) const;
 
  private:
+  friend class DynamicDataBaseSnapshot;
+
   std::unordered_map<std::string, MacroConnection> macroConnections_;               ///< list of macro connections
   std::unordered_map<std::string, MacroConnection> networkMacroConnections_;        ///< list of macro connections for network components
   std::unordered_map<std::string, SingleAssociation> singleAssociations_;           ///< list of single associations
@@ -16,6 +16,8 @@
  */
 #pragma once
 
+#include "InputArchive.h"
+
 #include <boost/filesystem.hpp>
 #include <boost/optional.hpp>
 #include <boost/property_tree/ptree.hpp>
@@ -45,9 +47,11 @@ class Configuration {
    *
    * @param filepath the configuration file to use
    * @param simulationKind the simulation kind (Steady state or Security analysis)
+   * @param inputArchive the input archive the configuration file may belong to
    */
   explicit Configuration(const boost::filesystem::path &filepath,
-                         dfl::inputs::Configuration::SimulationKind simulationKind = dfl::inputs::Configuration::SimulationKind::STEADY_STATE_CALCULATION);
+                         dfl::inputs::Configuration::SimulationKind simulationKind = dfl::inputs::Configuration::SimulationKind::STEADY_STATE_CALCULATION,
+                         const common::InputArchive &inputArchive = common::InputArchive::empty());
 
   /**
    * @brief performs sanity checks on the configuration
@@ -72,6 +76,27 @@ class Configuration {
    */
   unsigned int timeTableStep() const { return timeTableStep_; }
 
+  /**
+   * @brief getter for the number of threads to use to process the network
+   *
+   * @returns the number of threads
+   */
+  unsigned int getNbThreads() const { return nbThreads_; }
+
+  /**
+   * @brief Set the number of threads to use to process the network
+   *
+   * @param nbThreads the new number of threads
+   */
+  void setNbThreads(unsigned int nbThreads) { nbThreads_ = nbThreads; }
+
+  /**
+   * @brief determines if all the diagram tables are written in a single file
+   *
+   * @returns the parameter value
+   */
+  bool useSingleDiagramFile() const { return useSingleDiagramFile_; }
+
   /**
    * @brief determines if SVarC regulation is on
    *
@@ -173,6 +198,20 @@ class Configuration {
    */
   double getTimeOfEvent() const { return timeOfEvent_; }
 
+  /**
+   * @brief determines if the parameter sets of the events of all the contingencies are written in a single file
+   *
+   * @returns the parameter value
+   */
+  bool useSingleEventsParFile() const { return useSingleEventsParFile_; }
+
+  /**
+   * @brief determines if the scenarios are submitted by decreasing estimated cost instead of the contingencies order
+   *
+   * @returns the parameter value
+   */
+  bool isCostBasedScenarioOrderingOn() const { return costBasedScenarioOrdering_; }
+
   /**
    * @brief Set the Time at which the events related to each contingency will be simulated
    *
@@ -237,6 +276,12 @@ class Configuration {
    */
   const boost::filesystem::path &criteriaFilePath() const { return criteriaFilePath_; }
 
+  /**
+   * @brief Retrieves the input files Dynawo opens by path, which cannot be read from an input archive in memory
+   * @returns the starting dump and criteria file paths, when set
+   */
+  std::vector<boost::filesystem::path> dynawoInputFilePaths() const;
+
   /**
    * @brief Set the starting dump file path
    * @param startingDumpFilePath the new starting dump file path
@@ -343,9 +388,13 @@ class Configuration {
   double tfoVoltageLevel_ = 100;             ///< Maximum voltage level we assume that generator's transformers are already described in the static description
   unsigned int timeTableStep_ = 0;           ///< time table step to display progress
   bool restorativeFictitiousLoads_ = false;  ///< determines if fictitious loads are modeled as restorative
+  unsigned int nbThreads_ = 1;               ///< number of threads to use to process the network
+  bool useSingleDiagramFile_ = false;        ///< determines if all the diagram tables are written in a single file
 
   // SA
   double timeOfEvent_ = 10.;                                ///< time for contingency simulation (security analysis only)
+  bool useSingleEventsParFile_ = false;                     ///< determines if the events parameter sets are written in a single file (SA only)
+  bool costBasedScenarioOrdering_ = false;                  ///< determines if the scenarios are ordered by decreasing estimated cost (SA only)
   boost::filesystem::path startingDumpFilePath_;            ///< starting dump file path
                                                             ///< are already described in the static description
   boost::filesystem::path criteriaFilePath_;                ///< criteria file path (optional)
@@ -17,6 +17,7 @@
 #pragma once
 
 #include "Contingencies.h"
+#include "InputArchive.h"
 
 #include <boost/filesystem.hpp>
 #include <string>
@@ -35,8 +36,9 @@ class ContingenciesManager {
    * Load contingency from file. Exit the program on error in parsing the file
    *
    * @param filepath the JSON contingencies file to use
+   * @param inputArchive the input archive the contingencies file may belong to
    */
-  explicit ContingenciesManager(const boost::filesystem::path& filepath);
+  explicit ContingenciesManager(const boost::filesystem::path& filepath, const common::InputArchive& inputArchive = common::InputArchive::empty());
 
   /**
    * @brief List of contingencies
@@ -52,7 +54,8 @@ class ContingenciesManager {
  private:
   /// @brief Load contingencies from an input file
   /// @param filepath the JSON contigencies file to load
-  void load(const boost::filesystem::path& filepath);
+  /// @param inputArchive the input archive the contingencies file may belong to
+  void load(const boost::filesystem::path& filepath, const common::InputArchive& inputArchive);
 
   std::vector<Contingency> contingencies_;  ///< Contingencies obtained from input file
 };
@@ -35,8 +35,12 @@ class DynamicDataBaseManager {
    * @brief Constructor
    * @param settingFilePaths the setting documents file paths
    * @param assemblingFilePaths the assembling documents file paths
+   * @param inputArchive the input archive the setting and assembling documents may belong to
+   * @param snapshotCacheDirectory directory of the data base snapshots, empty to disable the snapshot cache
    */
-  DynamicDataBaseManager(const std::vector<boost::filesystem::path> & settingFilePaths, const std::vector<boost::filesystem::path> & assemblingFilePaths);
+  DynamicDataBaseManager(const std::vector<boost::filesystem::path> & settingFilePaths, const std::vector<boost::filesystem::path> & assemblingFilePaths,
+                         const common::InputArchive & inputArchive = common::InputArchive::empty(),
+                         const boost::filesystem::path & snapshotCacheDirectory = boost::filesystem::path());
 
   /**
    * @brief get current assembling database
@@ -0,0 +1,142 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  DynamicDataBaseSnapshot.h
+ *
+ * @brief Dynamic data base snapshot header file
+ *
+ */
+
+#pragma once
+
+#include "AssemblingDataBase.h"
+#include "InputArchive.h"
+#include "SettingDataBase.h"
+
+#include <boost/filesystem.hpp>
+#include <string>
+#include <vector>
+
+namespace dfl {
+namespace inputs {
+
+class SnapshotReader;
+
+/**
+ * @brief Persistent binary snapshot of the setting and assembling data bases
+ *
+ * A snapshot contains the data base as built from its XML documents, once they were parsed and validated against their schema,
+ * so that the following runs on the same documents neither parse nor validate them again.
+ *
+ * A snapshot is identified by a key computed from the content of the documents, the kind of data base, the versions of dynaflow launcher
+ * and of the dynawo library it is built against, and the version of the snapshot format. The key is stored in the snapshot so that a snapshot not matching the documents is never
+ * restored. Snapshots are read through a memory mapping of the file.
+ */
+class DynamicDataBaseSnapshot {
+ public:
+  /**
+   * @brief Compute the key of the snapshot of a data base
+   *
+   * @param kind the kind of data base, "setting" or "assembling"
+   * @param filepaths the file paths of the documents of the data base
+   * @param inputArchive the input archive the documents may belong to
+   * @returns the key of the snapshot, as an hexadecimal string
+   */
+  static std::string computeKey(const std::string &kind, const std::vector<boost::filesystem::path> &filepaths,
+                                const common::InputArchive &inputArchive);
+
+  /**
+   * @brief Compute the path of a snapshot in a cache directory
+   *
+   * @param cacheDirectory the cache directory
+   * @param kind the kind of data base, "setting" or "assembling"
+   * @param key the key of the snapshot
+   * @returns the snapshot file path
+   */
+  static boost::filesystem::path filepath(const boost::filesystem::path &cacheDirectory, const std::string &kind, const std::string &key);
+
+  /**
+   * @brief Save a setting data base into a snapshot
+   *
+   * Failing to save the snapshot is not an error: a warning is logged and the run goes on.
+   *
+   * @param filepath the snapshot file path
+   * @param key the key of the snapshot
+   * @param dataBase the data base built from its documents
+   */
+  static void write(const boost::filesystem::path &filepath, const std::string &key, const SettingDataBase &dataBase);
+
+  /**
+   * @brief Save an assembling data base into a snapshot
+   *
+   * Failing to save the snapshot is not an error: a warning is logged and the run goes on.
+   *
+   * @param filepath the snapshot file path
+   * @param key the key of the snapshot
+   * @param dataBase the data base built from its documents
+   */
+  static void write(const boost::filesystem::path &filepath, const std::string &key, const AssemblingDataBase &dataBase);
+
+  /**
+   * @brief Restore a setting data base from a snapshot
+   *
+   * The data base is left untouched if the snapshot does not exist, does not match the key or cannot be read.
+   *
+   * @param filepath the snapshot file path
+   * @param key the expected key of the snapshot
+   * @param dataBase the data base to fill
+   * @returns true if the data base was restored, false otherwise
+   */
+  static bool read(const boost::filesystem::path &filepath, const std::string &key, SettingDataBase &dataBase);
+
+  /**
+   * @brief Restore an assembling data base from a snapshot
+   *
+   * The data base is left untouched if the snapshot does not exist, does not match the key or cannot be read.
+   *
+   * @param filepath the snapshot file path
+   * @param key the expected key of the snapshot
+   * @param dataBase the data base to fill
+   * @returns true if the data base was restored, false otherwise
+   */
+  static bool read(const boost::filesystem::path &filepath, const std::string &key, AssemblingDataBase &dataBase);
+
+ private:
+  /**
+   * @brief Restore a data base from a snapshot file, whatever its kind
+   *
+   * @param filepath the snapshot file path
+   * @param key the expected key of the snapshot
+   * @param dataBase the data base to fill
+   * @returns true if the data base was restored, false otherwise
+   */
+  template<class DataBase>
+  static bool readFile(const boost::filesystem::path &filepath, const std::string &key, DataBase &dataBase);
+
+  /**
+   * @brief Restore the sets of a setting data base from the content of a snapshot
+   *
+   * @param reader the reader of the content, past the header of the snapshot
+   * @param dataBase the data base to fill
+   */
+  static void restore(SnapshotReader &reader, SettingDataBase &dataBase);
+
+  /**
+   * @brief Restore the elements of an assembling data base from the content of a snapshot
+   *
+   * @param reader the reader of the content, past the header of the snapshot
+   * @param dataBase the data base to fill
+   */
+  static void restore(SnapshotReader &reader, AssemblingDataBase &dataBase);
+};
+
+}  // namespace inputs
+}  // namespace dfl
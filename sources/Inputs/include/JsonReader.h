@@ -0,0 +1,163 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  JsonReader.h
+ *
+ * @brief Streaming JSON reader header file
+ *
+ */
+
+#pragma once
+
+#include <istream>
+#include <streambuf>
+#include <string>
+
+namespace dfl {
+namespace inputs {
+
+/**
+ * @brief Pull reader of a JSON document
+ *
+ * The document is read character by character from its stream, without building any tree: the caller walks the structure it
+ * expects and skips the values it does not need, so that the memory used does not depend on the size of the document.
+ * Syntax errors are reported as boost::property_tree::json_parser_error, with the line they occur at.
+ *
+ * Objects and arrays are iterated with a flag owned by the caller:
+ * @code
+ * reader.beginObject();
+ * bool first = true;
+ * std::string key;
+ * while (reader.nextMember(key, first)) {
+ *   ...  // read or skip the value of the member
+ * }
+ * @endcode
+ */
+class JsonReader {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param stream the stream of the document, which must outlive the reader
+   * @param filename the name of the document, used in the error reports
+   */
+  JsonReader(std::istream &stream, const std::string &filename);
+
+  /**
+   * @brief Retrieve the current line
+   * @returns the line of the next character to read, starting at 1
+   */
+  std::size_t line() const { return line_; }
+
+  /**
+   * @brief Report an error at the current line
+   * @param message the error message
+   */
+  [[noreturn]] void error(const std::string &message) const;
+
+  /**
+   * @brief Report an error at a given line
+   * @param message the error message
+   * @param line the line of the error
+   */
+  [[noreturn]] void error(const std::string &message, std::size_t line) const;
+
+  /**
+   * @brief Start reading an object
+   */
+  void beginObject() { expect('{'); }
+
+  /**
+   * @brief Start reading an array
+   */
+  void beginArray() { expect('['); }
+
+  /**
+   * @brief Read the key of the next member of the current object
+   *
+   * @param key the key of the member, if any
+   * @param first flag, initialized to true by the caller, telling if no member was read yet
+   * @returns true if a member was read and its value must be processed, false at the end of the object
+   */
+  bool nextMember(std::string &key, bool &first);
+
+  /**
+   * @brief Move to the next item of the current array
+   *
+   * @param first flag, initialized to true by the caller, telling if no item was read yet
+   * @returns true if an item follows and must be processed, false at the end of the array
+   */
+  bool nextItem(bool &first);
+
+  /**
+   * @brief Read a string value
+   * @param value the decoded string
+   */
+  void readString(std::string &value);
+
+  /**
+   * @brief Read a scalar value
+   *
+   * Strings are decoded, numbers and literals (true, false, null) are kept as written
+   *
+   * @param value the scalar value, as text
+   */
+  void readScalar(std::string &value);
+
+  /**
+   * @brief Skip a value, whatever its type
+   */
+  void skipValue();
+
+  /**
+   * @brief End reading the document, checking that nothing but whitespace follows
+   */
+  void end();
+
+ private:
+  /**
+   * @brief Skip whitespace and retrieve the next character, without consuming it
+   * @returns the next significant character, or EOF at the end of the stream
+   */
+  int peek();
+
+  /**
+   * @brief Consume the next character, counting lines
+   * @returns the consumed character, or EOF at the end of the stream
+   */
+  int get();
+
+  /**
+   * @brief Consume an expected significant character
+   * @param expected the expected character
+   */
+  void expect(char expected);
+
+  /**
+   * @brief Read a number or a literal, as written
+   * @param value the text of the number or literal
+   */
+  void readLiteral(std::string &value);
+
+  /**
+   * @brief Read the four hexadecimal digits of a unicode escape sequence
+   * @returns the code unit
+   */
+  unsigned int readCodeUnit();
+
+ private:
+  std::streambuf &buffer_;  ///< buffer of the document stream
+  std::string filename_;    ///< name of the document
+  std::size_t line_ = 1;    ///< line of the next character to read
+};
+
+}  // namespace inputs
+}  // namespace dfl
@@ -0,0 +1,322 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  NetworkGraph.h
+ *
+ * @brief Index based network graph header file
+ *
+ */
+
+#pragma once
+
+#include "HvdcLine.h"
+#include "Node.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace dfl {
+namespace inputs {
+
+/**
+ * @brief Index based representation of the network topology
+ *
+ * Nodes, lines, transformers and converters are stored in flat vectors and addressed by 32 bits indices.
+ * The connections of each node are stored in compressed sparse row format, so that traversing the graph
+ * does not require any access to the node references nor any reference counting.
+ *
+ * Once its graph is built, the network manager releases the node references (Node::lines, Node::tfos, Node::converters
+ * and Node::neighbours) of its nodes, so that the graph is the only store of the topology. The accessors of the graph
+ * fall back on the node references for the nodes not belonging to the graph, built outside of a network manager.
+ *
+ * The lines, transformers and converters are not owned by the graph: they must outlive it.
+ */
+class NetworkGraph {
+ public:
+  using Index = Node::NodeIndex;  ///< alias for the index of an element in the graph
+
+  /**
+   * @brief Contiguous read-only sequence of elements of the graph
+   */
+  template<class T>
+  class Range {
+   public:
+    /**
+     * @brief Constructor
+     *
+     * @param first pointer to the first element
+     * @param last pointer past the last element
+     */
+    Range(const T *first, const T *last) : first_(first), last_(last) {}
+
+    /**
+     * @brief Retrieve the beginning of the sequence
+     * @returns pointer to the first element
+     */
+    const T *begin() const { return first_; }
+
+    /**
+     * @brief Retrieve the end of the sequence
+     * @returns pointer past the last element
+     */
+    const T *end() const { return last_; }
+
+    /**
+     * @brief Retrieve the number of elements of the sequence
+     * @returns the number of elements
+     */
+    std::size_t size() const { return static_cast<std::size_t>(last_ - first_); }
+
+    /**
+     * @brief Determines if the sequence is empty
+     * @returns true if the sequence has no element, false otherwise
+     */
+    bool empty() const { return first_ == last_; }
+
+    /**
+     * @brief Retrieve an element of the sequence
+     * @param i the position of the element in the sequence
+     * @returns the element
+     */
+    const T &operator[](std::size_t i) const { return first_[i]; }
+
+   private:
+    const T *first_;  ///< first element
+    const T *last_;   ///< past the last element
+  };
+
+ public:
+  /// @brief Default constructor, building an empty graph
+  NetworkGraph() = default;
+
+  /**
+   * @brief Constructor
+   *
+   * Indexes the nodes, following the input order, and the lines, transformers and converters they are connected to, from the node references.
+   * The index of each node is stored in the node itself. Neighbours not belonging to the input nodes are ignored.
+   *
+   * @param nodes the nodes of the graph
+   */
+  explicit NetworkGraph(const std::vector<std::shared_ptr<Node>> &nodes);
+
+  /**
+   * @brief Retrieve a graph without any node
+   *
+   * Used by the algorithms which are run on nodes built outside of a network manager
+   *
+   * @returns the empty graph
+   */
+  static const NetworkGraph &empty();
+
+  /**
+   * @brief Retrieve the number of nodes of the graph
+   * @returns the number of nodes
+   */
+  Index nbNodes() const { return static_cast<Index>(nodes_.size()); }
+
+  /**
+   * @brief Retrieve a node
+   * @param index the index of the node
+   * @returns the node
+   */
+  const std::shared_ptr<Node> &node(Index index) const { return nodes_[index]; }
+
+  /**
+   * @brief Determines if a node belongs to the graph
+   * @param node the node
+   * @returns true if the node belongs to the graph, false otherwise
+   */
+  bool contains(const Node &node) const { return node.index < nodes_.size() && nodes_[node.index].get() == &node; }
+
+  /**
+   * @brief Retrieve the neighbours of a node
+   * @param index the index of the node
+   * @returns the indexes of the neighbours of the node
+   */
+  Range<Index> neighbours(Index index) const { return neighbours_.row(index); }
+
+  /**
+   * @brief Retrieve the number of neighbours of a node
+   *
+   * Relies on the node references if the node does not belong to the graph
+   *
+   * @param node the node
+   * @returns the number of neighbours of the node
+   */
+  std::size_t nbNeighbours(const Node &node) const { return contains(node) ? neighbours(node.index).size() : node.neighbours.size(); }
+
+  /**
+   * @brief Retrieve a neighbour of a node
+   *
+   * Relies on the node references if the node does not belong to the graph
+   *
+   * @param node the node
+   * @param i the position of the neighbour, lower than the number of neighbours of the node
+   * @returns the neighbour
+   */
+  const std::shared_ptr<Node> &neighbour(const Node &node, std::size_t i) const {
+    return contains(node) ? nodes_[neighbours(node.index)[i]] : node.neighbours[i];
+  }
+
+  /**
+   * @brief Retrieve the lines connected to a node
+   * @param index the index of the node
+   * @returns the indexes of the lines connected to the node
+   */
+  Range<Index> lines(Index index) const { return nodeLines_.row(index); }
+
+  /**
+   * @brief Retrieve the transformers connected to a node
+   * @param index the index of the node
+   * @returns the indexes of the transformers connected to the node
+   */
+  Range<Index> tfos(Index index) const { return nodeTfos_.row(index); }
+
+  /**
+   * @brief Retrieve the converters connected to a node
+   * @param index the index of the node
+   * @returns the indexes of the converters connected to the node
+   */
+  Range<Index> converters(Index index) const { return nodeConverters_.row(index); }
+
+  /**
+   * @brief Retrieve a line
+   * @param index the index of the line
+   * @returns the line
+   */
+  const Line &line(Index index) const { return *lines_[index]; }
+
+  /**
+   * @brief Retrieve a transformer
+   * @param index the index of the transformer
+   * @returns the transformer
+   */
+  const Tfo &tfo(Index index) const { return *tfos_[index]; }
+
+  /**
+   * @brief Retrieve a converter
+   * @param index the index of the converter
+   * @returns the converter
+   */
+  const Converter &converter(Index index) const { return *converters_[index]; }
+
+  /**
+   * @brief Apply a function on each line connected to a node
+   *
+   * Relies on the node references if the node does not belong to the graph
+   *
+   * @param node the node
+   * @param func the function to apply, taking a const Line reference
+   */
+  template<class F>
+  void forEachLine(const Node &node, F &&func) const;
+
+  /**
+   * @brief Apply a function on each transformer connected to a node
+   *
+   * Relies on the node references if the node does not belong to the graph
+   *
+   * @param node the node
+   * @param func the function to apply, taking a const Tfo reference
+   */
+  template<class F>
+  void forEachTfo(const Node &node, F &&func) const;
+
+  /**
+   * @brief Apply a function on each converter connected to a node
+   *
+   * Relies on the node references if the node does not belong to the graph
+   *
+   * @param node the node
+   * @param func the function to apply, taking a const Converter reference
+   */
+  template<class F>
+  void forEachConverter(const Node &node, F &&func) const;
+
+  /**
+   * @brief Release the node references of the nodes of the graph
+   *
+   * The graph becomes the only store of their topology. This also breaks the reference cycles between neighbour nodes.
+   */
+  void releaseNodeReferences();
+
+ private:
+  /**
+   * @brief Relation between nodes and other elements, in compressed sparse row format
+   */
+  struct CompressedRows {
+    /**
+     * @brief Retrieve the elements related to a node
+     * @param row the index of the node
+     * @returns the indexes of the elements related to the node
+     */
+    Range<Index> row(Index row) const { return Range<Index>(values.data() + offsets[row], values.data() + offsets[row + 1]); }
+
+    /// @brief Close the row of the current node, the next added values being related to the next node
+    void closeRow() { offsets.push_back(static_cast<Index>(values.size())); }
+
+    std::vector<Index> offsets = std::vector<Index>(1, 0);  ///< position of the first element related to each node, plus the total number of values
+    std::vector<Index> values;                              ///< indexes of the related elements, node after node
+  };
+
+ private:
+  std::vector<std::shared_ptr<Node>> nodes_;   ///< nodes of the graph
+  std::vector<const Line *> lines_;            ///< lines of the graph
+  std::vector<const Tfo *> tfos_;              ///< transformers of the graph
+  std::vector<const Converter *> converters_;  ///< converters of the graph
+  CompressedRows neighbours_;                  ///< neighbours of each node
+  CompressedRows nodeLines_;                   ///< lines connected to each node
+  CompressedRows nodeTfos_;                    ///< transformers connected to each node
+  CompressedRows nodeConverters_;              ///< converters connected to each node
+};
+
+template<class F>
+void NetworkGraph::forEachLine(const Node &node, F &&func) const {
+  if (contains(node)) {
+    for (auto lineIndex : lines(node.index)) {
+      func(line(lineIndex));
+    }
+  } else {
+    for (const auto &line : node.lines) {
+      func(*line.lock());
+    }
+  }
+}
+
+template<class F>
+void NetworkGraph::forEachTfo(const Node &node, F &&func) const {
+  if (contains(node)) {
+    for (auto tfoIndex : tfos(node.index)) {
+      func(tfo(tfoIndex));
+    }
+  } else {
+    for (const auto &tfo : node.tfos) {
+      func(*tfo.lock());
+    }
+  }
+}
+
+template<class F>
+void NetworkGraph::forEachConverter(const Node &node, F &&func) const {
+  if (contains(node)) {
+    for (auto converterIndex : converters(node.index)) {
+      func(converter(converterIndex));
+    }
+  } else {
+    for (const auto &converter : node.converters) {
+      func(*converter.lock());
+    }
+  }
+}
+
+}  // namespace inputs
+}  // namespace dfl
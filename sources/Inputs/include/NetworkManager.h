@@ -18,13 +18,18 @@
 #pragma once
 
 #include "HvdcLine.h"
+#include "NetworkGraph.h"
 #include "Node.h"
 
 #include <DYNComponentInterface.h>
 #include <DYNDataInterface.h>
+#include <DYNNetworkInterface.h>
+#include <DYNVoltageLevelInterface.h>
 #include <boost/filesystem.hpp>
 #include <boost/optional.hpp>
 #include <boost/shared_ptr.hpp>
+#include <exception>
+#include <functional>
 #include <map>
 #include <memory>
 #include <unordered_map>
@@ -55,9 +60,18 @@ class NetworkManager {
   /**
    * @brief Constructor
    *
+   * The voltage levels of the network are processed independently from each other, concurrently if more than one thread is requested.
+   * The resulting node tree is the same whatever the number of threads.
+   *
+   * If a snapshot cache directory is given, the node tree is restored from the snapshot of the network file found in this directory, if any and valid.
+   * Otherwise the node tree is built from the network file and its snapshot is saved into the directory for the next runs.
+   *
    * @param filepath network file path
+   * @param nbThreads number of threads to use to build the node tree
+   * @param snapshotCacheDirectory directory of the network snapshots, empty to disable the snapshot cache
    */
-  explicit NetworkManager(const boost::filesystem::path &filepath);
+  explicit NetworkManager(const boost::filesystem::path &filepath, unsigned int nbThreads = 1,
+                          const boost::filesystem::path &snapshotCacheDirectory = boost::filesystem::path());
 
   /**
    * @brief Register a callback to call at each node
@@ -73,6 +87,16 @@ class NetworkManager {
    */
   void walkNodes() const;
 
+  /**
+   * @brief Walk through nodes with a visitor
+   *
+   * The visitor is called on each node, without going through the registered callbacks
+   *
+   * @param visitor the visitor, taking a const reference to the node pointer
+   */
+  template<class Visitor>
+  void walkNodes(Visitor &&visitor) const;
+
   /**
    * @brief Retrieve the slack node if it is given in the network file
    *
@@ -83,9 +107,27 @@ class NetworkManager {
   /**
    * @brief Retrieve data interface
    *
+   * The data interface is built on first call if the node tree was restored from a network snapshot
+   *
    * @returns data interface
    */
-  boost::shared_ptr<DYN::DataInterface> dataInterface() const { return interface_; }
+  boost::shared_ptr<DYN::DataInterface> dataInterface() const;
+
+  /**
+   * @brief Determines if the node tree was restored from a network snapshot
+   * @returns true if the node tree was restored from a network snapshot, false if it was built from the network file
+   */
+  bool isRestoredFromSnapshot() const { return restoredFromSnapshot_; }
+
+  /**
+   * @brief Retrieve the index based graph of the network
+   *
+   * Nodes are indexed following their id order. The graph is the only store of the topology of the nodes: their references
+   * to their neighbours, lines, transformers and converters are released once it is built.
+   *
+   * @returns the network graph
+   */
+  const NetworkGraph &graph() const { return graph_; }
 
   /**
    * @brief Retrieve the hvdc lines of the network
@@ -112,19 +154,109 @@ class NetworkManager {
    * @brief determines if the network is at least partially conditioned
    * @returns true if at least one component has initial conditions set, false otherwise
    */
-  bool isPartiallyConditioned() const { return isPartiallyConditioned_; }
+  bool isPartiallyConditioned() const { return conditioning_.isPartiallyConditioned; }
 
   /**
    * @brief determines if the network is fully conditioned
    * @returns true if all components have initial conditions set, false otherwise
    */
-  bool isFullyConditioned() const { return isFullyConditioned_; }
+  bool isFullyConditioned() const { return conditioning_.isFullyConditioned; }
 
  private:
+  friend class NetworkSnapshot;
+
+  /// @brief Conditioning status of a set of network components
+  struct ConditioningStatus {
+    /**
+     * @brief Update the status according to the conditioning status of a component
+     * @param componentInterface the data interface of the component
+     */
+    void update(const std::shared_ptr<DYN::ComponentInterface> &componentInterface);
+
+    /**
+     * @brief Merge the status of another set of components into this one
+     * @param other the status to merge
+     */
+    void merge(const ConditioningStatus &other);
+
+    bool isPartiallyConditioned = false;  ///< true if at least one component has initial conditions set, false otherwise
+    bool isFullyConditioned = true;       ///< true if all components have initial conditions set, false otherwise
+  };
+
+  /**
+   * @brief Part of the node tree relative to a single voltage level
+   *
+   * A shard only references the nodes of its own voltage level, so that the shards of different voltage levels can be built concurrently.
+   * Everything depending on the rest of the network is recorded in the shard and resolved when the shard is merged into the node tree.
+   */
+  struct VoltageLevelShard {
+    std::shared_ptr<VoltageLevel> voltageLevel;    ///< voltage level, containing the nodes of the shard
+    std::shared_ptr<Node> slackNode;               ///< slack node defined in network, if it belongs to the voltage level
+    std::vector<BusId> regulatedBuses;             ///< buses to register in the regulation map, in network order
+    ConditioningStatus conditioning;               ///< conditioning status of the components of the voltage level
+    std::vector<std::function<void()>> debugLogs;  ///< debug logs to perform when merging the shard, in network order
+    std::exception_ptr error;                      ///< error raised while building the shard, if any
+  };
+
+  /// @brief Bus regulated by a generator or a static var compensator
+  struct RegulatedBus {
+    BusId id;     ///< id of the regulated bus
+    double vNom;  ///< nominal voltage of the regulated bus
+  };
+  using RegulatedBusesByElement = std::unordered_map<std::string, RegulatedBus>;  ///< alias for the regulated buses by regulating element id
+
+  /**
+   * @brief Resolve the buses regulated by the generators and the static var compensators of the network
+   *
+   * The service manager computes the regulated buses on demand and is not known to be safe to use from several threads: the buses
+   * are resolved once, before the voltage level shards are built
+   *
+   * @param network the network data interface
+   * @returns the regulated buses by regulating element id, for the elements regulating a bus
+   */
+  RegulatedBusesByElement resolveRegulatedBuses(const std::shared_ptr<DYN::NetworkInterface> &network) const;
+
+  /**
+   * @brief Resolve the buses of the network that are connected to the network
+   *
+   * As the regulated buses, they are resolved once with the service manager, before the voltage level shards are built
+   *
+   * @param network the network data interface
+   * @returns the ids of the connected buses
+   */
+  std::unordered_set<BusId> resolveConnectedBuses(const std::shared_ptr<DYN::NetworkInterface> &network) const;
+
   /**
    * @brief Build node tree from data interface
+   *
+   * @param nbThreads number of threads to use to build the voltage level shards
+   */
+  void buildTree(unsigned int nbThreads);
+
+  /**
+   * @brief Build the shard of a voltage level
+   *
+   * Only reads the values of the components of the voltage level, without using the service manager, so that it can be called concurrently
+   * for different voltage levels
+   *
+   * @param networkVL the voltage level data interface
+   * @param slackNodeId the id of the slack node defined in network, if any
+   * @param regulatedBusesByElement the regulated buses by regulating element id
+   * @param connectedBuses the ids of the connected buses
+   * @param shard the shard to fill
    */
-  void buildTree();
+  void buildVoltageLevelShard(const std::shared_ptr<DYN::VoltageLevelInterface> &networkVL, const boost::optional<std::string> &slackNodeId,
+                              const RegulatedBusesByElement &regulatedBusesByElement, const std::unordered_set<BusId> &connectedBuses,
+                              VoltageLevelShard &shard) const;
+
+  /**
+   * @brief Merge a voltage level shard into the node tree
+   *
+   * Shards are merged following the voltage levels order of the network so that the result does not depend on the way they were built
+   *
+   * @param shard the shard to merge
+   */
+  void mergeVoltageLevelShard(const VoltageLevelShard &shard);
 
   /**
    * @brief Update a bus regulating map according to internal interface
@@ -133,25 +265,28 @@ class NetworkManager {
    */
   static void updateMapRegulatingBuses(BusMapRegulating &map, const std::shared_ptr<Node> &node);
 
-  /**
-   * @brief Update the network conditioning status based on a component conditioning status
-   * @param componentInterface the data interface to use
-   */
-  void updateConditioningStatus(const std::shared_ptr<DYN::ComponentInterface> &componentInterface);
-
  private:
-  boost::shared_ptr<DYN::DataInterface> interface_;           ///< data interface
+  boost::filesystem::path networkFilepath_;                   ///< network file path
+  mutable boost::shared_ptr<DYN::DataInterface> interface_;   ///< data interface, built on demand
+  bool restoredFromSnapshot_;                                 ///< whether the node tree was restored from a network snapshot
   std::shared_ptr<Node> slackNode_;                           ///< Slack node defined in network, if any
-  std::map<Node::NodeId, std::shared_ptr<Node>> nodes_;       ///< nodes representing the node tree
+  std::map<Node::NodeId, std::shared_ptr<Node>> nodes_;       ///< nodes representing the node tree, by id, while it is built
   std::vector<ProcessNodeCallback> nodesCallbacks_;           ///< list of callback or nodes
   std::vector<std::shared_ptr<HvdcLine>> hvdcLines_;          ///< hvdc Lines
   std::vector<std::shared_ptr<VoltageLevel>> voltagelevels_;  ///< Voltage levels elements
   std::vector<std::shared_ptr<Line>> lines_;                  ///< List of the lines
   std::vector<std::shared_ptr<Tfo>> tfos_;                    ///< List of transformers
+  NetworkGraph graph_;                                        ///< index based graph of the network
   BusMapRegulating mapBusIdToNumberOfRegulation_;             ///< mapping of busId and the number of generators or VSC converters that regulate them
-  bool isPartiallyConditioned_;                               ///< true if the network is at last partially conditioned, false otherwise
-  bool isFullyConditioned_;                                   ///< true if the network is fully conditioned, false otherwise
+  ConditioningStatus conditioning_;                           ///< conditioning status of the network
 };
 
+template<class Visitor>
+void NetworkManager::walkNodes(Visitor &&visitor) const {
+  for (NetworkGraph::Index i = 0; i < graph_.nbNodes(); ++i) {
+    visitor(graph_.node(i));
+  }
+}
+
 }  // namespace inputs
 }  // namespace dfl
@@ -0,0 +1,95 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  NetworkSnapshot.h
+ *
+ * @brief Network snapshot header file
+ *
+ */
+
+#pragma once
+
+#include "NetworkManager.h"
+
+#include <boost/filesystem.hpp>
+#include <string>
+
+namespace dfl {
+namespace inputs {
+
+/**
+ * @brief Persistent binary snapshot of the node tree of a network manager
+ *
+ * The snapshot contains everything the network manager derives from the network file: voltage levels, nodes and their elements,
+ * lines, transformers, hvdc lines, bus regulation map, slack node and conditioning status.
+ *
+ * A snapshot is identified by a key computed from the content of the network file, the versions of dynaflow launcher and of the dynawo
+ * library it is built against, and the version of the snapshot format. The key is stored in the snapshot so that a snapshot not matching the network file is never restored.
+ * Snapshots are read through a memory mapping of the file.
+ */
+class NetworkSnapshot {
+ public:
+  /**
+   * @brief Compute the key of the snapshot of a network file
+   *
+   * @param networkFilepath the network file path
+   * @returns the key of the snapshot, as an hexadecimal string
+   */
+  static std::string computeKey(const boost::filesystem::path &networkFilepath);
+
+  /**
+   * @brief Compute the path of a snapshot in a cache directory
+   *
+   * @param cacheDirectory the cache directory
+   * @param key the key of the snapshot
+   * @returns the snapshot file path
+   */
+  static boost::filesystem::path filepath(const boost::filesystem::path &cacheDirectory, const std::string &key);
+
+  /**
+   * @brief Save the node tree of a network manager into a snapshot
+   *
+   * The snapshot is written in a temporary file which is renamed once complete, so that concurrent runs never read a partial snapshot.
+   * Failing to save the snapshot is not an error: a warning is logged and the run goes on.
+   *
+   * @param filepath the snapshot file path
+   * @param key the key of the snapshot
+   * @param manager the network manager whose node tree was built from the network file
+   */
+  static void write(const boost::filesystem::path &filepath, const std::string &key, const NetworkManager &manager);
+
+  /**
+   * @brief Restore the node tree of a network manager from a snapshot
+   *
+   * The network manager is left untouched if the snapshot does not exist, does not match the key or cannot be read.
+   *
+   * @param filepath the snapshot file path
+   * @param key the expected key of the snapshot
+   * @param manager the network manager to fill
+   * @returns true if the node tree was restored, false otherwise
+   */
+  static bool read(const boost::filesystem::path &filepath, const std::string &key, NetworkManager &manager);
+
+ private:
+  /**
+   * @brief Restore the node tree of a network manager from the content of a snapshot
+   *
+   * @param data the content of the snapshot
+   * @param size the size of the content of the snapshot
+   * @param key the expected key of the snapshot
+   * @param manager the network manager to fill
+   * @returns true if the node tree was restored, false if the snapshot does not match the key
+   */
+  static bool restore(const char *data, std::size_t size, const std::string &key, NetworkManager &manager);
+};
+
+}  // namespace inputs
+}  // namespace dfl
@@ -18,12 +18,15 @@
 #pragma once
 
 #include "Behaviours.h"
+#include "SwitchTopology.h"
 
 #include <DYNServiceManagerInterface.h>
+#include <array>
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <string>
 #include <vector>
-#include <array>
 
 namespace dfl {
 /// @brief Namespace for inputs of Dynaflow launcher
@@ -46,8 +49,24 @@ struct VoltageLevel {
    */
   explicit VoltageLevel(const VoltageLevelId &vlid);
 
+  /**
+   * @brief Retrieve the representative connected bus of the voltage level
+   *
+   * The representative bus is the first node of the voltage level whose bus is connected. It is set when the node is built, so that
+   * it is only read afterwards, including concurrently.
+   *
+   * @returns the id of the representative bus, or an empty string if no bus of the voltage level is connected
+   */
+  const std::string &representativeConnectedBus() const { return representativeConnectedBus_; }
+
   const VoltageLevelId id;                   ///< id
   std::vector<std::shared_ptr<Node>> nodes;  ///< nodes contained in the voltage level
+  SwitchTopology switchTopology;             ///< connectivity of the nodes through the closed switches of the voltage level
+
+ private:
+  friend class Node;
+
+  std::string representativeConnectedBus_;  ///< first connected bus of the voltage level, empty if none
 };
 
 /**
@@ -206,7 +225,8 @@ struct BusBarSection {
  */
 class Node {
  public:
-  using NodeId = std::string;  ///< node id definition
+  using NodeId = std::string;       ///< node id definition
+  using NodeIndex = std::uint32_t;  ///< node index definition, in a network graph
 
   /**
    * @brief Builder for node
@@ -219,13 +239,37 @@ class Node {
    * @param shunts the list of the shunts connectable to this node
    * @param fictitious the flag to mark the node is fictitious
    * @param serviceManagerNode the dynawo service manager to use
+   * @param busConnected whether the node is connected to the network, resolved beforehand as the service manager is not used concurrently
+   *
+   * @returns the built node
+   */
+  static std::shared_ptr<Node> build(const NodeId &id, const std::shared_ptr<VoltageLevel> &vl, double nominalVoltage, const std::vector<Shunt> &shunts,
+                                     bool fictitious = false, boost::shared_ptr<DYN::ServiceManagerInterface> serviceManagerNode = nullptr,
+                                     bool busConnected = true);
+
+  /**
+   * @brief Builder for node whose connections inside its voltage level are already known
+   *
+   * Used to restore a node from a network snapshot, without any dynawo service manager
+   *
+   * @param id the node id
+   * @param vl the voltage level element containing the node
+   * @param nominalVoltage the nominal voltage of the node
+   * @param shunts the list of the shunts connectable to this node
+   * @param fictitious the flag to mark the node is fictitious
+   * @param busesConnected the buses linked to this node through its voltage level
+   * @param busConnected whether the node is connected to the network
    *
    * @returns the built node
    */
   static std::shared_ptr<Node> build(const NodeId &id, const std::shared_ptr<VoltageLevel> &vl, double nominalVoltage, const std::vector<Shunt> &shunts,
-                                     bool fictitious = false, boost::shared_ptr<DYN::ServiceManagerInterface> serviceManagerNode = nullptr);
+                                     bool fictitious, const std::vector<std::string> &busesConnected, bool busConnected);
+
   /**
    * @brief Retrieve the buses linked to this node through its voltage level
+   *
+   * Relies on the switch topology of the voltage level if the node belongs to it, on the dynawo service manager otherwise, if any
+   *
    * @returns the list of the bus ids linked to this node
    */
   const std::vector<std::string> &getBusesConnectedByVoltageLevel();
@@ -233,23 +277,24 @@ class Node {
    * @brief Returns true if this node is connected to the network
    * @returns true if this node is connected to the network
    */
-  bool isBusConnected();
+  bool isBusConnected() const { return busConnected; }
 
   const NodeId id;                                                 ///< node id
   const std::weak_ptr<VoltageLevel> voltageLevel;                  ///< voltage level containing the node
   const double nominalVoltage;                                     ///< Nominal voltage of the node
   const std::vector<Shunt> shunts;                                 ///< Shunts connectable to the node
   const bool fictitious;                                           ///< Flag to mark the node is fictitious
-  std::vector<std::weak_ptr<Line>> lines;                          ///< Lines connected to this node
-  std::vector<std::weak_ptr<Tfo>> tfos;                            ///< Transformers connected to this node
-  std::vector<std::shared_ptr<Node>> neighbours;                   ///< list of neighbours
+  std::vector<std::weak_ptr<Line>> lines;                          ///< Lines connected to this node, until the network graph is built
+  std::vector<std::weak_ptr<Tfo>> tfos;                            ///< Transformers connected to this node, until the network graph is built
+  std::vector<std::shared_ptr<Node>> neighbours;                   ///< list of neighbours, until the network graph is built
   std::vector<Load> loads;                                         ///< list of loads associated to this node
   std::vector<Generator> generators;                               ///< list of generators associated to this node
-  std::vector<std::weak_ptr<Converter>> converters;                ///< list of converter associated to this node
+  std::vector<std::weak_ptr<Converter>> converters;                ///< list of converter associated to this node, until the network graph is built
   std::vector<StaticVarCompensator> svarcs;                        ///< List of static var compensators
   std::vector<DanglingLine> danglingLines;                         ///< List of dangling lines
   std::vector<BusBarSection> busBarSections;                       ///< List of bus bar sections
   boost::shared_ptr<DYN::ServiceManagerInterface> serviceManager;  ///< Service manager to use
+  NodeIndex index = std::numeric_limits<NodeIndex>::max();         ///< index of the node in the network graph it belongs to, if any
 
  private:
   /**
@@ -263,13 +308,15 @@ class Node {
    * @param shunts the list of the shunts connectable to this node
    * @param fictitious the flag to mark if node is fictitious
    * @param serviceManagerNode the dynawo service manager to use
+   * @param busConnected whether the node is connected to the network
    */
   Node(const NodeId &id, const std::shared_ptr<VoltageLevel> vl, double nominalVoltage, const std::vector<Shunt> &shunts, bool fictitious,
-       boost::shared_ptr<DYN::ServiceManagerInterface> serviceManagerNode);
+       boost::shared_ptr<DYN::ServiceManagerInterface> serviceManagerNode, bool busConnected);
 
  private:
   bool busesConnectedInitialized;           ///< true if busesConnected was filled with getBusesConnectedByVoltageLevel, false otherwise
   std::vector<std::string> busesConnected;  ///< List of buses connected by this switch
+  bool busConnected;                        ///< whether the node is connected to the network
 };
 
 /**
@@ -15,6 +15,8 @@
 
 #pragma once
 
+#include "InputArchive.h"
+
 #include <boost/filesystem.hpp>
 #include <string>
 #include <unordered_map>
@@ -211,8 +213,12 @@ class SettingDataBase {
   /**
    * @brief Constructor
    * @param settingFilePaths the setting documents file paths
+   * @param inputArchive the input archive the setting documents may belong to
+   * @param snapshotCacheDirectory directory of the data base snapshots, empty to disable the snapshot cache
    */
-  explicit SettingDataBase(const std::vector<boost::filesystem::path> & settingFilePaths);
+  explicit SettingDataBase(const std::vector<boost::filesystem::path> & settingFilePaths,
+                           const common::InputArchive & inputArchive = common::InputArchive::empty(),
+                           const boost::filesystem::path & snapshotCacheDirectory = boost::filesystem::path());
 
   /**
    * @brief Retrieve a parameter set with its id
@@ -222,6 +228,8 @@ class SettingDataBase {
   const Set& getSet(const std::string& id) const;
 
  private:
+  friend class DynamicDataBaseSnapshot;
+
   std::unordered_map<std::string, Set> sets_;  ///< list of the sets
 };
 
@@ -18,6 +18,7 @@
 #pragma once
 
 #include "Configuration.h"
+#include "InputArchive.h"
 #include "Options.h"
 
 #include <boost/filesystem.hpp>
@@ -42,6 +43,7 @@ struct SimulationParams {
   dfl::inputs::Configuration::SimulationKind simulationKind;        ///< type of simulation
   std::chrono::time_point<std::chrono::steady_clock> timeStart;     ///< time of the start of the simulation
   dfl::common::Options::RuntimeConfiguration const *runtimeConfig;  ///< runtime configuration of the program
+  dfl::common::InputArchive const *inputArchive;                    ///< input archive decoded in memory, nullptr to read all the inputs from disk
 };
 
 }  // namespace inputs
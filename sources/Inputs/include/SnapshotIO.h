@@ -0,0 +1,230 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  SnapshotIO.h
+ *
+ * @brief Binary snapshot reading and writing utilities header file
+ *
+ */
+
+#pragma once
+
+#include "Log.h"
+
+#include <boost/filesystem.hpp>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace dfl {
+namespace inputs {
+
+/**
+ * @brief Sequential writer of the content of a snapshot
+ */
+class SnapshotWriter {
+ public:
+  /**
+   * @brief Write an arithmetic value
+   * @param value the value to write
+   */
+  template<class T>
+  void write(T value) {
+    buffer_.append(reinterpret_cast<const char *>(&value), sizeof(T));
+  }
+
+  /**
+   * @brief Write a boolean
+   * @param value the boolean to write
+   */
+  void writeBool(bool value) { write<std::uint8_t>(value ? 1 : 0); }
+
+  /**
+   * @brief Write a string
+   * @param value the string to write
+   */
+  void writeString(const std::string &value) {
+    write(static_cast<std::uint32_t>(value.size()));
+    buffer_.append(value);
+  }
+
+  /**
+   * @brief Write a list of strings
+   * @param values the strings to write
+   */
+  void writeStrings(const std::vector<std::string> &values) {
+    write(static_cast<std::uint32_t>(values.size()));
+    for (const auto &value : values) {
+      writeString(value);
+    }
+  }
+
+  /**
+   * @brief Retrieve the content written so far
+   * @returns the content
+   */
+  const std::string &buffer() const { return buffer_; }
+
+ private:
+  std::string buffer_;  ///< content written so far
+};
+
+/**
+ * @brief Sequential reader of the content of a snapshot
+ *
+ * Reads never go past the end of the content: an error is raised instead
+ */
+class SnapshotReader {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param data the content of the snapshot
+   * @param size the size of the content
+   */
+  SnapshotReader(const char *data, std::size_t size) : current_(data), end_(data + size) {}
+
+  /**
+   * @brief Read an arithmetic value
+   * @returns the value
+   */
+  template<class T>
+  T read() {
+    require(sizeof(T));
+    T value;
+    std::memcpy(&value, current_, sizeof(T));
+    current_ += sizeof(T);
+    return value;
+  }
+
+  /**
+   * @brief Read a boolean
+   * @returns the boolean
+   */
+  bool readBool() { return read<std::uint8_t>() != 0; }
+
+  /**
+   * @brief Read a string
+   * @returns the string
+   */
+  std::string readString() {
+    const auto size = read<std::uint32_t>();
+    require(size);
+    std::string value(current_, size);
+    current_ += size;
+    return value;
+  }
+
+  /**
+   * @brief Read a list of strings
+   * @returns the strings
+   */
+  std::vector<std::string> readStrings() {
+    const auto size = read<std::uint32_t>();
+    std::vector<std::string> values;
+    for (std::uint32_t i = 0; i < size; ++i) {
+      values.push_back(readString());
+    }
+    return values;
+  }
+
+  /**
+   * @brief Read the index of an element
+   * @param nbElements the number of elements the index refers to
+   * @returns the index
+   */
+  std::uint32_t readIndex(std::size_t nbElements) {
+    const auto index = read<std::uint32_t>();
+    if (index >= nbElements) {
+      throw DFLError(SnapshotInconsistent);
+    }
+    return index;
+  }
+
+  /**
+   * @brief Read a sequence of raw bytes
+   * @param size the number of bytes to read
+   * @returns the first byte of the sequence
+   */
+  const char *readBytes(std::size_t size) {
+    require(size);
+    const char *bytes = current_;
+    current_ += size;
+    return bytes;
+  }
+
+  /**
+   * @brief Check that the whole content was read
+   * @returns true if no byte remains to be read
+   */
+  bool atEnd() const { return current_ == end_; }
+
+ private:
+  /**
+   * @brief Check that enough bytes remain to be read
+   * @param size the number of bytes to be read
+   */
+  void require(std::size_t size) const {
+    if (static_cast<std::size_t>(end_ - current_) < size) {
+      throw DFLError(SnapshotTruncated);
+    }
+  }
+
+ private:
+  const char *current_;  ///< next byte to read
+  const char *end_;      ///< past the last byte of the content
+};
+
+/**
+ * @brief Snapshot file utilities
+ */
+namespace snapshot {
+
+static const std::uint64_t hashSeed = 14695981039346656037ULL;  ///< initial value of the hashes of the snapshot keys
+
+/**
+ * @brief Update a FNV-1a hash with a sequence of bytes
+ *
+ * @param hash the hash to update
+ * @param data the bytes to hash
+ * @param size the number of bytes to hash
+ * @returns the updated hash
+ */
+std::uint64_t hashBytes(std::uint64_t hash, const char *data, std::size_t size);
+
+/**
+ * @brief Format the key of a snapshot
+ *
+ * The versions of dynaflow launcher, of the dynawo library it is built against and of the snapshot format are added to the hash,
+ * so that a snapshot saved by another version is never restored
+ *
+ * @param hash the hash of the content the snapshot is built from
+ * @param formatVersion the version of the snapshot format
+ * @returns the key of the snapshot, as an hexadecimal string
+ */
+std::string formatKey(std::uint64_t hash, std::uint32_t formatVersion);
+
+/**
+ * @brief Save the content of a snapshot into a file
+ *
+ * The content is written in a temporary file which is renamed once complete, so that concurrent runs never read a partial snapshot.
+ * An error is raised if the file cannot be written.
+ *
+ * @param filepath the snapshot file path
+ * @param content the content of the snapshot
+ */
+void save(const boost::filesystem::path &filepath, const std::string &content);
+
+}  // namespace snapshot
+
+}  // namespace inputs
+}  // namespace dfl
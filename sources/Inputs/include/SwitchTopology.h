@@ -0,0 +1,111 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  SwitchTopology.h
+ *
+ * @brief Switch topology of a voltage level header file
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace dfl {
+namespace inputs {
+
+/**
+ * @brief Connectivity of the buses of a voltage level through its closed switches
+ *
+ * Buses are gathered with a union-find structure while the switches are registered. Once built, the buses connected by switch
+ * to a given bus are retrieved without traversing the switches again.
+ */
+class SwitchTopology {
+ public:
+  using BusId = std::string;             ///< alias for bus id
+  using ComponentIndex = std::uint32_t;  ///< alias for the index of a set of buses connected by switch
+
+  /**
+   * @brief Register a bus
+   *
+   * Buses already registered are ignored
+   *
+   * @param busId the bus id
+   */
+  void addBus(const BusId &busId);
+
+  /**
+   * @brief Register a closed switch between two buses
+   *
+   * Buses not yet registered are registered first
+   *
+   * @param busId1 the id of the first bus of the switch
+   * @param busId2 the id of the second bus of the switch
+   */
+  void connect(const BusId &busId1, const BusId &busId2);
+
+  /**
+   * @brief Compute the sets of buses connected by switch
+   *
+   * To be called once all buses and switches are registered, before any query
+   */
+  void build();
+
+  /**
+   * @brief Determines if a bus belongs to the topology
+   * @param busId the bus id
+   * @returns true if the bus was registered, false otherwise
+   */
+  bool contains(const BusId &busId) const { return indexes_.count(busId) > 0; }
+
+  /**
+   * @brief Retrieve the set of buses connected by switch a bus belongs to
+   * @param busId the bus id, which must be registered
+   * @returns the index of the set of buses
+   */
+  ComponentIndex component(const BusId &busId) const { return components_[indexes_.at(busId)]; }
+
+  /**
+   * @brief Retrieve the number of sets of buses connected by switch
+   * @returns the number of sets
+   */
+  std::size_t nbComponents() const { return componentOffsets_.size() - 1; }
+
+  /**
+   * @brief Retrieve the buses connected by switch to a bus
+   * @param busId the bus id, which must be registered
+   * @returns the ids of the other buses of the set the bus belongs to, in registration order
+   */
+  std::vector<BusId> busesConnected(const BusId &busId) const;
+
+ private:
+  /**
+   * @brief Retrieve the representative of the set of a bus, compressing the path to it
+   * @param index the index of the bus
+   * @returns the index of the representative bus
+   */
+  std::size_t find(std::size_t index);
+
+ private:
+  std::unordered_map<BusId, std::size_t> indexes_;                              ///< index of each bus, in registration order
+  std::vector<BusId> buses_;                                                    ///< buses, by index
+  std::vector<std::size_t> parents_;                                            ///< parent of each bus in the union-find structure
+  std::vector<std::size_t> sizes_;                                              ///< size of the set of each representative bus
+  std::vector<ComponentIndex> components_;                                      ///< set of each bus, once built
+  std::vector<std::size_t> componentOffsets_ = std::vector<std::size_t>(1, 0);  ///< position of the first bus of each set, plus the number of buses
+  std::vector<std::size_t> componentBuses_;                                     ///< indexes of the buses, set after set
+};
+
+}  // namespace inputs
+}  // namespace dfl
@@ -15,8 +15,8 @@
 
 #include "AssemblingDataBase.h"
 #include "Constants.h"
+#include "DynamicDataBaseSnapshot.h"
 #include "XsdPath.hpp"
-#include <fstream>
 #include <xml/sax/parser/ParserFactory.h>
 
 namespace parser = xml::sax::parser;
@@ -25,10 +25,23 @@ namespace file = boost::filesystem;
 namespace dfl {
 namespace inputs {
 
-AssemblingDataBase::AssemblingDataBase(const std::vector<boost::filesystem::path> &assemblingFilePaths) : containsSVC_(false) {
+AssemblingDataBase::AssemblingDataBase(const std::vector<boost::filesystem::path> &assemblingFilePaths, const common::InputArchive &inputArchive,
+                                       const boost::filesystem::path &snapshotCacheDirectory)
+    : containsSVC_(false) {
   if (assemblingFilePaths.empty())
     return;
 
+  std::string snapshotKey;
+  boost::filesystem::path snapshotFilepath;
+  if (!snapshotCacheDirectory.empty()) {
+    snapshotKey = DynamicDataBaseSnapshot::computeKey("assembling", assemblingFilePaths, inputArchive);
+    snapshotFilepath = DynamicDataBaseSnapshot::filepath(snapshotCacheDirectory, "assembling", snapshotKey);
+    if (DynamicDataBaseSnapshot::read(snapshotFilepath, snapshotKey, *this)) {
+      LOG(info, DynamicDataBaseSnapshotLoaded, snapshotFilepath.generic_string());
+      return;
+    }
+  }
+
   parser::ParserPtr parser = parser::ParserFactory().createParser();
   file::path xsdPath = getXsdPath("assembling_dynaflow.xsd");
   if (xsdPath != "")
@@ -36,18 +49,21 @@ AssemblingDataBase::AssemblingDataBase(const std::vector<boost::filesystem::path
 
   AssemblingXmlDocument settingXml(*this);
   for (const boost::filesystem::path &path : assemblingFilePaths) {
-    std::ifstream in(path.c_str());
-    if (!in) {
+    auto in = inputArchive.open(path);
+    if (!*in) {
       LOG(warn, DynModelFileNotFound, path.generic_string());
       continue;
     }
 
     try {
-      parser->parse(in, settingXml, xsdPath != "");
+      parser->parse(*in, settingXml, xsdPath != "");
     } catch (const xml::sax::parser::ParserException &e) {
       throw DFLError(DynModelFileReadError, path.generic_string(), e.what());
     }
   }
+
+  if (!snapshotFilepath.empty())
+    DynamicDataBaseSnapshot::write(snapshotFilepath, snapshotKey, *this);
 }
 
 const AssemblingDataBase::MacroConnection &AssemblingDataBase::getMacroConnection(const std::string &id, bool network) const {
@@ -218,10 +218,15 @@ static void updateFileNameValue(std::string &fileName, std::string fileExtension
 
 }  // namespace helper
 
-Configuration::Configuration(const boost::filesystem::path &filepath, SimulationKind simulationKind) : filepath_(filepath), simulationKind_(simulationKind) {
+Configuration::Configuration(const boost::filesystem::path &filepath, SimulationKind simulationKind, const common::InputArchive &inputArchive)
+    : filepath_(filepath), simulationKind_(simulationKind) {
   try {
     boost::property_tree::ptree tree;
-    boost::property_tree::read_json(filepath.generic_string(), tree);
+    auto stream = inputArchive.open(filepath);
+    if (!*stream) {
+      throw boost::property_tree::json_parser_error("cannot open file", filepath.generic_string(), 0);
+    }
+    boost::property_tree::read_json(*stream, tree);
 
     /**
      * We assume the following format for the configuration in JSON format
@@ -267,17 +272,32 @@ Configuration::Configuration(const boost::filesystem::path &filepath, Simulation
     helper::updateValue(minTimeStep_, config, "MinTimeStep", saMode, parameterValueModified_);
     helper::updateValue(tfoVoltageLevel_, config, "TfoVoltageLevel", saMode, parameterValueModified_);
     helper::updateValue(timeTableStep_, config, "TimeTable", saMode, parameterValueModified_);
+    helper::updateValue(nbThreads_, config, "NbThreads", saMode, parameterValueModified_);
+    helper::updateValue(useSingleDiagramFile_, config, "SingleDiagramFile", saMode, parameterValueModified_);
     helper::updateActivePowerCompensationValue(activePowerCompensation_, config, saMode, parameterValueModified_);
     helper::updatePathValue(startingDumpFilePath_, config, "StartingDumpFile", prefixConfigFile, true);
     helper::updatePathValue(criteriaFilePath_, config, "CriteriaPath", prefixConfigFile, saMode);
     if (simulationKind_ == dfl::inputs::Configuration::SimulationKind::SECURITY_ANALYSIS) {
       helper::updateValue(timeOfEvent_, config, "TimeOfEvent", true, parameterValueModified_);
+      helper::updateValue(useSingleEventsParFile_, config, "SingleEventsParFile", true, parameterValueModified_);
+      helper::updateValue(costBasedScenarioOrdering_, config, "CostBasedScenarioOrdering", true, parameterValueModified_);
     }
   } catch (std::exception &e) {
     throw DFLError(ErrorConfigFileRead, e.what());
   }
 }
 
+std::vector<boost::filesystem::path> Configuration::dynawoInputFilePaths() const {
+  std::vector<boost::filesystem::path> filepaths;
+  if (!startingDumpFilePath_.empty()) {
+    filepaths.push_back(startingDumpFilePath_);
+  }
+  if (!criteriaFilePath_.empty()) {
+    filepaths.push_back(criteriaFilePath_);
+  }
+  return filepaths;
+}
+
 void Configuration::sanityCheck() const {
   if (simulationKind_ == dfl::inputs::Configuration::SimulationKind::SECURITY_ANALYSIS && !startingDumpFilePath_.empty() && !exists(startingDumpFilePath_)) {
     throw DFLError(StartingDumpFileNotFound, startingDumpFilePath_.generic_string());
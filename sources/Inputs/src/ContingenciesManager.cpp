@@ -17,24 +17,180 @@
 
 #include "ContingenciesManager.h"
 
+#include "JsonReader.h"
 #include "Log.h"
 
-#include <boost/property_tree/json_parser.hpp>
-#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/json_parser/error.hpp>
+
+#include <utility>
 
 namespace dfl {
 namespace inputs {
 
-ContingenciesManager::ContingenciesManager(const boost::filesystem::path &filepath) {
+namespace {
+
+/**
+ * @brief Streaming reader of the contingencies of a JSON document
+ *
+ * The contingencies are built while the document is read, one at a time, so that the memory used only depends on the
+ * contingencies kept.
+ */
+class ContingenciesReader {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param reader the reader of the JSON document
+   * @param contingencies the list to add the valid contingencies to
+   */
+  ContingenciesReader(JsonReader &reader, std::vector<Contingency> &contingencies) : reader_(reader), contingencies_(contingencies) {}
+
+  /**
+   * @brief Read the whole document
+   */
+  void read() {
+    bool found = false;
+    reader_.beginObject();
+    bool first = true;
+    while (reader_.nextMember(key_, first)) {
+      if (key_ == "contingencies") {
+        readContingencies();
+        found = true;
+      } else {
+        reader_.skipValue();
+      }
+    }
+    reader_.end();
+    if (!found) {
+      reader_.error("no contingencies list");
+    }
+  }
+
+ private:
+  /// @brief Read the list of contingencies
+  void readContingencies() {
+    reader_.beginArray();
+    bool first = true;
+    while (reader_.nextItem(first)) {
+      readContingency();
+    }
+  }
+
+  /// @brief Read a contingency and add it to the list if all its elements have a valid type
+  void readContingency() {
+    reader_.beginObject();
+    const auto line = reader_.line();
+    bool hasId = false;
+    bool hasElements = false;
+    nbElements_ = 0;
+    bool first = true;
+    while (reader_.nextMember(key_, first)) {
+      if (key_ == "id") {
+        reader_.readScalar(contingencyId_);
+        hasId = true;
+      } else if (key_ == "elements") {
+        readElements();
+        hasElements = true;
+      } else {
+        reader_.skipValue();
+      }
+    }
+    if (!hasId) {
+      reader_.error("contingency without id", line);
+    }
+    if (!hasElements) {
+      reader_.error("contingency " + contingencyId_ + " without elements", line);
+    }
+
+    Contingency contingency(contingencyId_);
+    contingency.elements.reserve(nbElements_);
+    bool valid = true;
+    for (std::size_t i = 0; i < nbElements_; ++i) {
+      const auto &elementId = elements_[i].first;
+      const auto &elementTypeStr = elements_[i].second;
+      const auto elementType = ContingencyElement::typeFromString(elementTypeStr);
+      if (!elementType) {
+        valid = false;
+        LOG(warn, ContingencyInvalidBadElemType, contingency.id, elementId, elementTypeStr);
+        continue;
+      }
+      // We follow the same strategy applied in Dynawo: converting a 3-winding transformer to 3 2-winding transformers.
+      // The 3 2-winding transformers representing each leg will always be connected at least to the fictitious star bus.
+      // If any of the legs is connected to the main connected component, then the star bus will be also in the main cc.
+      // Even if one leg is disconnected, the contingency as a whole will be considered,
+      // because all 3 2-winding transformers will be connected at least at the start bus.
+      if (*elementType == ContingencyElement::Type::THREE_WINDINGS_TRANSFORMER) {
+        contingency.elements.emplace_back(elementId + "_1", ContingencyElement::Type::TWO_WINDINGS_TRANSFORMER);
+        contingency.elements.emplace_back(elementId + "_2", ContingencyElement::Type::TWO_WINDINGS_TRANSFORMER);
+        contingency.elements.emplace_back(elementId + "_3", ContingencyElement::Type::TWO_WINDINGS_TRANSFORMER);
+        LOG(debug, Contingency2WIsFrom3W, elementId);
+        LOG(debug, Contingency2WIsFrom3WLeg, elementId + "_1", "1");
+        LOG(debug, Contingency2WIsFrom3WLeg, elementId + "_2", "2");
+        LOG(debug, Contingency2WIsFrom3WLeg, elementId + "_3", "3");
+      } else {
+        contingency.elements.emplace_back(elementId, *elementType);
+      }
+    }
+    if (valid) {
+      contingencies_.push_back(std::move(contingency));
+    }
+  }
+
+  /// @brief Read the elements of the current contingency
+  void readElements() {
+    reader_.beginArray();
+    bool first = true;
+    while (reader_.nextItem(first)) {
+      // the strings of the previous contingencies are reused, to avoid allocations
+      if (nbElements_ == elements_.size()) {
+        elements_.emplace_back();
+      }
+      auto &element = elements_[nbElements_++];
+      reader_.beginObject();
+      const auto line = reader_.line();
+      bool hasId = false;
+      bool hasType = false;
+      bool firstMember = true;
+      while (reader_.nextMember(key_, firstMember)) {
+        if (key_ == "id") {
+          reader_.readScalar(element.first);
+          hasId = true;
+        } else if (key_ == "type") {
+          reader_.readScalar(element.second);
+          hasType = true;
+        } else {
+          reader_.skipValue();
+        }
+      }
+      if (!hasId || !hasType) {
+        reader_.error(std::string("contingency element without ") + (hasId ? "type" : "id"), line);
+      }
+    }
+  }
+
+ private:
+  JsonReader &reader_;                                         ///< reader of the JSON document
+  std::vector<Contingency> &contingencies_;                    ///< valid contingencies read so far
+  std::string key_;                                            ///< key of the current member
+  std::string contingencyId_;                                  ///< id of the current contingency
+  std::vector<std::pair<std::string, std::string>> elements_;  ///< id and type of the elements of the current contingency
+  std::size_t nbElements_ = 0;                                 ///< number of elements of the current contingency
+};
+
+}  // namespace
+
+ContingenciesManager::ContingenciesManager(const boost::filesystem::path &filepath, const common::InputArchive &inputArchive) {
   if (!filepath.empty()) {
-    load(filepath);
+    load(filepath, inputArchive);
   }
 }
 
-void ContingenciesManager::load(const boost::filesystem::path &filepath) {
+void ContingenciesManager::load(const boost::filesystem::path &filepath, const common::InputArchive &inputArchive) {
   try {
-    boost::property_tree::ptree tree;
-    boost::property_tree::read_json(filepath.generic_string(), tree);
+    auto stream = inputArchive.open(filepath);
+    if (!*stream) {
+      throw boost::property_tree::json_parser::json_parser_error("cannot open file", filepath.generic_string(), 0);
+    }
 
     /**
      * The JSON format for contingencies is inherited from Powsybl:
@@ -62,43 +218,8 @@ void ContingenciesManager::load(const boost::filesystem::path &filepath) {
      */
 
     LOG(info, ContingenciesReadingFrom, filepath.generic_string());
-    contingencies_.reserve(tree.get_child("contingencies").size());
-    for (const auto &contingencyPtree : tree.get_child("contingencies")) {
-      const auto &contingencyId = contingencyPtree.second.get<std::string>("id");
-
-      Contingency contingency(contingencyId);
-      bool valid = true;
-      for (const auto &elementPtree : contingencyPtree.second.get_child("elements")) {
-        const auto &elementId = elementPtree.second.get<std::string>("id");
-        const auto &elementTypeStr = elementPtree.second.get<std::string>("type");
-
-        const auto elementType = ContingencyElement::typeFromString(elementTypeStr);
-        if (elementType) {
-          // We follow the same strategy applied in Dynawo: converting a 3-winding transformer to 3 2-winding transformers.
-          // The 3 2-winding transformers representing each leg will always be connected at least to the fictitious star bus.
-          // If any of the legs is connected to the main connected component, then the star bus will be also in the main cc.
-          // Even if one leg is disconnected, the contingency as a whole will be considered,
-          // because all 3 2-winding transformers will be connected at least at the start bus.
-          if (*elementType == ContingencyElement::Type::THREE_WINDINGS_TRANSFORMER) {
-            contingency.elements.emplace_back(elementId + "_1", ContingencyElement::Type::TWO_WINDINGS_TRANSFORMER);
-            contingency.elements.emplace_back(elementId + "_2", ContingencyElement::Type::TWO_WINDINGS_TRANSFORMER);
-            contingency.elements.emplace_back(elementId + "_3", ContingencyElement::Type::TWO_WINDINGS_TRANSFORMER);
-            LOG(debug, Contingency2WIsFrom3W, elementId);
-            LOG(debug, Contingency2WIsFrom3WLeg, elementId + "_1", "1");
-            LOG(debug, Contingency2WIsFrom3WLeg, elementId + "_2", "2");
-            LOG(debug, Contingency2WIsFrom3WLeg, elementId + "_3", "3");
-          } else {
-            contingency.elements.emplace_back(elementId, *elementType);
-          }
-        } else {
-          valid = false;
-          LOG(warn, ContingencyInvalidBadElemType, contingency.id, elementId, elementTypeStr);
-        }
-      }
-      if (valid) {
-        contingencies_.push_back(contingency);
-      }
-    }
+    JsonReader reader(*stream, filepath.generic_string());
+    ContingenciesReader(reader, contingencies_).read();
   } catch (std::exception &e) {
     throw DFLError(ContingenciesReadError, filepath.generic_string(), e.what());
   }
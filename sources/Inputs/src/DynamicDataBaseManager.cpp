@@ -21,9 +21,11 @@ namespace dfl {
 namespace inputs {
 
 DynamicDataBaseManager::DynamicDataBaseManager(const std::vector<boost::filesystem::path> & settingFilePaths,
-                                               const std::vector<boost::filesystem::path> & assemblingFilePaths) :
-  assembling_(assemblingFilePaths),
-  setting_(settingFilePaths) {}
+                                               const std::vector<boost::filesystem::path> & assemblingFilePaths,
+                                               const common::InputArchive & inputArchive,
+                                               const boost::filesystem::path & snapshotCacheDirectory) :
+  assembling_(assemblingFilePaths, inputArchive, snapshotCacheDirectory),
+  setting_(settingFilePaths, inputArchive, snapshotCacheDirectory) {}
 }  // namespace inputs
 
 }  // namespace dfl
@@ -0,0 +1,598 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  DynamicDataBaseSnapshot.cpp
+ *
+ * @brief Dynamic data base snapshot implementation file
+ *
+ */
+
+#include "DynamicDataBaseSnapshot.h"
+
+#include "Log.h"
+#include "SnapshotIO.h"
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+namespace dfl {
+namespace inputs {
+
+namespace helper {
+
+static const char snapshotMagic[8] = {'D', 'F', 'L', 'D', 'B', 'S', 'N', '\0'};  ///< first bytes of any dynamic data base snapshot
+static const std::uint32_t snapshotFormatVersion = 1;                            ///< version of the snapshot format, to increase at each format change
+
+/**
+ * @brief Write the header of a snapshot
+ *
+ * @param writer the snapshot writer
+ * @param key the key of the snapshot
+ */
+static void writeHeader(SnapshotWriter &writer, const std::string &key) {
+  for (auto c : snapshotMagic) {
+    writer.write(c);
+  }
+  writer.write(snapshotFormatVersion);
+  writer.writeString(key);
+}
+
+/**
+ * @brief Read the header of a snapshot
+ *
+ * @param reader the snapshot reader
+ * @param key the expected key of the snapshot
+ * @returns true if the snapshot matches the key, false otherwise
+ */
+static bool readHeader(SnapshotReader &reader, const std::string &key) {
+  if (std::memcmp(reader.readBytes(sizeof(snapshotMagic)), snapshotMagic, sizeof(snapshotMagic)) != 0) {
+    throw DFLError(SnapshotInconsistent);
+  }
+  return reader.read<std::uint32_t>() == snapshotFormatVersion && reader.readString() == key;
+}
+
+/**
+ * @brief Write the value of a double parameter
+ * @param writer the snapshot writer
+ * @param value the value to write
+ */
+static void writeValue(SnapshotWriter &writer, double value) { writer.write(value); }
+
+/**
+ * @brief Write the value of a boolean parameter
+ * @param writer the snapshot writer
+ * @param value the value to write
+ */
+static void writeValue(SnapshotWriter &writer, bool value) { writer.writeBool(value); }
+
+/**
+ * @brief Write the value of an integer parameter
+ * @param writer the snapshot writer
+ * @param value the value to write
+ */
+static void writeValue(SnapshotWriter &writer, int value) { writer.write(static_cast<std::int32_t>(value)); }
+
+/**
+ * @brief Write the value of a string parameter
+ * @param writer the snapshot writer
+ * @param value the value to write
+ */
+static void writeValue(SnapshotWriter &writer, const std::string &value) { writer.writeString(value); }
+
+/**
+ * @brief Read the value of a double parameter
+ * @param reader the snapshot reader
+ * @param value the value read
+ */
+static void readValue(SnapshotReader &reader, double &value) { value = reader.read<double>(); }
+
+/**
+ * @brief Read the value of a boolean parameter
+ * @param reader the snapshot reader
+ * @param value the value read
+ */
+static void readValue(SnapshotReader &reader, bool &value) { value = reader.readBool(); }
+
+/**
+ * @brief Read the value of an integer parameter
+ * @param reader the snapshot reader
+ * @param value the value read
+ */
+static void readValue(SnapshotReader &reader, int &value) { value = reader.read<std::int32_t>(); }
+
+/**
+ * @brief Read the value of a string parameter
+ * @param reader the snapshot reader
+ * @param value the value read
+ */
+static void readValue(SnapshotReader &reader, std::string &value) { value = reader.readString(); }
+
+/**
+ * @brief Write the parameters of a set
+ *
+ * @param writer the snapshot writer
+ * @param parameters the parameters to write
+ */
+template<class T>
+static void writeParameters(SnapshotWriter &writer, const std::vector<SettingDataBase::Parameter<T>> &parameters) {
+  writer.write(static_cast<std::uint32_t>(parameters.size()));
+  for (const auto &parameter : parameters) {
+    writer.writeString(parameter.name);
+    writeValue(writer, parameter.value);
+  }
+}
+
+/**
+ * @brief Read the parameters of a set
+ *
+ * @param reader the snapshot reader
+ * @param parameters the parameters to fill
+ */
+template<class T>
+static void readParameters(SnapshotReader &reader, std::vector<SettingDataBase::Parameter<T>> &parameters) {
+  const auto size = reader.read<std::uint32_t>();
+  for (std::uint32_t i = 0; i < size; ++i) {
+    SettingDataBase::Parameter<T> parameter;
+    parameter.name = reader.readString();
+    readValue(reader, parameter.value);
+    parameters.push_back(parameter);
+  }
+}
+
+/**
+ * @brief Write a parameter set
+ *
+ * @param writer the snapshot writer
+ * @param set the set to write
+ */
+static void writeSet(SnapshotWriter &writer, const SettingDataBase::Set &set) {
+  writer.writeString(set.id);
+  writer.write(static_cast<std::uint32_t>(set.counts.size()));
+  for (const auto &count : set.counts) {
+    writer.writeString(count.name);
+    writer.writeString(count.id);
+  }
+  writer.write(static_cast<std::uint32_t>(set.refs.size()));
+  for (const auto &ref : set.refs) {
+    writer.writeString(ref.id);
+    writer.writeString(ref.name);
+    writer.writeString(ref.tag);
+  }
+  writer.write(static_cast<std::uint32_t>(set.references.size()));
+  for (const auto &reference : set.references) {
+    writer.writeBool(reference.componentId.is_initialized());
+    if (reference.componentId) {
+      writer.writeString(*reference.componentId);
+    }
+    writer.writeString(reference.name);
+    writer.writeString(reference.origName);
+    writer.write(static_cast<std::uint8_t>(reference.dataType));
+  }
+  writeParameters(writer, set.doubleParameters);
+  writeParameters(writer, set.boolParameters);
+  writeParameters(writer, set.integerParameters);
+  writeParameters(writer, set.stringParameters);
+}
+
+/**
+ * @brief Read a parameter set
+ *
+ * @param reader the snapshot reader
+ * @returns the set
+ */
+static SettingDataBase::Set readSet(SnapshotReader &reader) {
+  SettingDataBase::Set set;
+  set.id = reader.readString();
+  const auto nbCounts = reader.read<std::uint32_t>();
+  for (std::uint32_t i = 0; i < nbCounts; ++i) {
+    SettingDataBase::Count count;
+    count.name = reader.readString();
+    count.id = reader.readString();
+    set.counts.push_back(count);
+  }
+  const auto nbRefs = reader.read<std::uint32_t>();
+  for (std::uint32_t i = 0; i < nbRefs; ++i) {
+    SettingDataBase::Ref ref;
+    ref.id = reader.readString();
+    ref.name = reader.readString();
+    ref.tag = reader.readString();
+    set.refs.push_back(ref);
+  }
+  const auto nbReferences = reader.read<std::uint32_t>();
+  for (std::uint32_t i = 0; i < nbReferences; ++i) {
+    SettingDataBase::Reference reference;
+    if (reader.readBool()) {
+      reference.componentId = reader.readString();
+    }
+    reference.name = reader.readString();
+    reference.origName = reader.readString();
+    const auto dataType = reader.read<std::uint8_t>();
+    if (dataType > static_cast<std::uint8_t>(SettingDataBase::Reference::DataType::STRING)) {
+      throw DFLError(SnapshotInconsistent);
+    }
+    reference.dataType = static_cast<SettingDataBase::Reference::DataType>(dataType);
+    set.references.push_back(reference);
+  }
+  readParameters(reader, set.doubleParameters);
+  readParameters(reader, set.boolParameters);
+  readParameters(reader, set.integerParameters);
+  readParameters(reader, set.stringParameters);
+  return set;
+}
+
+/**
+ * @brief Write a macro connection
+ *
+ * @param writer the snapshot writer
+ * @param macroConnection the macro connection to write
+ */
+static void writeMacroConnection(SnapshotWriter &writer, const AssemblingDataBase::MacroConnection &macroConnection) {
+  writer.writeString(macroConnection.id);
+  writer.writeBool(macroConnection.network);
+  writer.writeString(macroConnection.indexId);
+  writer.write(static_cast<std::uint32_t>(macroConnection.connections.size()));
+  for (const auto &connection : macroConnection.connections) {
+    writer.writeString(connection.var1);
+    writer.writeString(connection.var2);
+  }
+}
+
+/**
+ * @brief Read a macro connection
+ *
+ * @param reader the snapshot reader
+ * @returns the macro connection
+ */
+static AssemblingDataBase::MacroConnection readMacroConnection(SnapshotReader &reader) {
+  AssemblingDataBase::MacroConnection macroConnection;
+  macroConnection.id = reader.readString();
+  macroConnection.network = reader.readBool();
+  macroConnection.indexId = reader.readString();
+  const auto nbConnections = reader.read<std::uint32_t>();
+  for (std::uint32_t i = 0; i < nbConnections; ++i) {
+    AssemblingDataBase::Connection connection;
+    connection.var1 = reader.readString();
+    connection.var2 = reader.readString();
+    macroConnection.connections.push_back(connection);
+  }
+  return macroConnection;
+}
+
+/**
+ * @brief Write an optional element identified by a single string
+ *
+ * @param writer the snapshot writer
+ * @param element the element to write
+ * @param name the identifier of the element
+ */
+template<class T>
+static void writeOptional(SnapshotWriter &writer, const boost::optional<T> &element, std::string T::*name) {
+  writer.writeBool(element.is_initialized());
+  if (element) {
+    writer.writeString((*element).*name);
+  }
+}
+
+/**
+ * @brief Read an optional element identified by a single string
+ *
+ * @param reader the snapshot reader
+ * @param element the element to fill
+ * @param name the identifier of the element
+ */
+template<class T>
+static void readOptional(SnapshotReader &reader, boost::optional<T> &element, std::string T::*name) {
+  if (reader.readBool()) {
+    element = T();
+    (*element).*name = reader.readString();
+  }
+}
+
+/**
+ * @brief Write a single association
+ *
+ * @param writer the snapshot writer
+ * @param association the single association to write
+ */
+static void writeSingleAssociation(SnapshotWriter &writer, const AssemblingDataBase::SingleAssociation &association) {
+  writer.writeString(association.id);
+  writeOptional(writer, association.bus, &AssemblingDataBase::Bus::voltageLevel);
+  writeOptional(writer, association.tfo, &AssemblingDataBase::Tfo::name);
+  writeOptional(writer, association.line, &AssemblingDataBase::Line::name);
+  writeOptional(writer, association.hvdcLine, &AssemblingDataBase::HvdcLine::name);
+  if (association.hvdcLine) {
+    writer.write(static_cast<std::uint8_t>(association.hvdcLine->converterStation1));
+  }
+  writeOptional(writer, association.shunt, &AssemblingDataBase::SingleShunt::name);
+  writer.write(static_cast<std::uint32_t>(association.generators.size()));
+  for (const auto &generator : association.generators) {
+    writer.writeString(generator.name);
+  }
+  writer.write(static_cast<std::uint32_t>(association.loads.size()));
+  for (const auto &load : association.loads) {
+    writer.writeString(load.name);
+  }
+}
+
+/**
+ * @brief Read a single association
+ *
+ * @param reader the snapshot reader
+ * @returns the single association
+ */
+static AssemblingDataBase::SingleAssociation readSingleAssociation(SnapshotReader &reader) {
+  AssemblingDataBase::SingleAssociation association;
+  association.id = reader.readString();
+  readOptional(reader, association.bus, &AssemblingDataBase::Bus::voltageLevel);
+  readOptional(reader, association.tfo, &AssemblingDataBase::Tfo::name);
+  readOptional(reader, association.line, &AssemblingDataBase::Line::name);
+  readOptional(reader, association.hvdcLine, &AssemblingDataBase::HvdcLine::name);
+  if (association.hvdcLine) {
+    const auto side = reader.read<std::uint8_t>();
+    if (side > static_cast<std::uint8_t>(AssemblingDataBase::HvdcLineConverterSide::SIDE2)) {
+      throw DFLError(SnapshotInconsistent);
+    }
+    association.hvdcLine->converterStation1 = static_cast<AssemblingDataBase::HvdcLineConverterSide>(side);
+  }
+  readOptional(reader, association.shunt, &AssemblingDataBase::SingleShunt::name);
+  for (const auto &name : reader.readStrings()) {
+    AssemblingDataBase::Generator generator;
+    generator.name = name;
+    association.generators.push_back(generator);
+  }
+  for (const auto &name : reader.readStrings()) {
+    AssemblingDataBase::Load load;
+    load.name = name;
+    association.loads.push_back(load);
+  }
+  return association;
+}
+
+/**
+ * @brief Write a map of strings
+ *
+ * @param writer the snapshot writer
+ * @param map the map to write
+ */
+static void writeStringMap(SnapshotWriter &writer, const std::unordered_map<std::string, std::string> &map) {
+  writer.write(static_cast<std::uint32_t>(map.size()));
+  for (const auto &entry : map) {
+    writer.writeString(entry.first);
+    writer.writeString(entry.second);
+  }
+}
+
+/**
+ * @brief Read a map of strings
+ *
+ * @param reader the snapshot reader
+ * @param map the map to fill
+ */
+static void readStringMap(SnapshotReader &reader, std::unordered_map<std::string, std::string> &map) {
+  const auto size = reader.read<std::uint32_t>();
+  for (std::uint32_t i = 0; i < size; ++i) {
+    auto key = reader.readString();
+    map[key] = reader.readString();
+  }
+}
+
+}  // namespace helper
+
+std::string DynamicDataBaseSnapshot::computeKey(const std::string &kind, const std::vector<boost::filesystem::path> &filepaths,
+                                                const common::InputArchive &inputArchive) {
+  std::uint64_t hash = snapshot::hashBytes(snapshot::hashSeed, kind.data(), kind.size());
+  std::vector<char> buffer(1 << 16);
+  for (const auto &path : filepaths) {
+    // the size of each document separates its content from the next one, a missing document is hashed with a size no document can have
+    std::uint64_t size = std::numeric_limits<std::uint64_t>::max();
+    auto in = inputArchive.open(path);
+    if (*in) {
+      size = 0;
+      do {
+        in->read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        const auto count = static_cast<std::size_t>(in->gcount());
+        hash = snapshot::hashBytes(hash, buffer.data(), count);
+        size += count;
+      } while (*in);
+    }
+    hash = snapshot::hashBytes(hash, reinterpret_cast<const char *>(&size), sizeof(size));
+  }
+  return snapshot::formatKey(hash, helper::snapshotFormatVersion);
+}
+
+boost::filesystem::path DynamicDataBaseSnapshot::filepath(const boost::filesystem::path &cacheDirectory, const std::string &kind, const std::string &key) {
+  return cacheDirectory / (kind + "-" + key + ".snapshot");
+}
+
+void DynamicDataBaseSnapshot::write(const boost::filesystem::path &filepath, const std::string &key, const SettingDataBase &dataBase) {
+  SnapshotWriter writer;
+  helper::writeHeader(writer, key);
+  writer.write(static_cast<std::uint32_t>(dataBase.sets_.size()));
+  for (const auto &set : dataBase.sets_) {
+    helper::writeSet(writer, set.second);
+  }
+
+  try {
+    snapshot::save(filepath, writer.buffer());
+    LOG(info, DynamicDataBaseSnapshotSaved, filepath.generic_string());
+  } catch (const std::exception &e) {
+    LOG(warn, DynamicDataBaseSnapshotWriteFailed, filepath.generic_string(), e.what());
+  }
+}
+
+void DynamicDataBaseSnapshot::write(const boost::filesystem::path &filepath, const std::string &key, const AssemblingDataBase &dataBase) {
+  SnapshotWriter writer;
+  helper::writeHeader(writer, key);
+  writer.writeBool(dataBase.containsSVC_);
+  writer.write(static_cast<std::uint32_t>(dataBase.macroConnections_.size()));
+  for (const auto &macroConnection : dataBase.macroConnections_) {
+    helper::writeMacroConnection(writer, macroConnection.second);
+  }
+  writer.write(static_cast<std::uint32_t>(dataBase.networkMacroConnections_.size()));
+  for (const auto &macroConnection : dataBase.networkMacroConnections_) {
+    helper::writeMacroConnection(writer, macroConnection.second);
+  }
+  writer.write(static_cast<std::uint32_t>(dataBase.singleAssociations_.size()));
+  for (const auto &association : dataBase.singleAssociations_) {
+    helper::writeSingleAssociation(writer, association.second);
+  }
+  writer.write(static_cast<std::uint32_t>(dataBase.multipleAssociations_.size()));
+  for (const auto &association : dataBase.multipleAssociations_) {
+    writer.writeString(association.second.id);
+    helper::writeOptional(writer, association.second.shunt, &AssemblingDataBase::MultipleShunts::voltageLevel);
+  }
+  helper::writeStringMap(writer, dataBase.generatorIdToSingleAssociationsId_);
+  helper::writeStringMap(writer, dataBase.HvdcIdToSingleAssociationsId_);
+  writer.write(static_cast<std::uint32_t>(dataBase.dynamicAutomatons_.size()));
+  for (const auto &automaton : dataBase.dynamicAutomatons_) {
+    writer.writeString(automaton.second.id);
+    writer.writeString(automaton.second.lib);
+    writer.write(static_cast<std::uint32_t>(automaton.second.macroConnects.size()));
+    for (const auto &macroConnect : automaton.second.macroConnects) {
+      writer.writeString(macroConnect.macroConnection);
+      writer.writeString(macroConnect.id);
+      writer.writeBool(macroConnect.mandatory);
+    }
+  }
+  writer.write(static_cast<std::uint32_t>(dataBase.properties_.size()));
+  for (const auto &property : dataBase.properties_) {
+    writer.writeString(property.second.id);
+    writer.write(static_cast<std::uint32_t>(property.second.devices.size()));
+    for (const auto &device : property.second.devices) {
+      writer.writeString(device.id);
+    }
+  }
+
+  try {
+    snapshot::save(filepath, writer.buffer());
+    LOG(info, DynamicDataBaseSnapshotSaved, filepath.generic_string());
+  } catch (const std::exception &e) {
+    LOG(warn, DynamicDataBaseSnapshotWriteFailed, filepath.generic_string(), e.what());
+  }
+}
+
+bool DynamicDataBaseSnapshot::read(const boost::filesystem::path &filepath, const std::string &key, SettingDataBase &dataBase) {
+  return readFile(filepath, key, dataBase);
+}
+
+bool DynamicDataBaseSnapshot::read(const boost::filesystem::path &filepath, const std::string &key, AssemblingDataBase &dataBase) {
+  return readFile(filepath, key, dataBase);
+}
+
+template<class DataBase>
+bool DynamicDataBaseSnapshot::readFile(const boost::filesystem::path &filepath, const std::string &key, DataBase &dataBase) {
+  boost::system::error_code ec;
+  if (!boost::filesystem::is_regular_file(filepath, ec)) {
+    return false;
+  }
+
+  try {
+    if (boost::filesystem::file_size(filepath) == 0) {
+      throw DFLError(SnapshotTruncated);
+    }
+    boost::interprocess::file_mapping mapping(filepath.c_str(), boost::interprocess::read_only);
+    boost::interprocess::mapped_region region(mapping, boost::interprocess::read_only);
+    SnapshotReader reader(static_cast<const char *>(region.get_address()), region.get_size());
+    if (!helper::readHeader(reader, key)) {
+      LOG(info, DynamicDataBaseSnapshotOutdated, filepath.generic_string());
+      return false;
+    }
+    restore(reader, dataBase);
+  } catch (const std::exception &e) {
+    LOG(warn, DynamicDataBaseSnapshotCorrupted, filepath.generic_string(), e.what());
+    return false;
+  }
+  return true;
+}
+
+void DynamicDataBaseSnapshot::restore(SnapshotReader &reader, SettingDataBase &dataBase) {
+  // the sets are restored in a local variable first, so that the data base is left untouched if the snapshot is not consistent
+  std::unordered_map<std::string, SettingDataBase::Set> sets;
+  const auto nbSets = reader.read<std::uint32_t>();
+  for (std::uint32_t i = 0; i < nbSets; ++i) {
+    auto set = helper::readSet(reader);
+    const auto id = set.id;
+    sets[id] = std::move(set);
+  }
+  if (!reader.atEnd()) {
+    throw DFLError(SnapshotInconsistent);
+  }
+  dataBase.sets_ = std::move(sets);
+}
+
+void DynamicDataBaseSnapshot::restore(SnapshotReader &reader, AssemblingDataBase &dataBase) {
+  // the elements are restored in a local data base first, so that the data base is left untouched if the snapshot is not consistent
+  AssemblingDataBase restored({});
+  restored.containsSVC_ = reader.readBool();
+  const auto nbMacroConnections = reader.read<std::uint32_t>();
+  for (std::uint32_t i = 0; i < nbMacroConnections; ++i) {
+    auto macroConnection = helper::readMacroConnection(reader);
+    const auto id = macroConnection.id;
+    restored.macroConnections_[id] = std::move(macroConnection);
+  }
+  const auto nbNetworkMacroConnections = reader.read<std::uint32_t>();
+  for (std::uint32_t i = 0; i < nbNetworkMacroConnections; ++i) {
+    auto macroConnection = helper::readMacroConnection(reader);
+    const auto id = macroConnection.id;
+    restored.networkMacroConnections_[id] = std::move(macroConnection);
+  }
+  const auto nbSingleAssociations = reader.read<std::uint32_t>();
+  for (std::uint32_t i = 0; i < nbSingleAssociations; ++i) {
+    auto association = helper::readSingleAssociation(reader);
+    const auto id = association.id;
+    restored.singleAssociations_[id] = std::move(association);
+  }
+  const auto nbMultipleAssociations = reader.read<std::uint32_t>();
+  for (std::uint32_t i = 0; i < nbMultipleAssociations; ++i) {
+    AssemblingDataBase::MultipleAssociation association;
+    association.id = reader.readString();
+    helper::readOptional(reader, association.shunt, &AssemblingDataBase::MultipleShunts::voltageLevel);
+    restored.multipleAssociations_[association.id] = association;
+  }
+  helper::readStringMap(reader, restored.generatorIdToSingleAssociationsId_);
+  helper::readStringMap(reader, restored.HvdcIdToSingleAssociationsId_);
+  const auto nbAutomatons = reader.read<std::uint32_t>();
+  for (std::uint32_t i = 0; i < nbAutomatons; ++i) {
+    AssemblingDataBase::DynamicAutomaton automaton;
+    automaton.id = reader.readString();
+    automaton.lib = reader.readString();
+    const auto nbMacroConnects = reader.read<std::uint32_t>();
+    for (std::uint32_t j = 0; j < nbMacroConnects; ++j) {
+      AssemblingDataBase::MacroConnect macroConnect;
+      macroConnect.macroConnection = reader.readString();
+      macroConnect.id = reader.readString();
+      macroConnect.mandatory = reader.readBool();
+      automaton.macroConnects.push_back(macroConnect);
+    }
+    restored.dynamicAutomatons_[automaton.id] = automaton;
+  }
+  const auto nbProperties = reader.read<std::uint32_t>();
+  for (std::uint32_t i = 0; i < nbProperties; ++i) {
+    AssemblingDataBase::Property property;
+    property.id = reader.readString();
+    for (const auto &deviceId : reader.readStrings()) {
+      AssemblingDataBase::Device device;
+      device.id = deviceId;
+      property.devices.push_back(device);
+    }
+    restored.properties_[property.id] = property;
+  }
+  if (!reader.atEnd()) {
+    throw DFLError(SnapshotInconsistent);
+  }
+  dataBase = std::move(restored);
+}
+
+}  // namespace inputs
+}  // namespace dfl
@@ -0,0 +1,247 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  JsonReader.cpp
+ *
+ * @brief Streaming JSON reader implementation file
+ *
+ */
+
+#include "JsonReader.h"
+
+#include <boost/property_tree/json_parser/error.hpp>
+
+#include <cctype>
+
+namespace dfl {
+namespace inputs {
+
+namespace {
+const int endOfStream = std::char_traits<char>::eof();  ///< value returned at the end of the stream
+}
+
+JsonReader::JsonReader(std::istream &stream, const std::string &filename) : buffer_(*stream.rdbuf()), filename_(filename) {}
+
+void JsonReader::error(const std::string &message) const { error(message, line_); }
+
+void JsonReader::error(const std::string &message, std::size_t line) const {
+  throw boost::property_tree::json_parser::json_parser_error(message, filename_, static_cast<unsigned long>(line));
+}
+
+int JsonReader::get() {
+  const int c = buffer_.sbumpc();
+  if (c == '\n') {
+    ++line_;
+  }
+  return c;
+}
+
+int JsonReader::peek() {
+  int c = buffer_.sgetc();
+  while (c == ' ' || c == '\t' || c == '\n' || c == '\r') {
+    get();
+    c = buffer_.sgetc();
+  }
+  return c;
+}
+
+void JsonReader::expect(char expected) {
+  const int c = peek();
+  if (c == endOfStream) {
+    error(std::string("expected '") + expected + "', found end of input");
+  }
+  if (c != expected) {
+    error(std::string("expected '") + expected + "', found '" + static_cast<char>(c) + "'");
+  }
+  get();
+}
+
+bool JsonReader::nextMember(std::string &key, bool &first) {
+  if (peek() == '}') {
+    get();
+    return false;
+  }
+  if (!first) {
+    expect(',');
+  }
+  first = false;
+  if (peek() != '"') {
+    error("expected key string");
+  }
+  readString(key);
+  expect(':');
+  return true;
+}
+
+bool JsonReader::nextItem(bool &first) {
+  if (peek() == ']') {
+    get();
+    return false;
+  }
+  if (!first) {
+    expect(',');
+  }
+  first = false;
+  return true;
+}
+
+unsigned int JsonReader::readCodeUnit() {
+  unsigned int codeUnit = 0;
+  for (unsigned int i = 0; i < 4; ++i) {
+    const int c = get();
+    codeUnit <<= 4;
+    if (c >= '0' && c <= '9') {
+      codeUnit += static_cast<unsigned int>(c - '0');
+    } else if (c >= 'a' && c <= 'f') {
+      codeUnit += static_cast<unsigned int>(c - 'a' + 10);
+    } else if (c >= 'A' && c <= 'F') {
+      codeUnit += static_cast<unsigned int>(c - 'A' + 10);
+    } else {
+      error("invalid escape sequence");
+    }
+  }
+  return codeUnit;
+}
+
+void JsonReader::readString(std::string &value) {
+  expect('"');
+  value.clear();
+  while (true) {
+    int c = buffer_.sgetc();
+    if (c == endOfStream || c == '\n') {
+      error("unterminated string");
+    }
+    get();
+    if (c == '"') {
+      return;
+    }
+    if (c != '\\') {
+      value.push_back(static_cast<char>(c));
+      continue;
+    }
+    c = get();
+    switch (c) {
+    case '"':
+    case '\\':
+    case '/':
+      value.push_back(static_cast<char>(c));
+      break;
+    case 'b':
+      value.push_back('\b');
+      break;
+    case 'f':
+      value.push_back('\f');
+      break;
+    case 'n':
+      value.push_back('\n');
+      break;
+    case 'r':
+      value.push_back('\r');
+      break;
+    case 't':
+      value.push_back('\t');
+      break;
+    case 'u': {
+      unsigned long codePoint = readCodeUnit();
+      if (codePoint >= 0xD800 && codePoint < 0xDC00) {
+        // high surrogate, followed by the low surrogate of the pair
+        if (get() != '\\' || get() != 'u') {
+          error("expected low surrogate");
+        }
+        const unsigned int low = readCodeUnit();
+        if (low < 0xDC00 || low >= 0xE000) {
+          error("invalid low surrogate");
+        }
+        codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+      }
+      // UTF-8 encoding of the code point
+      if (codePoint < 0x80) {
+        value.push_back(static_cast<char>(codePoint));
+      } else if (codePoint < 0x800) {
+        value.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+        value.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+      } else if (codePoint < 0x10000) {
+        value.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+        value.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        value.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+      } else {
+        value.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+        value.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+        value.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        value.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+      }
+      break;
+    }
+    default:
+      error("invalid escape sequence");
+    }
+  }
+}
+
+void JsonReader::readLiteral(std::string &value) {
+  value.clear();
+  int c = peek();
+  while (c != endOfStream && (std::isalnum(c) || c == '-' || c == '+' || c == '.')) {
+    value.push_back(static_cast<char>(get()));
+    c = buffer_.sgetc();
+  }
+  if (value.empty()) {
+    if (c == endOfStream) {
+      error("expected value, found end of input");
+    }
+    error(std::string("expected value, found '") + static_cast<char>(c) + "'");
+  }
+  const bool number = value[0] == '-' || std::isdigit(static_cast<unsigned char>(value[0]));
+  if (!number && value != "true" && value != "false" && value != "null") {
+    error("invalid value '" + value + "'");
+  }
+}
+
+void JsonReader::readScalar(std::string &value) {
+  const int c = peek();
+  if (c == '"') {
+    readString(value);
+  } else if (c == '{' || c == '[') {
+    error("expected scalar value");
+  } else {
+    readLiteral(value);
+  }
+}
+
+void JsonReader::skipValue() {
+  const int c = peek();
+  std::string scratch;
+  if (c == '{') {
+    beginObject();
+    bool first = true;
+    while (nextMember(scratch, first)) {
+      skipValue();
+    }
+  } else if (c == '[') {
+    beginArray();
+    bool first = true;
+    while (nextItem(first)) {
+      skipValue();
+    }
+  } else {
+    readScalar(scratch);
+  }
+}
+
+void JsonReader::end() {
+  const int c = peek();
+  if (c != endOfStream) {
+    error("garbage after data");
+  }
+}
+
+}  // namespace inputs
+}  // namespace dfl
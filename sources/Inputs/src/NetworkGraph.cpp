@@ -0,0 +1,107 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  NetworkGraph.cpp
+ *
+ * @brief Index based network graph implementation file
+ *
+ */
+
+#include "NetworkGraph.h"
+
+#include <unordered_map>
+
+namespace dfl {
+namespace inputs {
+
+namespace helper {
+
+/**
+ * @brief Retrieve the index of an element, registering it if it is met for the first time
+ *
+ * @param element the element
+ * @param indexes the indexes of the already registered elements
+ * @param elements the registered elements, in index order
+ * @returns the index of the element
+ */
+template<class T>
+static NetworkGraph::Index registerElement(const T *element, std::unordered_map<const T *, NetworkGraph::Index> &indexes, std::vector<const T *> &elements) {
+  auto found = indexes.find(element);
+  if (found != indexes.end()) {
+    return found->second;
+  }
+  auto index = static_cast<NetworkGraph::Index>(elements.size());
+  indexes.insert({element, index});
+  elements.push_back(element);
+  return index;
+}
+
+/**
+ * @brief Release the memory of a vector
+ *
+ * @param elements the vector to release
+ */
+template<class T>
+static void release(std::vector<T> &elements) {
+  std::vector<T>().swap(elements);
+}
+
+}  // namespace helper
+
+NetworkGraph::NetworkGraph(const std::vector<std::shared_ptr<Node>> &nodes) : nodes_(nodes) {
+  for (Index i = 0; i < nodes_.size(); ++i) {
+    nodes_[i]->index = i;
+  }
+
+  std::unordered_map<const Line *, Index> lineIndexes;
+  std::unordered_map<const Tfo *, Index> tfoIndexes;
+  std::unordered_map<const Converter *, Index> converterIndexes;
+  for (const auto &node : nodes_) {
+    for (const auto &neighbour : node->neighbours) {
+      if (contains(*neighbour)) {
+        neighbours_.values.push_back(neighbour->index);
+      }
+    }
+    neighbours_.closeRow();
+
+    for (const auto &line : node->lines) {
+      nodeLines_.values.push_back(helper::registerElement<Line>(line.lock().get(), lineIndexes, lines_));
+    }
+    nodeLines_.closeRow();
+
+    for (const auto &tfo : node->tfos) {
+      nodeTfos_.values.push_back(helper::registerElement<Tfo>(tfo.lock().get(), tfoIndexes, tfos_));
+    }
+    nodeTfos_.closeRow();
+
+    for (const auto &converter : node->converters) {
+      nodeConverters_.values.push_back(helper::registerElement<Converter>(converter.lock().get(), converterIndexes, converters_));
+    }
+    nodeConverters_.closeRow();
+  }
+}
+
+void NetworkGraph::releaseNodeReferences() {
+  for (const auto &node : nodes_) {
+    helper::release(node->neighbours);
+    helper::release(node->lines);
+    helper::release(node->tfos);
+    helper::release(node->converters);
+  }
+}
+
+const NetworkGraph &NetworkGraph::empty() {
+  static const NetworkGraph emptyGraph;
+  return emptyGraph;
+}
+
+}  // namespace inputs
+}  // namespace dfl
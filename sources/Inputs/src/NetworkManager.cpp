@@ -18,6 +18,7 @@
 #include "NetworkManager.h"
 
 #include "Log.h"
+#include "NetworkSnapshot.h"
 
 #include <DYNBusInterface.h>
 #include <DYNCommon.h>
@@ -37,14 +38,36 @@
 #include <DYNTwoWTransformerInterface.h>
 #include <DYNVoltageLevelInterface.h>
 #include <DYNVscConverterInterface.h>
+#include <algorithm>
+#include <atomic>
+#include <thread>
 
 namespace dfl {
 namespace inputs {
 
-NetworkManager::NetworkManager(const boost::filesystem::path &filepath)
-    : interface_(DYN::DataInterfaceFactory::build(DYN::DataInterfaceFactory::DATAINTERFACE_IIDM, filepath.generic_string())), slackNode_{}, nodes_{},
-      nodesCallbacks_{}, isPartiallyConditioned_(false), isFullyConditioned_(true) {
-  buildTree();
+NetworkManager::NetworkManager(const boost::filesystem::path &filepath, unsigned int nbThreads, const boost::filesystem::path &snapshotCacheDirectory)
+    : networkFilepath_(filepath), interface_{}, restoredFromSnapshot_(false), slackNode_{}, nodes_{}, nodesCallbacks_{}, conditioning_{} {
+  if (snapshotCacheDirectory.empty()) {
+    buildTree(nbThreads);
+    return;
+  }
+
+  const auto key = NetworkSnapshot::computeKey(filepath);
+  const auto snapshotFilepath = NetworkSnapshot::filepath(snapshotCacheDirectory, key);
+  restoredFromSnapshot_ = NetworkSnapshot::read(snapshotFilepath, key, *this);
+  if (restoredFromSnapshot_) {
+    LOG(info, NetworkSnapshotLoaded, snapshotFilepath.generic_string(), filepath.generic_string());
+  } else {
+    buildTree(nbThreads);
+    NetworkSnapshot::write(snapshotFilepath, key, *this);
+  }
+}
+
+boost::shared_ptr<DYN::DataInterface> NetworkManager::dataInterface() const {
+  if (!interface_) {
+    interface_ = DYN::DataInterfaceFactory::build(DYN::DataInterfaceFactory::DATAINTERFACE_IIDM, networkFilepath_.generic_string());
+  }
+  return interface_;
 }
 
 void NetworkManager::updateMapRegulatingBuses(BusMapRegulating &map, const std::shared_ptr<Node> &node) {
@@ -60,71 +83,90 @@ void NetworkManager::updateMapRegulatingBuses(BusMapRegulating &map, const std::
   }
 }
 
-void NetworkManager::updateConditioningStatus(const std::shared_ptr<DYN::ComponentInterface> &componentInterface) {
+void NetworkManager::ConditioningStatus::update(const std::shared_ptr<DYN::ComponentInterface> &componentInterface) {
   if (componentInterface->hasInitialConditions()) {
-    isPartiallyConditioned_ = true;
+    isPartiallyConditioned = true;
   } else {
-    isFullyConditioned_ = false;
+    isFullyConditioned = false;
   }
 }
 
-void NetworkManager::buildTree() {
-  auto network = interface_->getNetwork();
+void NetworkManager::ConditioningStatus::merge(const ConditioningStatus &other) {
+  isPartiallyConditioned = isPartiallyConditioned || other.isPartiallyConditioned;
+  isFullyConditioned = isFullyConditioned && other.isFullyConditioned;
+}
 
-  auto opt_id = network->getSlackNodeBusId();
+NetworkManager::RegulatedBusesByElement NetworkManager::resolveRegulatedBuses(const std::shared_ptr<DYN::NetworkInterface> &network) const {
+  RegulatedBusesByElement regulatedBusesByElement;
+  const auto &serviceManager = interface_->getServiceManager();
+  for (const auto &networkVL : network->getVoltageLevels()) {
+    for (const auto &generator : networkVL->getGenerators()) {
+      auto regulatedBus = serviceManager->getRegulatedBus(generator->getID());
+      if (regulatedBus) {
+        regulatedBusesByElement[generator->getID()] = RegulatedBus{regulatedBus->getID(), regulatedBus->getVNom()};
+      }
+    }
+    for (const auto &svarc : networkVL->getStaticVarCompensators()) {
+      auto regulatedBus = serviceManager->getRegulatedBus(svarc->getID());
+      if (regulatedBus) {
+        regulatedBusesByElement[svarc->getID()] = RegulatedBus{regulatedBus->getID(), regulatedBus->getVNom()};
+      }
+    }
+  }
+  return regulatedBusesByElement;
+}
 
-  const auto &voltageLevels = network->getVoltageLevels();
-  // We first initialize all nodes
-  for (const auto &networkVL : voltageLevels) {
+std::unordered_set<NetworkManager::BusId> NetworkManager::resolveConnectedBuses(const std::shared_ptr<DYN::NetworkInterface> &network) const {
+  std::unordered_set<BusId> connectedBuses;
+  const auto &serviceManager = interface_->getServiceManager();
+  for (const auto &networkVL : network->getVoltageLevels()) {
+    for (const auto &bus : networkVL->getBuses()) {
+      if (serviceManager->isBusConnected(bus->getID(), networkVL->getID())) {
+        connectedBuses.insert(bus->getID());
+      }
+    }
+  }
+  return connectedBuses;
+}
+
+void NetworkManager::buildVoltageLevelShard(const std::shared_ptr<DYN::VoltageLevelInterface> &networkVL, const boost::optional<std::string> &slackNodeId,
+                                            const RegulatedBusesByElement &regulatedBusesByElement, const std::unordered_set<BusId> &connectedBuses,
+                                            VoltageLevelShard &shard) const {
+  try {
     const auto &shunts = networkVL->getShuntCompensators();
     std::unordered_map<Node::NodeId, std::vector<Shunt>> shuntsMap;
     for (const auto &shunt : shunts) {
-      updateConditioningStatus(shunt);
+      shard.conditioning.update(shunt);
       // We take into account even disconnected shunts as dynamic models may aim to connect them
       (shuntsMap[shunt->getBusInterface()->getID()]).push_back(std::move(Shunt(shunt->getID())));
     }
 
     auto vl = std::make_shared<VoltageLevel>(networkVL->getID());
-    voltagelevels_.push_back(vl);
+    shard.voltageLevel = vl;
 
+    // nodes of the voltage level, the only ones the elements of the voltage level can be connected to
+    std::unordered_map<Node::NodeId, std::shared_ptr<Node>> vlNodes;
     const auto &buses = networkVL->getBuses();
     for (const auto &bus : buses) {
-      updateConditioningStatus(bus);
+      shard.conditioning.update(bus);
       const auto &nodeId = bus->getID();
-#if _DEBUG_
-      // ids of nodes should be unique
-      assert(nodes_.count(nodeId) == 0);
-#endif
       auto found = shuntsMap.find(nodeId);
-      nodes_[nodeId] = Node::build(nodeId, vl, networkVL->getVNom(), (found != shuntsMap.end()) ? found->second : std::vector<Shunt>{}, bus->isFictitious(),
-                                   interface_->getServiceManager());
-      if (bus->isFictitious())
-        LOG(debug, FictitiousNodeCreation, nodeId);
-      else
-        LOG(debug, NodeCreation, nodeId);
-      if (opt_id && *opt_id == nodeId) {
-        LOG(debug, SlackNodeFound, *opt_id);
-        slackNode_ = nodes_[nodeId];
+      auto node = Node::build(nodeId, vl, networkVL->getVNom(), (found != shuntsMap.end()) ? found->second : std::vector<Shunt>{}, bus->isFictitious(),
+                              interface_->getServiceManager(), connectedBuses.count(nodeId) > 0);
+      vlNodes[nodeId] = node;
+      vl->switchTopology.addBus(nodeId);
+      if (slackNodeId && *slackNodeId == nodeId) {
+        shard.slackNode = node;
       }
 
       for (const auto &busBarSection : bus->getBusBarSectionIdentifiers()) {
-        nodes_[bus->getID()]->busBarSections.emplace_back(busBarSection);
+        node->busBarSections.emplace_back(busBarSection);
       }
     }
-  }
-  // And then we update others elements
-  for (const auto &networkVL : voltageLevels) {
-    const auto &shunts = networkVL->getShuntCompensators();
-    std::unordered_map<Node::NodeId, std::vector<Shunt>> shuntsMap;
-    for (const auto &shunt : shunts) {
-      updateConditioningStatus(shunt);
-      // We take into account even disconnected shunts as dynamic models may aim to connect them
-      (shuntsMap[shunt->getBusInterface()->getID()]).push_back(std::move(Shunt(shunt->getID())));
-    }
 
     const auto &loads = networkVL->getLoads();
     for (const auto &load : loads) {
-      updateConditioningStatus(load);
+      shard.conditioning.update(load);
       // if load is not connected, it is ignored
       if (!load->getInitialConnected())
         continue;
@@ -132,49 +174,55 @@ void NetworkManager::buildTree() {
       bool isNotInjecting = (DYN::doubleIsZero(load->getP0()) && DYN::doubleIsZero(load->getQ0()));
 #if _DEBUG_
       // node should exist at this point
-      assert(nodes_.count(nodeid));
+      assert(vlNodes.count(nodeid));
 #endif
-      nodes_[nodeid]->loads.emplace_back(load->getID(), load->isFictitious(), isNotInjecting);
-      LOG(debug, NodeContainsLoad, nodeid, load->getID());
+      vlNodes[nodeid]->loads.emplace_back(load->getID(), load->isFictitious(), isNotInjecting);
+      auto loadId = load->getID();
+      shard.debugLogs.push_back([nodeid, loadId]() { LOG(debug, NodeContainsLoad, nodeid, loadId); });
     }
 
     const auto &generators = networkVL->getGenerators();
     for (const auto &generator : generators) {
-      updateConditioningStatus(generator);
+      shard.conditioning.update(generator);
       // if generator is not connected, it is ignored
       if (!generator->getInitialConnected())
         continue;
       auto nodeid = generator->getBusInterface()->getID();
 #if _DEBUG_
       // node should exist at this point
-      assert(nodes_.count(nodeid));
+      assert(vlNodes.count(nodeid));
 #endif
       auto targetP = generator->getTargetP();
       auto pmin = generator->getPMin();
       auto pmax = generator->getPMax();
       std::string regulatedBusId = "";
-      auto regulatedBus = interface_->getServiceManager()->getRegulatedBus(generator->getID());
-      if (regulatedBus) {
-        regulatedBusId = regulatedBus->getID();
+      auto regulatedBus = regulatedBusesByElement.find(generator->getID());
+      if (regulatedBus != regulatedBusesByElement.end()) {
+        regulatedBusId = regulatedBus->second.id;
       }
       // we verify here that the generators is in voltage regulation to properly fill the map mapBusGeneratorBusId_.
       // This test is done also on algorithms.
       // The reason it is checked also here is to avoid to go through all the nodes later on
       if (generator->isVoltageRegulationOn()) {
         // We don't use dynamic models for generators with voltage regulation disabled
-        updateMapRegulatingBuses(mapBusIdToNumberOfRegulation_, nodes_[regulatedBusId]);
+        // The regulated bus may belong to another voltage level: the map is updated when merging the shard
+        shard.regulatedBuses.push_back(regulatedBusId);
         if (nodeid != regulatedBusId)
-          updateMapRegulatingBuses(mapBusIdToNumberOfRegulation_, nodes_[nodeid]);
+          shard.regulatedBuses.push_back(nodeid);
       }
-      nodes_[nodeid]->generators.emplace_back(generator->getID(), generator->isVoltageRegulationOn(), generator->getReactiveCurvesPoints(),
-                                              generator->getQMin(), generator->getQMax(), pmin, pmax, -generator->getQ(), targetP,
-                                              generator->getBusInterface()->getVNom(), regulatedBusId, nodeid,
-                                              generator->getEnergySource() == DYN::GeneratorInterface::SOURCE_NUCLEAR, generator->hasActivePowerControl());
-      LOG(debug, NodeContainsGen, nodeid, generator->getID());
+      vlNodes[nodeid]->generators.emplace_back(generator->getID(), generator->isVoltageRegulationOn(), generator->getReactiveCurvesPoints(),
+                                               generator->getQMin(), generator->getQMax(), pmin, pmax, -generator->getQ(), targetP,
+                                               generator->getBusInterface()->getVNom(), regulatedBusId, nodeid,
+                                               generator->getEnergySource() == DYN::GeneratorInterface::SOURCE_NUCLEAR, generator->hasActivePowerControl());
+      auto generatorId = generator->getID();
+      shard.debugLogs.push_back([nodeid, generatorId]() { LOG(debug, NodeContainsGen, nodeid, generatorId); });
     }
 
     const auto &switches = networkVL->getSwitches();
     for (const auto &sw : switches) {
+      if (!sw->isOpen()) {
+        vl->switchTopology.connect(sw->getBusInterface1()->getID(), sw->getBusInterface2()->getID());
+      }
       if (sw->isOpen() && sw->isRetained()) {
         // only keep opened retained switch if they are connected to a shunt
         auto bus1 = sw->getBusInterface1();
@@ -185,22 +233,25 @@ void NetworkManager::buildTree() {
           continue;
       }
       if (!sw->isOpen() || sw->isRetained()) {
-        auto bus1 = sw->getBusInterface1();
-        auto bus2 = sw->getBusInterface2();
+        auto bus1Id = sw->getBusInterface1()->getID();
+        auto bus2Id = sw->getBusInterface2()->getID();
 #ifdef _DEBUG_
         // By construction buses in switches are all inside the voltage level, so the nodes already exist
-        assert(nodes_.count(bus1->getID()) > 0);
-        assert(nodes_.count(bus2->getID()) > 0);
+        assert(vlNodes.count(bus1Id) > 0);
+        assert(vlNodes.count(bus2Id) > 0);
 #endif
-        nodes_[bus1->getID()]->neighbours.push_back(nodes_.at(bus2->getID()));
-        nodes_[bus2->getID()]->neighbours.push_back(nodes_.at(bus1->getID()));
-        LOG(debug, NodeConnectionBySwitch, bus1->getID(), bus2->getID(), sw->getID());
+        vlNodes[bus1Id]->neighbours.push_back(vlNodes.at(bus2Id));
+        vlNodes[bus2Id]->neighbours.push_back(vlNodes.at(bus1Id));
+        auto switchId = sw->getID();
+        shard.debugLogs.push_back([bus1Id, bus2Id, switchId]() { LOG(debug, NodeConnectionBySwitch, bus1Id, bus2Id, switchId); });
       }
     }
+    // buses connected by switch are computed once for the whole voltage level
+    vl->switchTopology.build();
 
     const auto &svarcs = networkVL->getStaticVarCompensators();
     for (const auto &svarc : svarcs) {
-      updateConditioningStatus(svarc);
+      shard.conditioning.update(svarc);
       if (!svarc->getInitialConnected()) {
         continue;
       }
@@ -209,7 +260,7 @@ void NetworkManager::buildTree() {
                                         svarc->getRegulationMode() == DYN::StaticVarCompensatorInterface::RegulationMode_t::RUNNING_Q)
                                            ? false
                                            : true;
-      auto regulatedBus = interface_->getServiceManager()->getRegulatedBus(svarc->getID());
+      const auto &regulatedBus = regulatedBusesByElement.at(svarc->getID());
       const double voltageSetPoint = isRegulatingVoltage ? svarc->getVSetPoint() : 0.;
       const bool hasStandByAutomaton = svarc->hasStandbyAutomaton();
       const double b0 = hasStandByAutomaton ? svarc->getB0() : 0.;
@@ -217,23 +268,96 @@ void NetworkManager::buildTree() {
       const double uMaxActivation = hasStandByAutomaton ? svarc->getUMaxActivation() : 0.;
       const double uSetPointMin = hasStandByAutomaton ? svarc->getUSetPointMin() : 0.;
       const double uSetPointMax = hasStandByAutomaton ? svarc->getUSetPointMax() : 0.;
-      nodes_[nodeid]->svarcs.emplace_back(svarc->getID(), isRegulatingVoltage, svarc->getBMin(), svarc->getBMax(), voltageSetPoint, svarc->getVNom(),
-                                          uMinActivation, uMaxActivation, uSetPointMin, uSetPointMax, b0, svarc->getSlope(), svarc->hasStandbyAutomaton(),
-                                          svarc->hasVoltagePerReactivePowerControl(), regulatedBus->getID(), nodeid, regulatedBus->getVNom());
-      LOG(debug, NodeContainsSVarC, nodeid, svarc->getID());
+      vlNodes[nodeid]->svarcs.emplace_back(svarc->getID(), isRegulatingVoltage, svarc->getBMin(), svarc->getBMax(), voltageSetPoint, svarc->getVNom(),
+                                           uMinActivation, uMaxActivation, uSetPointMin, uSetPointMax, b0, svarc->getSlope(), svarc->hasStandbyAutomaton(),
+                                           svarc->hasVoltagePerReactivePowerControl(), regulatedBus.id, nodeid, regulatedBus.vNom);
+      auto svarcId = svarc->getID();
+      shard.debugLogs.push_back([nodeid, svarcId]() { LOG(debug, NodeContainsSVarC, nodeid, svarcId); });
     }
 
     const auto &dangling_lines = networkVL->getDanglingLines();
     for (const auto &dline : dangling_lines) {
-      updateConditioningStatus(dline);
-      nodes_[dline->getBusInterface()->getID()]->danglingLines.emplace_back(dline->getID());
+      shard.conditioning.update(dline);
+      vlNodes[dline->getBusInterface()->getID()]->danglingLines.emplace_back(dline->getID());
+    }
+  } catch (...) {
+    // errors are propagated when merging the shard, to report them in the same order whatever the number of threads
+    shard.error = std::current_exception();
+  }
+}
+
+void NetworkManager::mergeVoltageLevelShard(const VoltageLevelShard &shard) {
+  if (shard.error) {
+    std::rethrow_exception(shard.error);
+  }
+  voltagelevels_.push_back(shard.voltageLevel);
+  for (const auto &node : shard.voltageLevel->nodes) {
+#if _DEBUG_
+    // ids of nodes should be unique
+    assert(nodes_.count(node->id) == 0);
+#endif
+    nodes_[node->id] = node;
+    if (node->fictitious)
+      LOG(debug, FictitiousNodeCreation, node->id);
+    else
+      LOG(debug, NodeCreation, node->id);
+  }
+  if (shard.slackNode) {
+    LOG(debug, SlackNodeFound, shard.slackNode->id);
+    slackNode_ = shard.slackNode;
+  }
+  conditioning_.merge(shard.conditioning);
+  for (const auto &debugLog : shard.debugLogs) {
+    debugLog();
+  }
+}
+
+void NetworkManager::buildTree(unsigned int nbThreads) {
+  auto network = dataInterface()->getNetwork();
+
+  auto opt_id = network->getSlackNodeBusId();
+
+  // We first build each voltage level on its own, with its nodes and the elements connected to them
+  const auto &voltageLevels = network->getVoltageLevels();
+  const auto regulatedBusesByElement = resolveRegulatedBuses(network);
+  const auto connectedBuses = resolveConnectedBuses(network);
+  std::vector<VoltageLevelShard> shards(voltageLevels.size());
+  const std::size_t nbWorkers = std::min<std::size_t>(nbThreads, voltageLevels.size());
+  if (nbWorkers <= 1) {
+    for (std::size_t i = 0; i < voltageLevels.size(); ++i) {
+      buildVoltageLevelShard(voltageLevels[i], opt_id, regulatedBusesByElement, connectedBuses, shards[i]);
+    }
+  } else {
+    std::atomic<std::size_t> nextVoltageLevel(0);
+    std::vector<std::thread> workers;
+    workers.reserve(nbWorkers);
+    for (std::size_t worker = 0; worker < nbWorkers; ++worker) {
+      workers.emplace_back([this, &voltageLevels, &opt_id, &regulatedBusesByElement, &connectedBuses, &shards, &nextVoltageLevel]() {
+        for (std::size_t i = nextVoltageLevel++; i < voltageLevels.size(); i = nextVoltageLevel++) {
+          buildVoltageLevelShard(voltageLevels[i], opt_id, regulatedBusesByElement, connectedBuses, shards[i]);
+        }
+      });
+    }
+    for (auto &worker : workers) {
+      worker.join();
+    }
+  }
+
+  // Then we gather them in the node tree, following the network order
+  for (const auto &shard : shards) {
+    mergeVoltageLevelShard(shard);
+  }
+  // Regulated buses may belong to any voltage level so they are processed once all nodes are known
+  for (const auto &shard : shards) {
+    for (const auto &busId : shard.regulatedBuses) {
+      updateMapRegulatingBuses(mapBusIdToNumberOfRegulation_, nodes_[busId]);
     }
   }
 
   // perform connections
   const auto &lines = network->getLines();
   for (const auto &line : lines) {
-    updateConditioningStatus(line);
+    conditioning_.update(line);
     auto bus1 = line->getBusInterface1();
     auto bus2 = line->getBusInterface2();
     if (line->getInitialConnected1() || line->getInitialConnected2()) {
@@ -253,7 +377,7 @@ void NetworkManager::buildTree() {
 
   const auto &transfos = network->getTwoWTransformers();
   for (const auto &transfo : transfos) {
-    updateConditioningStatus(transfo);
+    conditioning_.update(transfo);
     auto bus1 = transfo->getBusInterface1();
     auto bus2 = transfo->getBusInterface2();
     if (transfo->getInitialConnected1() || transfo->getInitialConnected2()) {
@@ -295,7 +419,7 @@ void NetworkManager::buildTree() {
     if (converterDyn1->getConverterType() == DYN::ConverterInterface::ConverterType_t::VSC_CONVERTER) {
       converterType = HvdcLine::ConverterType::VSC;
       auto vscConverterDyn1 = std::dynamic_pointer_cast<DYN::VscConverterInterface>(converterDyn1);
-      updateConditioningStatus(vscConverterDyn1);
+      conditioning_.update(vscConverterDyn1);
       bool voltageRegulationOn = vscConverterDyn1->getVoltageRegulatorOn();
       converter1 = std::make_shared<VSCConverter>(converterDyn1->getID(), converterDyn1->getBusInterface()->getID(), nullptr, voltageRegulationOn,
                                                   vscConverterDyn1->getQMax(), vscConverterDyn1->getQMin(), vscConverterDyn1->getQ(),
@@ -304,7 +428,7 @@ void NetworkManager::buildTree() {
         updateMapRegulatingBuses(mapBusIdToNumberOfRegulation_, nodes_[converterDyn1->getBusInterface()->getID()]);
       }
       auto vscConverterDyn2 = std::dynamic_pointer_cast<DYN::VscConverterInterface>(converterDyn2);
-      updateConditioningStatus(vscConverterDyn2);
+      conditioning_.update(vscConverterDyn2);
       voltageRegulationOn = vscConverterDyn2->getVoltageRegulatorOn();
       converter2 = std::make_shared<VSCConverter>(converterDyn2->getID(), converterDyn2->getBusInterface()->getID(), nullptr, voltageRegulationOn,
                                                   vscConverterDyn2->getQMax(), vscConverterDyn2->getQMin(), vscConverterDyn2->getQ(),
@@ -315,12 +439,12 @@ void NetworkManager::buildTree() {
     } else {
       converterType = HvdcLine::ConverterType::LCC;
       auto lccConverterDyn1 = std::dynamic_pointer_cast<DYN::LccConverterInterface>(converterDyn1);
-      updateConditioningStatus(lccConverterDyn1);
+      conditioning_.update(lccConverterDyn1);
       converter1 =
           std::make_shared<LCCConverter>(converterDyn1->getID(), converterDyn1->getBusInterface()->getID(), nullptr, lccConverterDyn1->getPowerFactor());
 
       auto lccConverterDyn2 = std::dynamic_pointer_cast<DYN::LccConverterInterface>(converterDyn2);
-      updateConditioningStatus(lccConverterDyn2);
+      conditioning_.update(lccConverterDyn2);
       converter2 =
           std::make_shared<LCCConverter>(converterDyn2->getID(), converterDyn2->getBusInterface()->getID(), nullptr, lccConverterDyn2->getPowerFactor());
     }
@@ -347,12 +471,23 @@ void NetworkManager::buildTree() {
     nodes_[converterDyn2->getBusInterface()->getID()]->converters.push_back(converter2);
     LOG(debug, HvdcLineInNetwork, hvdcLine->getID(), hvdcLine->getIdConverter1(), hvdcLine->getIdConverter2());
   }
+
+  std::vector<std::shared_ptr<Node>> nodes;
+  nodes.reserve(nodes_.size());
+  for (const auto &node : nodes_) {
+    nodes.push_back(node.second);
+  }
+  graph_ = NetworkGraph(nodes);
+  // from now on, the graph is the only store of the topology and the node index
+  graph_.releaseNodeReferences();
+  nodes_.clear();
 }
 
 void NetworkManager::walkNodes() const {
-  for (const auto &node : nodes_) {
+  for (NetworkGraph::Index i = 0; i < graph_.nbNodes(); ++i) {
+    const auto &node = graph_.node(i);
     for (const auto &cbk : nodesCallbacks_) {
-      cbk(node.second);
+      cbk(node);
     }
   }
 }
@@ -0,0 +1,570 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  NetworkSnapshot.cpp
+ *
+ * @brief Network snapshot implementation file
+ *
+ */
+
+#include "NetworkSnapshot.h"
+
+#include "Log.h"
+#include "SnapshotIO.h"
+
+#include <DYNTimer.h>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+
+namespace dfl {
+namespace inputs {
+
+namespace helper {
+
+static const char snapshotMagic[8] = {'D', 'F', 'L', 'S', 'N', 'A', 'P', '\0'};  ///< first bytes of any snapshot
+static const std::uint32_t snapshotFormatVersion = 1;                            ///< version of the snapshot format, to increase at each format change
+static const std::uint32_t noIndex = std::numeric_limits<std::uint32_t>::max();  ///< index representing a missing element
+
+/**
+ * @brief Write the reactive curve points of a generator or a converter
+ *
+ * @param writer the snapshot writer
+ * @param points the points to write
+ */
+template<class Point>
+static void writePoints(SnapshotWriter &writer, const std::vector<Point> &points) {
+  writer.write(static_cast<std::uint32_t>(points.size()));
+  for (const auto &point : points) {
+    writer.write(point.p);
+    writer.write(point.qmin);
+    writer.write(point.qmax);
+  }
+}
+
+/**
+ * @brief Read the reactive curve points of a generator or a converter
+ *
+ * @param reader the snapshot reader
+ * @returns the points
+ */
+template<class Point>
+static std::vector<Point> readPoints(SnapshotReader &reader) {
+  const auto size = reader.read<std::uint32_t>();
+  std::vector<Point> points;
+  for (std::uint32_t i = 0; i < size; ++i) {
+    const auto p = reader.read<double>();
+    const auto qmin = reader.read<double>();
+    const auto qmax = reader.read<double>();
+    points.emplace_back(p, qmin, qmax);
+  }
+  return points;
+}
+
+/**
+ * @brief Write a converter of a hvdc line
+ *
+ * @param writer the snapshot writer
+ * @param converter the converter to write
+ * @param converterType the type of converter of the hvdc line
+ */
+static void writeConverter(SnapshotWriter &writer, const Converter &converter, HvdcLine::ConverterType converterType) {
+  writer.writeString(converter.converterId);
+  writer.writeString(converter.busId);
+  if (converterType == HvdcLine::ConverterType::LCC) {
+    const auto &lccConverter = dynamic_cast<const LCCConverter &>(converter);
+    writer.write(lccConverter.powerFactor);
+  } else {
+    const auto &vscConverter = dynamic_cast<const VSCConverter &>(converter);
+    writer.writeBool(vscConverter.voltageRegulationOn);
+    writer.write(vscConverter.qMax);
+    writer.write(vscConverter.qMin);
+    writer.write(vscConverter.q);
+    writePoints(writer, vscConverter.points);
+  }
+}
+
+/**
+ * @brief Read a converter of a hvdc line
+ *
+ * @param reader the snapshot reader
+ * @param converterType the type of converter of the hvdc line
+ * @returns the converter, not yet connected to its hvdc line
+ */
+static std::shared_ptr<Converter> readConverter(SnapshotReader &reader, HvdcLine::ConverterType converterType) {
+  const auto converterId = reader.readString();
+  const auto busId = reader.readString();
+  if (converterType == HvdcLine::ConverterType::LCC) {
+    const auto powerFactor = reader.read<double>();
+    return std::make_shared<LCCConverter>(converterId, busId, nullptr, powerFactor);
+  }
+  const bool voltageRegulationOn = reader.readBool();
+  const auto qMax = reader.read<double>();
+  const auto qMin = reader.read<double>();
+  const auto q = reader.read<double>();
+  const auto points = readPoints<VSCConverter::ReactiveCurvePoint>(reader);
+  return std::make_shared<VSCConverter>(converterId, busId, nullptr, voltageRegulationOn, qMax, qMin, q, points);
+}
+
+/**
+ * @brief Write the elements of a node, apart from its connections to other nodes
+ *
+ * @param writer the snapshot writer
+ * @param node the node to write
+ */
+static void writeNode(SnapshotWriter &writer, Node &node) {
+  writer.write(node.index);
+  writer.writeString(node.id);
+  writer.write(node.nominalVoltage);
+  writer.writeBool(node.fictitious);
+  writer.write(static_cast<std::uint32_t>(node.shunts.size()));
+  for (const auto &shunt : node.shunts) {
+    writer.writeString(shunt.id);
+  }
+  writer.writeStrings(node.getBusesConnectedByVoltageLevel());
+  writer.writeBool(node.isBusConnected());
+
+  writer.write(static_cast<std::uint32_t>(node.busBarSections.size()));
+  for (const auto &busBarSection : node.busBarSections) {
+    writer.writeString(busBarSection.id);
+  }
+  writer.write(static_cast<std::uint32_t>(node.danglingLines.size()));
+  for (const auto &danglingLine : node.danglingLines) {
+    writer.writeString(danglingLine.id);
+  }
+  writer.write(static_cast<std::uint32_t>(node.loads.size()));
+  for (const auto &load : node.loads) {
+    writer.writeString(load.id);
+    writer.writeBool(load.isFictitious);
+    writer.writeBool(load.isNotInjecting);
+  }
+  writer.write(static_cast<std::uint32_t>(node.generators.size()));
+  for (const auto &generator : node.generators) {
+    writer.writeString(generator.id);
+    writer.writeBool(generator.isVoltageRegulationOn);
+    writePoints(writer, generator.points);
+    writer.write(generator.qmin);
+    writer.write(generator.qmax);
+    writer.write(generator.pmin);
+    writer.write(generator.pmax);
+    writer.write(generator.q);
+    writer.write(generator.targetP);
+    writer.write(generator.VNom);
+    writer.writeString(generator.regulatedBusId);
+    writer.writeString(generator.connectedBusId);
+    writer.writeBool(generator.isNuclear);
+    writer.writeBool(generator.hasActivePowerControl);
+  }
+  writer.write(static_cast<std::uint32_t>(node.svarcs.size()));
+  for (const auto &svarc : node.svarcs) {
+    writer.writeString(svarc.id);
+    writer.writeBool(svarc.isRegulatingVoltage);
+    writer.write(svarc.bMin);
+    writer.write(svarc.bMax);
+    writer.write(svarc.voltageSetPoint);
+    writer.write(svarc.UNom);
+    writer.write(svarc.UMinActivation);
+    writer.write(svarc.UMaxActivation);
+    writer.write(svarc.USetPointMin);
+    writer.write(svarc.USetPointMax);
+    writer.write(svarc.b0);
+    writer.write(svarc.slope);
+    writer.writeBool(svarc.hasStandByAutomaton);
+    writer.writeBool(svarc.hasVoltagePerReactivePowerControl);
+    writer.writeString(svarc.regulatedBusId);
+    writer.writeString(svarc.connectedBusId);
+    writer.write(svarc.UNomRemote);
+  }
+}
+
+/**
+ * @brief Read a node and its elements, apart from its connections to other nodes
+ *
+ * @param reader the snapshot reader
+ * @param vl the voltage level containing the node
+ * @param nodes the nodes of the snapshot, by index, to update
+ */
+static void readNode(SnapshotReader &reader, const std::shared_ptr<VoltageLevel> &vl, std::vector<std::shared_ptr<Node>> &nodes) {
+  const auto index = reader.readIndex(nodes.size());
+  if (nodes[index]) {
+    throw DFLError(SnapshotInconsistent);
+  }
+  const auto id = reader.readString();
+  const auto nominalVoltage = reader.read<double>();
+  const bool fictitious = reader.readBool();
+  std::vector<Shunt> shunts;
+  for (const auto &shuntId : reader.readStrings()) {
+    shunts.emplace_back(shuntId);
+  }
+  const auto busesConnected = reader.readStrings();
+  const bool busConnected = reader.readBool();
+  auto node = Node::build(id, vl, nominalVoltage, shunts, fictitious, busesConnected, busConnected);
+  nodes[index] = node;
+
+  for (const auto &busBarSectionId : reader.readStrings()) {
+    node->busBarSections.emplace_back(busBarSectionId);
+  }
+  for (const auto &danglingLineId : reader.readStrings()) {
+    node->danglingLines.emplace_back(danglingLineId);
+  }
+  const auto nbLoads = reader.read<std::uint32_t>();
+  for (std::uint32_t i = 0; i < nbLoads; ++i) {
+    const auto loadId = reader.readString();
+    const bool isFictitious = reader.readBool();
+    const bool isNotInjecting = reader.readBool();
+    node->loads.emplace_back(loadId, isFictitious, isNotInjecting);
+  }
+  const auto nbGenerators = reader.read<std::uint32_t>();
+  for (std::uint32_t i = 0; i < nbGenerators; ++i) {
+    const auto generatorId = reader.readString();
+    const bool isVoltageRegulationOn = reader.readBool();
+    const auto points = readPoints<Generator::ReactiveCurvePoint>(reader);
+    const auto qmin = reader.read<double>();
+    const auto qmax = reader.read<double>();
+    const auto pmin = reader.read<double>();
+    const auto pmax = reader.read<double>();
+    const auto q = reader.read<double>();
+    const auto targetP = reader.read<double>();
+    const auto VNom = reader.read<double>();
+    const auto regulatedBusId = reader.readString();
+    const auto connectedBusId = reader.readString();
+    const bool isNuclear = reader.readBool();
+    const bool hasActivePowerControl = reader.readBool();
+    node->generators.emplace_back(generatorId, isVoltageRegulationOn, points, qmin, qmax, pmin, pmax, q, targetP, VNom, regulatedBusId, connectedBusId,
+                                  isNuclear, hasActivePowerControl);
+  }
+  const auto nbSvarcs = reader.read<std::uint32_t>();
+  for (std::uint32_t i = 0; i < nbSvarcs; ++i) {
+    const auto svarcId = reader.readString();
+    const bool isRegulatingVoltage = reader.readBool();
+    const auto bMin = reader.read<double>();
+    const auto bMax = reader.read<double>();
+    const auto voltageSetPoint = reader.read<double>();
+    const auto UNom = reader.read<double>();
+    const auto UMinActivation = reader.read<double>();
+    const auto UMaxActivation = reader.read<double>();
+    const auto USetPointMin = reader.read<double>();
+    const auto USetPointMax = reader.read<double>();
+    const auto b0 = reader.read<double>();
+    const auto slope = reader.read<double>();
+    const bool hasStandByAutomaton = reader.readBool();
+    const bool hasVoltagePerReactivePowerControl = reader.readBool();
+    const auto regulatedBusId = reader.readString();
+    const auto connectedBusId = reader.readString();
+    const auto UNomRemote = reader.read<double>();
+    node->svarcs.emplace_back(svarcId, isRegulatingVoltage, bMin, bMax, voltageSetPoint, UNom, UMinActivation, UMaxActivation, USetPointMin, USetPointMax, b0,
+                              slope, hasStandByAutomaton, hasVoltagePerReactivePowerControl, regulatedBusId, connectedBusId, UNomRemote);
+  }
+}
+
+/**
+ * @brief Write the indexes of the elements connected to a node
+ *
+ * @param writer the snapshot writer
+ * @param graphIndexes the indexes in the network graph of the elements connected to the node
+ * @param element the function retrieving an element of the network graph from its index in the graph
+ * @param indexes the indexes of the elements in the snapshot
+ */
+template<class T, class F>
+static void writeReferences(SnapshotWriter &writer, NetworkGraph::Range<NetworkGraph::Index> graphIndexes, F &&element,
+                            const std::unordered_map<const T *, std::uint32_t> &indexes) {
+  writer.write(static_cast<std::uint32_t>(graphIndexes.size()));
+  for (auto graphIndex : graphIndexes) {
+    writer.write(indexes.at(&element(graphIndex)));
+  }
+}
+
+/**
+ * @brief Read the references to the elements connected to a node
+ *
+ * @param reader the snapshot reader
+ * @param elements the elements of the snapshot, by index
+ * @returns the references to the elements connected to the node
+ */
+template<class T>
+static std::vector<std::weak_ptr<T>> readReferences(SnapshotReader &reader, const std::vector<std::shared_ptr<T>> &elements) {
+  const auto size = reader.read<std::uint32_t>();
+  std::vector<std::weak_ptr<T>> references;
+  for (std::uint32_t i = 0; i < size; ++i) {
+    references.push_back(elements[reader.readIndex(elements.size())]);
+  }
+  return references;
+}
+
+}  // namespace helper
+
+std::string NetworkSnapshot::computeKey(const boost::filesystem::path &networkFilepath) {
+  std::uint64_t hash = snapshot::hashSeed;
+  if (boost::filesystem::file_size(networkFilepath) > 0) {
+    boost::interprocess::file_mapping mapping(networkFilepath.c_str(), boost::interprocess::read_only);
+    boost::interprocess::mapped_region region(mapping, boost::interprocess::read_only);
+    hash = snapshot::hashBytes(hash, static_cast<const char *>(region.get_address()), region.get_size());
+  }
+  return snapshot::formatKey(hash, helper::snapshotFormatVersion);
+}
+
+boost::filesystem::path NetworkSnapshot::filepath(const boost::filesystem::path &cacheDirectory, const std::string &key) {
+  return cacheDirectory / ("network-" + key + ".snapshot");
+}
+
+void NetworkSnapshot::write(const boost::filesystem::path &filepath, const std::string &key, const NetworkManager &manager) {
+#if defined(_DEBUG_) || defined(PRINT_TIMERS)
+  DYN::Timer timer("DFL::NetworkSnapshot::write()");
+#endif
+  SnapshotWriter writer;
+  for (auto c : helper::snapshotMagic) {
+    writer.write(c);
+  }
+  writer.write(helper::snapshotFormatVersion);
+  writer.writeString(key);
+
+  const auto &graph = manager.graph_;
+  writer.writeBool(manager.conditioning_.isPartiallyConditioned);
+  writer.writeBool(manager.conditioning_.isFullyConditioned);
+  writer.write(static_cast<std::uint32_t>(graph.nbNodes()));
+  writer.write(static_cast<std::uint32_t>(manager.voltagelevels_.size()));
+  for (const auto &vl : manager.voltagelevels_) {
+    writer.writeString(vl->id);
+    writer.write(static_cast<std::uint32_t>(vl->nodes.size()));
+    for (const auto &node : vl->nodes) {
+      helper::writeNode(writer, *node);
+    }
+  }
+  writer.write(manager.slackNode_ ? manager.slackNode_->index : helper::noIndex);
+
+  std::unordered_map<const Line *, std::uint32_t> lineIndexes;
+  writer.write(static_cast<std::uint32_t>(manager.lines_.size()));
+  for (const auto &line : manager.lines_) {
+    lineIndexes.insert({line.get(), static_cast<std::uint32_t>(lineIndexes.size())});
+    writer.writeString(line->id);
+    writer.writeString(line->activeSeason);
+    writer.write(line->nodes[0]->index);
+    writer.write(line->nodes[1]->index);
+  }
+  std::unordered_map<const Tfo *, std::uint32_t> tfoIndexes;
+  writer.write(static_cast<std::uint32_t>(manager.tfos_.size()));
+  for (const auto &tfo : manager.tfos_) {
+    tfoIndexes.insert({tfo.get(), static_cast<std::uint32_t>(tfoIndexes.size())});
+    writer.writeString(tfo->id);
+    writer.writeString(tfo->activeSeason);
+    writer.write(static_cast<std::uint32_t>(tfo->nodes.size()));
+    for (const auto &node : tfo->nodes) {
+      writer.write(node->index);
+    }
+  }
+  // converters are indexed by the position of their hvdc line and their side
+  std::unordered_map<const Converter *, std::uint32_t> converterIndexes;
+  writer.write(static_cast<std::uint32_t>(manager.hvdcLines_.size()));
+  for (const auto &hvdcLine : manager.hvdcLines_) {
+    converterIndexes.insert({hvdcLine->converter1.get(), static_cast<std::uint32_t>(converterIndexes.size())});
+    converterIndexes.insert({hvdcLine->converter2.get(), static_cast<std::uint32_t>(converterIndexes.size())});
+    writer.writeString(hvdcLine->id);
+    writer.writeBool(hvdcLine->converterType == HvdcLine::ConverterType::VSC);
+    helper::writeConverter(writer, *hvdcLine->converter1, hvdcLine->converterType);
+    helper::writeConverter(writer, *hvdcLine->converter2, hvdcLine->converterType);
+    writer.writeBool(hvdcLine->activePowerControl.is_initialized());
+    if (hvdcLine->activePowerControl) {
+      writer.write(hvdcLine->activePowerControl->droop);
+      writer.write(hvdcLine->activePowerControl->p0);
+    }
+    writer.write(hvdcLine->pMax);
+    writer.writeBool(hvdcLine->isConverter1Rectifier);
+    writer.write(hvdcLine->vdcNom);
+    writer.write(hvdcLine->pSetPoint);
+    writer.write(hvdcLine->rdc);
+    writer.write(hvdcLine->lossFactors[0]);
+    writer.write(hvdcLine->lossFactors[1]);
+  }
+
+  for (NetworkGraph::Index i = 0; i < graph.nbNodes(); ++i) {
+    writer.write(static_cast<std::uint32_t>(graph.neighbours(i).size()));
+    for (auto neighbour : graph.neighbours(i)) {
+      writer.write(neighbour);
+    }
+    helper::writeReferences(writer, graph.lines(i), [&graph](NetworkGraph::Index index) -> const Line & { return graph.line(index); }, lineIndexes);
+    helper::writeReferences(writer, graph.tfos(i), [&graph](NetworkGraph::Index index) -> const Tfo & { return graph.tfo(index); }, tfoIndexes);
+    helper::writeReferences(writer, graph.converters(i), [&graph](NetworkGraph::Index index) -> const Converter & { return graph.converter(index); },
+                            converterIndexes);
+  }
+
+  writer.write(static_cast<std::uint32_t>(manager.mapBusIdToNumberOfRegulation_.size()));
+  for (const auto &regulation : manager.mapBusIdToNumberOfRegulation_) {
+    writer.writeString(regulation.first);
+    writer.writeBool(regulation.second == NetworkManager::NbOfRegulating::MULTIPLES);
+  }
+
+  try {
+    snapshot::save(filepath, writer.buffer());
+    LOG(info, NetworkSnapshotSaved, filepath.generic_string());
+  } catch (const std::exception &e) {
+    LOG(warn, NetworkSnapshotWriteFailed, filepath.generic_string(), e.what());
+  }
+}
+
+bool NetworkSnapshot::read(const boost::filesystem::path &filepath, const std::string &key, NetworkManager &manager) {
+#if defined(_DEBUG_) || defined(PRINT_TIMERS)
+  DYN::Timer timer("DFL::NetworkSnapshot::read()");
+#endif
+  boost::system::error_code ec;
+  if (!boost::filesystem::is_regular_file(filepath, ec)) {
+    return false;
+  }
+
+  try {
+    if (boost::filesystem::file_size(filepath) == 0) {
+      throw DFLError(SnapshotTruncated);
+    }
+    boost::interprocess::file_mapping mapping(filepath.c_str(), boost::interprocess::read_only);
+    boost::interprocess::mapped_region region(mapping, boost::interprocess::read_only);
+    if (!restore(static_cast<const char *>(region.get_address()), region.get_size(), key, manager)) {
+      LOG(info, NetworkSnapshotOutdated, filepath.generic_string());
+      return false;
+    }
+  } catch (const std::exception &e) {
+    LOG(warn, NetworkSnapshotCorrupted, filepath.generic_string(), e.what());
+    return false;
+  }
+  return true;
+}
+
+bool NetworkSnapshot::restore(const char *data, std::size_t size, const std::string &key, NetworkManager &manager) {
+  SnapshotReader reader(data, size);
+  if (std::memcmp(reader.readBytes(sizeof(helper::snapshotMagic)), helper::snapshotMagic, sizeof(helper::snapshotMagic)) != 0) {
+    throw DFLError(SnapshotInconsistent);
+  }
+  if (reader.read<std::uint32_t>() != helper::snapshotFormatVersion || reader.readString() != key) {
+    return false;
+  }
+
+  // everything is restored in local variables first, so that the manager is left untouched if the snapshot is not consistent
+  NetworkManager::ConditioningStatus conditioning;
+  conditioning.isPartiallyConditioned = reader.readBool();
+  conditioning.isFullyConditioned = reader.readBool();
+  const auto nbNodes = reader.read<std::uint32_t>();
+  if (nbNodes > size) {
+    throw DFLError(SnapshotInconsistent);
+  }
+  std::vector<std::shared_ptr<Node>> nodes(nbNodes);
+  const auto nbVoltageLevels = reader.read<std::uint32_t>();
+  std::vector<std::shared_ptr<VoltageLevel>> voltageLevels;
+  for (std::uint32_t i = 0; i < nbVoltageLevels; ++i) {
+    auto vl = std::make_shared<VoltageLevel>(reader.readString());
+    const auto nbVlNodes = reader.read<std::uint32_t>();
+    for (std::uint32_t j = 0; j < nbVlNodes; ++j) {
+      helper::readNode(reader, vl, nodes);
+    }
+    voltageLevels.push_back(vl);
+  }
+  for (const auto &node : nodes) {
+    if (!node) {
+      throw DFLError(SnapshotInconsistent);
+    }
+  }
+  const auto slackNodeIndex = reader.read<std::uint32_t>();
+  std::shared_ptr<Node> slackNode;
+  if (slackNodeIndex != helper::noIndex) {
+    if (slackNodeIndex >= nodes.size()) {
+      throw DFLError(SnapshotInconsistent);
+    }
+    slackNode = nodes[slackNodeIndex];
+  }
+
+  // lines and transformers are built without connection, node references are restored afterwards as they were saved
+  const auto nbLines = reader.read<std::uint32_t>();
+  std::vector<std::shared_ptr<Line>> lines;
+  for (std::uint32_t i = 0; i < nbLines; ++i) {
+    const auto lineId = reader.readString();
+    const auto season = reader.readString();
+    const auto &node1 = nodes[reader.readIndex(nodes.size())];
+    const auto &node2 = nodes[reader.readIndex(nodes.size())];
+    lines.push_back(Line::build(lineId, node1, node2, season, false, false));
+  }
+  const auto nbTfos = reader.read<std::uint32_t>();
+  std::vector<std::shared_ptr<Tfo>> tfos;
+  for (std::uint32_t i = 0; i < nbTfos; ++i) {
+    const auto tfoId = reader.readString();
+    const auto season = reader.readString();
+    const auto nbTfoNodes = reader.read<std::uint32_t>();
+    if (nbTfoNodes == 2) {
+      const auto &node1 = nodes[reader.readIndex(nodes.size())];
+      const auto &node2 = nodes[reader.readIndex(nodes.size())];
+      tfos.push_back(Tfo::build(tfoId, node1, node2, season, false, false));
+    } else if (nbTfoNodes == 3) {
+      const auto &node1 = nodes[reader.readIndex(nodes.size())];
+      const auto &node2 = nodes[reader.readIndex(nodes.size())];
+      const auto &node3 = nodes[reader.readIndex(nodes.size())];
+      tfos.push_back(Tfo::build(tfoId, node1, node2, node3, season, false, false, false));
+    } else {
+      throw DFLError(SnapshotInconsistent);
+    }
+  }
+  const auto nbHvdcLines = reader.read<std::uint32_t>();
+  std::vector<std::shared_ptr<HvdcLine>> hvdcLines;
+  std::vector<std::shared_ptr<Converter>> converters;
+  for (std::uint32_t i = 0; i < nbHvdcLines; ++i) {
+    const auto hvdcLineId = reader.readString();
+    const auto converterType = reader.readBool() ? HvdcLine::ConverterType::VSC : HvdcLine::ConverterType::LCC;
+    auto converter1 = helper::readConverter(reader, converterType);
+    auto converter2 = helper::readConverter(reader, converterType);
+    boost::optional<HvdcLine::ActivePowerControl> activePowerControl;
+    if (reader.readBool()) {
+      const auto droop = reader.read<double>();
+      const auto p0 = reader.read<double>();
+      activePowerControl = HvdcLine::ActivePowerControl(droop, p0);
+    }
+    const auto pMax = reader.read<double>();
+    const bool isConverter1Rectifier = reader.readBool();
+    const auto vdcNom = reader.read<double>();
+    const auto pSetPoint = reader.read<double>();
+    const auto rdc = reader.read<double>();
+    std::array<double, 2> lossFactors;
+    lossFactors[0] = reader.read<double>();
+    lossFactors[1] = reader.read<double>();
+    hvdcLines.push_back(HvdcLine::build(hvdcLineId, converterType, converter1, converter2, activePowerControl, pMax, isConverter1Rectifier, vdcNom, pSetPoint,
+                                        rdc, lossFactors));
+    converters.push_back(converter1);
+    converters.push_back(converter2);
+  }
+
+  for (const auto &node : nodes) {
+    const auto nbNeighbours = reader.read<std::uint32_t>();
+    for (std::uint32_t i = 0; i < nbNeighbours; ++i) {
+      node->neighbours.push_back(nodes[reader.readIndex(nodes.size())]);
+    }
+    node->lines = helper::readReferences(reader, lines);
+    node->tfos = helper::readReferences(reader, tfos);
+    node->converters = helper::readReferences(reader, converters);
+  }
+
+  NetworkManager::BusMapRegulating busRegulationMap;
+  const auto nbRegulatedBuses = reader.read<std::uint32_t>();
+  for (std::uint32_t i = 0; i < nbRegulatedBuses; ++i) {
+    const auto busId = reader.readString();
+    busRegulationMap[busId] = reader.readBool() ? NetworkManager::NbOfRegulating::MULTIPLES : NetworkManager::NbOfRegulating::ONE;
+  }
+
+  manager.voltagelevels_ = std::move(voltageLevels);
+  manager.slackNode_ = slackNode;
+  manager.lines_ = std::move(lines);
+  manager.tfos_ = std::move(tfos);
+  manager.hvdcLines_ = std::move(hvdcLines);
+  manager.mapBusIdToNumberOfRegulation_ = std::move(busRegulationMap);
+  manager.conditioning_ = conditioning;
+  manager.graph_ = NetworkGraph(nodes);
+  manager.graph_.releaseNodeReferences();
+  return true;
+}
+
+}  // namespace inputs
+}  // namespace dfl
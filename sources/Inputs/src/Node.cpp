@@ -21,31 +21,41 @@ namespace dfl {
 namespace inputs {
 
 std::shared_ptr<Node> Node::build(const NodeId &id, const std::shared_ptr<VoltageLevel> &vl, double nominalVoltage, const std::vector<Shunt> &shunts,
-                                  bool fictitious, boost::shared_ptr<DYN::ServiceManagerInterface> serviceManagerNode) {
-  auto ret = std::shared_ptr<Node>(new Node(id, vl, nominalVoltage, shunts, fictitious, serviceManagerNode));
+                                  bool fictitious, boost::shared_ptr<DYN::ServiceManagerInterface> serviceManagerNode, bool busConnected) {
+  auto ret = std::shared_ptr<Node>(new Node(id, vl, nominalVoltage, shunts, fictitious, serviceManagerNode, busConnected));
   vl->nodes.push_back(ret);
+  if (busConnected && vl->representativeConnectedBus_.empty()) {
+    vl->representativeConnectedBus_ = id;
+  }
+  return ret;
+}
+
+std::shared_ptr<Node> Node::build(const NodeId &id, const std::shared_ptr<VoltageLevel> &vl, double nominalVoltage, const std::vector<Shunt> &shunts,
+                                  bool fictitious, const std::vector<std::string> &busesConnected, bool busConnected) {
+  auto ret = build(id, vl, nominalVoltage, shunts, fictitious, nullptr, busConnected);
+  ret->busesConnectedInitialized = true;
+  ret->busesConnected = busesConnected;
   return ret;
 }
 
 Node::Node(const NodeId &idNode, const std::shared_ptr<VoltageLevel> vl, double nominalVoltageNode, const std::vector<Shunt> &shunts, bool fictitious,
-           boost::shared_ptr<DYN::ServiceManagerInterface> serviceManagerNode)
+           boost::shared_ptr<DYN::ServiceManagerInterface> serviceManagerNode, bool busConnected)
     : id(idNode), voltageLevel(vl), nominalVoltage{nominalVoltageNode}, shunts(shunts), fictitious(fictitious), neighbours{},
-      serviceManager(serviceManagerNode), busesConnectedInitialized(serviceManagerNode == nullptr) {}
+      serviceManager(serviceManagerNode), busesConnectedInitialized(false), busConnected(busConnected) {}
 
 const std::vector<std::string> &Node::getBusesConnectedByVoltageLevel() {
   if (!busesConnectedInitialized) {
     busesConnectedInitialized = true;
     auto vl = voltageLevel.lock();
-    busesConnected = serviceManager->getBusesConnectedBySwitch(id, vl->id);
+    if (vl->switchTopology.contains(id)) {
+      busesConnected = vl->switchTopology.busesConnected(id);
+    } else if (serviceManager) {
+      busesConnected = serviceManager->getBusesConnectedBySwitch(id, vl->id);
+    }
   }
   return busesConnected;
 }
 
-bool Node::isBusConnected() {
-  auto vl = voltageLevel.lock();
-  return serviceManager->isBusConnected(id, vl->id);
-}
-
 bool operator==(const Node &lhs, const Node &rhs) { return lhs.id == rhs.id; }
 
 bool operator!=(const Node &lhs, const Node &rhs) { return !(lhs == rhs); }
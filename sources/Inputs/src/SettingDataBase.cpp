@@ -14,12 +14,12 @@
  */
 
 #include "SettingDataBase.h"
+#include "DynamicDataBaseSnapshot.h"
 #include "XsdPath.hpp"
 
 #include "Log.h"
 
 #include <boost/optional.hpp>
-#include <fstream>
 #include <xml/sax/parser/ParserFactory.h>
 
 namespace parser = xml::sax::parser;
@@ -35,10 +35,22 @@ static parser::namespace_uri ns("");
 
 const std::string SettingDataBase::SettingXmlDocument::origData_("IIDM");
 
-SettingDataBase::SettingDataBase(const std::vector<boost::filesystem::path> &settingFilePaths) {
+SettingDataBase::SettingDataBase(const std::vector<boost::filesystem::path> &settingFilePaths, const common::InputArchive &inputArchive,
+                                 const boost::filesystem::path &snapshotCacheDirectory) {
   if (settingFilePaths.empty())
     return;
 
+  std::string snapshotKey;
+  boost::filesystem::path snapshotFilepath;
+  if (!snapshotCacheDirectory.empty()) {
+    snapshotKey = DynamicDataBaseSnapshot::computeKey("setting", settingFilePaths, inputArchive);
+    snapshotFilepath = DynamicDataBaseSnapshot::filepath(snapshotCacheDirectory, "setting", snapshotKey);
+    if (DynamicDataBaseSnapshot::read(snapshotFilepath, snapshotKey, *this)) {
+      LOG(info, DynamicDataBaseSnapshotLoaded, snapshotFilepath.generic_string());
+      return;
+    }
+  }
+
   parser::ParserPtr parser = parser::ParserFactory().createParser();
 
   file::path xsdPath = getXsdPath("setting_dynaflow.xsd");
@@ -47,18 +59,21 @@ SettingDataBase::SettingDataBase(const std::vector<boost::filesystem::path> &set
 
   SettingXmlDocument settingXml(*this);
   for (const boost::filesystem::path &path : settingFilePaths) {
-    std::ifstream in(path.c_str());
-    if (!in) {
+    auto in = inputArchive.open(path);
+    if (!*in) {
       LOG(warn, DynModelFileNotFound, path.generic_string());
       continue;
     }
 
     try {
-      parser->parse(in, settingXml, xsdPath != "");
+      parser->parse(*in, settingXml, xsdPath != "");
     } catch (const xml::sax::parser::ParserException &e) {
       throw DFLError(DynModelFileReadError, path.generic_string(), e.what());
     }
   }
+
+  if (!snapshotFilepath.empty())
+    DynamicDataBaseSnapshot::write(snapshotFilepath, snapshotKey, *this);
 }
 
 const SettingDataBase::Set &SettingDataBase::getSet(const std::string &id) const {
@@ -0,0 +1,71 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  SnapshotIO.cpp
+ *
+ * @brief Binary snapshot reading and writing utilities implementation file
+ *
+ */
+
+#include "SnapshotIO.h"
+
+#include "version.h"
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace dfl {
+namespace inputs {
+namespace snapshot {
+
+std::uint64_t hashBytes(std::uint64_t hash, const char *data, std::size_t size) {
+  const std::uint64_t prime = 1099511628211ULL;
+  for (std::size_t i = 0; i < size; ++i) {
+    hash ^= static_cast<unsigned char>(data[i]);
+    hash *= prime;
+  }
+  return hash;
+}
+
+std::string formatKey(std::uint64_t hash, std::uint32_t formatVersion) {
+  // the versions are separated so that their concatenation is not ambiguous
+  const std::string version = DYNAFLOW_LAUNCHER_VERSION_STRING "/" DYNAFLOW_LAUNCHER_DYNAWO_VERSION_STRING;
+  hash = hashBytes(hash, version.data(), version.size());
+  hash = hashBytes(hash, reinterpret_cast<const char *>(&formatVersion), sizeof(formatVersion));
+
+  std::stringstream ss;
+  ss << std::hex << std::setw(16) << std::setfill('0') << hash;
+  return ss.str();
+}
+
+void save(const boost::filesystem::path &filepath, const std::string &content) {
+  boost::filesystem::path temporaryFilepath;
+  try {
+    boost::filesystem::create_directories(filepath.parent_path());
+    temporaryFilepath = filepath.parent_path() / boost::filesystem::unique_path(filepath.filename().generic_string() + ".%%%%-%%%%-%%%%");
+    std::ofstream file(temporaryFilepath.c_str(), std::ios::binary);
+    file.write(content.data(), static_cast<std::streamsize>(content.size()));
+    file.close();
+    if (!file) {
+      throw DFLError(FileCreationFailed, temporaryFilepath.generic_string());
+    }
+    boost::filesystem::rename(temporaryFilepath, filepath);
+  } catch (...) {
+    boost::system::error_code ec;
+    boost::filesystem::remove(temporaryFilepath, ec);
+    throw;
+  }
+}
+
+}  // namespace snapshot
+}  // namespace inputs
+}  // namespace dfl
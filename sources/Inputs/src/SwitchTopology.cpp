@@ -0,0 +1,101 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  SwitchTopology.cpp
+ *
+ * @brief Switch topology of a voltage level implementation file
+ *
+ */
+
+#include "SwitchTopology.h"
+
+#include <limits>
+#include <utility>
+
+namespace dfl {
+namespace inputs {
+
+void SwitchTopology::addBus(const BusId &busId) {
+  if (contains(busId)) {
+    return;
+  }
+  indexes_[busId] = buses_.size();
+  parents_.push_back(buses_.size());
+  sizes_.push_back(1);
+  buses_.push_back(busId);
+}
+
+void SwitchTopology::connect(const BusId &busId1, const BusId &busId2) {
+  addBus(busId1);
+  addBus(busId2);
+  auto root1 = find(indexes_.at(busId1));
+  auto root2 = find(indexes_.at(busId2));
+  if (root1 == root2) {
+    return;
+  }
+  // union by size keeps the trees shallow
+  if (sizes_[root1] < sizes_[root2]) {
+    std::swap(root1, root2);
+  }
+  parents_[root2] = root1;
+  sizes_[root1] += sizes_[root2];
+}
+
+std::size_t SwitchTopology::find(std::size_t index) {
+  while (parents_[index] != index) {
+    parents_[index] = parents_[parents_[index]];
+    index = parents_[index];
+  }
+  return index;
+}
+
+void SwitchTopology::build() {
+  const auto noComponent = std::numeric_limits<ComponentIndex>::max();
+  std::vector<ComponentIndex> rootComponents(buses_.size(), noComponent);
+  std::vector<std::size_t> componentSizes;
+  components_.assign(buses_.size(), noComponent);
+  for (std::size_t i = 0; i < buses_.size(); ++i) {
+    auto root = find(i);
+    if (rootComponents[root] == noComponent) {
+      rootComponents[root] = static_cast<ComponentIndex>(componentSizes.size());
+      componentSizes.push_back(0);
+    }
+    components_[i] = rootComponents[root];
+    ++componentSizes[components_[i]];
+  }
+
+  componentOffsets_.assign(1, 0);
+  for (auto size : componentSizes) {
+    componentOffsets_.push_back(componentOffsets_.back() + size);
+  }
+  // buses are placed in registration order inside each set
+  std::vector<std::size_t> positions(componentOffsets_.begin(), componentOffsets_.end() - 1);
+  componentBuses_.resize(buses_.size());
+  for (std::size_t i = 0; i < buses_.size(); ++i) {
+    componentBuses_[positions[components_[i]]++] = i;
+  }
+}
+
+std::vector<SwitchTopology::BusId> SwitchTopology::busesConnected(const BusId &busId) const {
+  const auto index = indexes_.at(busId);
+  const auto component = components_[index];
+  std::vector<BusId> ret;
+  ret.reserve(componentOffsets_[component + 1] - componentOffsets_[component] - 1);
+  for (auto i = componentOffsets_[component]; i < componentOffsets_[component + 1]; ++i) {
+    if (componentBuses_[i] != index) {
+      ret.push_back(buses_[componentBuses_[i]]);
+    }
+  }
+  return ret;
+}
+
+}  // namespace inputs
+}  // namespace dfl
@@ -42,16 +42,18 @@ class Diagram {
      * @param directoryPath the directory path of the diagram files to write
      * @param gens generators definition coming from algorithms
      * @param hvdcDefinitions the HVDC definitions to used
+     * @param singleFile true to write all the tables in a single file, false to write a file per element
      */
     DiagramDefinition(const std::string &base, const std::string &directoryPath, const std::vector<algo::GeneratorDefinition> &gens,
-                      const algo::HVDCLineDefinitions &hvdcDefinitions)
-        : basename(base), directoryPath(directoryPath), generators(gens), hvdcDefinitions(hvdcDefinitions) {}
-
-    const std::string basename;       ///< basename for file
-    const std::string directoryPath;  ///< directory path for files to write
-    // non const copies instead of const references because we need to modify them before use
-    std::vector<algo::GeneratorDefinition> generators;  ///< generators found
-    algo::HVDCLineDefinitions hvdcDefinitions;          ///< HVDC definitions
+                      const algo::HVDCLineDefinitions &hvdcDefinitions, bool singleFile = false)
+        : basename(base), directoryPath(directoryPath), generators(gens), singleFile(singleFile), hvdcDefinitions(hvdcDefinitions) {}
+
+    const std::string basename;                                ///< basename for file
+    const std::string directoryPath;                           ///< directory path for files to write
+    const std::vector<algo::GeneratorDefinition> &generators;  ///< generators found
+    const bool singleFile;                                     ///< true if all the tables are written in a single file
+    // non const copy instead of const reference because we need to modify it before use
+    algo::HVDCLineDefinitions hvdcDefinitions;  ///< HVDC definitions
   };
 
   /**
@@ -62,7 +64,9 @@ class Diagram {
   explicit Diagram(DiagramDefinition &&def);
 
   /**
-   * @brief Write the Diagram file
+   * @brief Write the Diagram files
+   *
+   * Either a file per element or a single file with the tables of all the elements, see DiagramDefinition::singleFile
    */
   void write() const;
 
@@ -87,40 +91,72 @@ class Diagram {
    * @brief Write a single table in the Diagram file
    *
    * the type T requires to have:
-   * - a field "id" (string)
    * - a vector of reactive curve points field "points"
    * - a double field "pmax"
    * - a double field "qmax"
    * - a double field "pmin"
    * - a double field "qmin"
    *
+   * @param id The id the table is named after
    * @param element The element that will be used to write the diagram values
    * @param buffer The buffer to store the string that will be written to the file
    * @param table The enum determining if we write the Qmin or Qmax table
    */
-  template <class T> static void writeTable(const T &element, std::stringstream &buffer, Tables table);
+  template <class T> static void writeTable(const std::string &id, const T &element, std::stringstream &buffer, Tables table);
+
+  /**
+   * @brief Write the Qmin and Qmax tables of an element
+   *
+   * The tables are appended to the tables buffer in single file mode, otherwise they are written in the file of the element
+   *
+   * @param id The id the tables are named after
+   * @param element The element that will be used to write the diagram values, see writeTable
+   * @param tables The buffer gathering the tables of all the elements in single file mode
+   */
+  template <class T> void writeDiagram(const std::string &id, const T &element, std::stringstream &tables) const;
+
+  /**
+   * @brief Write a diagram file
+   *
+   * @param filename the name of the file in the diagram directory
+   * @param tables the tables to write
+   */
+  void writeFile(const std::string &filename, const std::stringstream &tables) const;
 
-  /// @brief Write generator diagrams
-  void writeGenerators() const;
-  /// @brief Write VSC converters diagrams
-  void writeConverters() const;
+  /**
+   * @brief Write generator diagrams
+   *
+   * A diagram shared by several generators is written once, named after one of them, see algo::nameReactiveDiagrams
+   *
+   * @param tables The buffer gathering the tables of all the elements in single file mode
+   */
+  void writeGenerators(std::stringstream &tables) const;
+
+  /**
+   * @brief Write VSC converters diagrams
+   * @param tables The buffer gathering the tables of all the elements in single file mode
+   */
+  void writeConverters(std::stringstream &tables) const;
 
   /**
    * @brief Write VSC converter diagram
    * @param vscDefinition the VSC definition to use
+   * @param tables The buffer gathering the tables of all the elements in single file mode
    */
-  void writeVSC(const dfl::algo::VSCDefinition &vscDefinition) const;
+  void writeVSC(const dfl::algo::VSCDefinition &vscDefinition, std::stringstream &tables) const;
 
   /**
    * @brief Write LCC converter diagram
    * @param converterId the id of the LCC converter
    * @param powerFactor the power factor of the LCC
    * @param pMax the maximum p of the HVDC line which owns the LCC converter
+   * @param tables The buffer gathering the tables of all the elements in single file mode
    */
-  void writeLCC(const algo::HVDCDefinition::ConverterId &converterId, double powerFactor, double pMax) const;
+  void writeLCC(const algo::HVDCDefinition::ConverterId &converterId, double powerFactor, double pMax, std::stringstream &tables) const;
 
  private:
-  DiagramDefinition def_;  ///< Diagram file information
+  DiagramDefinition def_;                  ///< Diagram file information
+  mutable bool directoryCreated_ = false;  ///< true once the diagram directory is known to exist
 };
 }  // namespace outputs
 }  // namespace dfl
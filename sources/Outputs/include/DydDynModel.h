@@ -17,12 +17,12 @@
 
 #pragma once
 
+#include "DydStream.h"
 #include "DynModelDefinitionAlgorithm.h"
 #include "GeneratorDefinitionAlgorithm.h"
 #include "HVDCDefinitionAlgorithm.h"
 #include "LoadDefinitionAlgorithm.h"
 
-#include <DYDDynamicModelsCollection.h>
 #include <boost/shared_ptr.hpp>
 
 namespace dfl {
@@ -47,31 +47,31 @@ class DydDynModel {
   /**
    * @brief enrich the dynamic black models set collection for defined dynamic models
    *
-   * @param dynamicModelsToConnect dynamic black models set collection to enrich
+   * @param dynamicModelsToConnect streaming writer of the dynamic black models to enrich
    * @param basename the basename for current file
    * @param dynamicDataBaseManager the database manager to use
    */
-  void write(boost::shared_ptr<dynamicdata::DynamicModelsCollection> &dynamicModelsToConnect, const std::string &basename,
+  void write(DydStream &dynamicModelsToConnect, const std::string &basename,
              const inputs::DynamicDataBaseManager &dynamicDataBaseManager);
 
  private:
   /**
    * @brief add the macro connector for defined dynamic models
    *
-   * @param dynamicModelsToConnect dynamic black models set collection to enrich
+   * @param dynamicModelsToConnect streaming writer of the dynamic black models to enrich
    * @param dynModel defined dynamic model
    * @param dynamicDataBaseManager the database manager to use
    */
-  void writeMacroConnector(boost::shared_ptr<dynamicdata::DynamicModelsCollection> &dynamicModelsToConnect, const algo::DynamicModelDefinition &dynModel,
+  void writeMacroConnector(DydStream &dynamicModelsToConnect, const algo::DynamicModelDefinition &dynModel,
                            const inputs::DynamicDataBaseManager &dynamicDataBaseManager);
 
   /**
    * @brief add all the macro connectors for defined dynamic models
    *
-   * @param dynamicModelsToConnect dynamic black models set collection to enrich
+   * @param dynamicModelsToConnect streaming writer of the dynamic black models to enrich
    * @param dynamicDataBaseManager the database manager to use
    */
-  void writeMacroConnectors(boost::shared_ptr<dynamicdata::DynamicModelsCollection> &dynamicModelsToConnect,
+  void writeMacroConnectors(DydStream &dynamicModelsToConnect,
                             const inputs::DynamicDataBaseManager &dynamicDataBaseManager);
 
  private:
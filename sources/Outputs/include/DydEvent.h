@@ -84,6 +84,24 @@ class DydEvent {
    */
   void write() const;
 
+  /**
+   * @brief Add the macro connectors common to all the events
+   *
+   * @param dynamicModels the list of dynamic models where the macro connectors will be added
+   */
+  static void addMacroConnectors(boost::shared_ptr<dynamicdata::DynamicModelsCollection>& dynamicModels);
+
+  /**
+   * @brief Add the models and connections of the event disconnecting a contingency element
+   *
+   * @param dynamicModels the list of dynamic models where the models and connections will be added
+   * @param element the contingency element
+   * @param isNetwork true if the element is using a network cpp model
+   * @param basename basename for file
+   */
+  static void addElementModels(boost::shared_ptr<dynamicdata::DynamicModelsCollection>& dynamicModels, const inputs::ContingencyElement& element,
+                               bool isNetwork, const std::string& basename);
+
  private:
   /**
    * @brief Create black box model for disconnecting a branch
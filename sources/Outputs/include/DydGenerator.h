@@ -17,9 +17,9 @@
 
 #pragma once
 
+#include "DydStream.h"
 #include "GeneratorDefinitionAlgorithm.h"
 
-#include <DYDDynamicModelsCollection.h>
 #include <boost/shared_ptr.hpp>
 #include <unordered_map>
 
@@ -66,11 +66,11 @@ class DydGenerator {
   /**
    * @brief enrich the dynamic black models set collection for generators
    *
-   * @param dynamicModelsToConnect dynamic black models set collection to enrich
+   * @param dynamicModelsToConnect streaming writer of the dynamic black models to enrich
    * @param basename the basename for current file
    * @param slackNodeId id of slack node
    */
-  void write(boost::shared_ptr<dynamicdata::DynamicModelsCollection>& dynamicModelsToConnect,
+  void write(DydStream& dynamicModelsToConnect,
               const std::string& basename,
               const std::string& slackNodeId);
 
@@ -78,38 +78,38 @@ class DydGenerator {
   /**
    * @brief add the macro connector for generators
    *
-   * @param dynamicModelsToConnect dynamic black models set collection to enrich
+   * @param dynamicModelsToConnect streaming writer of the dynamic black models to enrich
    */
-  void writeMacroConnector(boost::shared_ptr<dynamicdata::DynamicModelsCollection>& dynamicModelsToConnect);
+  void writeMacroConnector(DydStream& dynamicModelsToConnect);
 
   /**
    * @brief add the macro static reference for generators
    *
-   * @param dynamicModelsToConnect dynamic black models set collection to enrich
+   * @param dynamicModelsToConnect streaming writer of the dynamic black models to enrich
    */
-  void writeMacroStaticReference(boost::shared_ptr<dynamicdata::DynamicModelsCollection>& dynamicModelsToConnect);
+  void writeMacroStaticReference(DydStream& dynamicModelsToConnect);
 
   /**
    * @brief add the signal N balck box model
    *
-   * @param dynamicModelsToConnect dynamic black models set collection to enrich
+   * @param dynamicModelsToConnect streaming writer of the dynamic black models to enrich
    */
-  void writeSignalNBlackBox(boost::shared_ptr<dynamicdata::DynamicModelsCollection>& dynamicModelsToConnect);
+  void writeSignalNBlackBox(DydStream& dynamicModelsToConnect);
 
   /**
    * @brief write all the connection between a generator and signal N
    *
-   * @param dynamicModelsToConnect dynamic black models set collection to enrich
+   * @param dynamicModelsToConnect streaming writer of the dynamic black models to enrich
    */
-  void writeMacroConnect(boost::shared_ptr<dynamicdata::DynamicModelsCollection>& dynamicModelsToConnect);
+  void writeMacroConnect(DydStream& dynamicModelsToConnect);
 
   /**
    * @brief add the connection of signal N model to the slack node
    *
-   * @param dynamicModelsToConnect dynamic black models set collection to enrich
+   * @param dynamicModelsToConnect streaming writer of the dynamic black models to enrich
    * @param slackNodeId slack node id
    */
-  void writeThetaRefConnect(boost::shared_ptr<dynamicdata::DynamicModelsCollection>& dynamicModelsToConnect, const std::string& slackNodeId);
+  void writeThetaRefConnect(DydStream& dynamicModelsToConnect, const std::string& slackNodeId);
 
  private:
   static const std::unordered_map<algo::GeneratorDefinition::ModelType, std::string>
@@ -17,9 +17,9 @@
 
 #pragma once
 
+#include "DydStream.h"
 #include "HVDCDefinitionAlgorithm.h"
 
-#include <DYDDynamicModelsCollection.h>
 #include <boost/shared_ptr.hpp>
 #include <unordered_map>
 
@@ -66,19 +66,19 @@ class DydHvdc {
   /**
    * @brief enrich the dynamic black models set collection for Hvdc
    *
-   * @param dynamicModelsToConnect dynamic black models set collection to enrich
+   * @param dynamicModelsToConnect streaming writer of the dynamic black models to enrich
    * @param basename the basename for current file
    */
-  void write(boost::shared_ptr<dynamicdata::DynamicModelsCollection>& dynamicModelsToConnect, const std::string& basename);
+  void write(DydStream& dynamicModelsToConnect, const std::string& basename);
 
  private:
   /**
    * @brief write specific hvdc connections
    *
-   * @param dynamicModelsToConnect dynamic black models set collection to enrich
+   * @param dynamicModelsToConnect streaming writer of the dynamic black models to enrich
    * @param hvdcLine the hvdc line definition to process
    */
-  void writeConnect(boost::shared_ptr<dynamicdata::DynamicModelsCollection>& dynamicModelsToConnect, const algo::HVDCDefinition& hvdcLine);
+  void writeConnect(DydStream& dynamicModelsToConnect, const algo::HVDCDefinition& hvdcLine);
 
  private:
   const algo::HVDCLineDefinitions& hvdcDefinitions_;  ///< list of Hvdc definitions
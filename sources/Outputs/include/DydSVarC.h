@@ -17,9 +17,9 @@
 
 #pragma once
 
+#include "DydStream.h"
 #include "SVarCDefinitionAlgorithm.h"
 
-#include <DYDDynamicModelsCollection.h>
 #include <boost/shared_ptr.hpp>
 #include <unordered_map>
 
@@ -66,25 +66,25 @@ class DydSVarC {
   /**
    * @brief enrich the dynamic black models set collection for SVarCs
    *
-   * @param dynamicModelsToConnect dynamic black models set collection to enrich
+   * @param dynamicModelsToConnect streaming writer of the dynamic black models to enrich
    * @param basename the basename for current file
    */
-  void write(boost::shared_ptr<dynamicdata::DynamicModelsCollection>& dynamicModelsToConnect, const std::string& basename);
+  void write(DydStream& dynamicModelsToConnect, const std::string& basename);
 
  private:
   /**
    * @brief add the macro connector for SVarCs
    *
-   * @param dynamicModelsToConnect dynamic black models set collection to enrich
+   * @param dynamicModelsToConnect streaming writer of the dynamic black models to enrich
    */
-  void writeMacroConnector(boost::shared_ptr<dynamicdata::DynamicModelsCollection>& dynamicModelsToConnect);
+  void writeMacroConnector(DydStream& dynamicModelsToConnect);
 
   /**
    * @brief add the macro static reference for SVarCs
    *
-   * @param dynamicModelsToConnect dynamic black models set collection to enrich
+   * @param dynamicModelsToConnect streaming writer of the dynamic black models to enrich
    */
-  void writeMacroStaticReference(boost::shared_ptr<dynamicdata::DynamicModelsCollection>& dynamicModelsToConnect);
+  void writeMacroStaticReference(DydStream& dynamicModelsToConnect);
 
  private:
   std::vector<algo::StaticVarCompensatorDefinition> svarcsDefinitions_;  ///< list of SVarCs definitions
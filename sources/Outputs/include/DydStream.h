@@ -0,0 +1,167 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  DydStream.h
+ *
+ * @brief Streaming DYD file writer header file
+ *
+ */
+
+#pragma once
+
+#include "XmlDocumentWriter.h"
+#include "XmlSections.h"
+
+#include <DYDBlackBoxModel.h>
+#include <DYDDynamicModelsCollection.h>
+#include <DYDMacroConnect.h>
+#include <DYDMacroConnector.h>
+#include <DYDMacroStaticReference.h>
+#include <boost/shared_ptr.hpp>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace dfl {
+namespace outputs {
+
+/**
+ * @brief Streaming writer of a DYD file
+ *
+ * The DYD exporter writes the macro connectors, the macro static references and the black box models sorted by id, then the macro
+ * connections and the connections in the order they were added. The elements sorted by id are added as builders, sorted by id while
+ * they are added and only built when they are written. The elements are added by passes: the sorted elements during the first pass,
+ * the macro connections during the second one and the connections during the last one. The elements are gathered in batches of
+ * bounded size, each batch being exported at once as soon as it is full and released before the next one. So the whole collection
+ * of the DYD file is never built, and the file written is the same as the export of the whole collection.
+ *
+ * The additions of an element outside of its pass are ignored, so the same writers are called at each pass:
+ * @code
+ * DydStream stream(file);
+ * do {
+ *   writers(stream);
+ * } while (stream.nextPass());
+ * @endcode
+ */
+class DydStream {
+ public:
+  /// @brief Builder of an element of the DYD file
+  template<class T>
+  using Builder = std::function<std::unique_ptr<T>()>;
+
+  /**
+   * @brief Constructor
+   *
+   * @param stream the stream to write the DYD file into
+   * @param batchSize the maximum number of elements exported at once
+   */
+  explicit DydStream(std::ostream &stream, std::size_t batchSize = XmlDocumentWriter::defaultBatchSize);
+
+  /**
+   * @brief Add a macro connector
+   *
+   * @param id the id of the macro connector
+   * @param builder the builder of the macro connector
+   */
+  void addMacroConnector(const std::string &id, Builder<dynamicdata::MacroConnector> builder);
+
+  /**
+   * @brief Add a macro static reference
+   *
+   * @param id the id of the macro static reference
+   * @param builder the builder of the macro static reference
+   */
+  void addMacroStaticReference(const std::string &id, Builder<dynamicdata::MacroStaticReference> builder);
+
+  /**
+   * @brief Add a black box model
+   *
+   * @param id the id of the model
+   * @param builder the builder of the model
+   */
+  void addModel(const std::string &id, Builder<dynamicdata::BlackBoxModel> builder);
+
+  /**
+   * @brief Add a macro connection between two models
+   *
+   * @param macroConnect the macro connection
+   */
+  void addMacroConnect(std::unique_ptr<dynamicdata::MacroConnect> macroConnect);
+
+  /**
+   * @brief Add a connection between two models
+   *
+   * @param model1 the id of the first model
+   * @param var1 the variable of the first model
+   * @param model2 the id of the second model
+   * @param var2 the variable of the second model
+   */
+  void addConnect(const std::string &model1, const std::string &var1, const std::string &model2, const std::string &var2);
+
+  /**
+   * @brief End the current pass
+   *
+   * The elements of the pass which are not written yet are written, and the end of the DYD file after the last pass
+   *
+   * @returns true if there is a next pass
+   */
+  bool nextPass();
+
+  /**
+   * @brief Retrieve the groups of top level elements of a DYD file, in the order of the DYD exporter
+   * @returns the groups of top level elements
+   */
+  static std::vector<XmlSections::SectionDefinition> sectionDefinitions();
+
+ private:
+  /// @brief Pass of the additions
+  enum class Pass {
+    SORTED_ELEMENTS = 0,  ///< macro connectors, macro static references and black box models
+    MACRO_CONNECTS,       ///< macro connections
+    CONNECTS,             ///< connections
+    DONE                  ///< DYD file written
+  };
+
+  /**
+   * @brief Record the addition of an element to the current batch, writing the batch once full
+   */
+  void added();
+
+  /**
+   * @brief Write the elements of the current batch and start a new batch
+   */
+  void flush();
+
+  /**
+   * @brief Write the elements of builders sorted by id and release the builders
+   *
+   * @param builders the builders of the elements, by id
+   */
+  template<class T>
+  void write(std::map<std::string, Builder<T>> &builders);
+
+ private:
+  XmlDocumentWriter writer_;                                                           ///< writer of the DYD file
+  const std::size_t batchSize_;                                                        ///< maximum number of elements exported at once
+  boost::shared_ptr<dynamicdata::DynamicModelsCollection> batch_;                      ///< elements added and not written yet
+  std::size_t batchCount_ = 0;                                                         ///< number of elements of the current batch
+  Pass pass_ = Pass::SORTED_ELEMENTS;                                                  ///< current pass
+  std::map<std::string, Builder<dynamicdata::MacroConnector>> macroConnectors_;        ///< builders of the macro connectors, by id
+  std::map<std::string, Builder<dynamicdata::MacroStaticReference>> macroStaticRefs_;  ///< builders of the macro static references, by id
+  std::map<std::string, Builder<dynamicdata::BlackBoxModel>> models_;                  ///< builders of the black box models, by id
+};
+
+}  // namespace outputs
+}  // namespace dfl
@@ -17,11 +17,10 @@
 
 #pragma once
 
+#include "DydStream.h"
 #include "GeneratorDefinitionAlgorithm.h"
 #include "HVDCDefinitionAlgorithm.h"
 
-#include <DYDDynamicModelsCollection.h>
-
 namespace dfl {
 namespace outputs {
 
@@ -44,26 +43,26 @@ class DydVRRemote {
   /**
    * @brief enrich the dynamic black models set collection for VRRemote
    *
-   * @param dynamicModelsToConnect dynamic black models set collection to enrich
+   * @param dynamicModelsToConnect streaming writer of the dynamic black models to enrich
    * @param basename the basename for current file
    */
-  void writeVRRemotes(boost::shared_ptr<dynamicdata::DynamicModelsCollection> &dynamicModelsToConnect, const std::string &basename);
+  void writeVRRemotes(DydStream &dynamicModelsToConnect, const std::string &basename);
 
  private:
   /**
    * @brief add the macroconnectors for VRRemotes
    *
-   * @param dynamicModelsToConnect dynamic black models set collection to enrich
+   * @param dynamicModelsToConnect streaming writer of the dynamic black models to enrich
    */
-  void writeMacroConnector(boost::shared_ptr<dynamicdata::DynamicModelsCollection> &dynamicModelsToConnect);
+  void writeMacroConnector(DydStream &dynamicModelsToConnect);
 
   /**
    * @brief write the macroconnects and connects for VRRemotes
    *
-   * @param dynamicModelsToConnect dynamic black models set collection to enrich
+   * @param dynamicModelsToConnect streaming writer of the dynamic black models to enrich
    * @param basename the basename for current file
    */
-  void writeConnections(boost::shared_ptr<dynamicdata::DynamicModelsCollection> &dynamicModelsToConnect, const std::string &basename);
+  void writeConnections(DydStream &dynamicModelsToConnect, const std::string &basename);
 
   const std::string macroConnectorGenVRRemoteName_{"GEN_VRREMOTE_CONNECTOR"};               ///< name for the macro connector for generators
   const std::string macroConnectorHvdcVRRemoteSide1Name_{"HVDC_VRREMOTE_CONNECTOR_SIDE1"};  ///< name for the macro connector for side 1 of hvdcs
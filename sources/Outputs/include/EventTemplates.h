@@ -0,0 +1,131 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  EventTemplates.h
+ *
+ * @brief Contingency event files stamped from templates header file
+ *
+ */
+
+#pragma once
+
+#include "Contingencies.h"
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace dfl {
+namespace outputs {
+
+/**
+ * @brief Writer of the DYD and PAR event files of the contingencies, stamped from templates
+ *
+ * The event files of two contingencies only differ by the ids of the elements and by the basename of the PAR file. The DYD and PAR
+ * elements of the event of each kind of contingency element are exported once by the Dynawo exporters with placeholders instead
+ * of the ids, and the files of each contingency are written by replacing the placeholders of these templates. The elements are
+ * grouped and sorted as the exporters do, so that the files are the same as the ones written by DydEvent and ParEvent.
+ *
+ * The files with an id or a basename that the exporters would escape are exported as a whole, as DydEvent and ParEvent do, instead
+ * of being stamped. The templates are never modified once built, so that the files of several contingencies can be written concurrently.
+ */
+class EventTemplates {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param timeOfEvent time of the events
+   */
+  explicit EventTemplates(double timeOfEvent);
+
+  /**
+   * @brief Write the DYD event file of a contingency
+   *
+   * @param basename the basename of the PAR file the events refer to
+   * @param filepath the DYD file path
+   * @param contingency the contingency
+   * @param networkElements set of contingencies elements using network cpp model
+   */
+  void writeDyd(const std::string &basename, const std::string &filepath, const inputs::Contingency &contingency,
+                const std::unordered_set<std::string> &networkElements) const;
+
+  /**
+   * @brief Write the PAR event file of a contingency
+   *
+   * @param filepath the PAR file path
+   * @param contingency the contingency
+   * @param networkElements set of contingencies elements using network cpp model
+   */
+  void writePar(const std::string &filepath, const inputs::Contingency &contingency, const std::unordered_set<std::string> &networkElements) const;
+
+  /**
+   * @brief Write the parameter sets of the events of several contingencies in a single PAR file
+   *
+   * The set of an element disconnected by several contingencies is written once
+   *
+   * @param filepath the PAR file path
+   * @param contingencies the contingencies
+   * @param networkElements set of contingencies elements using network cpp model
+   */
+  void writeEventsPar(const std::string &filepath, const std::vector<inputs::Contingency> &contingencies,
+                      const std::unordered_set<std::string> &networkElements) const;
+
+ private:
+  /// @brief Number of templates: one for the elements using a network cpp model and one by type for the other elements
+  static constexpr std::size_t nbTemplates = 12;
+
+  /**
+   * @brief Retrieve the index of the templates of the event of a contingency element
+   *
+   * @param element the contingency element
+   * @param isNetwork true if the element is using a network cpp model
+   * @returns the index of the templates, lower than nbTemplates
+   */
+  static std::size_t templateIndex(const inputs::ContingencyElement &element, bool isNetwork);
+
+  /**
+   * @brief Build the DYD and PAR templates of the event of a contingency element
+   *
+   * @param element the contingency element, whose id is the placeholder of the id
+   * @param isNetwork true if the element is using a network cpp model
+   */
+  void addTemplates(const inputs::ContingencyElement &element, bool isNetwork);
+
+  /**
+   * @brief Write the parameter sets of the events of contingency elements in a PAR file
+   *
+   * @param filepath the PAR file path
+   * @param elements the contingency elements
+   * @param networkElements set of contingencies elements using network cpp model
+   */
+  void writePar(const std::string &filepath, const std::vector<const inputs::ContingencyElement *> &elements,
+                const std::unordered_set<std::string> &networkElements) const;
+
+  /**
+   * @brief Replace the placeholders of a template
+   *
+   * @param text the template
+   * @param elementId the id of the contingency element
+   * @param basename the basename of the PAR file the events refer to
+   * @returns the stamped text
+   */
+  static std::string stamp(const std::string &text, const std::string &elementId, const std::string &basename);
+
+ private:
+  double timeOfEvent_;                    ///< time of the events
+  std::string dydBase_;                   ///< DYD document of a contingency without element
+  std::vector<std::string> dydElements_;  ///< DYD documents of a contingency with a single element, by template index
+  std::string parBase_;                   ///< PAR document of a contingency without element
+  std::vector<std::string> parElements_;  ///< PAR documents of a contingency with a single element, by template index
+};
+
+}  // namespace outputs
+}  // namespace dfl
@@ -28,10 +28,13 @@ namespace constants {
 
 /**
  * @brief Return an uuid from a string as input
+ *
+ * The uuid of a string is computed once for the whole run: the following calls with the same string return the cached uuid
+ *
  * @param str The string that will serve as input for uuid generation
- * @return The uuid as a string
+ * @return The uuid as a string, valid until the end of the run
  */
-std::string uuid(const std::string &str);
+const std::string &uuid(const std::string &str);
 
 /**
  * @brief Computes Qmax
@@ -52,6 +55,14 @@ static inline double computeQmax(double powerFactor, double pMax) { return pMax
  */
 std::string diagramFilename(const std::string &id);
 
+/**
+ * @brief Return the filename of the diagram file gathering the tables of all the elements
+ *
+ * @param basename the basename of the simulation
+ * @return The string filename of the diagram file
+ */
+std::string diagramTablesFilename(const std::string &basename);
+
 const std::string networkModelName{"NETWORK"};                               ///< Name of the model corresponding to network
 const std::string loadParId{"GenericRestorativeLoad"};                       ///< PAR id common to all loads
 const std::string diagramMaxTableSuffix{"_tableqmax"};                       ///< Suffix for the table name for qmax in diagram file
@@ -82,6 +93,8 @@ static constexpr double pi_ = M_PI;                                   ///< PI va
 static constexpr double kGoverNullValue_ = 0.;                        ///< KGover null value
 static constexpr double kGoverDefaultValue_ = 1.;                     ///< KGover default value
 const std::string solverParFileName{"solver.par"};                    ///< name of the solver par file
+const std::string eventsParSuffix{"_Events"};                         ///< suffix of the basename of the PAR file of all the contingencies events
+const std::string journalFileName{"scenarioJournal.jsonl"};           ///< name of the journal of the results of the security analysis scenarios
 const std::string componentTransformerIdTag{"@TFO@"};                 ///< TFO special tag for component id
 const std::string seasonTag{"@SAISON@"};                              ///< Season special tag
 const std::string connectedStaticId{"@CONNECTED_STATIC_ID@"};         ///< Connected static id special tag
@@ -59,8 +59,7 @@ class Par {
      * @param dynamicDataBaseManager dynamic database manager to use
      * @param counters the counters definitions to use
      * @param models list of dynamic models definitions
-     * @param linesById the lines to use
-     * @param tfosById the transformers to use
+     * @param definitionsIndex the index of the definitions, built on the generators definitions
      * @param svarcsDefinitions the SVarC definitions to use
      * @param loadsDefinitions the loads definitions to use
      */
@@ -68,13 +67,14 @@ class Par {
                   const std::vector<algo::GeneratorDefinition> &gens, const algo::HVDCLineDefinitions &hvdcDefinitions,
                   const inputs::NetworkManager::BusMapRegulating &busesToNumberOfRegulationMap,
                   const dfl::inputs::DynamicDataBaseManager &dynamicDataBaseManager, const algo::ShuntCounterDefinitions &counters,
-                  const algo::DynamicModelDefinitions &models, const algo::LinesByIdDefinitions &linesById, const algo::TransformersByIdDefinitions &tfosById,
+                  const algo::DynamicModelDefinitions &models, const algo::DefinitionsIndex &definitionsIndex,
                   const std::vector<algo::StaticVarCompensatorDefinition> &svarcsDefinitions, const std::vector<algo::LoadDefinition> &loadsDefinitions)
         : basename_(base), dirname_(config.outputDir()), filepath_(filename), activePowerCompensation_(config.getActivePowerCompensation()),
-          dynamicDataBaseManager_(dynamicDataBaseManager), shuntCounters_(counters), linesByIdDefinitions_(linesById), tfosByIdDefinitions_(tfosById),
-          parLoads_(new ParLoads(loadsDefinitions)), parSVarC_(new ParSVarC(svarcsDefinitions)), parHvdc_(new ParHvdc(hvdcDefinitions)),
-          parGenerator_(new ParGenerator(gens)), parDynModel_(new ParDynModel(models, gens, hvdcDefinitions)),
-          parVRRemote_(new ParVRRemote(gens, busesToNumberOfRegulationMap, hvdcDefinitions)), startingPointMode_(config.getStartingPointMode()) {}
+          dynamicDataBaseManager_(dynamicDataBaseManager), shuntCounters_(counters), parLoads_(new ParLoads(loadsDefinitions)),
+          parSVarC_(new ParSVarC(svarcsDefinitions)), parHvdc_(new ParHvdc(hvdcDefinitions)), parGenerator_(new ParGenerator(gens)),
+          parDynModel_(new ParDynModel(models, gens, definitionsIndex)),
+          parVRRemote_(new ParVRRemote(gens, busesToNumberOfRegulationMap, hvdcDefinitions)), startingPointMode_(config.getStartingPointMode()),
+          singleDiagramFile_(config.useSingleDiagramFile()) {}
 
     std::string basename_;                                                         ///< basename
     boost::filesystem::path dirname_;                                              ///< Dirname of output file relative to execution dir
@@ -82,8 +82,6 @@ class Par {
     dfl::inputs::Configuration::ActivePowerCompensation activePowerCompensation_;  ///< the type of active power compensation
     const inputs::DynamicDataBaseManager &dynamicDataBaseManager_;                 ///< dynamic database manager
     const algo::ShuntCounterDefinitions &shuntCounters_;                           ///< Shunt counters to use
-    const algo::LinesByIdDefinitions &linesByIdDefinitions_;                       ///< lines by id to use
-    const algo::TransformersByIdDefinitions &tfosByIdDefinitions_;                 ///< transformers by id to use
     std::shared_ptr<ParLoads> parLoads_;                                           ///< reference to load par writer
     std::shared_ptr<ParSVarC> parSVarC_;                                           ///< reference to svarcs par writer
     std::shared_ptr<ParHvdc> parHvdc_;                                             ///< reference to hvdcs par writer
@@ -91,6 +89,7 @@ class Par {
     std::shared_ptr<ParDynModel> parDynModel_;                                     ///< reference to defined dynamic model par writer
     std::shared_ptr<ParVRRemote> parVRRemote_;                                     ///< reference to VRRemote par writer
     dfl::inputs::Configuration::StartingPointMode startingPointMode_;              ///< starting point mode
+    bool singleDiagramFile_;                                                       ///< true if all the diagram tables are written in a single file
   };
 
   /**
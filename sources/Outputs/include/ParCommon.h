@@ -28,6 +28,7 @@
 #include <PARParametersSetCollectionFactory.h>
 #include <PARReference.h>
 #include <PARReferenceFactory.h>
+#include <boost/filesystem.hpp>
 #include <boost/optional.hpp>
 #include <boost/shared_ptr.hpp>
 #include <string>
@@ -154,8 +155,32 @@ inline static std::string getGeneratorParameterSetId(const algo::GeneratorDefini
  * @return true if the generator shares its parameter set
  */
 inline static bool generatorSharesParId(const algo::GeneratorDefinition &generator) {
-  std::string parId = getGeneratorParameterSetId(generator);
-  return parId != constants::uuid(generator.id);
+  // only the generators with a dedicated parameter set use the uuid of their id, see getGeneratorParameterSetId
+  switch (generator.model) {
+  case algo::GeneratorDefinition::ModelType::PROP_SIGNALN_INFINITE:
+  case algo::GeneratorDefinition::ModelType::REMOTE_SIGNALN_INFINITE:
+  case algo::GeneratorDefinition::ModelType::SIGNALN_TFO_INFINITE:
+  case algo::GeneratorDefinition::ModelType::SIGNALN_INFINITE:
+    return true;
+  default:
+    return false;
+  }
+}
+
+/**
+ * @brief Retrieve the path of the diagram file containing the tables of an element
+ *
+ * @param dirname the dirname of the output directory
+ * @param basename the basename for the simulation
+ * @param id the id the tables are named after
+ * @param singleDiagramFile true if all the tables are written in a single file
+ * @return the path of the diagram file
+ */
+inline boost::filesystem::path getDiagramFilepath(const boost::filesystem::path &dirname, const std::string &basename, const std::string &id,
+                                                  bool singleDiagramFile) {
+  auto filepath = dirname;
+  filepath.append(basename + common::constants::diagramDirectorySuffix);
+  return filepath.append(singleDiagramFile ? constants::diagramTablesFilename(basename) : constants::diagramFilename(id));
 }
 
 }  // namespace helper
@@ -17,17 +17,16 @@
 
 #pragma once
 
+#include "DefinitionsIndex.h"
 #include "DynModelDefinitionAlgorithm.h"
 #include "GeneratorDefinitionAlgorithm.h"
 #include "HVDCDefinitionAlgorithm.h"
 #include "LineDefinitionAlgorithm.h"
 #include "OutputsConstants.h"
+#include "ParStream.h"
 #include "ShuntDefinitionAlgorithm.h"
 #include "TransfoDefinitionAlgorithm.h"
 
-#include <PARParametersSetCollection.h>
-
-
 namespace dfl {
 namespace outputs {
 
@@ -41,25 +40,21 @@ class ParDynModel {
    *
    * @param dynamicModelsDefinitions reference to the list of defined dynamic models definitions
    * @param gens generators definition coming from algorithms
-   * @param hvdcDefinitions hvdc definitions coming from algorithms
+   * @param definitionsIndex index of the definitions coming from algorithms, built on the generators definitions
    */
   explicit ParDynModel(const algo::DynamicModelDefinitions &dynamicModelsDefinitions, const std::vector<algo::GeneratorDefinition> &gens,
-                       const algo::HVDCLineDefinitions &hvdcDefinitions);
+                       const algo::DefinitionsIndex &definitionsIndex);
 
   /**
    * @brief enrich the parameter set collection for defined dynamic models
    *
-   * @param paramSetCollection parameter set collection to enrich
+   * @param paramSetCollection streaming writer of the parameter sets to enrich
    * @param dynamicDataBaseManager the dynamic DB manager to use
    * @param shuntCounters the counters to use
-   * @param linesByIdDefinitions lines by id to use
-   * @param transformersById transformers by id to use
    */
-  void write(const std::unique_ptr<parameters::ParametersSetCollection>& paramSetCollection,
+  void write(ParStream& paramSetCollection,
               const inputs::DynamicDataBaseManager& dynamicDataBaseManager,
-              const algo::ShuntCounterDefinitions& shuntCounters,
-              const algo::LinesByIdDefinitions& linesByIdDefinitions,
-              const algo::TransformersByIdDefinitions& transformersById);
+              const algo::ShuntCounterDefinitions& shuntCounters);
 
  private:
   /**
@@ -78,16 +73,13 @@ class ParDynModel {
    * @param automaton the current secondary voltage control automaton
    * @param counters the counters to use
    * @param models the models definitions to use
-   * @param linesById lines by id to use
-   * @param transformersById transformers by id to use
    *
    * @returns the parameter set to add
    */
   std::shared_ptr<parameters::ParametersSet>
   writeDynamicModelParameterSet(const inputs::SettingDataBase::Set &set, const inputs::DynamicDataBaseManager &dynamicDataBaseManager,
                                 const algo::DynamicModelDefinition &automaton, const algo::ShuntCounterDefinitions &counters,
-                                const algo::DynamicModelDefinitions &models, const algo::LinesByIdDefinitions &linesById,
-                                const algo::TransformersByIdDefinitions &transformersById);
+                                const algo::DynamicModelDefinitions &models);
 
   /**
    * @brief Write setting set for secondary voltage controller models
@@ -106,21 +98,16 @@ class ParDynModel {
    * @brief Retrieve active season
    *
    * @param ref the Ref XML element referencing the active season
-   * @param linesById Dynawo lines by id to use
-   * @param transformersById transformers by id to use
    * @param dynamicDataBaseManager the dynamic DB manager to use
    *
    * @return active season value
    */
-  boost::optional<std::string> getActiveSeason(const inputs::SettingDataBase::Ref &ref, const algo::LinesByIdDefinitions &linesById,
-                                               const algo::TransformersByIdDefinitions &transformersById,
-                                               const inputs::DynamicDataBaseManager &dynamicDataBaseManager);
+  boost::optional<std::string> getActiveSeason(const inputs::SettingDataBase::Ref &ref, const inputs::DynamicDataBaseManager &dynamicDataBaseManager);
 
  private:
   const algo::DynamicModelDefinitions &dynamicModelsDefinitions_;       ///< list of defined dynamic models
   const std::vector<algo::GeneratorDefinition> &generatorDefinitions_;  ///< list of generator definitions
-  const algo::HVDCLineDefinitions &hvdcDefinitions_;                    ///< hvdc definitions
-  std::unordered_map<std::string, size_t> generatorIdToIndex_;          ///< map of generator ids to their index
+  const algo::DefinitionsIndex &definitionsIndex_;                      ///< index of the definitions
 };
 
 }  // namespace outputs
@@ -31,6 +31,7 @@
 #include "SlackNodeAlgorithm.h"
 
 #include <PARParametersSet.h>
+#include <PARParametersSetCollection.h>
 #include <functional>
 #include <string>
 #include <unordered_map>
@@ -79,6 +80,17 @@ class ParEvent {
    */
   void write();
 
+  /**
+   * @brief Add the parameter set of the event disconnecting a contingency element
+   *
+   * @param parametersSets the parameter set collection where the set will be added
+   * @param element the contingency element
+   * @param isNetwork true if the element is using a network cpp model
+   * @param timeOfEvent time of event
+   */
+  static void addElementSet(const std::unique_ptr<parameters::ParametersSetCollection> &parametersSets, const inputs::ContingencyElement &element,
+                            bool isNetwork, const double timeOfEvent);
+
  private:
   /**
    * @brief Build branch disconnection parameter set
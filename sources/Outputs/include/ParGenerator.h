@@ -20,10 +20,9 @@
 #include "Configuration.h"
 #include "GeneratorDefinitionAlgorithm.h"
 #include "OutputsConstants.h"
+#include "ParStream.h"
 
 #include <DYNCommon.h>
-#include <PARParametersSetCollection.h>
-
 
 namespace dfl {
 namespace outputs {
@@ -46,19 +45,21 @@ class ParGenerator {
   /**
    * @brief enrich the parameter set collection for generators
    *
-   * @param paramSetCollection parameter set collection to enrich
+   * @param paramSetCollection streaming writer of the parameter sets to enrich
    * @param activePowerCompensation the type of active power compensation
    * @param basename basename for current simulation
    * @param dirname the dirname of the output PAR file
    * @param startingPointMode starting point mode
    * @param dynamicDataBaseManager the dynamic DB manager to use
+   * @param singleDiagramFile true if all the diagram tables are written in a single file
    */
-  void write(const std::unique_ptr<parameters::ParametersSetCollection>& paramSetCollection,
+  void write(ParStream& paramSetCollection,
               ActivePowerCompensation activePowerCompensation,
               const std::string& basename,
               const boost::filesystem::path& dirname,
               StartingPointMode startingPointMode,
-              const inputs::DynamicDataBaseManager& dynamicDataBaseManager);
+              const inputs::DynamicDataBaseManager& dynamicDataBaseManager,
+              bool singleDiagramFile);
 
  private:
   /**
@@ -131,13 +132,15 @@ class ParGenerator {
    * @brief Write generator parameter set
    *
    * @param def the generator definition to use
+   * @param diagramName the name of the diagram file of the generator, which may be shared with other generators
    * @param basename the basename for the simulation
    * @param dirname the dirname of the output directory
+   * @param singleDiagramFile true if all the diagram tables are written in a single file
    *
    * @returns the parameter set
    */
-  std::shared_ptr<parameters::ParametersSet> writeGenerator(const algo::GeneratorDefinition &def, const std::string &basename,
-                                                            const boost::filesystem::path &dirname);
+  std::shared_ptr<parameters::ParametersSet> writeGenerator(const algo::GeneratorDefinition &def, const std::string &diagramName, const std::string &basename,
+                                                            const boost::filesystem::path &dirname, bool singleDiagramFile);
 
   /**
    * @brief set the kGover value based on if generator has active power control and targetP value
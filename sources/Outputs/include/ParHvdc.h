@@ -20,8 +20,7 @@
 #include "Configuration.h"
 #include "HVDCDefinitionAlgorithm.h"
 #include "OutputsConstants.h"
-
-#include <PARParametersSetCollection.h>
+#include "ParStream.h"
 
 namespace dfl {
 namespace outputs {
@@ -41,15 +40,16 @@ class ParHvdc {
   /**
    * @brief enrich the parameter set collection for hvdcs
    *
-   * @param paramSetCollection parameter set collection to enrich
+   * @param paramSetCollection streaming writer of the parameter sets to enrich
    * @param basename the basename for the simulation
    * @param dirname the dirname of the output directory
    * @param startingPointMode starting point mode
    * @param dynamicDataBaseManager the dynamic DB manager to use
+   * @param singleDiagramFile true if all the diagram tables are written in a single file
    */
-  void write(const std::unique_ptr<parameters::ParametersSetCollection> &paramSetCollection, const std::string &basename,
+  void write(ParStream &paramSetCollection, const std::string &basename,
              const boost::filesystem::path &dirname, dfl::inputs::Configuration::StartingPointMode startingPointMode,
-             const inputs::DynamicDataBaseManager &dynamicDataBaseManager);
+             const inputs::DynamicDataBaseManager &dynamicDataBaseManager, bool singleDiagramFile);
 
  private:
   /**
@@ -60,13 +60,14 @@ class ParHvdc {
    * @param dirname the dirname of the output directory
    * @param startingPointMode starting point mode
    * @param dynamicDataBaseManager the dynamic DB manager to use
+   * @param singleDiagramFile true if all the diagram tables are written in a single file
    *
    * @returns the parameter set
    */
   std::shared_ptr<parameters::ParametersSet> writeHdvcLine(const algo::HVDCDefinition &hvdcLine, const std::string &basename,
                                                            const boost::filesystem::path &dirname,
                                                            dfl::inputs::Configuration::StartingPointMode startingPointMode,
-                                                           const inputs::DynamicDataBaseManager &dynamicDataBaseManager);
+                                                           const inputs::DynamicDataBaseManager &dynamicDataBaseManager, bool singleDiagramFile);
 
   /**
    * @brief Computes KAC emulation parameter
@@ -18,9 +18,7 @@
 #pragma once
 
 #include "LoadDefinitionAlgorithm.h"
-
-#include <PARParametersSetCollection.h>
-
+#include "ParStream.h"
 
 namespace dfl {
 namespace outputs {
@@ -40,10 +38,10 @@ class ParLoads {
   /**
    * @brief enrich the parameter set collection for loads
    *
-   * @param paramSetCollection parameter set collection to enrich
+   * @param paramSetCollection streaming writer of the parameter sets to enrich
    * @param startingPointMode starting point mode
    */
-  void write(const std::unique_ptr<parameters::ParametersSetCollection>& paramSetCollection,
+  void write(ParStream& paramSetCollection,
               dfl::inputs::Configuration::StartingPointMode startingPointMode);
 
  private:
@@ -19,9 +19,7 @@
 
 #include "SVarCDefinitionAlgorithm.h"
 #include "Configuration.h"
-
-#include <PARParametersSetCollection.h>
-
+#include "ParStream.h"
 
 namespace dfl {
 namespace outputs {
@@ -41,10 +39,10 @@ class ParSVarC {
   /**
    * @brief enrich the parameter set collection for SvarCs
    *
-   * @param paramSetCollection parameter set collection to enrich
+   * @param paramSetCollection streaming writer of the parameter sets to enrich
    * @param startingPointMode starting point mode
    */
-  void write(const std::unique_ptr<parameters::ParametersSetCollection>& paramSetCollection,
+  void write(ParStream& paramSetCollection,
               dfl::inputs::Configuration::StartingPointMode startingPointMode);
 
  private:
@@ -0,0 +1,124 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  ParStream.h
+ *
+ * @brief Streaming PAR file writer header file
+ *
+ */
+
+#pragma once
+
+#include "XmlDocumentWriter.h"
+#include "XmlSections.h"
+
+#include <PARMacroParameterSet.h>
+#include <PARParametersSet.h>
+#include <PARParametersSetCollection.h>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace dfl {
+namespace outputs {
+
+/**
+ * @brief Streaming writer of a PAR file
+ *
+ * The PAR exporter writes the macro parameters sets then the parameters sets, sorted by id. The sets are added as builders, sorted by
+ * id while they are added and only built when the PAR file is written. The sets built are gathered in batches of bounded size, each
+ * batch being exported at once as soon as it is full and released before the next one. So the whole collection of the PAR file is
+ * never built, and the file written is the same as the export of the whole collection.
+ */
+class ParStream {
+ public:
+  /// @brief Builder of a parameters set, returning nullptr when the set is not written after all
+  using SetBuilder = std::function<std::shared_ptr<parameters::ParametersSet>()>;
+  /// @brief Builder of a macro parameters set
+  using MacroSetBuilder = std::function<std::unique_ptr<parameters::MacroParameterSet>()>;
+
+  /**
+   * @brief Constructor
+   *
+   * @param stream the stream to write the PAR file into
+   * @param batchSize the maximum number of sets exported at once
+   */
+  explicit ParStream(std::ostream &stream, std::size_t batchSize = XmlDocumentWriter::defaultBatchSize);
+
+  /**
+   * @brief Add a parameters set
+   *
+   * @param id the id of the set
+   * @param builder the builder of the set
+   */
+  void addParametersSet(const std::string &id, SetBuilder builder);
+
+  /**
+   * @brief Add a macro parameters set
+   *
+   * @param id the id of the set
+   * @param builder the builder of the set
+   */
+  void addMacroParameterSet(const std::string &id, MacroSetBuilder builder);
+
+  /**
+   * @brief Determine if a parameters set was added
+   *
+   * @param id the id of the set
+   * @returns true if the set was added
+   */
+  bool hasParametersSet(const std::string &id) const;
+
+  /**
+   * @brief Determine if a macro parameters set was added
+   *
+   * @param id the id of the set
+   * @returns true if the set was added
+   */
+  bool hasMacroParametersSet(const std::string &id) const;
+
+  /**
+   * @brief Build and write the sets added, then release their builders
+   */
+  void write();
+
+  /**
+   * @brief Retrieve the groups of top level elements of a PAR file, in the order of the PAR exporter
+   * @returns the groups of top level elements
+   */
+  static std::vector<XmlSections::SectionDefinition> sectionDefinitions();
+
+ private:
+  /**
+   * @brief Record the addition of a set to the current batch, writing the batch once full
+   */
+  void added();
+
+  /**
+   * @brief Write the sets of the current batch and start a new batch
+   */
+  void flush();
+
+ private:
+  XmlDocumentWriter writer_;                                    ///< writer of the PAR file
+  const std::size_t batchSize_;                                 ///< maximum number of sets exported at once
+  std::unique_ptr<parameters::ParametersSetCollection> batch_;  ///< sets built and not written yet
+  std::size_t batchCount_ = 0;                                  ///< number of sets of the current batch
+  std::map<std::string, MacroSetBuilder> macroSets_;            ///< builders of the macro parameters sets, by id
+  std::map<std::string, SetBuilder> sets_;                      ///< builders of the parameters sets, by id
+};
+
+}  // namespace outputs
+}  // namespace dfl
@@ -19,8 +19,9 @@
 
 #include "GeneratorDefinitionAlgorithm.h"
 #include "HVDCDefinitionAlgorithm.h"
+#include "ParStream.h"
 
-#include <PARParametersSetCollection.h>
+#include <string>
 
 namespace dfl {
 namespace outputs {
@@ -44,9 +45,27 @@ class ParVRRemote {
   /**
    * @brief enrich the parameter set collection for VRRemote
    *
-   * @param paramSetCollection parameter set collection to enrich
+   * @param paramSetCollection streaming writer of the parameter sets to enrich
    */
-  void writeVRRemotes(const std::unique_ptr<parameters::ParametersSetCollection>& paramSetCollection);
+  void writeVRRemotes(ParStream& paramSetCollection);
+
+ private:
+  /**
+   * @brief Add the macro parameter set of the VRRemote models, if not added yet
+   *
+   * @param paramSetCollection streaming writer of the parameter sets to enrich
+   */
+  static void addMacroParameterSetVRRemote(ParStream &paramSetCollection);
+
+  /**
+   * @brief Add the parameter set of the VRRemote model of a bus
+   *
+   * @param paramSetCollection streaming writer of the parameter sets to enrich
+   * @param busId the regulated bus id, which must outlive the writing of the set
+   * @param elementId the id of the element giving the voltage target, which must outlive the writing of the set
+   * @param frozen true if the VRRemote model is frozen at the start of the simulation
+   */
+  static void addVRRemote(ParStream &paramSetCollection, const std::string &busId, const std::string &elementId, bool frozen);
 
  private:
   const std::vector<algo::GeneratorDefinition> &generatorDefinitions_;            ///< list of generators definitions
@@ -0,0 +1,78 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  ScenarioJournal.h
+ *
+ * @brief Journal of the results of the security analysis scenarios header file
+ *
+ */
+
+#pragma once
+
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace dfl {
+namespace outputs {
+
+/**
+ * @brief Journal of the results of the security analysis scenarios
+ *
+ * The results of the scenarios are appended to the journal as soon as they are known, one JSON object per line, so that a security
+ * analysis interrupted before its end can be resumed without simulating again the scenarios already completed. A line cut by the
+ * interruption is ignored when the journal is read.
+ */
+class ScenarioJournal {
+ public:
+  /**
+   * @brief Entry of the journal
+   */
+  struct Entry {
+    std::string id;      ///< id of the scenario
+    std::string key;     ///< key of the inputs of the scenario, see ScenarioKeys
+    std::string result;  ///< result of the scenario, as its element of the aggregated results
+  };
+
+  /**
+   * @brief Read the entries of a journal
+   *
+   * @param filepath the journal file path
+   * @returns the complete entries of the journal, in the order they were appended, empty if the journal does not exist
+   */
+  static std::vector<Entry> read(const boost::filesystem::path &filepath);
+
+  /**
+   * @brief Constructor
+   *
+   * Any previous journal of the same path is replaced
+   *
+   * @param filepath the journal file path
+   */
+  explicit ScenarioJournal(const boost::filesystem::path &filepath);
+
+  /**
+   * @brief Append an entry to the journal
+   *
+   * The entry is flushed to the journal file before returning
+   *
+   * @param entry the entry to append
+   */
+  void append(const Entry &entry);
+
+ private:
+  boost::filesystem::path filepath_;  ///< journal file path
+  std::ofstream file_;                ///< journal file
+};
+
+}  // namespace outputs
+}  // namespace dfl
@@ -0,0 +1,75 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  ScenarioKeys.h
+ *
+ * @brief Keys of the inputs of the security analysis scenarios header file
+ *
+ */
+
+#pragma once
+
+#include <boost/filesystem.hpp>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace dfl {
+namespace outputs {
+
+/**
+ * @brief Keys of the inputs of the security analysis scenarios
+ *
+ * The key of a scenario is computed from the content of the input files of its simulation: the files shared by all the scenarios
+ * (network, dynamic models, solver parameters and jobs) and the event files of the scenario, and from the versions of the launcher
+ * and of Dynawo. Two scenarios of the same key have the same result, whatever their ids.
+ *
+ * The files generated by the launcher refer to the output directory and to the input files by their paths: these paths are
+ * hashed as the place they hold, so that the keys match between runs in different output directories or on input files of the same
+ * content at different paths.
+ */
+class ScenarioKeys {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param commonInputs the input files shared by the simulations of all the scenarios, hashed as they are
+   * @param commonGeneratedInputs the files generated for the simulations of all the scenarios
+   * @param locations the paths the generated files may refer to, such as the output directory, hashed as their position in this list
+   */
+  ScenarioKeys(const std::vector<boost::filesystem::path> &commonInputs, const std::vector<boost::filesystem::path> &commonGeneratedInputs,
+               const std::vector<std::string> &locations);
+
+  /**
+   * @brief Compute the key of a scenario
+   *
+   * @param scenarioInputs the files generated for the simulation of the scenario
+   * @returns the key of the scenario, as an hexadecimal string
+   */
+  std::string compute(const std::vector<boost::filesystem::path> &scenarioInputs) const;
+
+ private:
+  /**
+   * @brief Update a hash with the content of a generated file, whose locations are replaced by their positions
+   *
+   * @param hash the hash to update
+   * @param filepath the file path
+   * @returns the updated hash
+   */
+  std::uint64_t hashGeneratedFile(std::uint64_t hash, const boost::filesystem::path &filepath) const;
+
+  std::vector<std::pair<std::string, std::string>> replacements_;  ///< locations and the text they are replaced with, longest locations first
+  std::uint64_t commonHash_;                                       ///< hash of the input files shared by all the scenarios
+};
+
+}  // namespace outputs
+}  // namespace dfl
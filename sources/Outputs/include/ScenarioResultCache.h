@@ -0,0 +1,120 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  ScenarioResultCache.h
+ *
+ * @brief Persistent cache of the results of the security analysis scenarios header file
+ *
+ */
+
+#pragma once
+
+#include <boost/filesystem.hpp>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace dfl {
+namespace outputs {
+
+/**
+ * @brief Persistent cache of the results of the security analysis scenarios
+ *
+ * The result of a scenario is stored under the key of its inputs, see ScenarioKeys. A scenario whose key is found in the cache does
+ * not need to be simulated again: its result and its output files are restored from the cache.
+ *
+ * Each entry is a directory named after its key, holding the result of the scenario and a copy of its output files. Entries are
+ * written in a temporary directory which is renamed once complete, so that concurrent runs never read a partial entry. When the
+ * cache exceeds its maximum size, the least recently used entries are removed.
+ */
+class ScenarioResultCache {
+ public:
+  using OutputFiles = std::unordered_map<std::string, std::vector<boost::filesystem::path>>;  ///< Alias for output files by scenario
+
+  /**
+   * @brief Constructor
+   *
+   * @param directory the directory of the cache
+   * @param maxSize the maximum size of the cache, in bytes
+   */
+  ScenarioResultCache(const boost::filesystem::path &directory, std::uintmax_t maxSize);
+
+  /**
+   * @brief List the output files of the scenarios
+   *
+   * The output files of a scenario are the files of its directory in the output directory and the files named after the scenario
+   * in the other subdirectories of the output directory, as "constraints/constraints_<id>.xml". The output directory is scanned
+   * once for all the scenarios.
+   *
+   * @param outputDirectory the output directory of the security analysis
+   * @param scenarioIds the ids of the scenarios
+   * @returns the output files of the scenarios, relative to the output directory
+   */
+  static OutputFiles listOutputFiles(const boost::filesystem::path &outputDirectory, const std::unordered_set<std::string> &scenarioIds);
+
+  /**
+   * @brief Check whether the result of a scenario is in the cache
+   *
+   * @param key the key of the result
+   * @returns true if the cache holds a result for this key, false otherwise
+   */
+  bool contains(const std::string &key) const;
+
+  /**
+   * @brief Store the result of a scenario
+   *
+   * Failing to store the result is not an error: a warning is logged and the run goes on.
+   *
+   * @param key the key of the result
+   * @param result the result of the scenario
+   * @param outputDirectory the output directory of the security analysis
+   * @param scenarioId the id of the scenario
+   * @param files the output files of the scenario, relative to the output directory
+   */
+  void store(const std::string &key, const std::string &result, const boost::filesystem::path &outputDirectory, const std::string &scenarioId,
+             const std::vector<boost::filesystem::path> &files) const;
+
+  /**
+   * @brief Restore the result of a scenario
+   *
+   * The output files stored with the result are copied in the output directory, renamed after the scenario. Failing to restore
+   * the result is not an error: a warning is logged and the scenario has to be simulated.
+   *
+   * @param key the key of the result
+   * @param outputDirectory the output directory of the security analysis
+   * @param scenarioId the id of the scenario
+   * @param result the result of the scenario, as stored
+   * @returns true if the result was restored, false otherwise
+   */
+  bool restore(const std::string &key, const boost::filesystem::path &outputDirectory, const std::string &scenarioId, std::string &result) const;
+
+  /**
+   * @brief Remove the least recently used entries until the cache does not exceed its maximum size
+   */
+  void evict() const;
+
+ private:
+  /**
+   * @brief Compute the path of an entry of the cache
+   *
+   * @param key the key of the entry
+   * @returns the path of the directory of the entry
+   */
+  boost::filesystem::path entryPath(const std::string &key) const;
+
+  boost::filesystem::path directory_;  ///< directory of the cache
+  std::uintmax_t maxSize_;             ///< maximum size of the cache, in bytes
+};
+
+}  // namespace outputs
+}  // namespace dfl
@@ -0,0 +1,90 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  XmlDocumentWriter.h
+ *
+ * @brief XML document written a few top level elements at a time header file
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+namespace dfl {
+namespace outputs {
+
+/**
+ * @brief XML document written a few top level elements at a time
+ *
+ * Batches of top level elements are exported by a Dynawo exporter, as the elements of a document, and written to the stream right
+ * away: the exporter indents the elements as in the export of the whole collection, so the document written is the same.
+ */
+class XmlDocumentWriter {
+ public:
+  static constexpr std::size_t defaultBatchSize = 1000;  ///< default maximum number of top level elements exported at once
+
+  /**
+   * @brief Constructor
+   *
+   * @param stream the stream to write into
+   */
+  explicit XmlDocumentWriter(std::ostream &stream) : stream_(stream) {}
+
+  /**
+   * @brief Write top level elements
+   *
+   * The header of the document is written with the first elements
+   *
+   * @param document the exported document holding the elements as its top level elements
+   */
+  void write(const std::string &document);
+
+  /**
+   * @brief Write the end of the document
+   *
+   * @param emptyDocument the exported document without element, written as is if no element was written
+   */
+  void close(const std::string &emptyDocument);
+
+ private:
+  std::ostream &stream_;  ///< stream to write into
+  std::string footer_;    ///< text of the document from the closing tag of the root element included
+  bool started_ = false;  ///< true once the header of the document is written
+};
+
+namespace helper {
+
+/**
+ * @brief Retrieve the end of a line, past its end of line character
+ *
+ * @param text the text the line belongs to
+ * @param position the start of the line
+ * @returns the position of the next line, or the size of the text for the last line
+ */
+std::size_t nextLine(const std::string &text, std::size_t position);
+
+/**
+ * @brief Retrieve the start of the content of an exported document
+ *
+ * The opening tag of the root element is the first line which is neither the XML declaration nor a comment
+ *
+ * @param document the exported document
+ * @returns the position of the line following the opening tag of the root element
+ */
+std::size_t contentStart(const std::string &document);
+
+}  // namespace helper
+
+}  // namespace outputs
+}  // namespace dfl
@@ -0,0 +1,118 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  XmlSections.h
+ *
+ * @brief XML document assembled from partial exports header file
+ *
+ */
+
+#pragma once
+
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace dfl {
+namespace outputs {
+
+/**
+ * @brief XML document assembled from the exports of successive parts of a collection
+ *
+ * The Dynawo exporters write each element of a collection as a top level element of the document, grouped by kind of element in a fixed order.
+ * Inside a group, the elements stored in maps by the collection are sorted by id and the other ones keep their insertion order.
+ *
+ * A collection can then be exported part by part: the top level elements of each part are kept here as serialized text, so that the objects of
+ * the part can be released, and are written back in the order the exporter would have used for the whole collection. The ids of the elements
+ * sorted by id must be written as is by the exporter, without any escaped character.
+ */
+class XmlSections {
+ public:
+  /**
+   * @brief Group of top level elements of the same kind
+   */
+  struct SectionDefinition {
+    std::string tag;  ///< tag of the elements, without namespace prefix
+    bool sorted;      ///< true if the elements are sorted by id, false if they keep their insertion order
+  };
+
+  /**
+   * @brief Constructor
+   *
+   * @param sections the groups of top level elements, in the order of the exporter
+   */
+  explicit XmlSections(const std::vector<SectionDefinition> &sections);
+
+  /**
+   * @brief Merge the export of a part of the collection
+   *
+   * An error is raised if an element sorted by id was already merged with the same id
+   *
+   * @param document the exported document
+   */
+  void merge(const std::string &document);
+
+  /**
+   * @brief Determine if an element sorted by id was merged
+   *
+   * @param tag the tag of the element, without namespace prefix
+   * @param id the id of the element
+   * @returns true if the element was merged
+   */
+  bool has(const std::string &tag, const std::string &id) const;
+
+  /**
+   * @brief Retrieve the number of top level elements merged
+   * @returns the number of elements
+   */
+  std::size_t size() const { return size_; }
+
+  /**
+   * @brief Write the whole document
+   *
+   * @param stream the stream to write into
+   */
+  void write(std::ostream &stream) const;
+
+ private:
+  /// @brief Group of top level elements and their serialized text
+  struct Section {
+    SectionDefinition definition;                       ///< definition of the group
+    std::map<std::string, std::string> sortedElements;  ///< serialized elements by id, for a group sorted by id
+    std::string orderedElements;                        ///< serialized elements in insertion order, for the other groups
+  };
+
+  /**
+   * @brief Add a serialized top level element
+   *
+   * @param element the serialized element, with its children and its closing tag
+   */
+  void add(const std::string &element);
+
+  /**
+   * @brief Retrieve the group of the elements of a tag, created as a group in insertion order at the end of the document if it was not defined
+   *
+   * @param tag the tag of the elements, without namespace prefix
+   * @returns the group
+   */
+  Section &section(const std::string &tag);
+
+ private:
+  std::vector<Section> sections_;  ///< groups of top level elements, in the order of the document
+  std::string header_;             ///< text of the document up to the opening tag of the root element included
+  std::string footer_;             ///< text of the document from the closing tag of the root element included
+  std::string emptyDocument_;      ///< exported document of an empty part, written as is if no element was merged
+  std::size_t size_ = 0;           ///< number of top level elements merged
+};
+
+}  // namespace outputs
+}  // namespace dfl
@@ -27,10 +27,7 @@ namespace dfl {
 namespace outputs {
 
 Diagram::Diagram(DiagramDefinition &&def) : def_{std::move(def)} {
-  for (auto &generator : def_.generators) {
-    std::sort(generator.points.begin(), generator.points.end(),
-              [](const DYN::GeneratorInterface::ReactiveCurvePoint &lhs, const DYN::GeneratorInterface::ReactiveCurvePoint &rhs) { return lhs.p < rhs.p; });
-  }
+  // the points of the generators diagrams are already sorted
   for (auto &hvdcPair : def_.hvdcDefinitions.hvdcLines) {
     if (hvdcPair.second.vscDefinition1) {
       auto &points = hvdcPair.second.vscDefinition1.get().points;
@@ -46,70 +43,59 @@ Diagram::Diagram(DiagramDefinition &&def) : def_{std::move(def)} {
 }
 
 void Diagram::write() const {
-  writeGenerators();
-  writeConverters();
-}
-
-void Diagram::writeGenerators() const {
-  for (const auto &generator : def_.generators) {
-    if (!generator.isUsingDiagram() || generator.isUsingRectangularDiagram())
-      continue;
-    if (!boost::filesystem::exists(def_.directoryPath)) {
-      boost::filesystem::create_directories(def_.directoryPath);
-    }
-
-    std::stringstream buffer;
-    //  Modelica requires this file to start with "#1", if it is not present, problems occurs
-    buffer << "#1";
-
-    writeTable(generator, buffer, Tables::TABLE_QMIN);
-    writeTable(generator, buffer, Tables::TABLE_QMAX);
-    boost::filesystem::path dir(def_.directoryPath);
-    std::string filename = dir.append(outputs::constants::diagramFilename(generator.id)).generic_string();
-    std::ofstream ofs(filename, std::ios::binary);
-    ofs << buffer.str();
-    ofs.close();
+  std::stringstream tables;
+  writeGenerators(tables);
+  writeConverters(tables);
+  if (def_.singleFile && tables.tellp() > 0) {
+    writeFile(constants::diagramTablesFilename(def_.basename), tables);
   }
 }
 
-void Diagram::writeVSC(const algo::VSCDefinition &vscDefinition) const {
-  if (!boost::filesystem::exists(def_.directoryPath)) {
+void Diagram::writeFile(const std::string &filename, const std::stringstream &tables) const {
+  if (!directoryCreated_) {
     boost::filesystem::create_directories(def_.directoryPath);
+    directoryCreated_ = true;
   }
-  std::stringstream buffer;
+  boost::filesystem::path filepath(def_.directoryPath);
+  filepath.append(filename);
+  std::ofstream ofs(filepath.generic_string(), std::ios::binary);
   //  Modelica requires this file to start with "#1", if it is not present, problems occurs
-  buffer << "#1";
-
-  writeTable(vscDefinition, buffer, Tables::TABLE_QMIN);
-  writeTable(vscDefinition, buffer, Tables::TABLE_QMAX);
-  boost::filesystem::path dir(def_.directoryPath);
-  std::string filename = dir.append(outputs::constants::diagramFilename(vscDefinition.id)).generic_string();
-  std::ofstream ofs(filename, std::ios::binary);
-  ofs << buffer.str();
-  ofs.close();
+  ofs << "#1" << tables.rdbuf();
 }
 
-void Diagram::writeLCC(const algo::HVDCDefinition::ConverterId &converterId, double powerFactor, double pMax) const {
-  if (!boost::filesystem::exists(def_.directoryPath)) {
-    boost::filesystem::create_directories(def_.directoryPath);
+template <class T> void Diagram::writeDiagram(const std::string &id, const T &element, std::stringstream &tables) const {
+  if (def_.singleFile) {
+    writeTable(id, element, tables, Tables::TABLE_QMIN);
+    writeTable(id, element, tables, Tables::TABLE_QMAX);
+    return;
   }
   std::stringstream buffer;
-  //  Modelica requires this file to start with "#1", if it is not present, problems occurs
-  buffer << "#1";
+  writeTable(id, element, buffer, Tables::TABLE_QMIN);
+  writeTable(id, element, buffer, Tables::TABLE_QMAX);
+  writeFile(constants::diagramFilename(id), buffer);
+}
+
+void Diagram::writeGenerators(std::stringstream &tables) const {
+  const auto diagramNames = algo::nameReactiveDiagrams(def_.generators);
+  for (const auto &generator : def_.generators) {
+    if (!generator.isUsingDiagram() || generator.isUsingRectangularDiagram())
+      continue;
+    // a shared diagram is written by the generator it is named after
+    if (diagramNames.at(generator.diagram.get()) != generator.id)
+      continue;
+    writeDiagram(generator.id, *generator.diagram, tables);
+  }
+}
 
+void Diagram::writeVSC(const algo::VSCDefinition &vscDefinition, std::stringstream &tables) const { writeDiagram(vscDefinition.id, vscDefinition, tables); }
+
+void Diagram::writeLCC(const algo::HVDCDefinition::ConverterId &converterId, double powerFactor, double pMax, std::stringstream &tables) const {
   auto qMax = constants::computeQmax(powerFactor, pMax);
   LCCDefinition lccDefinition{converterId, {}, pMax, qMax, -pMax, -qMax};
-
-  writeTable(lccDefinition, buffer, Tables::TABLE_QMIN);
-  writeTable(lccDefinition, buffer, Tables::TABLE_QMAX);
-  boost::filesystem::path dir(def_.directoryPath);
-  std::string filename = dir.append(outputs::constants::diagramFilename(converterId)).generic_string();
-  std::ofstream ofs(filename, std::ios::binary);
-  ofs << buffer.str();
-  ofs.close();
+  writeDiagram(lccDefinition.id, lccDefinition, tables);
 }
 
-void Diagram::writeConverters() const {
+void Diagram::writeConverters(std::stringstream &tables) const {
   for (const auto &hvdcDefPair : def_.hvdcDefinitions.hvdcLines) {
     const auto &hvdcDef = hvdcDefPair.second;
     if (!hvdcDef.hasDiagramModel()) {
@@ -121,30 +107,30 @@ void Diagram::writeConverters() const {
     switch (hvdcDef.position) {
     case algo::HVDCDefinition::Position::FIRST_IN_MAIN_COMPONENT: {
       if (hvdcDef.vscDefinition1) {
-        writeVSC(*hvdcDef.vscDefinition1);
+        writeVSC(*hvdcDef.vscDefinition1, tables);
       } else {
-        writeLCC(hvdcDef.converter1Id, hvdcDef.powerFactors.at(0), hvdcDef.pMax);
+        writeLCC(hvdcDef.converter1Id, hvdcDef.powerFactors.at(0), hvdcDef.pMax, tables);
       }
       break;
     }
     case algo::HVDCDefinition::Position::SECOND_IN_MAIN_COMPONENT: {
       if (hvdcDef.vscDefinition2) {
-        writeVSC(*hvdcDef.vscDefinition2);
+        writeVSC(*hvdcDef.vscDefinition2, tables);
       } else {
-        writeLCC(hvdcDef.converter2Id, hvdcDef.powerFactors.at(1), hvdcDef.pMax);
+        writeLCC(hvdcDef.converter2Id, hvdcDef.powerFactors.at(1), hvdcDef.pMax, tables);
       }
       break;
     }
     case algo::HVDCDefinition::Position::BOTH_IN_MAIN_COMPONENT: {
       if (hvdcDef.vscDefinition1) {
-        writeVSC(*hvdcDef.vscDefinition1);
+        writeVSC(*hvdcDef.vscDefinition1, tables);
       } else {
-        writeLCC(hvdcDef.converter1Id, hvdcDef.powerFactors.at(0), hvdcDef.pMax);
+        writeLCC(hvdcDef.converter1Id, hvdcDef.powerFactors.at(0), hvdcDef.pMax, tables);
       }
       if (hvdcDef.vscDefinition2) {
-        writeVSC(*hvdcDef.vscDefinition2);
+        writeVSC(*hvdcDef.vscDefinition2, tables);
       } else {
-        writeLCC(hvdcDef.converter2Id, hvdcDef.powerFactors.at(1), hvdcDef.pMax);
+        writeLCC(hvdcDef.converter2Id, hvdcDef.powerFactors.at(1), hvdcDef.pMax, tables);
       }
       break;
     }
@@ -154,9 +140,9 @@ void Diagram::writeConverters() const {
   }
 }
 
-template <class T> void Diagram::writeTable(const T &element, std::stringstream &buffer, Tables table) {
+template <class T> void Diagram::writeTable(const std::string &id, const T &element, std::stringstream &buffer, Tables table) {
   buffer << "\ndouble ";
-  buffer << constants::uuid(element.id);
+  buffer << constants::uuid(id);
   if (table == Tables::TABLE_QMIN)
     buffer << constants::diagramMinTableSuffix << '(';
   else
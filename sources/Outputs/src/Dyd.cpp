@@ -17,20 +17,20 @@
 
 #include "Dyd.h"
 
+#include "DydStream.h"
 #include "Log.h"
 #include "OutputsConstants.h"
 
 #include <DYDBlackBoxModelFactory.h>
 #include <DYDDynamicModelsCollection.h>
-#include <DYDDynamicModelsCollectionFactory.h>
 #include <DYDMacroConnectFactory.h>
 #include <DYDMacroConnectorFactory.h>
 #include <DYDMacroStaticRef.h>
 #include <DYDMacroStaticRefFactory.h>
 #include <DYDMacroStaticReferenceFactory.h>
 #include <DYDStaticRef.h>
-#include <DYDXmlExporter.h>
 #include <DYNCommon.h>
+#include <fstream>
 
 namespace dfl {
 namespace outputs {
@@ -39,17 +39,20 @@ Dyd::Dyd(DydDefinition&& def) : def_{std::move(def)} {}
 
 void
 Dyd::write() const {
-  dynamicdata::XmlExporter exporter;
-  auto dynamicModelsToConnect = dynamicdata::DynamicModelsCollectionFactory::newCollection();
-
-  def_.dydDynModel_->write(dynamicModelsToConnect, def_.basename_, def_.dynamicDataBaseManager_);
-  def_.dydLoads_->write(dynamicModelsToConnect, def_.basename_);
-  def_.dydGenerator_->write(dynamicModelsToConnect, def_.basename_, def_.slackNode_->id);
-  def_.dydHvdc_->write(dynamicModelsToConnect, def_.basename_);
-  def_.dydSVarC_->write(dynamicModelsToConnect, def_.basename_);
-  def_.dydVRRemote_->writeVRRemotes(dynamicModelsToConnect, def_.basename_);
-
-  exporter.exportToFile(dynamicModelsToConnect, def_.filename_, constants::xmlEncoding);
+  std::ofstream file(def_.filename_);
+  if (!file.is_open()) {
+    throw DFLError(FileCreationFailed, def_.filename_);
+  }
+  // the elements are written by batches of bounded size as soon as they are built, so that the whole collection is never held in memory
+  DydStream dynamicModelsToConnect(file);
+  do {
+    def_.dydDynModel_->write(dynamicModelsToConnect, def_.basename_, def_.dynamicDataBaseManager_);
+    def_.dydLoads_->write(dynamicModelsToConnect, def_.basename_);
+    def_.dydGenerator_->write(dynamicModelsToConnect, def_.basename_, def_.slackNode_->id);
+    def_.dydHvdc_->write(dynamicModelsToConnect, def_.basename_);
+    def_.dydSVarC_->write(dynamicModelsToConnect, def_.basename_);
+    def_.dydVRRemote_->writeVRRemotes(dynamicModelsToConnect, def_.basename_);
+  } while (dynamicModelsToConnect.nextPass());
 }
 
 }  // namespace outputs
@@ -43,17 +43,18 @@ DydDynModel::DydDynModel(const algo::DynamicModelDefinitions &dynamicModelsDefin
   }
 }
 
-void DydDynModel::write(boost::shared_ptr<dynamicdata::DynamicModelsCollection> &dynamicModelsToConnect, const std::string &basename,
+void DydDynModel::write(DydStream &dynamicModelsToConnect, const std::string &basename,
                         const inputs::DynamicDataBaseManager &dynamicDataBaseManager) {
   for (const auto &model : dynamicModelsDefinitions_.models) {
-    std::unique_ptr<dynamicdata::BlackBoxModel> blackBoxModel = helper::buildBlackBox(model.second.id, model.second.lib, basename + ".par", model.second.id);
-    dynamicModelsToConnect->addModel(std::move(blackBoxModel));
+    const auto &dynModel = model.second;
+    dynamicModelsToConnect.addModel(dynModel.id,
+                                    [&dynModel, &basename]() { return helper::buildBlackBox(dynModel.id, dynModel.lib, basename + ".par", dynModel.id); });
     writeMacroConnector(dynamicModelsToConnect, model.second, dynamicDataBaseManager);
   }
   writeMacroConnectors(dynamicModelsToConnect, dynamicDataBaseManager);
 }
 
-void DydDynModel::writeMacroConnector(boost::shared_ptr<dynamicdata::DynamicModelsCollection> &dynamicModelsToConnect,
+void DydDynModel::writeMacroConnector(DydStream &dynamicModelsToConnect,
                                       const algo::DynamicModelDefinition &dynModel, const inputs::DynamicDataBaseManager &dynamicDataBaseManager) {
   const auto &connections = dynModel.nodeConnections;
 
@@ -80,7 +81,7 @@ void DydDynModel::writeMacroConnector(boost::shared_ptr<dynamicdata::DynamicMode
 #endif
       macroConnect->setIndex1(std::to_string(std::get<INDEXES_CURRENT_INDEX>(indexes.at(indexId))));
       (std::get<INDEXES_CURRENT_INDEX>(indexes.at(indexId)))++;
-      dynamicModelsToConnect->addMacroConnect(std::move(macroConnect));
+      dynamicModelsToConnect.addMacroConnect(std::move(macroConnect));
     } else {
       auto modelName2 = constants::networkModelName;
       if (connection.elementType == dfl::algo::DynamicModelDefinition::MacroConnection::ElementType::AUTOMATON) {
@@ -97,25 +98,29 @@ void DydDynModel::writeMacroConnector(boost::shared_ptr<dynamicdata::DynamicMode
       // We set index1 to 0 even in case there is only one connection, for consistency in the output file
       macroConnect->setIndex1(std::to_string(std::get<INDEXES_CURRENT_INDEX>(indexes.at(indexId))));
       (std::get<INDEXES_CURRENT_INDEX>(indexes.at(indexId)))++;
-      dynamicModelsToConnect->addMacroConnect(std::move(macroConnect));
+      dynamicModelsToConnect.addMacroConnect(std::move(macroConnect));
     }
   }
 }
 
-void DydDynModel::writeMacroConnectors(boost::shared_ptr<dynamicdata::DynamicModelsCollection> &dynamicModelsToConnect,
+void DydDynModel::writeMacroConnectors(DydStream &dynamicModelsToConnect,
                                        const inputs::DynamicDataBaseManager &dynamicDataBaseManager) {
   for (const auto &macro : dynamicModelsDefinitions_.usedMacroConnections) {
-    std::unique_ptr<dynamicdata::MacroConnector> macroConnector = dynamicdata::MacroConnectorFactory::newMacroConnector(macro);
-    for (const auto &connection : dynamicDataBaseManager.assembling().getMacroConnection(macro).connections) {
-      macroConnector->addConnect(connection.var1, connection.var2);
-    }
-    dynamicModelsToConnect->addMacroConnector(std::move(macroConnector));
-    if (dynamicDataBaseManager.assembling().hasNetworkMacroConnection(macro)) {
-      std::unique_ptr<dynamicdata::MacroConnector> networkMacroConnector = dynamicdata::MacroConnectorFactory::newMacroConnector(macro + "Network");
-      for (const auto &connection : dynamicDataBaseManager.assembling().getMacroConnection(macro, true).connections) {
-        networkMacroConnector->addConnect(connection.var1, connection.var2);
+    dynamicModelsToConnect.addMacroConnector(macro, [&macro, &dynamicDataBaseManager]() {
+      std::unique_ptr<dynamicdata::MacroConnector> macroConnector = dynamicdata::MacroConnectorFactory::newMacroConnector(macro);
+      for (const auto &connection : dynamicDataBaseManager.assembling().getMacroConnection(macro).connections) {
+        macroConnector->addConnect(connection.var1, connection.var2);
       }
-      dynamicModelsToConnect->addMacroConnector(std::move(networkMacroConnector));
+      return macroConnector;
+    });
+    if (dynamicDataBaseManager.assembling().hasNetworkMacroConnection(macro)) {
+      dynamicModelsToConnect.addMacroConnector(macro + "Network", [&macro, &dynamicDataBaseManager]() {
+        std::unique_ptr<dynamicdata::MacroConnector> networkMacroConnector = dynamicdata::MacroConnectorFactory::newMacroConnector(macro + "Network");
+        for (const auto &connection : dynamicDataBaseManager.assembling().getMacroConnection(macro, true).connections) {
+          networkMacroConnector->addConnect(connection.var1, connection.var2);
+        }
+        return networkMacroConnector;
+      });
     }
   }
 }
@@ -38,68 +38,73 @@ namespace outputs {
 DydEvent::DydEvent(DydEventDefinition &&def) : def_{std::forward<DydEventDefinition>(def)} {}
 
 void DydEvent::write() const {
-  using Type = dfl::inputs::ContingencyElement::Type;
-
   dynamicdata::XmlExporter exporter;
 
   auto dynamicModels = dynamicdata::DynamicModelsCollectionFactory::newCollection();
+  addMacroConnectors(dynamicModels);
+  for (const auto &element : def_.contingency.elements) {
+    addElementModels(dynamicModels, element, isNetwork(element.id), def_.basename);
+  }
+
+  exporter.exportToFile(dynamicModels, def_.filename, constants::xmlEncoding);
+}
 
-  // macro connectors
+void DydEvent::addMacroConnectors(boost::shared_ptr<dynamicdata::DynamicModelsCollection> &dynamicModels) {
   std::unique_ptr<dynamicdata::MacroConnector> connector = dynamicdata::MacroConnectorFactory::newMacroConnector("MC_EventQuadripoleDisconnection");
   connector->addConnect("event_state1", "@NAME@_state_value");
   dynamicModels->addMacroConnector(std::move(connector));
+}
 
-  // models and connections
-  for (const auto &element : def_.contingency.elements) {
-    if (isNetwork(element.id)) {
-      std::unique_ptr<dynamicdata::BlackBoxModel> bbm = buildNetworkStateDisconnection(element.id, def_.basename);
-      dynamicModels->addModel(std::move(bbm));
-      addNetworkStateDisconnectionConnect(dynamicModels, element.id);
-      continue;
-    }
-    switch (element.type) {
-    case Type::BRANCH:
-    case Type::LINE:
-    case Type::TWO_WINDINGS_TRANSFORMER: {
-      std::unique_ptr<dynamicdata::BlackBoxModel> bbm = buildBranchDisconnection(element.id, def_.basename);
-      dynamicModels->addModel(std::move(bbm));
-      std::unique_ptr<dynamicdata::MacroConnect> macroConnect = buildBranchDisconnectionConnect(element.id);
-      dynamicModels->addMacroConnect(std::move(macroConnect));
-      break;
-    }
-    case Type::LOAD: {
-      std::unique_ptr<dynamicdata::BlackBoxModel> bbm = buildSwitchOffSignalDisconnection(element.id, def_.basename);
-      dynamicModels->addModel(std::move(bbm));
-      addSwitchOffSignalDisconnectionConnect(dynamicModels, element.id, "switchOff2");
-      break;
-    }
-    case Type::GENERATOR: {
-      std::unique_ptr<dynamicdata::BlackBoxModel> bbm = buildSwitchOffSignalDisconnection(element.id, def_.basename);
-      dynamicModels->addModel(std::move(bbm));
-      addSwitchOffSignalDisconnectionConnect(dynamicModels, element.id, "generator_switchOffSignal2");
-      break;
-    }
-    case Type::HVDC_LINE: {
-      std::unique_ptr<dynamicdata::BlackBoxModel> bbm = buildSwitchOffSignalDisconnection(element.id, def_.basename);
-      dynamicModels->addModel(std::move(bbm));
-      addSwitchOffSignalDisconnectionConnect(dynamicModels, element.id, "hvdc_switchOffSignal2Side1");
-      addSwitchOffSignalDisconnectionConnect(dynamicModels, element.id, "hvdc_switchOffSignal2Side2");
-      break;
-    }
-    case Type::STATIC_VAR_COMPENSATOR: {
-      std::unique_ptr<dynamicdata::BlackBoxModel> bbm = buildSwitchOffSignalDisconnection(element.id, def_.basename);
-      dynamicModels->addModel(std::move(bbm));
-      addSwitchOffSignalDisconnectionConnect(dynamicModels, element.id, "SVarC_switchOffSignal2");
-      break;
-    }
-    default:
-      std::unique_ptr<dynamicdata::BlackBoxModel> bbm = buildNetworkStateDisconnection(element.id, def_.basename);
-      dynamicModels->addModel(std::move(bbm));
-      addNetworkStateDisconnectionConnect(dynamicModels, element.id);
-    }
-  }
+void DydEvent::addElementModels(boost::shared_ptr<dynamicdata::DynamicModelsCollection> &dynamicModels, const inputs::ContingencyElement &element,
+                                bool isNetwork, const std::string &basename) {
+  using Type = dfl::inputs::ContingencyElement::Type;
 
-  exporter.exportToFile(dynamicModels, def_.filename, constants::xmlEncoding);
+  if (isNetwork) {
+    std::unique_ptr<dynamicdata::BlackBoxModel> bbm = buildNetworkStateDisconnection(element.id, basename);
+    dynamicModels->addModel(std::move(bbm));
+    addNetworkStateDisconnectionConnect(dynamicModels, element.id);
+    return;
+  }
+  switch (element.type) {
+  case Type::BRANCH:
+  case Type::LINE:
+  case Type::TWO_WINDINGS_TRANSFORMER: {
+    std::unique_ptr<dynamicdata::BlackBoxModel> bbm = buildBranchDisconnection(element.id, basename);
+    dynamicModels->addModel(std::move(bbm));
+    std::unique_ptr<dynamicdata::MacroConnect> macroConnect = buildBranchDisconnectionConnect(element.id);
+    dynamicModels->addMacroConnect(std::move(macroConnect));
+    break;
+  }
+  case Type::LOAD: {
+    std::unique_ptr<dynamicdata::BlackBoxModel> bbm = buildSwitchOffSignalDisconnection(element.id, basename);
+    dynamicModels->addModel(std::move(bbm));
+    addSwitchOffSignalDisconnectionConnect(dynamicModels, element.id, "switchOff2");
+    break;
+  }
+  case Type::GENERATOR: {
+    std::unique_ptr<dynamicdata::BlackBoxModel> bbm = buildSwitchOffSignalDisconnection(element.id, basename);
+    dynamicModels->addModel(std::move(bbm));
+    addSwitchOffSignalDisconnectionConnect(dynamicModels, element.id, "generator_switchOffSignal2");
+    break;
+  }
+  case Type::HVDC_LINE: {
+    std::unique_ptr<dynamicdata::BlackBoxModel> bbm = buildSwitchOffSignalDisconnection(element.id, basename);
+    dynamicModels->addModel(std::move(bbm));
+    addSwitchOffSignalDisconnectionConnect(dynamicModels, element.id, "hvdc_switchOffSignal2Side1");
+    addSwitchOffSignalDisconnectionConnect(dynamicModels, element.id, "hvdc_switchOffSignal2Side2");
+    break;
+  }
+  case Type::STATIC_VAR_COMPENSATOR: {
+    std::unique_ptr<dynamicdata::BlackBoxModel> bbm = buildSwitchOffSignalDisconnection(element.id, basename);
+    dynamicModels->addModel(std::move(bbm));
+    addSwitchOffSignalDisconnectionConnect(dynamicModels, element.id, "SVarC_switchOffSignal2");
+    break;
+  }
+  default:
+    std::unique_ptr<dynamicdata::BlackBoxModel> bbm = buildNetworkStateDisconnection(element.id, basename);
+    dynamicModels->addModel(std::move(bbm));
+    addNetworkStateDisconnectionConnect(dynamicModels, element.id);
+  }
 }
 
 std::unique_ptr<dynamicdata::BlackBoxModel> DydEvent::buildBranchDisconnection(const std::string &branchId, const std::string &basename) {
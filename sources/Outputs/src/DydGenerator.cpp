@@ -48,17 +48,19 @@ const std::unordered_map<algo::GeneratorDefinition::ModelType, std::string> DydG
     std::make_pair(algo::GeneratorDefinition::ModelType::PROP_SIGNALN_RECTANGULAR, "GeneratorPQPropSignalN"),
     std::make_pair(algo::GeneratorDefinition::ModelType::PROP_DIAGRAM_PQ_SIGNALN, "GeneratorPQPropDiagramPQSignalN")};
 
-void DydGenerator::write(boost::shared_ptr<dynamicdata::DynamicModelsCollection> &dynamicModelsToConnect, const std::string &basename,
+void DydGenerator::write(DydStream &dynamicModelsToConnect, const std::string &basename,
                          const std::string &slackNodeId) {
   for (const auto &generator : generatorDefinitions_) {
     if (generator.isNetwork()) {
       continue;
     }
-    std::string parId = helper::getGeneratorParameterSetId(generator);
-    std::unique_ptr<dynamicdata::BlackBoxModel> blackBoxModel =
-        helper::buildBlackBoxStaticId(generator.id, generator.id, correspondence_lib_.at(generator.model), basename + ".par", parId);
-    blackBoxModel->addMacroStaticRef(dynamicdata::MacroStaticRefFactory::newMacroStaticRef(macroStaticRefSignalNGeneratorName_));
-    dynamicModelsToConnect->addModel(std::move(blackBoxModel));
+    dynamicModelsToConnect.addModel(generator.id, [this, &generator, &basename]() {
+      std::string parId = helper::getGeneratorParameterSetId(generator);
+      std::unique_ptr<dynamicdata::BlackBoxModel> blackBoxModel =
+          helper::buildBlackBoxStaticId(generator.id, generator.id, correspondence_lib_.at(generator.model), basename + ".par", parId);
+      blackBoxModel->addMacroStaticRef(dynamicdata::MacroStaticRefFactory::newMacroStaticRef(macroStaticRefSignalNGeneratorName_));
+      return blackBoxModel;
+    });
   }
   writeThetaRefConnect(dynamicModelsToConnect, slackNodeId);
   writeMacroConnector(dynamicModelsToConnect);
@@ -67,39 +69,47 @@ void DydGenerator::write(boost::shared_ptr<dynamicdata::DynamicModelsCollection>
   writeMacroConnect(dynamicModelsToConnect);
 }
 
-void DydGenerator::writeMacroConnector(boost::shared_ptr<dynamicdata::DynamicModelsCollection> &dynamicModelsToConnect) {
+void DydGenerator::writeMacroConnector(DydStream &dynamicModelsToConnect) {
   if (!generatorDefinitions_.empty()) {
-    std::unique_ptr<dynamicdata::MacroConnector> connector1 = dynamicdata::MacroConnectorFactory::newMacroConnector(macroConnectorGenName_);
-    connector1->addConnect("generator_terminal", "@STATIC_ID@@NODE@_ACPIN");
-    connector1->addConnect("generator_switchOffSignal1", "@STATIC_ID@@NODE@_switchOff_value");
-    dynamicModelsToConnect->addMacroConnector(std::move(connector1));
+    dynamicModelsToConnect.addMacroConnector(macroConnectorGenName_, [this]() {
+      std::unique_ptr<dynamicdata::MacroConnector> connector1 = dynamicdata::MacroConnectorFactory::newMacroConnector(macroConnectorGenName_);
+      connector1->addConnect("generator_terminal", "@STATIC_ID@@NODE@_ACPIN");
+      connector1->addConnect("generator_switchOffSignal1", "@STATIC_ID@@NODE@_switchOff_value");
+      return connector1;
+    });
 
-    std::unique_ptr<dynamicdata::MacroConnector> connector2 = dynamicdata::MacroConnectorFactory::newMacroConnector(macroConnectorGenSignalNName_);
-    connector2->addConnect("generator_N", "signalN_N");
-    dynamicModelsToConnect->addMacroConnector(std::move(connector2));
+    dynamicModelsToConnect.addMacroConnector(macroConnectorGenSignalNName_, [this]() {
+      std::unique_ptr<dynamicdata::MacroConnector> connector2 = dynamicdata::MacroConnectorFactory::newMacroConnector(macroConnectorGenSignalNName_);
+      connector2->addConnect("generator_N", "signalN_N");
+      return connector2;
+    });
   }
 }
 
-void DydGenerator::writeMacroStaticReference(boost::shared_ptr<dynamicdata::DynamicModelsCollection> &dynamicModelsToConnect) {
+void DydGenerator::writeMacroStaticReference(DydStream &dynamicModelsToConnect) {
   if (!generatorDefinitions_.empty()) {
-    std::unique_ptr<dynamicdata::MacroStaticReference> macroStaticReference =
-        dynamicdata::MacroStaticReferenceFactory::newMacroStaticReference(macroStaticRefSignalNGeneratorName_);
-    macroStaticReference->addStaticRef("generator_PGenPu", "p");
-    macroStaticReference->addStaticRef("generator_QGenPu", "q");
-    macroStaticReference->addStaticRef("generator_state", "state");
-    dynamicModelsToConnect->addMacroStaticReference(std::move(macroStaticReference));
+    dynamicModelsToConnect.addMacroStaticReference(macroStaticRefSignalNGeneratorName_, [this]() {
+      std::unique_ptr<dynamicdata::MacroStaticReference> macroStaticReference =
+          dynamicdata::MacroStaticReferenceFactory::newMacroStaticReference(macroStaticRefSignalNGeneratorName_);
+      macroStaticReference->addStaticRef("generator_PGenPu", "p");
+      macroStaticReference->addStaticRef("generator_QGenPu", "q");
+      macroStaticReference->addStaticRef("generator_state", "state");
+      return macroStaticReference;
+    });
   }
 }
 
-void DydGenerator::writeSignalNBlackBox(boost::shared_ptr<dynamicdata::DynamicModelsCollection> &dynamicModelsToConnect) {
+void DydGenerator::writeSignalNBlackBox(DydStream &dynamicModelsToConnect) {
   if (!generatorDefinitions_.empty()) {
-    std::unique_ptr<dynamicdata::BlackBoxModel> blackBoxModelSignalN = dynamicdata::BlackBoxModelFactory::newModel(signalNModelName_);
-    blackBoxModelSignalN->setLib("SignalN");
-    dynamicModelsToConnect->addModel(std::move(blackBoxModelSignalN));
+    dynamicModelsToConnect.addModel(signalNModelName_, [this]() {
+      std::unique_ptr<dynamicdata::BlackBoxModel> blackBoxModelSignalN = dynamicdata::BlackBoxModelFactory::newModel(signalNModelName_);
+      blackBoxModelSignalN->setLib("SignalN");
+      return blackBoxModelSignalN;
+    });
   }
 }
 
-void DydGenerator::writeMacroConnect(boost::shared_ptr<dynamicdata::DynamicModelsCollection> &dynamicModelsToConnect) {
+void DydGenerator::writeMacroConnect(DydStream &dynamicModelsToConnect) {
   std::unordered_map<std::string, unsigned int> modelNQIdGenNumber;
   for (auto it = generatorDefinitions_.cbegin(); it != generatorDefinitions_.cend(); ++it) {
     if (it->isNetwork()) {
@@ -108,21 +118,21 @@ void DydGenerator::writeMacroConnect(boost::shared_ptr<dynamicdata::DynamicModel
     if (it->model == algo::GeneratorDefinition::ModelType::REMOTE_SIGNALN_INFINITE ||
         it->model == algo::GeneratorDefinition::ModelType::REMOTE_DIAGRAM_PQ_SIGNALN ||
         it->model == algo::GeneratorDefinition::ModelType::REMOTE_SIGNALN_RECTANGULAR) {
-      dynamicModelsToConnect->addConnect(it->id, "generator_URegulated", constants::networkModelName, it->regulatedBusId + "_U_value");
+      dynamicModelsToConnect.addConnect(it->id, "generator_URegulated", constants::networkModelName, it->regulatedBusId + "_U_value");
     }
 
     std::unique_ptr<dynamicdata::MacroConnect> connection =
         dynamicdata::MacroConnectFactory::newMacroConnect(macroConnectorGenName_, it->id, constants::networkModelName);
     std::unique_ptr<dynamicdata::MacroConnect> signal =
         dynamicdata::MacroConnectFactory::newMacroConnect(macroConnectorGenSignalNName_, it->id, signalNModelName_);
-    dynamicModelsToConnect->addMacroConnect(std::move(connection));
-    dynamicModelsToConnect->addMacroConnect(std::move(signal));
+    dynamicModelsToConnect.addMacroConnect(std::move(connection));
+    dynamicModelsToConnect.addMacroConnect(std::move(signal));
   }
 }
 
-void DydGenerator::writeThetaRefConnect(boost::shared_ptr<dynamicdata::DynamicModelsCollection> &dynamicModelsToConnect, const std::string &slackNodeId) {
+void DydGenerator::writeThetaRefConnect(DydStream &dynamicModelsToConnect, const std::string &slackNodeId) {
   if (!generatorDefinitions_.empty()) {
-    dynamicModelsToConnect->addConnect(signalNModelName_, "signalN_thetaRef", constants::networkModelName, slackNodeId + "_phi_value");
+    dynamicModelsToConnect.addConnect(signalNModelName_, "signalN_thetaRef", constants::networkModelName, slackNodeId + "_phi_value");
   }
 }
 }  // namespace outputs
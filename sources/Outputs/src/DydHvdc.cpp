@@ -51,46 +51,48 @@ const std::unordered_map<algo::HVDCDefinition::HVDCModel, std::string> DydHvdc::
     std::make_pair(algo::HVDCDefinition::HVDCModel::HvdcPVDanglingRpcl2Side2, "HvdcPVDanglingRpcl2Side1"),
     std::make_pair(algo::HVDCDefinition::HVDCModel::HvdcPVDanglingDiagramPQRpcl2Side2, "HvdcPVDanglingDiagramPQRpcl2Side1")};
 
-void DydHvdc::write(boost::shared_ptr<dynamicdata::DynamicModelsCollection> &dynamicModelsToConnect, const std::string &basename) {
+void DydHvdc::write(DydStream &dynamicModelsToConnect, const std::string &basename) {
   for (const auto &keyValue : hvdcDefinitions_.hvdcLines) {
-    auto hvdcLine = keyValue.second;
-    std::unique_ptr<dynamicdata::BlackBoxModel> blackBoxModel =
-        helper::buildBlackBoxStaticId(hvdcLine.id, hvdcLine.id, hvdcModelsNames_.at(hvdcLine.model), basename + ".par", hvdcLine.id);
-    if (hvdcLine.position == algo::HVDCDefinition::Position::SECOND_IN_MAIN_COMPONENT || hvdcLine.converterStationOnSide2()) {
-      blackBoxModel->addStaticRef("hvdc_PInj1Pu", "p2");
-      blackBoxModel->addStaticRef("hvdc_QInj1Pu", "q2");
-      blackBoxModel->addStaticRef("hvdc_state", "state2");
-      blackBoxModel->addStaticRef("hvdc_PInj2Pu", "p1");
-      blackBoxModel->addStaticRef("hvdc_QInj2Pu", "q1");
-      blackBoxModel->addStaticRef("hvdc_state", "state1");
-    } else {
-      // terminal 1 on 1 in case both are in main connex component
-      blackBoxModel->addStaticRef("hvdc_PInj1Pu", "p1");
-      blackBoxModel->addStaticRef("hvdc_QInj1Pu", "q1");
-      blackBoxModel->addStaticRef("hvdc_state", "state1");
-      blackBoxModel->addStaticRef("hvdc_PInj2Pu", "p2");
-      blackBoxModel->addStaticRef("hvdc_QInj2Pu", "q2");
-      blackBoxModel->addStaticRef("hvdc_state", "state2");
-    }
-    dynamicModelsToConnect->addModel(std::move(blackBoxModel));
+    const auto &hvdcLine = keyValue.second;
+    dynamicModelsToConnect.addModel(hvdcLine.id, [&hvdcLine, &basename]() {
+      std::unique_ptr<dynamicdata::BlackBoxModel> blackBoxModel =
+          helper::buildBlackBoxStaticId(hvdcLine.id, hvdcLine.id, hvdcModelsNames_.at(hvdcLine.model), basename + ".par", hvdcLine.id);
+      if (hvdcLine.position == algo::HVDCDefinition::Position::SECOND_IN_MAIN_COMPONENT || hvdcLine.converterStationOnSide2()) {
+        blackBoxModel->addStaticRef("hvdc_PInj1Pu", "p2");
+        blackBoxModel->addStaticRef("hvdc_QInj1Pu", "q2");
+        blackBoxModel->addStaticRef("hvdc_state", "state2");
+        blackBoxModel->addStaticRef("hvdc_PInj2Pu", "p1");
+        blackBoxModel->addStaticRef("hvdc_QInj2Pu", "q1");
+        blackBoxModel->addStaticRef("hvdc_state", "state1");
+      } else {
+        // terminal 1 on 1 in case both are in main connex component
+        blackBoxModel->addStaticRef("hvdc_PInj1Pu", "p1");
+        blackBoxModel->addStaticRef("hvdc_QInj1Pu", "q1");
+        blackBoxModel->addStaticRef("hvdc_state", "state1");
+        blackBoxModel->addStaticRef("hvdc_PInj2Pu", "p2");
+        blackBoxModel->addStaticRef("hvdc_QInj2Pu", "q2");
+        blackBoxModel->addStaticRef("hvdc_state", "state2");
+      }
+      return blackBoxModel;
+    });
     writeConnect(dynamicModelsToConnect, hvdcLine);
   }
 }
 
-void DydHvdc::writeConnect(boost::shared_ptr<dynamicdata::DynamicModelsCollection> &dynamicModelsToConnect, const algo::HVDCDefinition &hvdcLine) {
+void DydHvdc::writeConnect(DydStream &dynamicModelsToConnect, const algo::HVDCDefinition &hvdcLine) {
   if (hvdcLine.position == algo::HVDCDefinition::Position::SECOND_IN_MAIN_COMPONENT || hvdcLine.converterStationOnSide2()) {
-    dynamicModelsToConnect->addConnect(constants::networkModelName, hvdcLine.converter1BusId + "_ACPIN", hvdcLine.id, "hvdc_terminal2");
-    dynamicModelsToConnect->addConnect(constants::networkModelName, hvdcLine.converter2BusId + "_ACPIN", hvdcLine.id, "hvdc_terminal1");
-    dynamicModelsToConnect->addConnect(constants::networkModelName, hvdcLine.converter2BusId + "_switchOff_value", hvdcLine.id, "hvdc_switchOffSignal1Side1");
+    dynamicModelsToConnect.addConnect(constants::networkModelName, hvdcLine.converter1BusId + "_ACPIN", hvdcLine.id, "hvdc_terminal2");
+    dynamicModelsToConnect.addConnect(constants::networkModelName, hvdcLine.converter2BusId + "_ACPIN", hvdcLine.id, "hvdc_terminal1");
+    dynamicModelsToConnect.addConnect(constants::networkModelName, hvdcLine.converter2BusId + "_switchOff_value", hvdcLine.id, "hvdc_switchOffSignal1Side1");
     if (hvdcLine.position == algo::HVDCDefinition::Position::BOTH_IN_MAIN_COMPONENT)
-      dynamicModelsToConnect->addConnect(constants::networkModelName, hvdcLine.converter1BusId + "_switchOff_value", hvdcLine.id, "hvdc_switchOffSignal1Side2");
+      dynamicModelsToConnect.addConnect(constants::networkModelName, hvdcLine.converter1BusId + "_switchOff_value", hvdcLine.id, "hvdc_switchOffSignal1Side2");
   } else {
     // case both : 1 <-> 1 and 2 <-> 2
-    dynamicModelsToConnect->addConnect(constants::networkModelName, hvdcLine.converter1BusId + "_ACPIN", hvdcLine.id, "hvdc_terminal1");
-    dynamicModelsToConnect->addConnect(constants::networkModelName, hvdcLine.converter2BusId + "_ACPIN", hvdcLine.id, "hvdc_terminal2");
-    dynamicModelsToConnect->addConnect(constants::networkModelName, hvdcLine.converter1BusId + "_switchOff_value", hvdcLine.id, "hvdc_switchOffSignal1Side1");
+    dynamicModelsToConnect.addConnect(constants::networkModelName, hvdcLine.converter1BusId + "_ACPIN", hvdcLine.id, "hvdc_terminal1");
+    dynamicModelsToConnect.addConnect(constants::networkModelName, hvdcLine.converter2BusId + "_ACPIN", hvdcLine.id, "hvdc_terminal2");
+    dynamicModelsToConnect.addConnect(constants::networkModelName, hvdcLine.converter1BusId + "_switchOff_value", hvdcLine.id, "hvdc_switchOffSignal1Side1");
     if (hvdcLine.position == algo::HVDCDefinition::Position::BOTH_IN_MAIN_COMPONENT)
-      dynamicModelsToConnect->addConnect(constants::networkModelName, hvdcLine.converter2BusId + "_switchOff_value", hvdcLine.id, "hvdc_switchOffSignal1Side2");
+      dynamicModelsToConnect.addConnect(constants::networkModelName, hvdcLine.converter2BusId + "_switchOff_value", hvdcLine.id, "hvdc_switchOffSignal1Side2");
   }
 }
 }  // namespace outputs
@@ -22,45 +22,51 @@ namespace dfl {
 namespace outputs {
 
 void
-DydLoads::write(boost::shared_ptr<dynamicdata::DynamicModelsCollection>& dynamicModelsToConnect, const std::string& basename) {
+DydLoads::write(DydStream& dynamicModelsToConnect, const std::string& basename) {
   for (const auto& load : loadsDefinitions_) {
     if (load.isNetwork()) {
       continue;
     }
-    std::unique_ptr<dynamicdata::BlackBoxModel> blackBoxModel =
-        helper::buildBlackBoxStaticId(load.id, load.id, "DYNModelLoadRestorativeWithLimits", basename + ".par", constants::loadParId);
-    blackBoxModel->addMacroStaticRef(dynamicdata::MacroStaticRefFactory::newMacroStaticRef(macroStaticRefLoadName_));
+    dynamicModelsToConnect.addModel(load.id, [this, &load, &basename]() {
+      std::unique_ptr<dynamicdata::BlackBoxModel> blackBoxModel =
+          helper::buildBlackBoxStaticId(load.id, load.id, "DYNModelLoadRestorativeWithLimits", basename + ".par", constants::loadParId);
+      blackBoxModel->addMacroStaticRef(dynamicdata::MacroStaticRefFactory::newMacroStaticRef(macroStaticRefLoadName_));
+      return blackBoxModel;
+    });
     std::unique_ptr<dynamicdata::MacroConnect> loadMacroConnectRef =
         dynamicdata::MacroConnectFactory::newMacroConnect(macroConnectorLoadName_, load.id, constants::networkModelName);
-    dynamicModelsToConnect->addModel(std::move(blackBoxModel));
-    dynamicModelsToConnect->addMacroConnect(std::move(loadMacroConnectRef));
+    dynamicModelsToConnect.addMacroConnect(std::move(loadMacroConnectRef));
   }
   writeMacroConnector(dynamicModelsToConnect);
   writeMacroStaticReference(dynamicModelsToConnect);
 }
 
 void
-DydLoads::writeMacroConnector(boost::shared_ptr<dynamicdata::DynamicModelsCollection>& dynamicModelsToConnect) {
+DydLoads::writeMacroConnector(DydStream& dynamicModelsToConnect) {
   if (!loadsDefinitions_.empty()) {
-    std::unique_ptr<dynamicdata::MacroConnector> connector = dynamicdata::MacroConnectorFactory::newMacroConnector(macroConnectorLoadName_);
-    connector->addConnect("Ur_value", "@STATIC_ID@@NODE@_ACPIN_V_re");
-    connector->addConnect("Ui_value", "@STATIC_ID@@NODE@_ACPIN_V_im");
-    connector->addConnect("Ir_value", "@STATIC_ID@@NODE@_ACPIN_i_re");
-    connector->addConnect("Ii_value", "@STATIC_ID@@NODE@_ACPIN_i_im");
-    connector->addConnect("switchOff1_value", "@STATIC_ID@@NODE@_switchOff_value");
-    dynamicModelsToConnect->addMacroConnector(std::move(connector));
+    dynamicModelsToConnect.addMacroConnector(macroConnectorLoadName_, [this]() {
+      std::unique_ptr<dynamicdata::MacroConnector> connector = dynamicdata::MacroConnectorFactory::newMacroConnector(macroConnectorLoadName_);
+      connector->addConnect("Ur_value", "@STATIC_ID@@NODE@_ACPIN_V_re");
+      connector->addConnect("Ui_value", "@STATIC_ID@@NODE@_ACPIN_V_im");
+      connector->addConnect("Ir_value", "@STATIC_ID@@NODE@_ACPIN_i_re");
+      connector->addConnect("Ii_value", "@STATIC_ID@@NODE@_ACPIN_i_im");
+      connector->addConnect("switchOff1_value", "@STATIC_ID@@NODE@_switchOff_value");
+      return connector;
+    });
   }
 }
 
 void
-DydLoads::writeMacroStaticReference(boost::shared_ptr<dynamicdata::DynamicModelsCollection>& dynamicModelsToConnect) {
+DydLoads::writeMacroStaticReference(DydStream& dynamicModelsToConnect) {
   if (!loadsDefinitions_.empty()) {
-    std::unique_ptr<dynamicdata::MacroStaticReference> macroStaticReference =
-        dynamicdata::MacroStaticReferenceFactory::newMacroStaticReference(macroStaticRefLoadName_);
-    macroStaticReference->addStaticRef("PPu_value", "p");
-    macroStaticReference->addStaticRef("QPu_value", "q");
-    macroStaticReference->addStaticRef("state_value", "state");
-    dynamicModelsToConnect->addMacroStaticReference(std::move(macroStaticReference));
+    dynamicModelsToConnect.addMacroStaticReference(macroStaticRefLoadName_, [this]() {
+      std::unique_ptr<dynamicdata::MacroStaticReference> macroStaticReference =
+          dynamicdata::MacroStaticReferenceFactory::newMacroStaticReference(macroStaticRefLoadName_);
+      macroStaticReference->addStaticRef("PPu_value", "p");
+      macroStaticReference->addStaticRef("QPu_value", "q");
+      macroStaticReference->addStaticRef("state_value", "state");
+      return macroStaticReference;
+    });
   }
 }
 }  // namespace outputs
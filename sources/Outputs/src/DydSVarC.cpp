@@ -31,35 +31,37 @@ const std::unordered_map<algo::StaticVarCompensatorDefinition::ModelType, std::s
     std::make_pair(algo::StaticVarCompensatorDefinition::ModelType::SVARCPVREMOTE, "StaticVarCompensatorPVRemote"),
     std::make_pair(algo::StaticVarCompensatorDefinition::ModelType::SVARCPVREMOTEMODEHANDLING, "StaticVarCompensatorPVRemoteModeHandling")};
 
-void DydSVarC::write(boost::shared_ptr<dynamicdata::DynamicModelsCollection> &dynamicModelsToConnect, const std::string &basename) {
+void DydSVarC::write(DydStream &dynamicModelsToConnect, const std::string &basename) {
   for (const auto &svarc : svarcsDefinitions_) {
     if (svarc.isNetwork()) {
       continue;
     }
-    std::string parId = constants::uuid(svarc.id);
-    std::unique_ptr<dynamicdata::BlackBoxModel> blackBoxModel =
-        helper::buildBlackBoxStaticId(svarc.id, svarc.id, svarcModelsNames_.at(svarc.model), basename + ".par", parId);
-    blackBoxModel->addMacroStaticRef(dynamicdata::MacroStaticRefFactory::newMacroStaticRef(macroStaticRefSVarCName_));
-    switch (svarc.model) {
-    case algo::StaticVarCompensatorDefinition::ModelType::SVARCPVMODEHANDLING:
-    case algo::StaticVarCompensatorDefinition::ModelType::SVARCPVREMOTEMODEHANDLING:
-    case algo::StaticVarCompensatorDefinition::ModelType::SVARCPVPROPMODEHANDLING:
-    case algo::StaticVarCompensatorDefinition::ModelType::SVARCPVPROPREMOTEMODEHANDLING:
-      blackBoxModel->addStaticRef("SVarC_modeHandling_mode_value", "regulatingMode");
-      break;
-    default:
-      break;
-    }
+    dynamicModelsToConnect.addModel(svarc.id, [this, &svarc, &basename]() {
+      std::string parId = constants::uuid(svarc.id);
+      std::unique_ptr<dynamicdata::BlackBoxModel> blackBoxModel =
+          helper::buildBlackBoxStaticId(svarc.id, svarc.id, svarcModelsNames_.at(svarc.model), basename + ".par", parId);
+      blackBoxModel->addMacroStaticRef(dynamicdata::MacroStaticRefFactory::newMacroStaticRef(macroStaticRefSVarCName_));
+      switch (svarc.model) {
+      case algo::StaticVarCompensatorDefinition::ModelType::SVARCPVMODEHANDLING:
+      case algo::StaticVarCompensatorDefinition::ModelType::SVARCPVREMOTEMODEHANDLING:
+      case algo::StaticVarCompensatorDefinition::ModelType::SVARCPVPROPMODEHANDLING:
+      case algo::StaticVarCompensatorDefinition::ModelType::SVARCPVPROPREMOTEMODEHANDLING:
+        blackBoxModel->addStaticRef("SVarC_modeHandling_mode_value", "regulatingMode");
+        break;
+      default:
+        break;
+      }
+      return blackBoxModel;
+    });
     std::unique_ptr<dynamicdata::MacroConnect> sVarCMacroConnectRef =
         dynamicdata::MacroConnectFactory::newMacroConnect(macroConnectorSVarCName_, svarc.id, constants::networkModelName);
-    dynamicModelsToConnect->addModel(std::move(blackBoxModel));
-    dynamicModelsToConnect->addMacroConnect(std::move(sVarCMacroConnectRef));
+    dynamicModelsToConnect.addMacroConnect(std::move(sVarCMacroConnectRef));
     switch (svarc.model) {
     case algo::StaticVarCompensatorDefinition::ModelType::SVARCPVPROPREMOTE:
     case algo::StaticVarCompensatorDefinition::ModelType::SVARCPVPROPREMOTEMODEHANDLING:
     case algo::StaticVarCompensatorDefinition::ModelType::SVARCPVREMOTE:
     case algo::StaticVarCompensatorDefinition::ModelType::SVARCPVREMOTEMODEHANDLING:
-      dynamicModelsToConnect->addConnect(svarc.id, "SVarC_URegulatedPu", "NETWORK", svarc.regulatedBusId + "_Upu_value");
+      dynamicModelsToConnect.addConnect(svarc.id, "SVarC_URegulatedPu", "NETWORK", svarc.regulatedBusId + "_Upu_value");
       break;
     default:
       break;
@@ -69,22 +71,26 @@ void DydSVarC::write(boost::shared_ptr<dynamicdata::DynamicModelsCollection> &dy
   writeMacroStaticReference(dynamicModelsToConnect);
 }
 
-void DydSVarC::writeMacroConnector(boost::shared_ptr<dynamicdata::DynamicModelsCollection> &dynamicModelsToConnect) {
+void DydSVarC::writeMacroConnector(DydStream &dynamicModelsToConnect) {
   if (!svarcsDefinitions_.empty()) {
-    std::unique_ptr<dynamicdata::MacroConnector> connector = dynamicdata::MacroConnectorFactory::newMacroConnector(macroConnectorSVarCName_);
-    connector->addConnect("SVarC_terminal", "@STATIC_ID@@NODE@_ACPIN");
-    dynamicModelsToConnect->addMacroConnector(std::move(connector));
+    dynamicModelsToConnect.addMacroConnector(macroConnectorSVarCName_, [this]() {
+      std::unique_ptr<dynamicdata::MacroConnector> connector = dynamicdata::MacroConnectorFactory::newMacroConnector(macroConnectorSVarCName_);
+      connector->addConnect("SVarC_terminal", "@STATIC_ID@@NODE@_ACPIN");
+      return connector;
+    });
   }
 }
 
-void DydSVarC::writeMacroStaticReference(boost::shared_ptr<dynamicdata::DynamicModelsCollection> &dynamicModelsToConnect) {
+void DydSVarC::writeMacroStaticReference(DydStream &dynamicModelsToConnect) {
   if (!svarcsDefinitions_.empty()) {
-    std::unique_ptr<dynamicdata::MacroStaticReference> macroStaticReference =
-        dynamicdata::MacroStaticReferenceFactory::newMacroStaticReference(macroStaticRefSVarCName_);
-    macroStaticReference->addStaticRef("SVarC_PInjPu", "p");
-    macroStaticReference->addStaticRef("SVarC_QInjPu", "q");
-    macroStaticReference->addStaticRef("SVarC_state", "state");
-    dynamicModelsToConnect->addMacroStaticReference(std::move(macroStaticReference));
+    dynamicModelsToConnect.addMacroStaticReference(macroStaticRefSVarCName_, [this]() {
+      std::unique_ptr<dynamicdata::MacroStaticReference> macroStaticReference =
+          dynamicdata::MacroStaticReferenceFactory::newMacroStaticReference(macroStaticRefSVarCName_);
+      macroStaticReference->addStaticRef("SVarC_PInjPu", "p");
+      macroStaticReference->addStaticRef("SVarC_QInjPu", "q");
+      macroStaticReference->addStaticRef("SVarC_state", "state");
+      return macroStaticReference;
+    });
   }
 }
 }  // namespace outputs
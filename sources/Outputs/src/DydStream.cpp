@@ -0,0 +1,178 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  DydStream.cpp
+ *
+ * @brief Streaming DYD file writer implementation file
+ *
+ */
+
+#include "DydStream.h"
+
+#include "Log.h"
+#include "OutputsConstants.h"
+
+#include <DYDDynamicModelsCollectionFactory.h>
+#include <DYDXmlExporter.h>
+#include <algorithm>
+#include <sstream>
+
+namespace dfl {
+namespace outputs {
+
+namespace {
+
+/**
+ * @brief Add the builder of an element sorted by id
+ *
+ * @param builders the builders of the elements of the same tag, by id
+ * @param tag the tag of the element
+ * @param id the id of the element
+ * @param builder the builder of the element
+ */
+template<class T>
+void
+insert(std::map<std::string, DydStream::Builder<T>> &builders, const std::string &tag, const std::string &id, DydStream::Builder<T> builder) {
+  if (!builders.emplace(id, std::move(builder)).second) {
+    throw DFLError(XmlElementNotUnique, tag, id);
+  }
+}
+
+/**
+ * @brief Add an element to a collection
+ *
+ * @param collection the collection
+ * @param element the element to add
+ */
+void
+add(dynamicdata::DynamicModelsCollection &collection, std::unique_ptr<dynamicdata::MacroConnector> element) {
+  collection.addMacroConnector(std::move(element));
+}
+
+/// @copydoc add(dynamicdata::DynamicModelsCollection&, std::unique_ptr<dynamicdata::MacroConnector>)
+void
+add(dynamicdata::DynamicModelsCollection &collection, std::unique_ptr<dynamicdata::MacroStaticReference> element) {
+  collection.addMacroStaticReference(std::move(element));
+}
+
+/// @copydoc add(dynamicdata::DynamicModelsCollection&, std::unique_ptr<dynamicdata::MacroConnector>)
+void
+add(dynamicdata::DynamicModelsCollection &collection, std::unique_ptr<dynamicdata::BlackBoxModel> element) {
+  collection.addModel(std::move(element));
+}
+
+}  // namespace
+
+DydStream::DydStream(std::ostream &stream, std::size_t batchSize)
+    : writer_{stream}, batchSize_{std::max<std::size_t>(batchSize, 1)}, batch_{dynamicdata::DynamicModelsCollectionFactory::newCollection()} {}
+
+std::vector<XmlSections::SectionDefinition>
+DydStream::sectionDefinitions() {
+  return {{"macroConnector", true}, {"macroStaticReference", true}, {"blackBoxModel", true}, {"macroConnect", false}, {"connect", false}};
+}
+
+void
+DydStream::addMacroConnector(const std::string &id, Builder<dynamicdata::MacroConnector> builder) {
+  if (pass_ == Pass::SORTED_ELEMENTS) {
+    insert(macroConnectors_, "macroConnector", id, std::move(builder));
+  }
+}
+
+void
+DydStream::addMacroStaticReference(const std::string &id, Builder<dynamicdata::MacroStaticReference> builder) {
+  if (pass_ == Pass::SORTED_ELEMENTS) {
+    insert(macroStaticRefs_, "macroStaticReference", id, std::move(builder));
+  }
+}
+
+void
+DydStream::addModel(const std::string &id, Builder<dynamicdata::BlackBoxModel> builder) {
+  if (pass_ == Pass::SORTED_ELEMENTS) {
+    insert(models_, "blackBoxModel", id, std::move(builder));
+  }
+}
+
+void
+DydStream::addMacroConnect(std::unique_ptr<dynamicdata::MacroConnect> macroConnect) {
+  if (pass_ == Pass::MACRO_CONNECTS) {
+    batch_->addMacroConnect(std::shared_ptr<dynamicdata::MacroConnect>(std::move(macroConnect)));
+    added();
+  }
+}
+
+void
+DydStream::addConnect(const std::string &model1, const std::string &var1, const std::string &model2, const std::string &var2) {
+  if (pass_ == Pass::CONNECTS) {
+    batch_->addConnect(model1, var1, model2, var2);
+    added();
+  }
+}
+
+bool
+DydStream::nextPass() {
+  switch (pass_) {
+  case Pass::SORTED_ELEMENTS:
+    write(macroConnectors_);
+    write(macroStaticRefs_);
+    write(models_);
+    pass_ = Pass::MACRO_CONNECTS;
+    return true;
+  case Pass::MACRO_CONNECTS:
+    flush();
+    pass_ = Pass::CONNECTS;
+    return true;
+  case Pass::CONNECTS: {
+    flush();
+    dynamicdata::XmlExporter exporter;
+    std::stringstream emptyDocument;
+    exporter.exportToStream(dynamicdata::DynamicModelsCollectionFactory::newCollection(), emptyDocument, constants::xmlEncoding);
+    writer_.close(emptyDocument.str());
+    pass_ = Pass::DONE;
+    return false;
+  }
+  default:
+    return false;
+  }
+}
+
+void
+DydStream::added() {
+  if (++batchCount_ == batchSize_) {
+    flush();
+  }
+}
+
+void
+DydStream::flush() {
+  if (batchCount_ == 0) {
+    return;
+  }
+  dynamicdata::XmlExporter exporter;
+  std::stringstream document;
+  exporter.exportToStream(batch_, document, constants::xmlEncoding);
+  writer_.write(document.str());
+  batch_ = dynamicdata::DynamicModelsCollectionFactory::newCollection();
+  batchCount_ = 0;
+}
+
+template<class T>
+void
+DydStream::write(std::map<std::string, Builder<T>> &builders) {
+  for (auto &builder : builders) {
+    add(*batch_, builder.second());
+    added();
+  }
+  flush();
+  builders.clear();
+}
+
+}  // namespace outputs
+}  // namespace dfl
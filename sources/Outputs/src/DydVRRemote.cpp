@@ -20,41 +20,49 @@
 namespace dfl {
 namespace outputs {
 
-void DydVRRemote::writeVRRemotes(boost::shared_ptr<dynamicdata::DynamicModelsCollection> &dynamicModelsToConnect, const std::string &basename) {
+void DydVRRemote::writeVRRemotes(DydStream &dynamicModelsToConnect, const std::string &basename) {
   writeMacroConnector(dynamicModelsToConnect);
   writeConnections(dynamicModelsToConnect, basename);
 }
 
-void DydVRRemote::writeMacroConnector(boost::shared_ptr<dynamicdata::DynamicModelsCollection> &dynamicModelsToConnect) {
+void DydVRRemote::writeMacroConnector(DydStream &dynamicModelsToConnect) {
   for (auto it = generatorDefinitions_.cbegin(); it != generatorDefinitions_.cend(); ++it) {
     if (it->isRegulatingLocallyWithOthers()) {
-      std::unique_ptr<dynamicdata::MacroConnector> connector = dynamicdata::MacroConnectorFactory::newMacroConnector(macroConnectorGenVRRemoteName_);
-      connector->addConnect("generator_NQ", "vrremote_NQ");
-      connector->addConnect("generator_limUQUp", "vrremote_limUQUp_@INDEX@_");
-      connector->addConnect("generator_limUQDown", "vrremote_limUQDown_@INDEX@_");
-      dynamicModelsToConnect->addMacroConnector(std::move(connector));
+      dynamicModelsToConnect.addMacroConnector(macroConnectorGenVRRemoteName_, [this]() {
+        std::unique_ptr<dynamicdata::MacroConnector> connector = dynamicdata::MacroConnectorFactory::newMacroConnector(macroConnectorGenVRRemoteName_);
+        connector->addConnect("generator_NQ", "vrremote_NQ");
+        connector->addConnect("generator_limUQUp", "vrremote_limUQUp_@INDEX@_");
+        connector->addConnect("generator_limUQDown", "vrremote_limUQDown_@INDEX@_");
+        return connector;
+      });
       break;
     }
   }
   for (const auto &keyValue : hvdcDefinitions_.hvdcLines) {
-    algo::HVDCDefinition hvdcLine = keyValue.second;
+    const auto &hvdcLine = keyValue.second;
     if (hvdcLine.hasPQPropModel()) {
-      std::unique_ptr<dynamicdata::MacroConnector> connector1 = dynamicdata::MacroConnectorFactory::newMacroConnector(macroConnectorHvdcVRRemoteSide1Name_);
-      connector1->addConnect("hvdc_NQ1", "vrremote_NQ");
-      connector1->addConnect("hvdc_limUQUp1", "vrremote_limUQUp_@INDEX@_");
-      connector1->addConnect("hvdc_limUQDown1", "vrremote_limUQDown_@INDEX@_");
-      dynamicModelsToConnect->addMacroConnector(std::move(connector1));
-      std::unique_ptr<dynamicdata::MacroConnector> connector2 = dynamicdata::MacroConnectorFactory::newMacroConnector(macroConnectorHvdcVRRemoteSide2Name_);
-      connector2->addConnect("hvdc_NQ2", "vrremote_NQ");
-      connector2->addConnect("hvdc_limUQUp2", "vrremote_limUQUp_@INDEX@_");
-      connector2->addConnect("hvdc_limUQDown2", "vrremote_limUQDown_@INDEX@_");
-      dynamicModelsToConnect->addMacroConnector(std::move(connector2));
+      dynamicModelsToConnect.addMacroConnector(macroConnectorHvdcVRRemoteSide1Name_, [this]() {
+        std::unique_ptr<dynamicdata::MacroConnector> connector1 =
+            dynamicdata::MacroConnectorFactory::newMacroConnector(macroConnectorHvdcVRRemoteSide1Name_);
+        connector1->addConnect("hvdc_NQ1", "vrremote_NQ");
+        connector1->addConnect("hvdc_limUQUp1", "vrremote_limUQUp_@INDEX@_");
+        connector1->addConnect("hvdc_limUQDown1", "vrremote_limUQDown_@INDEX@_");
+        return connector1;
+      });
+      dynamicModelsToConnect.addMacroConnector(macroConnectorHvdcVRRemoteSide2Name_, [this]() {
+        std::unique_ptr<dynamicdata::MacroConnector> connector2 =
+            dynamicdata::MacroConnectorFactory::newMacroConnector(macroConnectorHvdcVRRemoteSide2Name_);
+        connector2->addConnect("hvdc_NQ2", "vrremote_NQ");
+        connector2->addConnect("hvdc_limUQUp2", "vrremote_limUQUp_@INDEX@_");
+        connector2->addConnect("hvdc_limUQDown2", "vrremote_limUQDown_@INDEX@_");
+        return connector2;
+      });
       break;
     }
   }
 }
 
-void DydVRRemote::writeConnections(boost::shared_ptr<dynamicdata::DynamicModelsCollection> &dynamicModelsToConnect, const std::string &basename) {
+void DydVRRemote::writeConnections(DydStream &dynamicModelsToConnect, const std::string &basename) {
   std::map<std::string, unsigned int> modelBusIdToNumber;
   for (auto it = generatorDefinitions_.cbegin(); it != generatorDefinitions_.cend(); ++it) {
     if (it->isRegulatingLocallyWithOthers()) {
@@ -65,7 +73,7 @@ void DydVRRemote::writeConnections(boost::shared_ptr<dynamicdata::DynamicModelsC
           dynamicdata::MacroConnectFactory::newMacroConnect(macroConnectorGenVRRemoteName_, it->id, modelNQId);
       connection->setIndex2(std::to_string(modelBusIdToNumber[it->regulatedBusId]));
       ++modelBusIdToNumber[it->regulatedBusId];
-      dynamicModelsToConnect->addMacroConnect(std::move(connection));
+      dynamicModelsToConnect.addMacroConnect(std::move(connection));
     }
   }
 
@@ -79,7 +87,7 @@ void DydVRRemote::writeConnections(boost::shared_ptr<dynamicdata::DynamicModelsC
           dynamicdata::MacroConnectFactory::newMacroConnect(macroConnectorHvdcVRRemoteSide1Name_, hvdcLine.id, modelNQId);
       connection->setIndex2(std::to_string(modelBusIdToNumber[busId1]));
       ++modelBusIdToNumber[busId1];
-      dynamicModelsToConnect->addMacroConnect(std::move(connection));
+      dynamicModelsToConnect.addMacroConnect(std::move(connection));
 
       if (hvdcLine.position == algo::HVDCDefinition::Position::BOTH_IN_MAIN_COMPONENT) {
         std::string modelNQId2 = constants::modelSignalNQprefix_ + hvdcLine.converter2BusId;
@@ -87,16 +95,15 @@ void DydVRRemote::writeConnections(boost::shared_ptr<dynamicdata::DynamicModelsC
             dynamicdata::MacroConnectFactory::newMacroConnect(macroConnectorHvdcVRRemoteSide2Name_, hvdcLine.id, modelNQId2);
         connectionSide2->setIndex2(std::to_string(modelBusIdToNumber[hvdcLine.converter2BusId]));
         ++modelBusIdToNumber[hvdcLine.converter2BusId];
-        dynamicModelsToConnect->addMacroConnect(std::move(connectionSide2));
+        dynamicModelsToConnect.addMacroConnect(std::move(connectionSide2));
       }
     }
   }
   for (const auto &busId : modelBusIdToNumber) {
     if (busId.second > 0) {
       std::string id = constants::modelSignalNQprefix_ + busId.first;
-      std::unique_ptr<dynamicdata::BlackBoxModel> blackBoxModelVRRemote = helper::buildBlackBox(id, "VRRemote", basename + ".par", id);
-      dynamicModelsToConnect->addModel(std::move(blackBoxModelVRRemote));
-      dynamicModelsToConnect->addConnect(id, "vrremote_URegulatedPu", constants::networkModelName, busId.first + "_Upu_value");
+      dynamicModelsToConnect.addModel(id, [id, &basename]() { return helper::buildBlackBox(id, "VRRemote", basename + ".par", id); });
+      dynamicModelsToConnect.addConnect(id, "vrremote_URegulatedPu", constants::networkModelName, busId.first + "_Upu_value");
     }
   }
 }
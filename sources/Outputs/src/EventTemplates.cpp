@@ -0,0 +1,278 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  EventTemplates.cpp
+ *
+ * @brief Contingency event files stamped from templates implementation file
+ *
+ */
+
+#include "EventTemplates.h"
+
+#include "DydEvent.h"
+#include "DydStream.h"
+#include "Log.h"
+#include "OutputsConstants.h"
+#include "ParEvent.h"
+#include "ParStream.h"
+#include "XmlSections.h"
+
+#include <DYDDynamicModelsCollectionFactory.h>
+#include <DYDXmlExporter.h>
+#include <PARParametersSetCollectionFactory.h>
+#include <PARXmlExporter.h>
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <sstream>
+
+namespace dfl {
+namespace outputs {
+
+namespace {
+
+const std::string elementIdPlaceholder{"@DFL_ELEMENT_ID@"};  ///< placeholder of the id of the contingency element in the templates
+const std::string basenamePlaceholder{"@DFL_BASENAME@"};     ///< placeholder of the basename of the PAR file in the templates
+
+/// @brief Types of the contingency elements, each one having its own template
+const inputs::ContingencyElement::Type elementTypes[] = {inputs::ContingencyElement::Type::LOAD,
+                                                         inputs::ContingencyElement::Type::GENERATOR,
+                                                         inputs::ContingencyElement::Type::BRANCH,
+                                                         inputs::ContingencyElement::Type::LINE,
+                                                         inputs::ContingencyElement::Type::TWO_WINDINGS_TRANSFORMER,
+                                                         inputs::ContingencyElement::Type::THREE_WINDINGS_TRANSFORMER,
+                                                         inputs::ContingencyElement::Type::SHUNT_COMPENSATOR,
+                                                         inputs::ContingencyElement::Type::STATIC_VAR_COMPENSATOR,
+                                                         inputs::ContingencyElement::Type::DANGLING_LINE,
+                                                         inputs::ContingencyElement::Type::HVDC_LINE,
+                                                         inputs::ContingencyElement::Type::BUSBAR_SECTION};
+
+/**
+ * @brief Determine if a value is written as is by the exporters
+ *
+ * Only printable ASCII characters which are not escaped in attribute values are accepted
+ *
+ * @param value the value
+ * @returns true if the value is written as is
+ */
+bool
+isVerbatim(const std::string &value) {
+  for (const auto c : value) {
+    const auto code = static_cast<unsigned char>(c);
+    if (code < 0x20 || code >= 0x7F || c == '&' || c == '<' || c == '>' || c == '"' || c == '\'') {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * @brief Write a file
+ *
+ * @param filepath the file path
+ * @param write the function writing the content of the file into a stream
+ */
+void
+writeFile(const std::string &filepath, const std::function<void(std::ostream &)> &write) {
+  std::ofstream file(filepath);
+  if (!file.is_open()) {
+    throw DFLError(FileCreationFailed, filepath);
+  }
+  write(file);
+  file.close();
+  if (file.fail()) {
+    throw DFLError(FileWritingFailed, filepath);
+  }
+}
+
+}  // namespace
+
+constexpr std::size_t EventTemplates::nbTemplates;
+
+EventTemplates::EventTemplates(double timeOfEvent) : timeOfEvent_{timeOfEvent} {
+  static_assert(sizeof(elementTypes) / sizeof(elementTypes[0]) + 1 == nbTemplates, "each type of contingency element must have its own template");
+  dynamicdata::XmlExporter dydExporter;
+  parameters::XmlExporter parExporter;
+
+  auto dynamicModels = dynamicdata::DynamicModelsCollectionFactory::newCollection();
+  DydEvent::addMacroConnectors(dynamicModels);
+  std::stringstream dydStream;
+  dydExporter.exportToStream(dynamicModels, dydStream, constants::xmlEncoding);
+  dydBase_ = dydStream.str();
+
+  std::stringstream parStream;
+  parExporter.exportToStream(parameters::ParametersSetCollectionFactory::newCollection(), parStream, constants::xmlEncoding);
+  parBase_ = parStream.str();
+
+  // one template for the elements using a network cpp model, whatever their type, and one template by type for the other ones
+  dydElements_.resize(nbTemplates);
+  parElements_.resize(nbTemplates);
+  addTemplates(inputs::ContingencyElement(elementIdPlaceholder, elementTypes[0]), true);
+  for (const auto type : elementTypes) {
+    addTemplates(inputs::ContingencyElement(elementIdPlaceholder, type), false);
+  }
+}
+
+void
+EventTemplates::addTemplates(const inputs::ContingencyElement &element, bool isNetwork) {
+  dynamicdata::XmlExporter dydExporter;
+  parameters::XmlExporter parExporter;
+  const auto index = templateIndex(element, isNetwork);
+
+  auto elementModels = dynamicdata::DynamicModelsCollectionFactory::newCollection();
+  DydEvent::addElementModels(elementModels, element, isNetwork, basenamePlaceholder);
+  std::stringstream elementDydStream;
+  dydExporter.exportToStream(elementModels, elementDydStream, constants::xmlEncoding);
+  dydElements_[index] = elementDydStream.str();
+
+  auto elementSets = parameters::ParametersSetCollectionFactory::newCollection();
+  ParEvent::addElementSet(elementSets, element, isNetwork, timeOfEvent_);
+  std::stringstream elementParStream;
+  parExporter.exportToStream(std::move(elementSets), elementParStream, constants::xmlEncoding);
+  parElements_[index] = elementParStream.str();
+}
+
+std::size_t
+EventTemplates::templateIndex(const inputs::ContingencyElement &element, bool isNetwork) {
+  using Type = inputs::ContingencyElement::Type;
+  if (isNetwork) {
+    return 0;
+  }
+  switch (element.type) {
+  case Type::LOAD:
+    return 1;
+  case Type::GENERATOR:
+    return 2;
+  case Type::BRANCH:
+    return 3;
+  case Type::LINE:
+    return 4;
+  case Type::TWO_WINDINGS_TRANSFORMER:
+    return 5;
+  case Type::THREE_WINDINGS_TRANSFORMER:
+    return 6;
+  case Type::SHUNT_COMPENSATOR:
+    return 7;
+  case Type::STATIC_VAR_COMPENSATOR:
+    return 8;
+  case Type::DANGLING_LINE:
+    return 9;
+  case Type::HVDC_LINE:
+    return 10;
+  case Type::BUSBAR_SECTION:
+    return 11;
+  }
+  // all the types are handled above, so that the compiler warns about a type added without its template
+  return 0;
+}
+
+std::string
+EventTemplates::stamp(const std::string &text, const std::string &elementId, const std::string &basename) {
+  // the values are inserted in a single pass, so that a value looking like a placeholder is never replaced
+  std::string stamped;
+  stamped.reserve(text.size() + 4 * (elementId.size() + basename.size()));
+  std::size_t position = 0;
+  while (true) {
+    const auto elementIdPosition = text.find(elementIdPlaceholder, position);
+    const auto basenamePosition = text.find(basenamePlaceholder, position);
+    if (elementIdPosition == std::string::npos && basenamePosition == std::string::npos) {
+      break;
+    }
+    const bool isElementId = elementIdPosition < basenamePosition;
+    const auto found = isElementId ? elementIdPosition : basenamePosition;
+    stamped.append(text, position, found - position);
+    stamped += isElementId ? elementId : basename;
+    position = found + (isElementId ? elementIdPlaceholder : basenamePlaceholder).size();
+  }
+  stamped.append(text, position, std::string::npos);
+  return stamped;
+}
+
+void
+EventTemplates::writeDyd(const std::string &basename, const std::string &filepath, const inputs::Contingency &contingency,
+                         const std::unordered_set<std::string> &networkElements) const {
+  const auto isNetwork = [&networkElements](const inputs::ContingencyElement &element) { return networkElements.find(element.id) != networkElements.end(); };
+  const bool isStamped = isVerbatim(basename) && std::all_of(contingency.elements.begin(), contingency.elements.end(),
+                                                             [](const inputs::ContingencyElement &element) { return isVerbatim(element.id); });
+  if (!isStamped) {
+    // the exporter escapes some values, so the whole document is exported as DydEvent does
+    auto dynamicModels = dynamicdata::DynamicModelsCollectionFactory::newCollection();
+    DydEvent::addMacroConnectors(dynamicModels);
+    for (const auto &element : contingency.elements) {
+      DydEvent::addElementModels(dynamicModels, element, isNetwork(element), basename);
+    }
+    writeFile(filepath, [&dynamicModels](std::ostream &file) {
+      dynamicdata::XmlExporter exporter;
+      exporter.exportToStream(dynamicModels, file, constants::xmlEncoding);
+    });
+    return;
+  }
+
+  XmlSections sections(DydStream::sectionDefinitions());
+  sections.merge(dydBase_);
+  for (const auto &element : contingency.elements) {
+    sections.merge(stamp(dydElements_[templateIndex(element, isNetwork(element))], element.id, basename));
+  }
+  writeFile(filepath, [&sections](std::ostream &file) { sections.write(file); });
+}
+
+void
+EventTemplates::writePar(const std::string &filepath, const inputs::Contingency &contingency, const std::unordered_set<std::string> &networkElements) const {
+  std::vector<const inputs::ContingencyElement *> elements;
+  elements.reserve(contingency.elements.size());
+  for (const auto &element : contingency.elements) {
+    elements.push_back(&element);
+  }
+  writePar(filepath, elements, networkElements);
+}
+
+void
+EventTemplates::writeEventsPar(const std::string &filepath, const std::vector<inputs::Contingency> &contingencies,
+                               const std::unordered_set<std::string> &networkElements) const {
+  std::vector<const inputs::ContingencyElement *> elements;
+  std::unordered_set<std::string> elementIds;
+  for (const auto &contingency : contingencies) {
+    for (const auto &element : contingency.elements) {
+      if (elementIds.insert(element.id).second) {
+        elements.push_back(&element);
+      }
+    }
+  }
+  writePar(filepath, elements, networkElements);
+}
+
+void
+EventTemplates::writePar(const std::string &filepath, const std::vector<const inputs::ContingencyElement *> &elements,
+                         const std::unordered_set<std::string> &networkElements) const {
+  const auto isNetwork = [&networkElements](const inputs::ContingencyElement &element) { return networkElements.find(element.id) != networkElements.end(); };
+  if (!std::all_of(elements.begin(), elements.end(), [](const inputs::ContingencyElement *element) { return isVerbatim(element->id); })) {
+    // the exporter escapes some ids, so the whole document is exported as ParEvent does
+    auto parametersSets = parameters::ParametersSetCollectionFactory::newCollection();
+    for (const auto element : elements) {
+      ParEvent::addElementSet(parametersSets, *element, isNetwork(*element), timeOfEvent_);
+    }
+    writeFile(filepath, [&parametersSets](std::ostream &file) {
+      parameters::XmlExporter exporter;
+      exporter.exportToStream(std::move(parametersSets), file, constants::xmlEncoding);
+    });
+    return;
+  }
+
+  XmlSections sections(ParStream::sectionDefinitions());
+  sections.merge(parBase_);
+  for (const auto element : elements) {
+    sections.merge(stamp(parElements_[templateIndex(*element, isNetwork(*element))], element->id, ""));
+  }
+  writeFile(filepath, [&sections](std::ostream &file) { sections.write(file); });
+}
+
+}  // namespace outputs
+}  // namespace dfl
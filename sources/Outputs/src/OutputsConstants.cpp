@@ -18,6 +18,8 @@
 #include "OutputsConstants.h"
 
 #include <algorithm>
+#include <mutex>
+#include <unordered_map>
 
 #include <boost/uuid/name_generator_sha1.hpp>
 #include <boost/uuid/nil_generator.hpp>
@@ -27,11 +29,19 @@ namespace dfl {
 namespace outputs {
 namespace constants {
 
-std::string
+const std::string&
 uuid(const std::string& str) {
   static boost::uuids::name_generator_sha1 gen(boost::uuids::nil_uuid());  // null root, change as necessary
+  // uuids are cached per string, the elements of the cache keep their address when it grows
+  static std::unordered_map<std::string, std::string> cache;
+  static std::mutex mutex;
 
-  return boost::uuids::to_string(gen(str));
+  std::lock_guard<std::mutex> lock(mutex);
+  auto found = cache.find(str);
+  if (found == cache.end()) {
+    found = cache.emplace(str, boost::uuids::to_string(gen(str))).first;
+  }
+  return found->second;
 }
 
 std::string
@@ -43,6 +53,14 @@ diagramFilename(const std::string& id) {
   return idCpy + "_Diagram.txt";
 }
 
+std::string
+diagramTablesFilename(const std::string& basename) {
+  auto basenameCpy = basename;
+  std::replace(basenameCpy.begin(), basenameCpy.end(), '/', '_');
+  std::replace(basenameCpy.begin(), basenameCpy.end(), '\\', '_');
+  return basenameCpy + "_Diagrams.txt";
+}
+
 }  // namespace constants
 }  // namespace outputs
 }  // namespace dfl
@@ -17,10 +17,10 @@
 
 #include "Par.h"
 
-#include <PARParametersSetCollection.h>
-#include <PARParametersSetCollectionFactory.h>
-#include <PARXmlExporter.h>
+#include "Log.h"
+#include "ParStream.h"
 
+#include <fstream>
 
 namespace dfl {
 namespace outputs {
@@ -28,19 +28,23 @@ namespace outputs {
 Par::Par(ParDefinition&& def) : def_{std::move(def)} {}
 
 void Par::write() const {
-  parameters::XmlExporter exporter;
-
-  std::unique_ptr<parameters::ParametersSetCollection> paramSetCollection = parameters::ParametersSetCollectionFactory::newCollection();
+  std::ofstream file(def_.filepath_.generic_string());
+  if (!file.is_open()) {
+    throw DFLError(FileCreationFailed, def_.filepath_.generic_string());
+  }
+  // the sets are only built when they are written, by batches of bounded size, so that the whole collection is never held in memory
+  ParStream paramSetCollection(file);
   // adding load parameter set
   def_.parLoads_->write(paramSetCollection, def_.startingPointMode_);
   def_.parGenerator_->write(paramSetCollection, def_.activePowerCompensation_, def_.basename_, def_.dirname_, def_.startingPointMode_,
-                            def_.dynamicDataBaseManager_);
+                            def_.dynamicDataBaseManager_, def_.singleDiagramFile_);
   def_.parSVarC_->write(paramSetCollection, def_.startingPointMode_);
-  def_.parHvdc_->write(paramSetCollection, def_.basename_, def_.dirname_, def_.startingPointMode_, def_.dynamicDataBaseManager_);
-  def_.parDynModel_->write(paramSetCollection, def_.dynamicDataBaseManager_, def_.shuntCounters_, def_.linesByIdDefinitions_, def_.tfosByIdDefinitions_);
+  def_.parHvdc_->write(paramSetCollection, def_.basename_, def_.dirname_, def_.startingPointMode_, def_.dynamicDataBaseManager_,
+                       def_.singleDiagramFile_);
+  def_.parDynModel_->write(paramSetCollection, def_.dynamicDataBaseManager_, def_.shuntCounters_);
   def_.parVRRemote_->writeVRRemotes(paramSetCollection);
 
-  exporter.exportToFile(std::move(paramSetCollection), def_.filepath_.generic_string(), constants::xmlEncoding);
+  paramSetCollection.write();
 }
 
 }  // namespace outputs
@@ -20,28 +20,20 @@ namespace dfl {
 namespace outputs {
 
 ParDynModel::ParDynModel(const algo::DynamicModelDefinitions &dynamicModelsDefinitions, const std::vector<algo::GeneratorDefinition> &gens,
-                         const algo::HVDCLineDefinitions &hvdcDefinitions)
-    : dynamicModelsDefinitions_(dynamicModelsDefinitions), generatorDefinitions_(gens), hvdcDefinitions_(hvdcDefinitions) {
-  for (size_t i = 0; i < gens.size(); ++i) {
-    generatorIdToIndex_[gens[i].id] = i;
-  }
-}
+                         const algo::DefinitionsIndex &definitionsIndex)
+    : dynamicModelsDefinitions_(dynamicModelsDefinitions), generatorDefinitions_(gens), definitionsIndex_(definitionsIndex) {}
 
-void ParDynModel::write(const std::unique_ptr<parameters::ParametersSetCollection> &paramSetCollection,
-                        const inputs::DynamicDataBaseManager &dynamicDataBaseManager, const algo::ShuntCounterDefinitions &shuntCounters,
-                        const algo::LinesByIdDefinitions &linesByIdDefinitions, const algo::TransformersByIdDefinitions &transformersById) {
+void ParDynModel::write(ParStream &paramSetCollection,
+                        const inputs::DynamicDataBaseManager &dynamicDataBaseManager, const algo::ShuntCounterDefinitions &shuntCounters) {
   for (const auto &dynModel : dynamicModelsDefinitions_.models) {
-    std::shared_ptr<parameters::ParametersSet> new_set;
-
-    if (dynModel.second.lib == common::constants::svcModelName) {
-      new_set = writeSVCParameterSet(dynamicDataBaseManager.setting().getSet(dynModel.first), dynamicDataBaseManager, dynModel.second);
-    } else {
-      new_set = writeDynamicModelParameterSet(dynamicDataBaseManager.setting().getSet(dynModel.first), dynamicDataBaseManager, dynModel.second, shuntCounters,
-                                              dynamicModelsDefinitions_, linesByIdDefinitions, transformersById);
-    }
-    if (new_set) {
-      paramSetCollection->addParametersSet(new_set);
-    }
+    const auto &set = dynamicDataBaseManager.setting().getSet(dynModel.first);
+    // the set may not be written after all, see writeDynamicModelParameterSet
+    paramSetCollection.addParametersSet(set.id, [this, &set, &dynModel, &dynamicDataBaseManager, &shuntCounters]() {
+      if (dynModel.second.lib == common::constants::svcModelName) {
+        return writeSVCParameterSet(set, dynamicDataBaseManager, dynModel.second);
+      }
+      return writeDynamicModelParameterSet(set, dynamicDataBaseManager, dynModel.second, shuntCounters, dynamicModelsDefinitions_);
+    });
   }
 }
 
@@ -95,10 +87,10 @@ std::shared_ptr<parameters::ParametersSet> ParDynModel::writeSVCParameterSet(con
   unsigned idx = 0;
   bool frozen = true;
   for (const auto &connection : automaton.nodeConnections) {
-    const auto &generatorIdx = generatorIdToIndex_.find(connection.connectedElementId);
-    const auto &hvdcIt = hvdcDefinitions_.hvdcLines.find(connection.connectedElementId);
-    if (generatorIdx != generatorIdToIndex_.end()) {
-      const auto &genDefinition = generatorDefinitions_[generatorIdx->second];
+    const auto generatorIdx = definitionsIndex_.generator(connection.connectedElementId);
+    const auto hvdcDefinitionPtr = definitionsIndex_.hvdcLine(connection.connectedElementId);
+    if (generatorIdx) {
+      const auto &genDefinition = generatorDefinitions_[*generatorIdx];
 
       auto it = regulatorIdToInitialIndex.find(genDefinition.id);
       if (it != regulatorIdToInitialIndex.end()) {
@@ -120,8 +112,8 @@ std::shared_ptr<parameters::ParametersSet> ParDynModel::writeSVCParameterSet(con
                                                      (genDefinition.isNuclear) ? constants::generatorNucXPuValue : constants::generatorXPuValue));
 
       ++idx;
-    } else if (hvdcIt != hvdcDefinitions_.hvdcLines.end()) {
-      const auto &hvdcDefinition = hvdcIt->second;
+    } else if (hvdcDefinitionPtr) {
+      const auto &hvdcDefinition = *hvdcDefinitionPtr;
       auto it = regulatorIdToInitialIndex.find(hvdcDefinition.id);
       if (it != regulatorIdToInitialIndex.end()) {
         assert(genInitialParamToValues.find("Qr_" + std::to_string(it->second)) != genInitialParamToValues.end());
@@ -149,8 +141,7 @@ std::shared_ptr<parameters::ParametersSet> ParDynModel::writeSVCParameterSet(con
 std::shared_ptr<parameters::ParametersSet>
 ParDynModel::writeDynamicModelParameterSet(const inputs::SettingDataBase::Set &set, const inputs::DynamicDataBaseManager &dynamicDataBaseManager,
                                            const algo::DynamicModelDefinition &automaton, const algo::ShuntCounterDefinitions &counters,
-                                           const algo::DynamicModelDefinitions &models, const algo::LinesByIdDefinitions &linesById,
-                                           const algo::TransformersByIdDefinitions &tfosById) {
+                                           const algo::DynamicModelDefinitions &models) {
   if (models.models.count(set.id) == 0) {
     // model is not connected : ignore corresponding set
     return nullptr;
@@ -246,7 +237,7 @@ ParDynModel::writeDynamicModelParameterSet(const inputs::SettingDataBase::Set &s
 
   for (const auto &ref : set.refs) {
     if (ref.tag == constants::seasonTag) {
-      auto seasonOpt = getActiveSeason(ref, linesById, tfosById, dynamicDataBaseManager);
+      auto seasonOpt = getActiveSeason(ref, dynamicDataBaseManager);
       if (!seasonOpt) {
         continue;
       }
@@ -259,8 +250,7 @@ ParDynModel::writeDynamicModelParameterSet(const inputs::SettingDataBase::Set &s
   return new_set;
 }
 
-boost::optional<std::string> ParDynModel::getActiveSeason(const inputs::SettingDataBase::Ref &ref, const algo::LinesByIdDefinitions &linesById,
-                                                          const algo::TransformersByIdDefinitions &tfosById,
+boost::optional<std::string> ParDynModel::getActiveSeason(const inputs::SettingDataBase::Ref &ref,
                                                           const inputs::DynamicDataBaseManager &dynamicDataBaseManager) {
   const auto &singleAssoc = dynamicDataBaseManager.assembling().getSingleAssociation(ref.id);
   if (!singleAssoc.line && !singleAssoc.tfo) {
@@ -269,22 +259,22 @@ boost::optional<std::string> ParDynModel::getActiveSeason(const inputs::SettingD
   }
   if (singleAssoc.line) {
     const auto &lineId = singleAssoc.line->name;
-    auto foundLine = linesById.linesMap.find(lineId);
-    if (foundLine == linesById.linesMap.end()) {
+    auto foundLine = definitionsIndex_.line(lineId);
+    if (!foundLine) {
       LOG(warn, RefDeviceNotFound, ref.name, ref.id, lineId);
       return boost::none;
     }
 
-    return foundLine->second.activeSeason;
+    return foundLine->activeSeason;
   } else {
     const auto &tfoId = singleAssoc.tfo->name;
-    auto found = tfosById.tfosMap.find(tfoId);
-    if (found == tfosById.tfosMap.end()) {
+    auto found = definitionsIndex_.tfo(tfoId);
+    if (!found) {
       LOG(warn, RefDeviceNotFound, ref.name, ref.id, tfoId);
       return boost::none;
     }
 
-    return found->second.activeSeason;
+    return found->activeSeason;
   }
 }
 
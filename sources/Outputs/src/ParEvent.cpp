@@ -32,35 +32,41 @@ namespace outputs {
 ParEvent::ParEvent(ParEventDefinition &&def) : def_{std::forward<ParEventDefinition>(def)} {}
 
 void ParEvent::write() {
-  using Type = dfl::inputs::ContingencyElement::Type;
   parameters::XmlExporter exporter;
 
   std::unique_ptr<parameters::ParametersSetCollection> parametersSets = parameters::ParametersSetCollectionFactory::newCollection();
   for (const auto &element : def_.contingency.elements) {
-    if (isNetwork(element.id)) {
-      parametersSets->addParametersSet(buildEventConnectedStatusDisconnection(element.id, def_.timeOfEvent));
-      continue;
-    }
-    switch (element.type) {
-    case Type::BRANCH:
-    case Type::LINE:
-    case Type::TWO_WINDINGS_TRANSFORMER:
-      parametersSets->addParametersSet(buildBranchDisconnection(element.id, def_.timeOfEvent));
-      break;
-    case Type::LOAD:
-    case Type::GENERATOR:
-    case Type::HVDC_LINE:
-    case Type::STATIC_VAR_COMPENSATOR:
-      parametersSets->addParametersSet(buildEventSetPointBooleanDisconnection(element.id, def_.timeOfEvent));
-      break;
-    default:
-      parametersSets->addParametersSet(buildEventConnectedStatusDisconnection(element.id, def_.timeOfEvent));
-    }
+    addElementSet(parametersSets, element, isNetwork(element.id), def_.timeOfEvent);
   }
 
   exporter.exportToFile(std::move(parametersSets), def_.filename, constants::xmlEncoding);
 }
 
+void ParEvent::addElementSet(const std::unique_ptr<parameters::ParametersSetCollection> &parametersSets, const inputs::ContingencyElement &element,
+                             bool isNetwork, const double timeOfEvent) {
+  using Type = dfl::inputs::ContingencyElement::Type;
+
+  if (isNetwork) {
+    parametersSets->addParametersSet(buildEventConnectedStatusDisconnection(element.id, timeOfEvent));
+    return;
+  }
+  switch (element.type) {
+  case Type::BRANCH:
+  case Type::LINE:
+  case Type::TWO_WINDINGS_TRANSFORMER:
+    parametersSets->addParametersSet(buildBranchDisconnection(element.id, timeOfEvent));
+    break;
+  case Type::LOAD:
+  case Type::GENERATOR:
+  case Type::HVDC_LINE:
+  case Type::STATIC_VAR_COMPENSATOR:
+    parametersSets->addParametersSet(buildEventSetPointBooleanDisconnection(element.id, timeOfEvent));
+    break;
+  default:
+    parametersSets->addParametersSet(buildEventConnectedStatusDisconnection(element.id, timeOfEvent));
+  }
+}
+
 std::shared_ptr<parameters::ParametersSet> ParEvent::buildBranchDisconnection(const std::string &branchId, const double timeOfEvent) {
   std::shared_ptr<parameters::ParametersSet> set = parameters::ParametersSetFactory::newParametersSet("Disconnect_" + branchId);
   set->addParameter(helper::buildParameter("event_tEvent", timeOfEvent));
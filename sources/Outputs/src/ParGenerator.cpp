@@ -17,47 +17,61 @@
 namespace dfl {
 namespace outputs {
 
-void ParGenerator::write(const std::unique_ptr<parameters::ParametersSetCollection> &paramSetCollection, ActivePowerCompensation activePowerCompensation,
+void ParGenerator::write(ParStream &paramSetCollection, ActivePowerCompensation activePowerCompensation,
                          const std::string &basename, const boost::filesystem::path &dirname, StartingPointMode startingPointMode,
-                         const inputs::DynamicDataBaseManager &dynamicDataBaseManager) {
+                         const inputs::DynamicDataBaseManager &dynamicDataBaseManager, bool singleDiagramFile) {
+  const auto diagramNames = algo::nameReactiveDiagrams(generatorDefinitions_);
   for (const auto &generator : generatorDefinitions_) {
     // if network model, nothing to do
     if (generator.isNetwork()) {
       continue;
     }
-    std::shared_ptr<parameters::ParametersSet> paramSet;
-    if (helper::generatorSharesParId(generator)) {
-      if (!paramSetCollection->hasParametersSet(helper::getGeneratorParameterSetId(generator))) {
-        paramSet = writeConstantGeneratorsSets(activePowerCompensation, generator, startingPointMode);
-      }
-    } else {
+    // the generators sharing a set add it once
+    const std::string parId = helper::getGeneratorParameterSetId(generator);
+    if (paramSetCollection.hasParametersSet(parId)) {
+      continue;
+    }
+    std::string diagramName;
+    if (!helper::generatorSharesParId(generator)) {
       // we check if the macroParameterSet need by generator model is not already created. If not, we create a new one
-      if (!paramSetCollection->hasMacroParametersSet(getGeneratorMacroParameterSetId(generator.model, DYN::doubleIsZero(generator.targetP)))) {
-        paramSetCollection->addMacroParameterSet(buildGeneratorMacroParameterSet(generator, activePowerCompensation, generator.targetP, startingPointMode));
+      const std::string macroParId = getGeneratorMacroParameterSetId(generator.model, DYN::doubleIsZero(generator.targetP));
+      if (!paramSetCollection.hasMacroParametersSet(macroParId)) {
+        paramSetCollection.addMacroParameterSet(macroParId, [this, &generator, activePowerCompensation, startingPointMode]() {
+          return buildGeneratorMacroParameterSet(generator, activePowerCompensation, generator.targetP, startingPointMode);
+        });
       }
       // if generator is not using infinite diagrams, no need to create constant sets
-      paramSet = writeGenerator(generator, basename, dirname);
+      auto diagramNameIt = diagramNames.find(generator.diagram.get());
+      diagramName = diagramNameIt != diagramNames.end() ? diagramNameIt->second : generator.id;
     }
 
-    if (paramSet && generator.hasRpcl()) {
-      updateRpclParameters(paramSet, generator.id,
-                           dynamicDataBaseManager.setting().getSet(dynamicDataBaseManager.assembling().getSingleAssociationFromGenerator(generator.id)),
-                           generator.hasRpcl2());
-      if (!generator.isUsingDiagram()) {
-        updateSignalNGenerator(paramSet, activePowerCompensation, generator.targetP, startingPointMode, generator.hasActivePowerControl);
+    paramSetCollection.addParametersSet(parId, [this, &generator, activePowerCompensation, &basename, &dirname, startingPointMode, &dynamicDataBaseManager,
+                                                singleDiagramFile, diagramName]() {
+      std::shared_ptr<parameters::ParametersSet> paramSet;
+      if (helper::generatorSharesParId(generator)) {
+        paramSet = writeConstantGeneratorsSets(activePowerCompensation, generator, startingPointMode);
+      } else {
+        paramSet = writeGenerator(generator, diagramName, basename, dirname, singleDiagramFile);
       }
-    }
-    if (paramSet && generator.hasTransformer()) {
-      updateTransfoParameters(paramSet, generator.isNuclear);
-    }
 
-    // adding parameter specific to remote voltage regulation for a generator and that cannot be included in a macroParameter
-    if (paramSet && generator.isRegulatingRemotely()) {
-      updateRemoteRegulationParameters(generator, paramSet);
-    }
-    if (paramSet && !paramSetCollection->hasParametersSet(paramSet->getId())) {
-      paramSetCollection->addParametersSet(paramSet);
-    }
+      if (generator.hasRpcl()) {
+        updateRpclParameters(paramSet, generator.id,
+                             dynamicDataBaseManager.setting().getSet(dynamicDataBaseManager.assembling().getSingleAssociationFromGenerator(generator.id)),
+                             generator.hasRpcl2());
+        if (!generator.isUsingDiagram()) {
+          updateSignalNGenerator(paramSet, activePowerCompensation, generator.targetP, startingPointMode, generator.hasActivePowerControl);
+        }
+      }
+      if (generator.hasTransformer()) {
+        updateTransfoParameters(paramSet, generator.isNuclear);
+      }
+
+      // adding parameter specific to remote voltage regulation for a generator and that cannot be included in a macroParameter
+      if (generator.isRegulatingRemotely()) {
+        updateRemoteRegulationParameters(generator, paramSet);
+      }
+      return paramSet;
+    });
   }
 }
 
@@ -258,8 +272,9 @@ void ParGenerator::updateRemoteRegulationParameters(const algo::GeneratorDefinit
   set->addReference(helper::buildReference("generator_URegulated0", "U", "DOUBLE", def.regulatedBusId));
 }
 
-std::shared_ptr<parameters::ParametersSet> ParGenerator::writeGenerator(const algo::GeneratorDefinition &def, const std::string &basename,
-                                                                        const boost::filesystem::path &dirname) {
+std::shared_ptr<parameters::ParametersSet> ParGenerator::writeGenerator(const algo::GeneratorDefinition &def, const std::string &diagramName,
+                                                                        const std::string &basename, const boost::filesystem::path &dirname,
+                                                                        bool singleDiagramFile) {
   std::string uuid = constants::uuid(def.id);
 
   //  Use the hash id in exported files to prevent use of non-ascii characters
@@ -269,13 +284,13 @@ std::shared_ptr<parameters::ParametersSet> ParGenerator::writeGenerator(const al
       std::unique_ptr<parameters::MacroParSet>(new parameters::MacroParSet(getGeneratorMacroParameterSetId(def.model, DYN::doubleIsZero(def.targetP)))));
 
   if (!def.isUsingRectangularDiagram()) {
-    auto dirname_diagram = dirname;
-    dirname_diagram.append(basename + common::constants::diagramDirectorySuffix).append(constants::diagramFilename(def.id));
+    auto dirname_diagram = helper::getDiagramFilepath(dirname, basename, diagramName, singleDiagramFile);
 
+    const auto &diagramUuid = constants::uuid(diagramName);
     set->addParameter(helper::buildParameter("generator_QMaxTableFile", dirname_diagram.generic_string()));
-    set->addParameter(helper::buildParameter("generator_QMaxTableName", uuid + constants::diagramMaxTableSuffix));
+    set->addParameter(helper::buildParameter("generator_QMaxTableName", diagramUuid + constants::diagramMaxTableSuffix));
     set->addParameter(helper::buildParameter("generator_QMinTableFile", dirname_diagram.generic_string()));
-    set->addParameter(helper::buildParameter("generator_QMinTableName", uuid + constants::diagramMinTableSuffix));
+    set->addParameter(helper::buildParameter("generator_QMinTableName", diagramUuid + constants::diagramMinTableSuffix));
   }
   return set;
 }
@@ -17,11 +17,15 @@
 namespace dfl {
 namespace outputs {
 
-void ParHvdc::write(const std::unique_ptr<parameters::ParametersSetCollection> &paramSetCollection, const std::string &basename,
+void ParHvdc::write(ParStream &paramSetCollection, const std::string &basename,
                     const boost::filesystem::path &dirname, dfl::inputs::Configuration::StartingPointMode startingPointMode,
-                    const inputs::DynamicDataBaseManager &dynamicDataBaseManager) {
+                    const inputs::DynamicDataBaseManager &dynamicDataBaseManager, bool singleDiagramFile) {
   for (const auto &hvdcLine : hvdcDefinitions_.hvdcLines) {
-    paramSetCollection->addParametersSet(writeHdvcLine(hvdcLine.second, basename, dirname, startingPointMode, dynamicDataBaseManager));
+    const auto &hvdcDefinition = hvdcLine.second;
+    paramSetCollection.addParametersSet(hvdcDefinition.id, [this, &hvdcDefinition, &basename, &dirname, startingPointMode, &dynamicDataBaseManager,
+                                                            singleDiagramFile]() {
+      return writeHdvcLine(hvdcDefinition, basename, dirname, startingPointMode, dynamicDataBaseManager, singleDiagramFile);
+    });
   }
 }
 
@@ -57,18 +61,14 @@ std::pair<double, double> ParHvdc::computeFlatP1RefSetPu(const algo::HVDCDefinit
 std::shared_ptr<parameters::ParametersSet> ParHvdc::writeHdvcLine(const algo::HVDCDefinition &hvdcDefinition, const std::string &basename,
                                                                   const boost::filesystem::path &dirname,
                                                                   dfl::inputs::Configuration::StartingPointMode startingPointMode,
-                                                                  const inputs::DynamicDataBaseManager &dynamicDataBaseManager) {
-  auto dirnameDiagram = dirname;
-  dirnameDiagram.append(basename + common::constants::diagramDirectorySuffix);
-
+                                                                  const inputs::DynamicDataBaseManager &dynamicDataBaseManager, bool singleDiagramFile) {
   // Define this function as a lambda instead of a class function to avoid too much arguments that would make it less readable
-  auto updateHVDCParams = [&hvdcDefinition, &dirnameDiagram, &dynamicDataBaseManager](std::shared_ptr<parameters::ParametersSet> set,
-                                                                                      const algo::HVDCDefinition::ConverterId &converterId,
-                                                                                      size_t converterNumber, size_t parameterNumber) {
+  auto updateHVDCParams = [&hvdcDefinition, &basename, &dirname, singleDiagramFile, &dynamicDataBaseManager](
+                              std::shared_ptr<parameters::ParametersSet> set, const algo::HVDCDefinition::ConverterId &converterId, size_t converterNumber,
+                              size_t parameterNumber) {
     constexpr double factorPU = 100;
     std::string uuid = constants::uuid(converterId);
-    auto dirnameDiagramLocal = dirnameDiagram;
-    dirnameDiagramLocal.append(constants::diagramFilename(converterId));
+    auto dirnameDiagramLocal = helper::getDiagramFilepath(dirname, basename, converterId, singleDiagramFile);
     set->addParameter(helper::buildParameter("hvdc_QInj" + std::to_string(parameterNumber) + "MinTableFile", dirnameDiagramLocal.generic_string()));
     set->addParameter(helper::buildParameter("hvdc_QInj" + std::to_string(parameterNumber) + "MinTableName", uuid + constants::diagramMinTableSuffix));
     set->addParameter(helper::buildParameter("hvdc_QInj" + std::to_string(parameterNumber) + "MaxTableFile", dirnameDiagramLocal.generic_string()));
@@ -16,10 +16,10 @@ namespace dfl {
 namespace outputs {
 
 void
-ParLoads::write(const std::unique_ptr<parameters::ParametersSetCollection>& paramSetCollection,
+ParLoads::write(ParStream& paramSetCollection,
                 dfl::inputs::Configuration::StartingPointMode startingPointMode) {
   if (!loadsDefinitions_.empty()) {
-    paramSetCollection->addParametersSet(writeConstantLoadsSet(startingPointMode));
+    paramSetCollection.addParametersSet(constants::loadParId, [this, startingPointMode]() { return writeConstantLoadsSet(startingPointMode); });
   }
 }
 
@@ -19,15 +19,16 @@ namespace outputs {
 
 const std::string ParSVarC::macroParameterSetStaticCompensator_("MacroParameterSetStaticCompensator");
 
-void ParSVarC::write(const std::unique_ptr<parameters::ParametersSetCollection> &paramSetCollection,
+void ParSVarC::write(ParStream &paramSetCollection,
                      dfl::inputs::Configuration::StartingPointMode startingPointMode) {
   if (!svarcsDefinitions_.empty()) {
-    paramSetCollection->addMacroParameterSet(writeMacroParameterSetStaticVarCompensators(startingPointMode));
+    paramSetCollection.addMacroParameterSet(macroParameterSetStaticCompensator_,
+                                            [this, startingPointMode]() { return writeMacroParameterSetStaticVarCompensators(startingPointMode); });
     for (const auto &svarc : svarcsDefinitions_) {
       if (svarc.isNetwork()) {
         continue;
       }
-      paramSetCollection->addParametersSet(writeStaticVarCompensator(svarc));
+      paramSetCollection.addParametersSet(constants::uuid(svarc.id), [this, &svarc]() { return writeStaticVarCompensator(svarc); });
     }
   }
 }
@@ -0,0 +1,108 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  ParStream.cpp
+ *
+ * @brief Streaming PAR file writer implementation file
+ *
+ */
+
+#include "ParStream.h"
+
+#include "Log.h"
+#include "OutputsConstants.h"
+
+#include <PARParametersSetCollectionFactory.h>
+#include <PARXmlExporter.h>
+#include <algorithm>
+#include <sstream>
+
+namespace dfl {
+namespace outputs {
+
+ParStream::ParStream(std::ostream &stream, std::size_t batchSize)
+    : writer_{stream}, batchSize_{std::max<std::size_t>(batchSize, 1)}, batch_{parameters::ParametersSetCollectionFactory::newCollection()} {}
+
+std::vector<XmlSections::SectionDefinition>
+ParStream::sectionDefinitions() {
+  return {{"macroParameterSet", true}, {"set", true}};
+}
+
+void
+ParStream::addParametersSet(const std::string &id, SetBuilder builder) {
+  if (!sets_.emplace(id, std::move(builder)).second) {
+    throw DFLError(XmlElementNotUnique, "set", id);
+  }
+}
+
+void
+ParStream::addMacroParameterSet(const std::string &id, MacroSetBuilder builder) {
+  if (!macroSets_.emplace(id, std::move(builder)).second) {
+    throw DFLError(XmlElementNotUnique, "macroParameterSet", id);
+  }
+}
+
+bool
+ParStream::hasParametersSet(const std::string &id) const {
+  return sets_.count(id) > 0;
+}
+
+bool
+ParStream::hasMacroParametersSet(const std::string &id) const {
+  return macroSets_.count(id) > 0;
+}
+
+void
+ParStream::write() {
+  for (const auto &macroSet : macroSets_) {
+    batch_->addMacroParameterSet(macroSet.second());
+    added();
+  }
+  flush();
+  for (const auto &set : sets_) {
+    auto parametersSet = set.second();
+    if (parametersSet) {
+      batch_->addParametersSet(parametersSet);
+      added();
+    }
+  }
+  flush();
+  macroSets_.clear();
+  sets_.clear();
+
+  parameters::XmlExporter exporter;
+  std::stringstream emptyDocument;
+  exporter.exportToStream(parameters::ParametersSetCollectionFactory::newCollection(), emptyDocument, constants::xmlEncoding);
+  writer_.close(emptyDocument.str());
+}
+
+void
+ParStream::added() {
+  if (++batchCount_ == batchSize_) {
+    flush();
+  }
+}
+
+void
+ParStream::flush() {
+  if (batchCount_ == 0) {
+    return;
+  }
+  parameters::XmlExporter exporter;
+  std::stringstream document;
+  exporter.exportToStream(std::move(batch_), document, constants::xmlEncoding);
+  writer_.write(document.str());
+  batch_ = parameters::ParametersSetCollectionFactory::newCollection();
+  batchCount_ = 0;
+}
+
+}  // namespace outputs
+}  // namespace dfl
@@ -12,10 +12,12 @@
 
 #include "ParCommon.h"
 
+#include <set>
+
 namespace dfl {
 namespace outputs {
 
-void ParVRRemote::writeVRRemotes(const std::unique_ptr<parameters::ParametersSetCollection>& paramSetCollection) {
+void ParVRRemote::writeVRRemotes(ParStream& paramSetCollection) {
   std::unordered_map<algo::GeneratorDefinitionAlgorithm::BusId, bool> componentToFrozen;
   for (const auto &busId2Number : busesToNumberOfRegulationMap_)
     if (busId2Number.second == dfl::inputs::NetworkManager::NbOfRegulating::MULTIPLES)
@@ -49,47 +51,48 @@ void ParVRRemote::writeVRRemotes(const std::unique_ptr<parameters::ParametersSet
       assert(busesToNumberOfRegulationMap_.find(keyValue.regulatedBusId) != busesToNumberOfRegulationMap_.end());
       if (handledBus.find(keyValue.regulatedBusId) != handledBus.end())
         continue;
-      if (!paramSetCollection->hasMacroParametersSet(helper::getMacroParameterSetId(constants::remoteVControlVRParId))) {
-        paramSetCollection->addMacroParameterSet(helper::buildMacroParameterSetVRRemote(helper::getMacroParameterSetId(constants::remoteVControlVRParId)));
-      }
-      auto VRRemoteParamSet = helper::writeVRRemote(keyValue.regulatedBusId, keyValue.id);
-      if (componentToFrozen[keyValue.regulatedBusId])
-        VRRemoteParamSet->addParameter(helper::buildParameter("vrremote_Frozen0", true));
-      paramSetCollection->addParametersSet(VRRemoteParamSet);
+      addMacroParameterSetVRRemote(paramSetCollection);
+      addVRRemote(paramSetCollection, keyValue.regulatedBusId, keyValue.id, componentToFrozen[keyValue.regulatedBusId]);
       handledBus.insert(keyValue.regulatedBusId);
     }
   }
 
   for (const auto &keyValue : hvdcDefinitions_.hvdcLines) {
-    algo::HVDCDefinition hvdcLine = keyValue.second;
+    const auto &hvdcLine = keyValue.second;
     if (hvdcLine.hasPQPropModel()) {
       const algo::HVDCDefinition::BusId &busId1 =
           (hvdcLine.position == algo::HVDCDefinition::Position::SECOND_IN_MAIN_COMPONENT) ? hvdcLine.converter2BusId : hvdcLine.converter1BusId;
       const auto &vscStation = (hvdcLine.position == algo::HVDCDefinition::Position::SECOND_IN_MAIN_COMPONENT) ? hvdcLine.converter2Id : hvdcLine.converter1Id;
       if (handledBus.find(busId1) == handledBus.end()) {
-        if (!paramSetCollection->hasMacroParametersSet(helper::getMacroParameterSetId(constants::remoteVControlVRParId))) {
-          paramSetCollection->addMacroParameterSet(helper::buildMacroParameterSetVRRemote(helper::getMacroParameterSetId(constants::remoteVControlVRParId)));
-        }
-        auto VRRemoteParamSet = helper::writeVRRemote(busId1, vscStation);
-        if (componentToFrozen[busId1])
-          VRRemoteParamSet->addParameter(helper::buildParameter("vrremote_Frozen0", true));
-        paramSetCollection->addParametersSet(VRRemoteParamSet);
+        addMacroParameterSetVRRemote(paramSetCollection);
+        addVRRemote(paramSetCollection, busId1, vscStation, componentToFrozen[busId1]);
         handledBus.insert(busId1);
       }
 
       if (hvdcLine.position == algo::HVDCDefinition::Position::BOTH_IN_MAIN_COMPONENT && handledBus.find(hvdcLine.converter2BusId) == handledBus.end()) {
-        if (!paramSetCollection->hasMacroParametersSet(helper::getMacroParameterSetId(constants::remoteVControlVRParId))) {
-          paramSetCollection->addMacroParameterSet(helper::buildMacroParameterSetVRRemote(helper::getMacroParameterSetId(constants::remoteVControlVRParId)));
-        }
-        auto VRRemoteParamSet = helper::writeVRRemote(hvdcLine.converter2BusId, hvdcLine.converter2Id);
-        if (componentToFrozen[hvdcLine.converter2BusId])
-          VRRemoteParamSet->addParameter(helper::buildParameter("vrremote_Frozen0", true));
-        paramSetCollection->addParametersSet(VRRemoteParamSet);
+        addMacroParameterSetVRRemote(paramSetCollection);
+        addVRRemote(paramSetCollection, hvdcLine.converter2BusId, hvdcLine.converter2Id, componentToFrozen[hvdcLine.converter2BusId]);
         handledBus.insert(hvdcLine.converter2BusId);
       }
     }
   }
 }
 
+void ParVRRemote::addMacroParameterSetVRRemote(ParStream &paramSetCollection) {
+  const std::string macroParId = helper::getMacroParameterSetId(constants::remoteVControlVRParId);
+  if (!paramSetCollection.hasMacroParametersSet(macroParId)) {
+    paramSetCollection.addMacroParameterSet(macroParId, [macroParId]() { return helper::buildMacroParameterSetVRRemote(macroParId); });
+  }
+}
+
+void ParVRRemote::addVRRemote(ParStream &paramSetCollection, const std::string &busId, const std::string &elementId, bool frozen) {
+  paramSetCollection.addParametersSet(constants::modelSignalNQprefix_ + busId, [&busId, &elementId, frozen]() {
+    auto VRRemoteParamSet = helper::writeVRRemote(busId, elementId);
+    if (frozen)
+      VRRemoteParamSet->addParameter(helper::buildParameter("vrremote_Frozen0", true));
+    return VRRemoteParamSet;
+  });
+}
+
 }  // namespace outputs
 }  // namespace dfl
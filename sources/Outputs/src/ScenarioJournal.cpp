@@ -0,0 +1,65 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  ScenarioJournal.cpp
+ *
+ * @brief Journal of the results of the security analysis scenarios implementation file
+ *
+ */
+
+#include "ScenarioJournal.h"
+
+#include "Log.h"
+
+#include <boost/property_tree/json_parser.hpp>
+#include <sstream>
+
+namespace dfl {
+namespace outputs {
+
+std::vector<ScenarioJournal::Entry> ScenarioJournal::read(const boost::filesystem::path &filepath) {
+  std::vector<Entry> entries;
+  std::ifstream in(filepath.c_str(), std::ios::binary);
+  std::string line;
+  while (std::getline(in, line)) {
+    try {
+      std::istringstream lineStream(line);
+      boost::property_tree::ptree entryTree;
+      boost::property_tree::json_parser::read_json(lineStream, entryTree);
+      entries.push_back(Entry{entryTree.get<std::string>("id"), entryTree.get<std::string>("key"), entryTree.get<std::string>("result")});
+    } catch (const boost::property_tree::ptree_error &) {
+      // the run was interrupted while writing this entry
+    }
+  }
+  return entries;
+}
+
+ScenarioJournal::ScenarioJournal(const boost::filesystem::path &filepath) : filepath_(filepath), file_(filepath.c_str(), std::ios::binary | std::ios::trunc) {
+  if (!file_) {
+    throw DFLError(FileCreationFailed, filepath_.generic_string());
+  }
+}
+
+void ScenarioJournal::append(const Entry &entry) {
+  boost::property_tree::ptree entryTree;
+  entryTree.put("id", entry.id);
+  entryTree.put("key", entry.key);
+  entryTree.put("result", entry.result);
+  // without pretty printing, each entry is written on a single line
+  boost::property_tree::json_parser::write_json(file_, entryTree, false);
+  file_.flush();
+  if (!file_) {
+    throw DFLError(FileCreationFailed, filepath_.generic_string());
+  }
+}
+
+}  // namespace outputs
+}  // namespace dfl
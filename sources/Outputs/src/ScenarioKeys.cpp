@@ -0,0 +1,127 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  ScenarioKeys.cpp
+ *
+ * @brief Keys of the inputs of the security analysis scenarios implementation file
+ *
+ */
+
+#include "ScenarioKeys.h"
+
+#include "SnapshotIO.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <limits>
+
+namespace file = boost::filesystem;
+
+namespace dfl {
+namespace outputs {
+
+namespace helper {
+
+static const std::uint32_t scenarioKeyFormatVersion = 2;  ///< version of the layout of the results stored under the keys, part of the keys
+
+/**
+ * @brief Update a hash with the size of a content, that separates it from the next one
+ *
+ * @param hash the hash to update
+ * @param size the size of the content, the maximum value for a missing file
+ * @returns the updated hash
+ */
+static std::uint64_t
+hashSize(std::uint64_t hash, std::uint64_t size) {
+  return inputs::snapshot::hashBytes(hash, reinterpret_cast<const char *>(&size), sizeof(size));
+}
+
+/**
+ * @brief Update a hash with the content of a file
+ *
+ * @param hash the hash to update
+ * @param filepath the file path
+ * @returns the updated hash
+ */
+static std::uint64_t
+hashFile(std::uint64_t hash, const file::path &filepath) {
+  // a missing file is hashed with a size no file can have
+  std::uint64_t size = std::numeric_limits<std::uint64_t>::max();
+  std::ifstream in(filepath.c_str(), std::ios::binary);
+  if (in) {
+    std::vector<char> buffer(1 << 16);
+    size = 0;
+    do {
+      in.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+      const auto count = static_cast<std::size_t>(in.gcount());
+      hash = inputs::snapshot::hashBytes(hash, buffer.data(), count);
+      size += count;
+    } while (in);
+  }
+  return hashSize(hash, size);
+}
+
+}  // namespace helper
+
+ScenarioKeys::ScenarioKeys(const std::vector<boost::filesystem::path> &commonInputs, const std::vector<boost::filesystem::path> &commonGeneratedInputs,
+                           const std::vector<std::string> &locations)
+    : commonHash_(inputs::snapshot::hashSeed) {
+  for (std::size_t i = 0; i < locations.size(); ++i) {
+    if (!locations[i].empty()) {
+      // control characters do not appear in the generated files, so that a replaced location cannot be mistaken for their text
+      replacements_.emplace_back(locations[i], "\x01" + std::to_string(i) + "\x01");
+    }
+  }
+  // a location containing another one is replaced first, such as a file of the output directory
+  typedef std::pair<std::string, std::string> Replacement;
+  std::stable_sort(replacements_.begin(), replacements_.end(),
+                   [](const Replacement &lhs, const Replacement &rhs) { return lhs.first.size() > rhs.first.size(); });
+
+  for (const auto &filepath : commonInputs) {
+    commonHash_ = helper::hashFile(commonHash_, filepath);
+  }
+  for (const auto &filepath : commonGeneratedInputs) {
+    commonHash_ = hashGeneratedFile(commonHash_, filepath);
+  }
+}
+
+std::uint64_t
+ScenarioKeys::hashGeneratedFile(std::uint64_t hash, const boost::filesystem::path &filepath) const {
+  std::ifstream in(filepath.c_str(), std::ios::binary);
+  if (!in) {
+    return helper::hashSize(hash, std::numeric_limits<std::uint64_t>::max());
+  }
+  std::string content((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+  for (const auto &replacement : replacements_) {
+    std::string replaced;
+    std::size_t start = 0;
+    for (auto found = content.find(replacement.first); found != std::string::npos; found = content.find(replacement.first, start)) {
+      replaced.append(content, start, found - start).append(replacement.second);
+      start = found + replacement.first.size();
+    }
+    replaced.append(content, start, std::string::npos);
+    content.swap(replaced);
+  }
+  hash = inputs::snapshot::hashBytes(hash, content.data(), content.size());
+  return helper::hashSize(hash, content.size());
+}
+
+std::string ScenarioKeys::compute(const std::vector<boost::filesystem::path> &scenarioInputs) const {
+  std::uint64_t hash = commonHash_;
+  for (const auto &filepath : scenarioInputs) {
+    hash = hashGeneratedFile(hash, filepath);
+  }
+  return inputs::snapshot::formatKey(hash, helper::scenarioKeyFormatVersion);
+}
+
+}  // namespace outputs
+}  // namespace dfl
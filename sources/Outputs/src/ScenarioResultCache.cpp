@@ -0,0 +1,245 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  ScenarioResultCache.cpp
+ *
+ * @brief Persistent cache of the results of the security analysis scenarios implementation file
+ *
+ */
+
+#include "ScenarioResultCache.h"
+
+#include "Log.h"
+
+#include <algorithm>
+#include <cctype>
+#include <ctime>
+#include <fstream>
+#include <sstream>
+#include <tuple>
+
+namespace file = boost::filesystem;
+
+namespace dfl {
+namespace outputs {
+
+namespace helper {
+
+static const char resultFileName[] = "result.xml";       ///< name of the file holding the result of the scenario in an entry
+static const char scenarioDirectoryName[] = "scenario";  ///< name of the copy of the directory of the scenario in an entry
+static const char filesDirectoryName[] = "files";        ///< name of the copy of the files named after the scenario in an entry
+static const char temporaryMarker[] = ".tmp-";           ///< marker of the entries being written
+
+/**
+ * @brief Copy a file, replacing the destination if it exists
+ *
+ * @param from the file to copy
+ * @param to the destination of the copy
+ */
+static void
+copyFile(const file::path &from, const file::path &to) {
+  file::create_directories(to.parent_path());
+  file::remove(to);
+  file::copy_file(from, to);
+}
+
+/**
+ * @brief Compute the size of the files of a directory and its subdirectories
+ *
+ * @param directory the directory
+ * @returns the size of the files, in bytes
+ */
+static std::uintmax_t
+directorySize(const file::path &directory) {
+  std::uintmax_t size = 0;
+  for (file::recursive_directory_iterator it(directory), end; it != end; ++it) {
+    if (file::is_regular_file(it->status())) {
+      size += file::file_size(it->path());
+    }
+  }
+  return size;
+}
+
+/**
+ * @brief Find the scenario a file of a subdirectory of the output directory is named after
+ *
+ * The files of the subdirectories of the output directory are named after the subdirectory, whatever the case, and the scenario,
+ * as "constraints/constraints_<id>.xml"
+ *
+ * @param filepath the file path
+ * @returns the id of the scenario, empty if the file is not named after a scenario
+ */
+static std::string
+scenarioIdOf(const file::path &filepath) {
+  const std::string prefix = filepath.parent_path().filename().generic_string() + "_";
+  const std::string stem = filepath.stem().generic_string();
+  if (stem.size() <= prefix.size() ||
+      !std::equal(prefix.begin(), prefix.end(), stem.begin(),
+                  [](char lhs, char rhs) { return std::tolower(static_cast<unsigned char>(lhs)) == std::tolower(static_cast<unsigned char>(rhs)); })) {
+    return "";
+  }
+  return stem.substr(prefix.size());
+}
+
+}  // namespace helper
+
+ScenarioResultCache::ScenarioResultCache(const boost::filesystem::path &directory, std::uintmax_t maxSize) : directory_(directory), maxSize_(maxSize) {}
+
+boost::filesystem::path ScenarioResultCache::entryPath(const std::string &key) const {
+  return directory_ / key;
+}
+
+ScenarioResultCache::OutputFiles ScenarioResultCache::listOutputFiles(const boost::filesystem::path &outputDirectory,
+                                                                     const std::unordered_set<std::string> &scenarioIds) {
+  OutputFiles outputFiles;
+  for (file::directory_iterator it(outputDirectory), end; it != end; ++it) {
+    if (!file::is_directory(it->status())) {
+      continue;
+    }
+    const std::string name = it->path().filename().generic_string();
+    if (scenarioIds.count(name) > 0) {
+      auto &files = outputFiles[name];
+      for (file::recursive_directory_iterator fileIt(it->path()), fileEnd; fileIt != fileEnd; ++fileIt) {
+        if (file::is_regular_file(fileIt->status())) {
+          files.push_back(file::relative(fileIt->path(), outputDirectory));
+        }
+      }
+      continue;
+    }
+    for (file::directory_iterator fileIt(it->path()), fileEnd; fileIt != fileEnd; ++fileIt) {
+      const std::string scenarioId = helper::scenarioIdOf(fileIt->path());
+      if (file::is_regular_file(fileIt->status()) && scenarioIds.count(scenarioId) > 0) {
+        outputFiles[scenarioId].push_back(file::relative(fileIt->path(), outputDirectory));
+      }
+    }
+  }
+  return outputFiles;
+}
+
+bool ScenarioResultCache::contains(const std::string &key) const {
+  boost::system::error_code ec;
+  return file::is_regular_file(entryPath(key) / helper::resultFileName, ec);
+}
+
+void ScenarioResultCache::store(const std::string &key, const std::string &result, const boost::filesystem::path &outputDirectory,
+                                const std::string &scenarioId, const std::vector<boost::filesystem::path> &files) const {
+  file::path temporaryPath;
+  try {
+    file::create_directories(directory_);
+    temporaryPath = directory_ / file::unique_path(key + helper::temporaryMarker + "%%%%-%%%%-%%%%");
+    file::create_directories(temporaryPath);
+
+    std::ofstream resultFile((temporaryPath / helper::resultFileName).c_str(), std::ios::binary);
+    resultFile << result;
+    resultFile.close();
+    if (!resultFile) {
+      throw DFLError(FileCreationFailed, (temporaryPath / helper::resultFileName).generic_string());
+    }
+
+    // output files are stored without the id of the scenario, so that they can be restored for another scenario of the same inputs
+    for (const auto &filepath : files) {
+      const auto first = filepath.begin();
+      file::path storedPath;
+      if (*first == scenarioId) {
+        storedPath = file::path(helper::scenarioDirectoryName) / file::relative(filepath, *first);
+      } else {
+        const std::string stem = filepath.stem().generic_string();
+        storedPath = file::path(helper::filesDirectoryName) / filepath.parent_path() /
+                     (stem.substr(0, stem.size() - scenarioId.size() - 1) + filepath.extension().generic_string());
+      }
+      helper::copyFile(outputDirectory / filepath, temporaryPath / storedPath);
+    }
+
+    file::rename(temporaryPath, entryPath(key));
+  } catch (const std::exception &e) {
+    boost::system::error_code ec;
+    file::remove_all(temporaryPath, ec);
+    // an entry stored by a concurrent run for the same key is as good as ours
+    if (!contains(key)) {
+      LOG(warn, ResultCacheStoreFailed, scenarioId, entryPath(key).generic_string(), e.what());
+    }
+  }
+}
+
+bool ScenarioResultCache::restore(const std::string &key, const boost::filesystem::path &outputDirectory, const std::string &scenarioId,
+                                  std::string &result) const {
+  const file::path path = entryPath(key);
+  try {
+    std::ifstream resultFile((path / helper::resultFileName).c_str(), std::ios::binary);
+    if (!resultFile) {
+      return false;
+    }
+    std::ostringstream content;
+    content << resultFile.rdbuf();
+
+    const file::path scenarioDirectory = path / helper::scenarioDirectoryName;
+    if (file::is_directory(scenarioDirectory)) {
+      for (file::recursive_directory_iterator it(scenarioDirectory), end; it != end; ++it) {
+        if (file::is_regular_file(it->status())) {
+          helper::copyFile(it->path(), outputDirectory / scenarioId / file::relative(it->path(), scenarioDirectory));
+        }
+      }
+    }
+    const file::path filesDirectory = path / helper::filesDirectoryName;
+    if (file::is_directory(filesDirectory)) {
+      for (file::recursive_directory_iterator it(filesDirectory), end; it != end; ++it) {
+        if (file::is_regular_file(it->status())) {
+          const file::path subdirectory = file::relative(it->path().parent_path(), filesDirectory);
+          const std::string filename = it->path().stem().generic_string() + "_" + scenarioId + it->path().extension().generic_string();
+          helper::copyFile(it->path(), outputDirectory / subdirectory / filename);
+        }
+      }
+    }
+
+    // the entry is marked as recently used so that it is evicted last
+    file::last_write_time(path, std::time(nullptr));
+    result = content.str();
+    return true;
+  } catch (const std::exception &e) {
+    LOG(warn, ResultCacheRestoreFailed, scenarioId, path.generic_string(), e.what());
+    return false;
+  }
+}
+
+void ScenarioResultCache::evict() const {
+  try {
+    if (!file::is_directory(directory_)) {
+      return;
+    }
+    std::vector<std::tuple<std::time_t, std::uintmax_t, file::path>> entries;
+    std::uintmax_t size = 0;
+    for (file::directory_iterator it(directory_), end; it != end; ++it) {
+      // entries being written by a concurrent run are left alone
+      if (!file::is_directory(it->status()) || it->path().filename().generic_string().find(helper::temporaryMarker) != std::string::npos) {
+        continue;
+      }
+      entries.emplace_back(file::last_write_time(it->path()), helper::directorySize(it->path()), it->path());
+      size += std::get<1>(entries.back());
+    }
+    if (size <= maxSize_) {
+      return;
+    }
+
+    std::sort(entries.begin(), entries.end());
+    std::size_t nbEvicted = 0;
+    for (auto entry = entries.begin(); entry != entries.end() && size > maxSize_; ++entry) {
+      file::remove_all(std::get<2>(*entry));
+      size -= std::get<1>(*entry);
+      ++nbEvicted;
+    }
+    LOG(info, ResultCacheEvicted, nbEvicted, directory_.generic_string());
+  } catch (const std::exception &e) {
+    LOG(warn, ResultCacheEvictionFailed, directory_.generic_string(), e.what());
+  }
+}
+
+}  // namespace outputs
+}  // namespace dfl
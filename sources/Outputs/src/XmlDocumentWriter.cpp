@@ -0,0 +1,63 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  XmlDocumentWriter.cpp
+ *
+ * @brief XML document written a few top level elements at a time implementation file
+ *
+ */
+
+#include "XmlDocumentWriter.h"
+
+namespace dfl {
+namespace outputs {
+
+constexpr std::size_t XmlDocumentWriter::defaultBatchSize;
+
+namespace helper {
+
+std::size_t
+nextLine(const std::string &text, std::size_t position) {
+  const auto end = text.find('\n', position);
+  return end == std::string::npos ? text.size() : end + 1;
+}
+
+std::size_t
+contentStart(const std::string &document) {
+  std::size_t rootStart = 0;
+  while (rootStart < document.size() && (document.compare(rootStart, 2, "<?") == 0 || document.compare(rootStart, 2, "<!") == 0)) {
+    rootStart = nextLine(document, rootStart);
+  }
+  return nextLine(document, rootStart);
+}
+
+}  // namespace helper
+
+void
+XmlDocumentWriter::write(const std::string &document) {
+  const auto contentStart = helper::contentStart(document);
+  // the closing tag of the root element ends the document
+  const auto contentEnd = document.rfind("</");
+  if (!started_) {
+    stream_.write(document.data(), static_cast<std::streamsize>(contentStart));
+    footer_ = document.substr(contentEnd);
+    started_ = true;
+  }
+  stream_.write(document.data() + contentStart, static_cast<std::streamsize>(contentEnd - contentStart));
+}
+
+void
+XmlDocumentWriter::close(const std::string &emptyDocument) {
+  stream_ << (started_ ? footer_ : emptyDocument);
+}
+
+}  // namespace outputs
+}  // namespace dfl
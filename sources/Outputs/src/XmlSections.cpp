@@ -0,0 +1,150 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  XmlSections.cpp
+ *
+ * @brief XML document assembled from partial exports implementation file
+ *
+ */
+
+#include "XmlSections.h"
+
+#include "Log.h"
+#include "XmlDocumentWriter.h"
+
+#include <algorithm>
+
+namespace dfl {
+namespace outputs {
+
+namespace {
+
+/**
+ * @brief Determine if a line of text starts with a prefix
+ *
+ * @param text the text the line belongs to
+ * @param position the start of the line
+ * @param prefix the prefix to look for
+ * @returns true if the line starts with the prefix
+ */
+bool
+startsWith(const std::string &text, std::size_t position, const char *prefix) {
+  return text.compare(position, std::char_traits<char>::length(prefix), prefix) == 0;
+}
+
+}  // namespace
+
+XmlSections::XmlSections(const std::vector<SectionDefinition> &sections) {
+  for (const auto &definition : sections) {
+    sections_.push_back(Section{definition, {}, {}});
+  }
+}
+
+void
+XmlSections::merge(const std::string &document) {
+  const std::size_t contentStart = helper::contentStart(document);
+  const auto rootEnd = document.find_last_not_of(" \r\n", contentStart - 1);
+  if (rootEnd != std::string::npos && rootEnd > 0 && document.compare(rootEnd - 1, 2, "/>") == 0) {
+    // a part without element is exported with an empty root element
+    if (emptyDocument_.empty()) {
+      emptyDocument_ = document;
+    }
+    return;
+  }
+  if (header_.empty()) {
+    header_ = document.substr(0, contentStart);
+  }
+
+  // top level elements start with an indentation of one level, their children and their closing tags being indented further
+  std::size_t elementStart = std::string::npos;
+  for (auto position = contentStart; position < document.size(); position = helper::nextLine(document, position)) {
+    const bool isRootEnd = startsWith(document, position, "</");
+    const bool isElementStart = startsWith(document, position, "  <") && !startsWith(document, position, "  </");
+    if (!isRootEnd && !isElementStart) {
+      continue;
+    }
+    if (elementStart != std::string::npos) {
+      add(document.substr(elementStart, position - elementStart));
+    }
+    elementStart = position;
+    if (isRootEnd) {
+      if (footer_.empty()) {
+        footer_ = document.substr(position);
+      }
+      return;
+    }
+  }
+  if (elementStart != std::string::npos) {
+    add(document.substr(elementStart));
+  }
+}
+
+void
+XmlSections::add(const std::string &element) {
+  // opening tag, after the indentation and the namespace prefix
+  const auto tagEnd = element.find_first_of(" />\n", 3);
+  std::string tag = element.substr(3, tagEnd - 3);
+  const auto prefixEnd = tag.find(':');
+  if (prefixEnd != std::string::npos) {
+    tag = tag.substr(prefixEnd + 1);
+  }
+
+  auto &elementSection = section(tag);
+  if (elementSection.definition.sorted) {
+    std::string id;
+    const auto idStart = element.find(" id=\"");
+    if (idStart != std::string::npos) {
+      const auto valueStart = idStart + 5;
+      id = element.substr(valueStart, element.find('"', valueStart) - valueStart);
+    }
+    if (!elementSection.sortedElements.emplace(id, element).second) {
+      throw DFLError(XmlElementNotUnique, tag, id);
+    }
+  } else {
+    elementSection.orderedElements += element;
+  }
+  ++size_;
+}
+
+XmlSections::Section &
+XmlSections::section(const std::string &tag) {
+  auto found = std::find_if(sections_.begin(), sections_.end(), [&tag](const Section &section) { return section.definition.tag == tag; });
+  if (found != sections_.end()) {
+    return *found;
+  }
+  sections_.push_back(Section{SectionDefinition{tag, false}, {}, {}});
+  return sections_.back();
+}
+
+bool
+XmlSections::has(const std::string &tag, const std::string &id) const {
+  auto found = std::find_if(sections_.begin(), sections_.end(), [&tag](const Section &section) { return section.definition.tag == tag; });
+  return found != sections_.end() && found->sortedElements.count(id) > 0;
+}
+
+void
+XmlSections::write(std::ostream &stream) const {
+  if (size_ == 0) {
+    stream << emptyDocument_;
+    return;
+  }
+  stream << header_;
+  for (const auto &elementSection : sections_) {
+    for (const auto &element : elementSection.sortedElements) {
+      stream << element.second;
+    }
+    stream << elementSection.orderedElements;
+  }
+  stream << footer_;
+}
+
+}  // namespace outputs
+}  // namespace dfl
@@ -10,6 +10,7 @@
 #include "Configuration.h"
 #include "Context.h"
 #include "Contingencies.h"
+#include "InputArchive.h"
 #include "Log.h"
 #include "Options.h"
 #include "SimulationParams.h"
@@ -34,6 +35,7 @@
 #include <fstream>
 #include <sstream>
 #include <unordered_map>
+#include <vector>
 
 static inline std::string getMandatoryEnvVar(const std::string &key) {
   char *var = getenv(key.c_str());
@@ -58,10 +60,32 @@ static inline double elapsed(const std::chrono::steady_clock::time_point &timePo
   return static_cast<double>(duration.count()) / 1000;  // To have the time in seconds as a double
 }
 
+/**
+ * @brief Write on the disk the entries of the input archive that Dynawo opens by path
+ *
+ * The files are written by the root process only, the other processes drop them from their memory and read them from the disk
+ *
+ * @param inputArchive the input archive, empty if the inputs are not given in an archive
+ * @param filepaths the paths of the files, as if the archive was extracted
+ */
+static void extractDynawoInputs(dfl::common::InputArchive &inputArchive, const std::vector<boost::filesystem::path> &filepaths) {
+  auto &mpiContext = DYNAlgorithms::multiprocessing::context();
+  for (const auto &filepath : filepaths) {
+    if (mpiContext.isRootProc()) {
+      inputArchive.extract(filepath);
+    } else {
+      inputArchive.release(filepath);
+    }
+  }
+}
+
 static boost::shared_ptr<dfl::Context> buildContext(dfl::inputs::SimulationParams const &params, dfl::inputs::Configuration &config,
                                                     std::unordered_map<std::string, std::string> &mapOutputFilesData) {
   auto timeContextStart = std::chrono::steady_clock::now();
   bool outputIsZip = !params.runtimeConfig->zipArchivePath.empty();
+  if (params.runtimeConfig->nbThreads > 0) {
+    config.setNbThreads(params.runtimeConfig->nbThreads);
+  }
   dfl::Context::ContextDef def{config.getStartingPointMode(),
                                params.simulationKind,
                                params.networkFilePath,
@@ -71,7 +95,14 @@ static boost::shared_ptr<dfl::Context> buildContext(dfl::inputs::SimulationParam
                                outputIsZip,
                                params.runtimeConfig->dynawoLogLevel,
                                params.resourcesDirPath,
-                               params.locale};
+                               params.locale,
+                               params.runtimeConfig->snapshotCacheDir,
+                               params.runtimeConfig->resultCacheDir,
+                               static_cast<std::uintmax_t>(params.runtimeConfig->resultCacheMaxSize) * 1024 * 1024,
+                               params.runtimeConfig->resultCacheDryRun,
+                               params.runtimeConfig->checkpointInterval,
+                               params.runtimeConfig->resume,
+                               params.inputArchive};
 
   boost::shared_ptr<dfl::Context> context = boost::shared_ptr<dfl::Context>(new dfl::Context(def, config, mapOutputFilesData));
 
@@ -204,52 +235,34 @@ int main(int argc, char *argv[]) {
   boost::filesystem::path configPath(runtimeConfig.configPath);
   boost::filesystem::path networkPath(runtimeConfig.networkFilePath);
   boost::filesystem::path contingencyPath(runtimeConfig.contingenciesFilePath);
+  // The input files of the archive are read from memory by every process: only the files opened by Dynawo itself are extracted, by the root
+  // process, and dropped from the memory of every process
+  dfl::common::InputArchive inputArchive;
   if (!runtimeConfig.zipArchivePath.empty()) {
-    if (mpiContext.isRootProc()) {
-      boost::shared_ptr<zip::ZipFile> archive;
-      try {
-        try {
-          archive = zip::ZipInputStream::read(runtimeConfig.zipArchivePath);
-        } catch (const zip::ZipException &e) {
-          switch (e.getErrorCode()) {
-          case zip::Error::Code::LIBARCHIVE_INTERNAL_ERROR:
-            throw DFLError(LibZipError, runtimeConfig.zipArchivePath, e.what());
-          case zip::Error::Code::FILE_NOT_FOUND:
-            throw DFLError(FileNotFound, e.what());
-          default:
-            // other libzip errors
-            throw;
-          }
-        }
-      } catch (std::exception &e) {
+    try {
+      inputArchive = dfl::common::InputArchive(runtimeConfig.zipArchivePath);
+    } catch (std::exception &e) {
+      if (mpiContext.isRootProc()) {
         std::cerr << "Initialization failed: " << e.what() << std::endl;
-        return EXIT_FAILURE;
-      }
-
-      std::string archiveParentPath = boost::filesystem::path(runtimeConfig.zipArchivePath).parent_path().string();
-      for (std::map<std::string, boost::shared_ptr<zip::ZipEntry>>::const_iterator archiveIt = archive->getEntries().begin();
-           archiveIt != archive->getEntries().end(); ++archiveIt) {
-        std::string name = archiveIt->first;
-        std::string data(archiveIt->second->getData());
-        std::ofstream file;
-        std::string filepath = createAbsolutePath(name, archiveParentPath);
-        file.open(filepath.c_str(), std::ios::binary);
-        file << data;
-        file.close();
       }
+      return EXIT_FAILURE;
     }
-    DYNAlgorithms::multiprocessing::Context::sync();
+
     boost::filesystem::path zipPath(runtimeConfig.zipArchivePath);
     configPath = zipPath.parent_path() / configPath;
     networkPath = zipPath.parent_path() / networkPath;
     if (!contingencyPath.empty())
       contingencyPath = zipPath.parent_path() / contingencyPath;
+    // the network is only read by dynawo, from the file extracted by the root process: no process keeps it in memory
+    extractDynawoInputs(inputArchive, {networkPath});
+    DYNAlgorithms::multiprocessing::Context::sync();
   }
   boost::filesystem::path outputDir;
   std::string outputArchiveName;
   std::unordered_map<std::string, std::string> mapOutputFilesData;
   try {
-    dfl::inputs::Configuration configN(configPath, dfl::inputs::Configuration::SimulationKind::STEADY_STATE_CALCULATION);
+    dfl::inputs::Configuration configN(configPath, dfl::inputs::Configuration::SimulationKind::STEADY_STATE_CALCULATION, inputArchive);
+    extractDynawoInputs(inputArchive, configN.dynawoInputFilePaths());
 
     outputDir = configN.outputDir();
     outputArchiveName = configN.getOutputZipName();
@@ -318,7 +331,7 @@ int main(int argc, char *argv[]) {
     if (!boost::filesystem::exists(networkPath)) {
       throw DFLError(NetworkFileNotFound, runtimeConfig.networkFilePath);
     }
-    if (!contingencyPath.empty() && !boost::filesystem::exists(boost::filesystem::path(contingencyPath))) {
+    if (!contingencyPath.empty() && !inputArchive.exists(contingencyPath)) {
       throw DFLError(ContingenciesFileNotFound, runtimeConfig.contingenciesFilePath);
     }
     if (userRequest == dfl::common::Options::Request::RUN_SIMULATION_NSA && contingencyPath.empty()) {
@@ -344,6 +357,7 @@ int main(int argc, char *argv[]) {
 
     dfl::inputs::SimulationParams params;
     params.runtimeConfig = &runtimeConfig;
+    params.inputArchive = &inputArchive;
     params.timeStart = timeStart;
     params.resourcesDirPath = resourcesDir;
     params.networkFilePath = networkPath;
@@ -407,7 +421,10 @@ int main(int argc, char *argv[]) {
     }
 
     if (userRequest == dfl::common::Options::Request::RUN_SIMULATION_SA || userRequest == dfl::common::Options::Request::RUN_SIMULATION_NSA) {
-      dfl::inputs::Configuration configSA(configPath, dfl::inputs::Configuration::SimulationKind::SECURITY_ANALYSIS);
+      dfl::inputs::Configuration configSA(configPath, dfl::inputs::Configuration::SimulationKind::SECURITY_ANALYSIS, inputArchive);
+      extractDynawoInputs(inputArchive, configSA.dynawoInputFilePaths());
+      // the sanity check of every process looks for the files extracted by the root process
+      DYNAlgorithms::multiprocessing::Context::sync();
       // IMPORTANT: Call inputs::Configuration::sanityCheck() after the constructor to ensure configuration is correct.
       configSA.sanityCheck();
       if (configSA.getStartingPointMode() == dfl::inputs::Configuration::StartingPointMode::FLAT) {
@@ -0,0 +1,166 @@
+//
+// Copyright (c) 2022, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  BenchBusMacroConnections.cpp
+ *
+ * @brief Benchmark of the bus macro connections of the DynModel algorithm
+ *
+ * Compares the representative connected bus of the voltage levels, resolved once per bus, with the scan of the buses of the
+ * voltage level done for each node and each bus macro connection before it. Only built when DYNAFLOW_LAUNCHER_BUILD_BENCHMARKS is ON.
+ */
+
+#include "DynModelDefinitionAlgorithm.h"
+#include "Tests.h"
+
+#include <DYNMultiProcessingContext.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+// Required for testing unit tests
+testing::Environment *initXmlEnvironment();
+
+testing::Environment *const env = initXmlEnvironment();
+
+DYNAlgorithms::multiprocessing::Context mpiContext;
+
+namespace bench {
+/**
+ * @brief Service manager stub counting the bus connection queries
+ *
+ * Only one bus is connected, as in a substation whose buses are all opened but one.
+ */
+class CountingServiceManagerInterface : public DYN::ServiceManagerInterface {
+ public:
+  /**
+   * @brief Constructor
+   * @param connectedBusId the id of the only connected bus
+   */
+  explicit CountingServiceManagerInterface(const std::string &connectedBusId) : connectedBusId_(connectedBusId), nbQueries_(0) {}
+
+  /**
+   * @copydoc DYN::ServiceManagerInterface::getBusesConnectedBySwitch
+   */
+  std::vector<std::string> getBusesConnectedBySwitch(const std::string &busId, const std::string &VLId) const final { return std::vector<std::string>(); }
+
+  /**
+   * @copydoc DYN::ServiceManagerInterface::isBusConnected
+   */
+  bool isBusConnected(const std::string &busId, const std::string &VLId) const final {
+    ++nbQueries_;
+    return busId == connectedBusId_;
+  }
+
+  /**
+   * @copydoc DYN::ServiceManagerInterface::getRegulatedBus
+   */
+  std::shared_ptr<DYN::BusInterface> getRegulatedBus(const std::string &regulatingComponent) const final { return std::shared_ptr<DYN::BusInterface>(); }
+
+  /**
+   * @brief Retrieve the number of bus connection queries
+   * @returns the number of calls to isBusConnected
+   */
+  unsigned int nbQueries() const { return nbQueries_; }
+
+ private:
+  const std::string connectedBusId_;  ///< id of the only connected bus
+  mutable unsigned int nbQueries_;    ///< number of bus connection queries
+};
+
+/// @brief Result of a benchmark run
+struct RunResult {
+  std::chrono::microseconds duration;  ///< duration of the run
+  unsigned int nbQueries;              ///< number of bus connection queries
+  std::string connectedBusId;          ///< bus the macro connections of the voltage level are connected to
+};
+
+/**
+ * @brief Run the DynModel algorithm on a single substation with many buses
+ *
+ * The voltage level, its nodes, the service manager and the definitions are created for each run, so that no state is shared
+ * between runs. Only the settings and assembling files, parsed beforehand, are shared.
+ *
+ * @param manager the dynamic data base manager
+ * @param nbBuses the number of buses of the substation, only the last one being connected
+ * @param scanByNode if true, the connected bus is searched by scanning the buses of the voltage level for each node and each
+ *                   bus macro connection, as it was done before the representative connected bus. Otherwise the connection of
+ *                   each bus is resolved once when building the nodes, as NetworkManager does
+ * @returns the result of the run
+ */
+RunResult
+run(const dfl::inputs::DynamicDataBaseManager &manager, unsigned int nbBuses, bool scanByNode) {
+  // number of bus macro connections of the voltage level in res/assembling.xml
+  const unsigned int nbBusMacroConnections = 2;
+  const std::string connectedBusId = "BUS_" + std::to_string(nbBuses - 1);
+  auto serviceManager = boost::make_shared<CountingServiceManagerInterface>(connectedBusId);
+  dfl::algo::DynamicModelDefinitions defs;
+  std::shared_ptr<dfl::algo::AlgorithmsResults> algoRes(new dfl::algo::AlgorithmsResults());
+
+  auto start = std::chrono::steady_clock::now();
+  auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
+  std::vector<std::shared_ptr<dfl::inputs::Node>> nodes;
+  nodes.reserve(nbBuses);
+  for (unsigned int i = 0; i < nbBuses; ++i) {
+    const auto nodeId = "BUS_" + std::to_string(i);
+    // the connection is known without query when scanning, as the scan queries the service manager itself
+    const bool busConnected = scanByNode ? nodeId == connectedBusId : serviceManager->isBusConnected(nodeId, vl->id);
+    nodes.push_back(dfl::inputs::Node::build(nodeId, vl, 1.0, {}, false, serviceManager, busConnected));
+  }
+
+  dfl::algo::DynModelAlgorithm algo(defs, manager, false);
+  std::string scannedBusId;
+  for (const auto &node : nodes) {
+    algo(node, algoRes);
+    if (scanByNode) {
+      for (unsigned int j = 0; j < nbBusMacroConnections; ++j) {
+        for (const auto &nodeVL : vl->nodes) {
+          if (serviceManager->isBusConnected(nodeVL->id, vl->id)) {
+            scannedBusId = nodeVL->id;
+            break;
+          }
+        }
+      }
+    }
+  }
+  auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+  return RunResult{duration, serviceManager->nbQueries(), scanByNode ? scannedBusId : vl->representativeConnectedBus()};
+}
+}  // namespace bench
+
+TEST(BenchBusMacroConnections, representativeVsScan) {
+  dfl::inputs::DynamicDataBaseManager manager(std::vector<boost::filesystem::path>(1, "res/setting.xml"),
+                                              std::vector<boost::filesystem::path>(1, "res/assembling.xml"));
+  const unsigned int nbRuns = 5;
+
+  for (unsigned int nbBuses : {100U, 1000U, 5000U}) {
+    // best duration over several runs, both modes being interleaved so that they run in the same conditions
+    bench::RunResult representative{std::chrono::microseconds::max(), 0, ""};
+    bench::RunResult scan{std::chrono::microseconds::max(), 0, ""};
+    for (unsigned int i = 0; i < nbRuns; ++i) {
+      auto representativeRun = bench::run(manager, nbBuses, false);
+      auto scanRun = bench::run(manager, nbBuses, true);
+      representativeRun.duration = std::min(representativeRun.duration, representative.duration);
+      scanRun.duration = std::min(scanRun.duration, scan.duration);
+      representative = representativeRun;
+      scan = scanRun;
+    }
+
+    ASSERT_EQ(representative.connectedBusId, scan.connectedBusId);
+    ASSERT_EQ(nbBuses, representative.nbQueries);
+    ASSERT_LT(representative.nbQueries, scan.nbQueries);
+    std::cout << nbBuses << " buses: representative bus " << representative.duration.count() << "us for " << representative.nbQueries
+              << " bus connection queries, scan by node " << scan.duration.count() << "us for " << scan.nbQueries << " bus connection queries"
+              << std::endl;
+  }
+}
@@ -46,12 +46,6 @@ namespace test {
  */
 class TestAlgoServiceManagerInterface : public DYN::ServiceManagerInterface {
  public:
-  /**
-   * Add a disconnected node
-   * @param nodeId id of the disconnected node
-   */
-  void addDisconnectedNode(const std::string &nodeId) { disconnectedNodes_.insert(nodeId); }
-
   /**
    * @copydoc DYN::ServiceManagerInterface::getBusesConnectedBySwitch
    */
@@ -60,15 +54,12 @@ class TestAlgoServiceManagerInterface : public DYN::ServiceManagerInterface {
   /**
    * @copydoc DYN::ServiceManagerInterface::getBusesConnectedBySwitch
    */
-  bool isBusConnected(const std::string &busId, const std::string &VLId) const final { return disconnectedNodes_.find(busId) == disconnectedNodes_.end(); }
+  bool isBusConnected(const std::string &busId, const std::string &VLId) const final { return true; }
 
   /**
    * @copydoc DYN::ServiceManagerInterface::getRegulatedBus
    */
   std::shared_ptr<DYN::BusInterface> getRegulatedBus(const std::string &regulatingComponent) const final { return std::shared_ptr<DYN::BusInterface>(); }
-
- private:
-  std::unordered_set<std::string> disconnectedNodes_;
 };
 }  // namespace test
 
@@ -429,11 +420,6 @@ TEST(TestAlgoDynModel, noRegulationAndBusDisconnected) {
                                  std::vector<boost::filesystem::path>(1, "res/assembling.xml"));
   DynamicModelDefinitions defs;
   auto testServiceManager = boost::make_shared<test::TestAlgoServiceManagerInterface>();
-  testServiceManager->addDisconnectedNode("VL1");
-  testServiceManager->addDisconnectedNode("VL2");
-  testServiceManager->addDisconnectedNode("VL3");
-  testServiceManager->addDisconnectedNode("VL4");
-  testServiceManager->addDisconnectedNode("VL5");
 
   auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
   auto vl2 = std::make_shared<dfl::inputs::VoltageLevel>("VLb");
@@ -446,11 +432,11 @@ TEST(TestAlgoDynModel, noRegulationAndBusDisconnected) {
 
   std::vector<std::shared_ptr<dfl::inputs::Node>> nodes{
       dfl::inputs::Node::build("VL0", vl2, 0.0, {}, false, testServiceManager),
-      dfl::inputs::Node::build("VL1", vl, 1.0, shunts1, false, testServiceManager),
-      dfl::inputs::Node::build("VL2", vl, 2.0, shunts2, false, testServiceManager),
-      dfl::inputs::Node::build("VL3", vl, 3.0, shunts3, false, testServiceManager),
-      dfl::inputs::Node::build("VL4", vl, 4.0, shunts4, false, testServiceManager),
-      dfl::inputs::Node::build("VL5", vl, 5.0, shunts5, false, testServiceManager),
+      dfl::inputs::Node::build("VL1", vl, 1.0, shunts1, false, testServiceManager, false),
+      dfl::inputs::Node::build("VL2", vl, 2.0, shunts2, false, testServiceManager, false),
+      dfl::inputs::Node::build("VL3", vl, 3.0, shunts3, false, testServiceManager, false),
+      dfl::inputs::Node::build("VL4", vl, 4.0, shunts4, false, testServiceManager, false),
+      dfl::inputs::Node::build("VL5", vl, 5.0, shunts5, false, testServiceManager, false),
       dfl::inputs::Node::build("VL6", vl, 0.0, {}, false, testServiceManager),
   };
   std::vector<std::shared_ptr<dfl::inputs::Line>> lines{
@@ -578,3 +564,128 @@ TEST(TestAlgoDynModel, noRegulationAndBusDisconnected) {
   ASSERT_EQ(found_connection->connectedElementId, "G3");
   ASSERT_EQ(found_connection->elementType, dfl::algo::DynamicModelDefinition::MacroConnection::ElementType::GENERATOR);
 }
+
+TEST(TestAlgoDynModel, busMacroConnectionsManyBuses) {
+  using dfl::algo::DynamicModelDefinitions;
+  using dfl::inputs::DynamicDataBaseManager;
+
+  DynamicDataBaseManager manager(std::vector<boost::filesystem::path>(1, "res/setting.xml"),
+                                 std::vector<boost::filesystem::path>(1, "res/assembling.xml"));
+  DynamicModelDefinitions defs;
+  auto testServiceManager = boost::make_shared<test::TestAlgoServiceManagerInterface>();
+
+  // a single substation with many buses, only the last one being connected, and two automatons connected to its bus
+  const unsigned int nbBuses = 2000;
+  auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
+  std::vector<std::shared_ptr<dfl::inputs::Node>> nodes;
+  for (unsigned int i = 0; i < nbBuses; ++i) {
+    const auto nodeId = "BUS_" + std::to_string(i);
+    nodes.push_back(dfl::inputs::Node::build(nodeId, vl, 1.0, {}, false, testServiceManager, i + 1 == nbBuses));
+  }
+  const auto lastBusId = nodes.back()->id;
+
+  dfl::algo::DynModelAlgorithm algo(defs, manager, false);
+  std::shared_ptr<dfl::algo::AlgorithmsResults> algoRes(new dfl::algo::AlgorithmsResults());
+
+  for (const auto &node : nodes) {
+    algo(node, algoRes);
+  }
+
+  ASSERT_EQ(vl->representativeConnectedBus(), lastBusId);
+
+  const std::vector<std::pair<std::string, std::string>> busMacroConnections = {{"MODELE_1_VL4", "ToUMeasurement"},
+                                                                                {"GeneratorAutomaton", "SVCToUMeasurement"}};
+  for (const auto &busMacroConnection : busMacroConnections) {
+    ASSERT_NO_THROW(defs.models.at(busMacroConnection.first));
+    const auto &dynModel = defs.models.at(busMacroConnection.first);
+    const auto &searched = busMacroConnection.second;
+    auto counter = std::count_if(dynModel.nodeConnections.begin(), dynModel.nodeConnections.end(),
+                                 [&searched](const dfl::algo::DynamicModelDefinition::MacroConnection &connection) { return connection.id == searched; });
+    ASSERT_EQ(counter, 1);
+    auto found_connection =
+        std::find_if(dynModel.nodeConnections.begin(), dynModel.nodeConnections.end(),
+                     [&searched](const dfl::algo::DynamicModelDefinition::MacroConnection &connection) { return connection.id == searched; });
+    ASSERT_EQ(found_connection->connectedElementId, lastBusId);
+    ASSERT_EQ(found_connection->elementType, dfl::algo::DynamicModelDefinition::MacroConnection::ElementType::NODE);
+  }
+}
+
+TEST(TestAlgoDynModel, splitNodes) {
+  using dfl::algo::DynamicModelDefinitions;
+  using dfl::inputs::DynamicDataBaseManager;
+
+  DynamicDataBaseManager manager(std::vector<boost::filesystem::path>(1, "res/setting.xml"),
+                                 std::vector<boost::filesystem::path>(1, "res/assembling.xml"));
+  auto testServiceManager = boost::make_shared<test::TestAlgoServiceManagerInterface>();
+
+  auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
+  auto vl2 = std::make_shared<dfl::inputs::VoltageLevel>("VLb");
+  std::vector<dfl::inputs::Shunt> shunts1 = {dfl::inputs::Shunt("1.1")};
+  std::vector<dfl::inputs::Shunt> shunts4 = {dfl::inputs::Shunt("4.1"), dfl::inputs::Shunt("4.2"), dfl::inputs::Shunt("4.3"), dfl::inputs::Shunt("4.4")};
+  std::vector<std::shared_ptr<dfl::inputs::Node>> nodes{
+      dfl::inputs::Node::build("VL0", vl2, 0.0, {}, false, testServiceManager),
+      dfl::inputs::Node::build("VL1", vl, 1.0, shunts1, false, testServiceManager),
+      dfl::inputs::Node::build("VL2", vl, 2.0, {}, false, testServiceManager),
+      dfl::inputs::Node::build("VL3", vl, 3.0, {}, false, testServiceManager),
+      dfl::inputs::Node::build("VL4", vl, 4.0, shunts4, false, testServiceManager),
+      dfl::inputs::Node::build("VL5", vl, 5.0, {}, false, testServiceManager),
+  };
+  std::vector<std::shared_ptr<dfl::inputs::Line>> lines{
+      dfl::inputs::Line::build("0", nodes[0], nodes[1], "UNDEFINED", true, true), dfl::inputs::Line::build("1", nodes[0], nodes[2], "UNDEFINED", true, true),
+      dfl::inputs::Line::build("3", nodes[3], nodes[4], "UNDEFINED", true, true), dfl::inputs::Line::build("5", nodes[1], nodes[4], "UNDEFINED", true, true),
+  };
+  auto tfo = dfl::inputs::Tfo::build("TFO1", nodes[2], nodes[3], "UNDEFINED", true, true);
+
+  std::vector<dfl::inputs::Generator::ReactiveCurvePoint> points(
+      {dfl::inputs::Generator::ReactiveCurvePoint(12., 44., 440.), dfl::inputs::Generator::ReactiveCurvePoint(65., 44., 440.)});
+  nodes[1]->generators.emplace_back("G0", true, points, 0, 0, 0, 0, 0, 0, 0, "BUS_1", "BUS_1");
+  nodes[0]->generators.emplace_back("G1", true, points, -2, 2, -2, 2, 0, 0, 0, "BUS_2", "BUS_2");
+  nodes[4]->generators.emplace_back("G3", true, points, -1, 1, -1, 1, 0, 0, 0, "BUS_1", "BUS_3");
+  nodes[1]->loads.emplace_back("L0", false, false);
+  nodes[0]->loads.emplace_back("L1", false, false);
+  nodes[5]->loads.emplace_back("L3", false, false);
+
+  // reference: all nodes processed by a single algorithm
+  DynamicModelDefinitions defs;
+  dfl::algo::DynModelAlgorithm algo(defs, manager, true);
+  std::shared_ptr<dfl::algo::AlgorithmsResults> algoRes(new dfl::algo::AlgorithmsResults());
+  for (const auto &node : nodes) {
+    algo(node, algoRes);
+  }
+
+  // nodes split in two ranges, each one processed by an algorithm writing to its own definitions
+  const std::size_t middle = nodes.size() / 2;
+  DynamicModelDefinitions defsFirst;
+  DynamicModelDefinitions defsSecond;
+  dfl::algo::DynModelAlgorithm algoFirst(algo, defsFirst);
+  dfl::algo::DynModelAlgorithm algoSecond(algo, defsSecond);
+  std::shared_ptr<dfl::algo::AlgorithmsResults> algoResSplit(new dfl::algo::AlgorithmsResults());
+  for (std::size_t i = 0; i < middle; ++i) {
+    algoFirst(nodes[i], algoResSplit);
+  }
+  for (std::size_t i = middle; i < nodes.size(); ++i) {
+    algoSecond(nodes[i], algoResSplit);
+  }
+
+  // merge, as done for the main connex component
+  DynamicModelDefinitions merged = defsFirst;
+  for (const auto &model : defsSecond.models) {
+    auto it = merged.models.find(model.first);
+    if (it == merged.models.end()) {
+      merged.models.insert(model);
+    } else {
+      it->second.nodeConnections.insert(model.second.nodeConnections.begin(), model.second.nodeConnections.end());
+    }
+  }
+  merged.usedMacroConnections.insert(defsSecond.usedMacroConnections.begin(), defsSecond.usedMacroConnections.end());
+
+  ASSERT_FALSE(defs.models.empty());
+  ASSERT_EQ(merged.usedMacroConnections, defs.usedMacroConnections);
+  ASSERT_EQ(merged.models.size(), defs.models.size());
+  for (const auto &model : defs.models) {
+    ASSERT_NO_THROW(merged.models.at(model.first));
+    const auto &mergedModel = merged.models.at(model.first);
+    ASSERT_EQ(mergedModel.lib, model.second.lib);
+    ASSERT_EQ(mergedModel.nodeConnections, model.second.nodeConnections);
+  }
+}
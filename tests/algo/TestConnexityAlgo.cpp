@@ -11,7 +11,7 @@
 /**
  * @file  TestConnexityAlgo.cpp
  *
- * @brief MainConnexComponentAlgorithm library test file
+ * @brief ConnexComponents library test file
  */
 
 #include "MainConnexComponentAlgorithm.h"
@@ -42,11 +42,11 @@ TEST(Connexity, base) {
   nodes[5]->neighbours.push_back(nodes[4]);
   nodes[6]->neighbours.push_back(nodes[5]);
 
-  dfl::algo::MainConnexComponentAlgorithm::ConnexGroup main;
-  dfl::algo::MainConnexComponentAlgorithm algo(main);
-
-  std::for_each(nodes.begin(), nodes.end(), algo);
+  dfl::inputs::NetworkGraph graph(nodes);
+  dfl::algo::ConnexComponents components(graph);
+  auto main = components.mainComponentNodes();
 
+  ASSERT_EQ(2, components.nbComponents());
   ASSERT_EQ(4, main.size());
   std::vector<dfl::inputs::Node::NodeId> nodeids_main;
   std::for_each(main.begin(), main.end(), [&nodeids_main](const std::shared_ptr<dfl::inputs::Node> &node) { nodeids_main.push_back(node->id); });
@@ -71,11 +71,12 @@ TEST(Connexity, SameSize) {
   nodes[4]->neighbours.push_back(nodes[3]);
   nodes[5]->neighbours.push_back(nodes[3]);
 
-  dfl::algo::MainConnexComponentAlgorithm::ConnexGroup main;
-  dfl::algo::MainConnexComponentAlgorithm algo(main);
-
-  std::for_each(nodes.begin(), nodes.end(), algo);
+  dfl::inputs::NetworkGraph graph(nodes);
+  dfl::algo::ConnexComponents components(graph);
+  auto main = components.mainComponentNodes();
 
+  // ties are resolved in favour of the component met first
+  ASSERT_EQ(2, components.nbComponents());
   ASSERT_EQ(3, main.size());
   std::vector<dfl::inputs::Node::NodeId> nodeids_main;
   std::for_each(main.begin(), main.end(), [&nodeids_main](const std::shared_ptr<dfl::inputs::Node> &node) { nodeids_main.push_back(node->id); });
@@ -87,10 +88,102 @@ TEST(Connexity, notRetainedSwitch) {
   using dfl::inputs::NetworkManager;
   NetworkManager manager("res/IEEE14_disconnected_shunts.iidm");
 
-  dfl::algo::MainConnexComponentAlgorithm::ConnexGroup main;
-  dfl::algo::MainConnexComponentAlgorithm algo(main);
-  manager.onNode(algo);
-  manager.walkNodes();
+  dfl::algo::ConnexComponents components(manager.graph());
+
+  ASSERT_EQ(10, components.mainComponentNodes().size());
+}
+
+TEST(Connexity, components) {
+  auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
+  std::vector<std::shared_ptr<dfl::inputs::Node>> nodes{
+      dfl::inputs::Node::build("0", vl, 0.0, {}), dfl::inputs::Node::build("1", vl, 1.0, {}), dfl::inputs::Node::build("2", vl, 2.0, {}),
+      dfl::inputs::Node::build("3", vl, 3.0, {}), dfl::inputs::Node::build("4", vl, 5.0, {}), dfl::inputs::Node::build("5", vl, 5.0, {}),
+      dfl::inputs::Node::build("6", vl, 0.0, {}), dfl::inputs::Node::build("7", vl, 0.0, {}),
+  };
+
+  nodes[0]->neighbours.push_back(nodes[2]);
+  nodes[2]->neighbours.push_back(nodes[0]);
+  nodes[1]->neighbours.push_back(nodes[3]);
+  nodes[3]->neighbours.push_back(nodes[1]);
+  nodes[3]->neighbours.push_back(nodes[5]);
+  nodes[5]->neighbours.push_back(nodes[3]);
+  nodes[5]->neighbours.push_back(nodes[6]);
+  nodes[6]->neighbours.push_back(nodes[5]);
+  nodes[4]->neighbours.push_back(nodes[7]);
+  nodes[7]->neighbours.push_back(nodes[4]);
+
+  dfl::inputs::NetworkGraph graph(nodes);
+  for (unsigned int nbThreads = 1; nbThreads <= 4; ++nbThreads) {
+    dfl::algo::ConnexComponents components(graph, nbThreads);
+
+    ASSERT_EQ(3, components.nbComponents());
+    const std::vector<dfl::algo::ConnexComponents::ComponentId> expectedComponents{0, 1, 0, 1, 2, 1, 1, 2};
+    for (unsigned int i = 0; i < nodes.size(); ++i) {
+      ASSERT_EQ(expectedComponents[i], components.component(*nodes[i]));
+    }
+    ASSERT_EQ(2, components.size(0));
+    ASSERT_EQ(4, components.size(1));
+    ASSERT_EQ(2, components.size(2));
+
+    ASSERT_TRUE(components.isInMainComponent(*nodes[1]));
+    ASSERT_FALSE(components.isInMainComponent(*nodes[0]));
+    auto vlOther = std::make_shared<dfl::inputs::VoltageLevel>("VLOther");
+    ASSERT_FALSE(components.isInMainComponent(*dfl::inputs::Node::build("8", vlOther, 0.0, {})));
+
+    // depth-first order from the first node of the main component
+    std::vector<dfl::inputs::Node::NodeId> nodeids_main;
+    for (const auto &node : components.mainComponentNodes()) {
+      nodeids_main.push_back(node->id);
+    }
+    const std::vector<dfl::inputs::Node::NodeId> expected_nodes{"1", "3", "5", "6"};
+    ASSERT_EQ(expected_nodes, nodeids_main);
+  }
+
+  dfl::algo::ConnexComponents noComponent(dfl::inputs::NetworkGraph::empty());
+  ASSERT_EQ(0, noComponent.nbComponents());
+  ASSERT_TRUE(noComponent.mainComponentNodes().empty());
+}
+
+TEST(Connexity, radialNetwork) {
+  // long enough for a recursive traversal to exhaust the call stack
+  const unsigned int nbNodes = 500000;
+  auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
+  std::vector<std::shared_ptr<dfl::inputs::Node>> nodes;
+  nodes.reserve(nbNodes);
+  for (unsigned int i = 0; i < nbNodes; ++i) {
+    nodes.push_back(dfl::inputs::Node::build(std::to_string(i), vl, 0.0, {}));
+    if (i > 0) {
+      nodes[i - 1]->neighbours.push_back(nodes[i]);
+      nodes[i]->neighbours.push_back(nodes[i - 1]);
+    }
+  }
+
+  dfl::inputs::NetworkGraph graph(nodes);
+  dfl::algo::ConnexComponents components(graph, 4);
+  ASSERT_EQ(1, components.nbComponents());
+  auto mainNodes = components.mainComponentNodes();
+  ASSERT_EQ(nodes, mainNodes);
+
+  for (const auto &node : nodes) {
+    node->neighbours.clear();
+  }
+}
+
+TEST(Connexity, componentsNetwork) {
+  using dfl::inputs::NetworkManager;
+  NetworkManager manager("res/IEEE14_disconnected_shunts.iidm");
 
-  ASSERT_EQ(10, main.size());
+  const auto &graph = manager.graph();
+
+  dfl::algo::ConnexComponents reference(graph);
+  auto main = reference.mainComponentNodes();
+  for (unsigned int nbThreads = 2; nbThreads <= 3; ++nbThreads) {
+    dfl::algo::ConnexComponents components(graph, nbThreads);
+    ASSERT_EQ(reference.nbComponents(), components.nbComponents());
+    ASSERT_EQ(main, components.mainComponentNodes());
+    for (dfl::inputs::NetworkGraph::Index i = 0; i < graph.nbNodes(); ++i) {
+      ASSERT_EQ(reference.component(*graph.node(i)), components.component(*graph.node(i)));
+      ASSERT_EQ(reference.isInMainComponent(*graph.node(i)), components.isInMainComponent(*graph.node(i)));
+    }
+  }
 }
@@ -162,3 +162,42 @@ TEST(ContingencyValidation, base) {
   ASSERT_TRUE(elementsNetworkType.find("GENERATORNETWORK") != elementsNetworkType.end());
   ASSERT_TRUE(elementsNetworkType.find("SVARCNETWORK") != elementsNetworkType.end());
 }
+
+TEST(ContingencyValidation, manyContingencies) {
+  using Type = dfl::inputs::ContingencyElement::Type;
+
+  // N-2 contingencies on a ring of lines, every other line being missing from the network, plus duplicated elements
+  const unsigned int nbLines = 2000;
+  auto contingencies = std::vector<dfl::inputs::Contingency>();
+  contingencies.reserve(nbLines + 1);
+  for (unsigned int i = 0; i < nbLines; ++i) {
+    addContingency(contingencies, "N2_" + std::to_string(i), "LINE_" + std::to_string(i), Type::LINE);
+    contingencies.back().elements.emplace_back("LINE_" + std::to_string((i + 1) % nbLines), Type::BRANCH);
+  }
+  addContingency(contingencies, "duplicated", "LINE_0", Type::LINE);
+  contingencies.back().elements.emplace_back("LINE_0", Type::GENERATOR);
+  contingencies.back().elements.emplace_back("LINE_1", Type::LINE);
+
+  auto validContingencies = dfl::algo::ValidContingencies(contingencies);
+  for (unsigned int i = 0; i < nbLines; i += 2) {
+    validContingencies.markElementValid("LINE_" + std::to_string(i), Type::LINE, i == 0);
+  }
+  validContingencies.keepContingenciesWithAllElementsValid();
+
+  // every contingency contains one line of the network
+  const auto &valid = validContingencies.get();
+  ASSERT_EQ(valid.size(), nbLines + 1);
+  for (unsigned int i = 0; i < nbLines; ++i) {
+    ASSERT_EQ(valid[i].id, "N2_" + std::to_string(i));
+    ASSERT_EQ(valid[i].elements.size(), 1);
+    ASSERT_EQ(valid[i].elements.front().id, "LINE_" + std::to_string((i % 2 == 0) ? i : (i + 1) % nbLines));
+  }
+  // an element given several times is checked against its first occurrence in the contingency
+  ASSERT_EQ(valid.back().id, "duplicated");
+  ASSERT_EQ(valid.back().elements.size(), 2);
+  ASSERT_EQ(valid.back().elements[0].id, "LINE_0");
+  ASSERT_EQ(valid.back().elements[1].id, "LINE_0");
+
+  ASSERT_EQ(validContingencies.getNetworkElements().size(), 1);
+  ASSERT_EQ(validContingencies.getNetworkElements().count("LINE_0"), 1);
+}
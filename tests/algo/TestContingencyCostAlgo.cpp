@@ -0,0 +1,85 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  TestContingencyCostAlgo.cpp
+ *
+ * @brief Contingency cost estimation Algo library test file
+ *
+ */
+
+#include "ContingencyCostAlgorithm.h"
+#include "Tests.h"
+
+#include <DYNCommon.h>
+#include <gtest_dynawo.h>
+
+#include <cmath>
+
+using Type = dfl::inputs::ContingencyElement::Type;
+
+static void addContingency(std::vector<dfl::inputs::Contingency> &contingencies, const std::string &id, const std::string elementId, Type elementType) {
+  contingencies.emplace_back(id);
+  contingencies.back().elements.emplace_back(elementId, elementType);
+}
+
+/**
+ * @brief Build the costs of the contingencies of a small network
+ *
+ * The node 0 holds a line, two loads and a shunt, the node 1 holds the line and a load
+ *
+ * @param contingencies the contingencies
+ * @returns the costs of the contingencies
+ */
+static dfl::algo::ContingencyCosts buildCosts(const std::vector<dfl::inputs::Contingency> &contingencies) {
+  auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
+  std::vector<std::shared_ptr<dfl::inputs::Node>> nodes{dfl::inputs::Node::build("0", vl, 110.0, {dfl::inputs::Shunt("SHUNT")}),
+                                                        dfl::inputs::Node::build("1", vl, 110.0, {})};
+  nodes[0]->loads.emplace_back("LOAD0", false, false);
+  nodes[0]->loads.emplace_back("LOAD0B", false, false);
+  nodes[1]->loads.emplace_back("LOAD1", false, false);
+  auto line = dfl::inputs::Line::build("LINE", nodes[0], nodes[1], "ETE", true, true);
+
+  dfl::algo::ContingencyCosts costs(contingencies);
+  dfl::algo::ContingencyCostAlgorithm algo(costs);
+  std::shared_ptr<dfl::algo::AlgorithmsResults> algoRes(new dfl::algo::AlgorithmsResults());
+  for (const auto &node : nodes) {
+    algo(node, algoRes);
+  }
+  return costs;
+}
+
+TEST(ContingencyCost, estimate) {
+  std::vector<dfl::inputs::Contingency> contingencies;
+  addContingency(contingencies, "load0", "LOAD0", Type::LOAD);
+  addContingency(contingencies, "load1", "LOAD1", Type::LOAD);
+  addContingency(contingencies, "line", "LINE", Type::LINE);
+  addContingency(contingencies, "missing", "XXX", Type::GENERATOR);
+  addContingency(contingencies, "load0_and_line", "LOAD0", Type::LOAD);
+  contingencies.back().elements.emplace_back("LINE", Type::BRANCH);
+
+  const auto costs = buildCosts(contingencies);
+
+  // the size of the network around an element is the number of branches and injections of its nodes, the largest for a branch
+  ASSERT_DOUBLE_EQUALS_DYNAWO(1. + std::log1p(4.), costs.estimate(contingencies[0]));
+  ASSERT_DOUBLE_EQUALS_DYNAWO(1. + std::log1p(2.), costs.estimate(contingencies[1]));
+  ASSERT_DOUBLE_EQUALS_DYNAWO(1.5 * (1. + std::log1p(4.)), costs.estimate(contingencies[2]));
+  // an element not found in the network only costs its type weight
+  ASSERT_DOUBLE_EQUALS_DYNAWO(4., costs.estimate(contingencies[3]));
+  ASSERT_DOUBLE_EQUALS_DYNAWO(2.5 * (1. + std::log1p(4.)), costs.estimate(contingencies[4]));
+}
+
+TEST(ContingencyCost, typeWeight) {
+  // generators and HVDC lines trips are the longest to simulate
+  ASSERT_GT(dfl::algo::ContingencyCosts::typeWeight(Type::GENERATOR), dfl::algo::ContingencyCosts::typeWeight(Type::LINE));
+  ASSERT_GT(dfl::algo::ContingencyCosts::typeWeight(Type::HVDC_LINE), dfl::algo::ContingencyCosts::typeWeight(Type::LINE));
+  ASSERT_GT(dfl::algo::ContingencyCosts::typeWeight(Type::LINE), dfl::algo::ContingencyCosts::typeWeight(Type::LOAD));
+  ASSERT_DOUBLE_EQUALS_DYNAWO(dfl::algo::ContingencyCosts::typeWeight(Type::BRANCH), dfl::algo::ContingencyCosts::typeWeight(Type::LINE));
+}
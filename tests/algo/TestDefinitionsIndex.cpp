@@ -0,0 +1,79 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  TestDefinitionsIndex.cpp
+ *
+ * @brief Definitions index test file
+ *
+ */
+
+#include "DefinitionsIndex.h"
+#include "LineDefinitionAlgorithm.h"
+#include "TransfoDefinitionAlgorithm.h"
+#include "Tests.h"
+
+#include <algorithm>
+
+TEST(DefinitionsIndex, empty) {
+  dfl::algo::DefinitionsIndex definitionsIndex;
+
+  ASSERT_FALSE(definitionsIndex.generator("G0"));
+  ASSERT_FALSE(definitionsIndex.load("L0"));
+  ASSERT_FALSE(definitionsIndex.staticVarCompensator("SVARC0"));
+  ASSERT_EQ(definitionsIndex.hvdcLine("HVDC0"), nullptr);
+  ASSERT_EQ(definitionsIndex.line("0"), nullptr);
+  ASSERT_EQ(definitionsIndex.tfo("TFO0"), nullptr);
+}
+
+TEST(DefinitionsIndex, base) {
+  using dfl::algo::GeneratorDefinition;
+  using dfl::algo::LoadDefinition;
+  using modelType = dfl::algo::StaticVarCompensatorDefinition::ModelType;
+
+  const std::string bus1 = "BUS_1";
+  std::vector<GeneratorDefinition> generators = {
+      GeneratorDefinition("G0", GeneratorDefinition::ModelType::SIGNALN_INFINITE, "00", {}, 1., 10., 11., 110., 0, 100, bus1),
+      GeneratorDefinition("G1", GeneratorDefinition::ModelType::DIAGRAM_PQ_SIGNALN, "01", {}, 3., 30., 33., 330., 0, 100, bus1),
+      GeneratorDefinition("G2", GeneratorDefinition::ModelType::DIAGRAM_PQ_SIGNALN, "02", {}, 3., 30., -33., 330., 0, 0, bus1)};
+  std::vector<LoadDefinition> loads = {LoadDefinition("L0", LoadDefinition::ModelType::LOADRESTORATIVEWITHLIMITS, "00"),
+                                       LoadDefinition("L1", LoadDefinition::ModelType::NETWORK, "01")};
+  std::vector<dfl::algo::StaticVarCompensatorDefinition> svarcs = {
+      dfl::algo::StaticVarCompensatorDefinition("SVARC0", modelType::SVARCPV, 0., 10., 100, 230, 215, 230, 235, 245, 0., 10., 10.)};
+  dfl::algo::HVDCLineDefinitions noHvdcDefs;
+
+  auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
+  std::vector<std::shared_ptr<dfl::inputs::Node>> nodes{dfl::inputs::Node::build("VL0", vl, 0.0, {}), dfl::inputs::Node::build("VL1", vl, 1.0, {})};
+  std::vector<std::shared_ptr<dfl::inputs::Line>> lines{dfl::inputs::Line::build("0", nodes[0], nodes[1], "ETE", true, true),
+                                                        dfl::inputs::Line::build("1", nodes[0], nodes[1], "HIVER", true, true)};
+  auto tfo = dfl::inputs::Tfo::build("TFO0", nodes[0], nodes[1], "UNDEFINED", true, true);
+  dfl::algo::LinesByIdDefinitions linesById;
+  dfl::algo::TransformersByIdDefinitions tfosById;
+  std::for_each(nodes.begin(), nodes.end(), dfl::algo::LinesByIdAlgorithm(linesById));
+  std::for_each(nodes.begin(), nodes.end(), dfl::algo::TransformersByIdAlgorithm(tfosById));
+
+  dfl::algo::DefinitionsIndex definitionsIndex(generators, loads, svarcs, noHvdcDefs, linesById, tfosById);
+
+  for (std::size_t i = 0; i < generators.size(); ++i) {
+    ASSERT_TRUE(definitionsIndex.generator(generators[i].id));
+    ASSERT_EQ(*definitionsIndex.generator(generators[i].id), i);
+  }
+  ASSERT_FALSE(definitionsIndex.generator("L0"));
+  ASSERT_EQ(*definitionsIndex.load("L1"), 1);
+  ASSERT_EQ(*definitionsIndex.staticVarCompensator("SVARC0"), 0);
+  ASSERT_FALSE(definitionsIndex.staticVarCompensator("SVARC1"));
+  ASSERT_EQ(definitionsIndex.hvdcLine("HVDC0"), nullptr);
+
+  // lines and transformers are the ones of the network, not copies
+  ASSERT_EQ(definitionsIndex.line("1"), lines[1].get());
+  ASSERT_EQ(definitionsIndex.line("1")->activeSeason, "HIVER");
+  ASSERT_EQ(definitionsIndex.line("2"), nullptr);
+  ASSERT_EQ(definitionsIndex.tfo("TFO0"), tfo.get());
+}
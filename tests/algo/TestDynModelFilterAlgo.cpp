@@ -86,7 +86,10 @@ TEST(DynModelFilter, RemoveRPCLIfMissingConnexionToSvc) {
     models.insert({dynModelId, dynModel});
     models.insert({dynModelId2, dynModel2});
     dfl::inputs::AssemblingDataBase assembling(std::vector<boost::filesystem::path>(1, "res/assembling_svc.xml"));
-    dfl::algo::DynModelFilterAlgorithm dynModelFilterAlgorithm(assembling, generators, hvdcLineDefinitions, models);
+    dfl::algo::LinesByIdDefinitions noLines;
+    dfl::algo::TransformersByIdDefinitions noTfos;
+    dfl::algo::DefinitionsIndex definitionsIndex(generators, {}, {}, hvdcLineDefinitions, noLines, noTfos);
+    dfl::algo::DynModelFilterAlgorithm dynModelFilterAlgorithm(assembling, generators, definitionsIndex, hvdcLineDefinitions, models);
     dynModelFilterAlgorithm.filter();
     auto modelsIt = models.find(dynModelId);
     switch (testConfig) {
@@ -111,15 +111,15 @@ static void generatorsEquals(const dfl::algo::GeneratorDefinition &lhs, const df
   std::cout << "Comparing " << lhs.id << std::endl;
   ASSERT_EQ(lhs.id, rhs.id);
   ASSERT_EQ(lhs.model, rhs.model);
-  ASSERT_EQ(lhs.points.size(), rhs.points.size());
+  ASSERT_EQ(lhs.diagram->points.size(), rhs.diagram->points.size());
   ASSERT_EQ(lhs.qmin, rhs.qmin);
   ASSERT_EQ(lhs.qmax, rhs.qmax);
   ASSERT_EQ(lhs.pmin, rhs.pmin);
   ASSERT_EQ(lhs.pmax, rhs.pmax);
-  for (size_t index_p = 0; index_p < lhs.points.size(); ++index_p) {
-    ASSERT_EQ(lhs.points[index_p].p, rhs.points[index_p].p);
-    ASSERT_EQ(lhs.points[index_p].qmax, rhs.points[index_p].qmax);
-    ASSERT_EQ(lhs.points[index_p].qmin, rhs.points[index_p].qmin);
+  for (size_t index_p = 0; index_p < lhs.diagram->points.size(); ++index_p) {
+    ASSERT_EQ(lhs.diagram->points[index_p].p, rhs.diagram->points[index_p].p);
+    ASSERT_EQ(lhs.diagram->points[index_p].qmax, rhs.diagram->points[index_p].qmax);
+    ASSERT_EQ(lhs.diagram->points[index_p].qmin, rhs.diagram->points[index_p].qmin);
   }
 }
 
@@ -176,7 +176,8 @@ TEST(Generators, base) {
   std::vector<boost::filesystem::path> emptyPathList;
   dfl::inputs::DynamicDataBaseManager manager(emptyPathList, emptyPathList);
 
-  dfl::algo::GeneratorDefinitionAlgorithm algo_infinite(generators, busMap, manager, true, 10.);
+  dfl::algo::ReactiveDiagramPool diagrams;
+  dfl::algo::GeneratorDefinitionAlgorithm algo_infinite(generators, busMap, manager, true, 10., diagrams);
   std::shared_ptr<dfl::algo::AlgorithmsResults> algoRes(new dfl::algo::AlgorithmsResults());
   for (const auto &node : nodes) {
     algo_infinite(node, algoRes);
@@ -190,7 +191,7 @@ TEST(Generators, base) {
   }
 
   generators.clear();
-  dfl::algo::GeneratorDefinitionAlgorithm algo_finite(generators, busMap, manager, false, 10.);
+  dfl::algo::GeneratorDefinitionAlgorithm algo_finite(generators, busMap, manager, false, 10., diagrams);
 
   for (const auto &node : nodes) {
     algo_finite(node, algoRes);
@@ -202,6 +203,13 @@ TEST(Generators, base) {
     generatorsEquals(expected_gens_finite[index], generators[index]);
     ASSERT_EQ(expected_gens_finite[index].targetP, generators[index].targetP);
   }
+
+  // generators with the same reactive capabilities share their diagram
+  ASSERT_EQ(generators[1].diagram, generators[2].diagram);
+  ASSERT_EQ(generators[1].diagram, generators[3].diagram);
+  ASSERT_EQ(generators[1].diagram, generators[4].diagram);
+  ASSERT_NE(generators[0].diagram, generators[1].diagram);
+  ASSERT_EQ(diagrams.size(), 2);
 }
 
 TEST(Generators, baseSVC) {
@@ -258,7 +266,8 @@ TEST(Generators, baseSVC) {
 
   std::vector<boost::filesystem::path> emptyPathList;
   dfl::inputs::DynamicDataBaseManager manager(emptyPathList, std::vector<boost::filesystem::path>(1, "res/assembling_test_generator.xml"));
-  dfl::algo::GeneratorDefinitionAlgorithm algo_infinite(generators, busMap, manager, true, 5.);
+  dfl::algo::ReactiveDiagramPool diagrams;
+  dfl::algo::GeneratorDefinitionAlgorithm algo_infinite(generators, busMap, manager, true, 5., diagrams);
   std::shared_ptr<dfl::algo::AlgorithmsResults> algoRes(new dfl::algo::AlgorithmsResults());
   for (const auto &node : nodes) {
     algo_infinite(node, algoRes);
@@ -272,7 +281,7 @@ TEST(Generators, baseSVC) {
   }
 
   generators.clear();
-  dfl::algo::GeneratorDefinitionAlgorithm algo_finite(generators, busMap, manager, false, 5.);
+  dfl::algo::GeneratorDefinitionAlgorithm algo_finite(generators, busMap, manager, false, 5., diagrams);
 
   for (const auto &node : nodes) {
     algo_finite(node, algoRes);
@@ -340,7 +349,8 @@ TEST(Generators, baseSVCRpcl2) {
 
   std::vector<boost::filesystem::path> emptyPathList;
   dfl::inputs::DynamicDataBaseManager manager(emptyPathList, std::vector<boost::filesystem::path>(1, "res/assembling_test_generator_rpcl2.xml"));
-  dfl::algo::GeneratorDefinitionAlgorithm algo_infinite(generators, busMap, manager, true, 5.);
+  dfl::algo::ReactiveDiagramPool diagrams;
+  dfl::algo::GeneratorDefinitionAlgorithm algo_infinite(generators, busMap, manager, true, 5., diagrams);
   std::shared_ptr<dfl::algo::AlgorithmsResults> algoRes(new dfl::algo::AlgorithmsResults());
   for (const auto &node : nodes) {
     algo_infinite(node, algoRes);
@@ -354,7 +364,7 @@ TEST(Generators, baseSVCRpcl2) {
   }
 
   generators.clear();
-  dfl::algo::GeneratorDefinitionAlgorithm algo_finite(generators, busMap, manager, false, 5.);
+  dfl::algo::GeneratorDefinitionAlgorithm algo_finite(generators, busMap, manager, false, 5., diagrams);
 
   for (const auto &node : nodes) {
     algo_finite(node, algoRes);
@@ -422,7 +432,8 @@ TEST(Generators, baseSVCTfo) {
 
   std::vector<boost::filesystem::path> emptyPathList;
   dfl::inputs::DynamicDataBaseManager manager(emptyPathList, std::vector<boost::filesystem::path>(1, "res/assembling_test_generator.xml"));
-  dfl::algo::GeneratorDefinitionAlgorithm algo_infinite(generators, busMap, manager, true, 5.);
+  dfl::algo::ReactiveDiagramPool diagrams;
+  dfl::algo::GeneratorDefinitionAlgorithm algo_infinite(generators, busMap, manager, true, 5., diagrams);
   std::shared_ptr<dfl::algo::AlgorithmsResults> algoRes(new dfl::algo::AlgorithmsResults());
   for (const auto &node : nodes) {
     algo_infinite(node, algoRes);
@@ -436,7 +447,7 @@ TEST(Generators, baseSVCTfo) {
   }
 
   generators.clear();
-  dfl::algo::GeneratorDefinitionAlgorithm algo_finite(generators, busMap, manager, false, 5.);
+  dfl::algo::GeneratorDefinitionAlgorithm algo_finite(generators, busMap, manager, false, 5., diagrams);
 
   for (const auto &node : nodes) {
     algo_finite(node, algoRes);
@@ -504,7 +515,8 @@ TEST(Generators, baseSVCTfoRpcl2) {
 
   std::vector<boost::filesystem::path> emptyPathList;
   dfl::inputs::DynamicDataBaseManager manager(emptyPathList, std::vector<boost::filesystem::path>(1, "res/assembling_test_generator_rpcl2.xml"));
-  dfl::algo::GeneratorDefinitionAlgorithm algo_infinite(generators, busMap, manager, true, 5.);
+  dfl::algo::ReactiveDiagramPool diagrams;
+  dfl::algo::GeneratorDefinitionAlgorithm algo_infinite(generators, busMap, manager, true, 5., diagrams);
   std::shared_ptr<dfl::algo::AlgorithmsResults> algoRes(new dfl::algo::AlgorithmsResults());
   for (const auto &node : nodes) {
     algo_infinite(node, algoRes);
@@ -518,7 +530,7 @@ TEST(Generators, baseSVCTfoRpcl2) {
   }
 
   generators.clear();
-  dfl::algo::GeneratorDefinitionAlgorithm algo_finite(generators, busMap, manager, false, 5.);
+  dfl::algo::GeneratorDefinitionAlgorithm algo_finite(generators, busMap, manager, false, 5., diagrams);
 
   for (const auto &node : nodes) {
     algo_finite(node, algoRes);
@@ -583,7 +595,8 @@ TEST(Generators, generatorRemoteRegulationWithTfo) {
                                                           {bus3, dfl::inputs::NetworkManager::NbOfRegulating::ONE}};
   std::vector<boost::filesystem::path> emptyPathList;
   dfl::inputs::DynamicDataBaseManager manager(emptyPathList, emptyPathList);
-  dfl::algo::GeneratorDefinitionAlgorithm algo_infinite(generators, busMap, manager, true, 10.);
+  dfl::algo::ReactiveDiagramPool diagrams;
+  dfl::algo::GeneratorDefinitionAlgorithm algo_infinite(generators, busMap, manager, true, 10., diagrams);
   std::shared_ptr<dfl::algo::AlgorithmsResults> algoRes(new dfl::algo::AlgorithmsResults());
   for (const auto &node : nodes) {
     algo_infinite(node, algoRes);
@@ -597,7 +610,7 @@ TEST(Generators, generatorRemoteRegulationWithTfo) {
   }
 
   generators.clear();
-  dfl::algo::GeneratorDefinitionAlgorithm algo_finite(generators, busMap, manager, false, 10.);
+  dfl::algo::GeneratorDefinitionAlgorithm algo_finite(generators, busMap, manager, false, 10., diagrams);
 
   for (const auto &node : nodes) {
     algo_finite(node, algoRes);
@@ -663,7 +676,8 @@ TEST(Generators, generatorRemoteRegulationWithTfoAndSVC) {
                                                           {bus4, dfl::inputs::NetworkManager::NbOfRegulating::MULTIPLES}};
   std::vector<boost::filesystem::path> emptyPathList;
   dfl::inputs::DynamicDataBaseManager manager(emptyPathList, std::vector<boost::filesystem::path>(1, "res/assembling_test_generator.xml"));
-  dfl::algo::GeneratorDefinitionAlgorithm algo_infinite(generators, busMap, manager, true, 10.);
+  dfl::algo::ReactiveDiagramPool diagrams;
+  dfl::algo::GeneratorDefinitionAlgorithm algo_infinite(generators, busMap, manager, true, 10., diagrams);
   std::shared_ptr<dfl::algo::AlgorithmsResults> algoRes(new dfl::algo::AlgorithmsResults());
   for (const auto &node : nodes) {
     algo_infinite(node, algoRes);
@@ -677,7 +691,7 @@ TEST(Generators, generatorRemoteRegulationWithTfoAndSVC) {
   }
 
   generators.clear();
-  dfl::algo::GeneratorDefinitionAlgorithm algo_finite(generators, busMap, manager, false, 10.);
+  dfl::algo::GeneratorDefinitionAlgorithm algo_finite(generators, busMap, manager, false, 10., diagrams);
 
   for (const auto &node : nodes) {
     algo_finite(node, algoRes);
@@ -742,7 +756,8 @@ TEST(Generators, generatorWithTfo) {
                                                           {bus3, dfl::inputs::NetworkManager::NbOfRegulating::ONE}};
   std::vector<boost::filesystem::path> emptyPathList;
   dfl::inputs::DynamicDataBaseManager manager(emptyPathList, emptyPathList);
-  dfl::algo::GeneratorDefinitionAlgorithm algo_infinite(generators, busMap, manager, true, 5.);
+  dfl::algo::ReactiveDiagramPool diagrams;
+  dfl::algo::GeneratorDefinitionAlgorithm algo_infinite(generators, busMap, manager, true, 5., diagrams);
   std::shared_ptr<dfl::algo::AlgorithmsResults> algoRes(new dfl::algo::AlgorithmsResults());
   for (const auto &node : nodes) {
     algo_infinite(node, algoRes);
@@ -756,7 +771,7 @@ TEST(Generators, generatorWithTfo) {
   }
 
   generators.clear();
-  dfl::algo::GeneratorDefinitionAlgorithm algo_finite(generators, busMap, manager, false, 5.);
+  dfl::algo::GeneratorDefinitionAlgorithm algo_finite(generators, busMap, manager, false, 5., diagrams);
 
   for (const auto &node : nodes) {
     algo_finite(node, algoRes);
@@ -789,7 +804,8 @@ TEST(Generators, noGeneratorRegulating) {
   dfl::inputs::NetworkManager::BusMapRegulating busMap;
   std::vector<boost::filesystem::path> emptyPathList;
   dfl::inputs::DynamicDataBaseManager manager(emptyPathList, emptyPathList);
-  dfl::algo::GeneratorDefinitionAlgorithm algo_infinite(generators, busMap, manager, true, 10.);
+  dfl::algo::ReactiveDiagramPool diagrams;
+  dfl::algo::GeneratorDefinitionAlgorithm algo_infinite(generators, busMap, manager, true, 10., diagrams);
   std::shared_ptr<dfl::algo::AlgorithmsResults> algoRes(new dfl::algo::AlgorithmsResults());
   for (const auto &node : nodes) {
     algo_infinite(node, algoRes);
@@ -799,7 +815,7 @@ TEST(Generators, noGeneratorRegulating) {
   ASSERT_FALSE(algoRes->isAtLeastOneGeneratorRegulating);
 
   generators.clear();
-  dfl::algo::GeneratorDefinitionAlgorithm algo_finite(generators, busMap, manager, false, 10.);
+  dfl::algo::GeneratorDefinitionAlgorithm algo_finite(generators, busMap, manager, false, 10., diagrams);
 
   for (const auto &node : nodes) {
     algo_finite(node, algoRes);
@@ -860,7 +876,8 @@ TEST(Generators, SwitchConnexity) {
                                                           {bus3, dfl::inputs::NetworkManager::NbOfRegulating::ONE}};
   std::vector<boost::filesystem::path> emptyPathList;
   dfl::inputs::DynamicDataBaseManager manager(emptyPathList, emptyPathList);
-  dfl::algo::GeneratorDefinitionAlgorithm algo_infinite(generators, busMap, manager, true, 10.);
+  dfl::algo::ReactiveDiagramPool diagrams;
+  dfl::algo::GeneratorDefinitionAlgorithm algo_infinite(generators, busMap, manager, true, 10., diagrams);
 
   std::shared_ptr<dfl::algo::AlgorithmsResults> algoRes(new dfl::algo::AlgorithmsResults());
   for (const auto &node : nodes) {
@@ -874,7 +891,7 @@ TEST(Generators, SwitchConnexity) {
 
   generators.clear();
   std::shared_ptr<dfl::algo::AlgorithmsResults> algoResFinite(new dfl::algo::AlgorithmsResults());
-  dfl::algo::GeneratorDefinitionAlgorithm algo_finite(generators, busMap, manager, false, 10.);
+  dfl::algo::GeneratorDefinitionAlgorithm algo_finite(generators, busMap, manager, false, 10., diagrams);
 
   for (const auto &node : nodes) {
     algo_finite(node, algoResFinite);
@@ -902,7 +919,8 @@ static void testDiagramValidity(std::vector<dfl::inputs::Generator::ReactiveCurv
   std::shared_ptr<dfl::algo::AlgorithmsResults> algoRes(new dfl::algo::AlgorithmsResults());
   std::vector<boost::filesystem::path> emptyPathList;
   dfl::inputs::DynamicDataBaseManager manager(emptyPathList, emptyPathList);
-  dfl::algo::GeneratorDefinitionAlgorithm algo_infinite(generators, busMap, manager, false, 10.);
+  dfl::algo::ReactiveDiagramPool diagrams;
+  dfl::algo::GeneratorDefinitionAlgorithm algo_infinite(generators, busMap, manager, false, 10., diagrams);
 
   node->generators.emplace_back(generator);
   algo_infinite(node, algoRes);
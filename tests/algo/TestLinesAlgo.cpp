@@ -44,10 +44,10 @@ TEST(LinesByIds, base) {
   std::for_each(nodes.begin(), nodes.end(), algo);
 
   ASSERT_EQ(def.linesMap.size(), 7);
-  ASSERT_EQ(def.linesMap.at("0").id, "0");
-  ASSERT_EQ(def.linesMap.at("0").activeSeason, "ETE");
-  ASSERT_EQ(def.linesMap.at("2").id, "2");
-  ASSERT_EQ(def.linesMap.at("2").activeSeason, "HIVER");
-  ASSERT_EQ(def.linesMap.at("3").id, "3");
-  ASSERT_EQ(def.linesMap.at("3").activeSeason, "UNDEFINED");
+  ASSERT_EQ(def.linesMap.at("0")->id, "0");
+  ASSERT_EQ(def.linesMap.at("0")->activeSeason, "ETE");
+  ASSERT_EQ(def.linesMap.at("2")->id, "2");
+  ASSERT_EQ(def.linesMap.at("2")->activeSeason, "HIVER");
+  ASSERT_EQ(def.linesMap.at("3")->id, "3");
+  ASSERT_EQ(def.linesMap.at("3")->activeSeason, "UNDEFINED");
 }
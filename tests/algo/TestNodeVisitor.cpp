@@ -0,0 +1,96 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  TestNodeVisitor.cpp
+ *
+ * @brief Node visitor test file
+ *
+ */
+
+#include "AlgorithmsResults.h"
+#include "NodeVisitor.h"
+#include "SlackNodeAlgorithm.h"
+#include "Tests.h"
+
+#include <string>
+#include <vector>
+
+namespace test {
+/**
+ * @brief Algorithm recording the nodes it processes
+ */
+class RecordingAlgorithm {
+ public:
+  /**
+   * @brief Constructor
+   *
+   * @param name the name of the algorithm
+   * @param calls the calls to update, as algorithm name and node id
+   */
+  RecordingAlgorithm(const std::string &name, std::vector<std::string> &calls) : name_(name), calls_(calls) {}
+
+  /**
+   * @brief Record the processing of a node
+   *
+   * @param node the node to process
+   * @param algoRes the algorithms results
+   */
+  void operator()(const dfl::NodePtr &node, std::shared_ptr<dfl::algo::AlgorithmsResults> &algoRes) {
+    calls_.push_back(name_ + ":" + node->id);
+    algoRes->isAtLeastOneGeneratorRegulating = true;
+  }
+
+ private:
+  std::string name_;                 ///< the name of the algorithm
+  std::vector<std::string> &calls_;  ///< the calls to update
+};
+}  // namespace test
+
+TEST(NodeVisitor, pipeline) {
+  auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
+  std::vector<std::shared_ptr<dfl::inputs::Node>> nodes{dfl::inputs::Node::build("0", vl, 0.0, {}), dfl::inputs::Node::build("1", vl, 1.0, {})};
+
+  std::vector<std::string> calls;
+  dfl::algo::OptionalAlgorithm<test::RecordingAlgorithm> enabled;
+  enabled.emplace("enabled", calls);
+  dfl::algo::OptionalAlgorithm<test::RecordingAlgorithm> disabled;
+  ASSERT_TRUE(enabled.enabled());
+  ASSERT_FALSE(disabled.enabled());
+
+  auto visitor = dfl::algo::makeNodeVisitor(test::RecordingAlgorithm("first", calls), disabled, enabled, test::RecordingAlgorithm("last", calls));
+  std::shared_ptr<dfl::algo::AlgorithmsResults> algoRes(new dfl::algo::AlgorithmsResults());
+  for (const auto &node : nodes) {
+    visitor(node, algoRes);
+  }
+
+  // all the algorithms are applied on a node before processing the next one
+  const std::vector<std::string> expectedCalls{"first:0", "enabled:0", "last:0", "first:1", "enabled:1", "last:1"};
+  ASSERT_EQ(expectedCalls, calls);
+  ASSERT_TRUE(algoRes->isAtLeastOneGeneratorRegulating);
+}
+
+TEST(NodeVisitor, nodeOnlyAlgorithms) {
+  auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
+  auto vl2 = std::make_shared<dfl::inputs::VoltageLevel>("VL2");
+  std::vector<std::shared_ptr<dfl::inputs::Node>> nodes{dfl::inputs::Node::build("0", vl, 0.0, {}), dfl::inputs::Node::build("1", vl, 1.0, {}),
+                                                        dfl::inputs::Node::build("2", vl2, 2.0, {})};
+
+  std::shared_ptr<dfl::inputs::Node> slackNode;
+  dfl::algo::OptionalAlgorithm<dfl::algo::SlackNodeAlgorithm> disabled;
+  auto visitor = dfl::algo::makeNodeVisitor(dfl::algo::SlackNodeAlgorithm(slackNode), disabled);
+  for (const auto &node : nodes) {
+    visitor(node);
+  }
+  ASSERT_EQ("2", slackNode->id);
+
+  dfl::algo::NodeVisitor<> empty;
+  empty(nodes.front());
+}
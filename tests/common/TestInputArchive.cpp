@@ -0,0 +1,113 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "InputArchive.h"
+#include "Log.h"
+#include "Tests.h"
+
+#include <boost/filesystem.hpp>
+#include <gtest_dynawo.h>
+
+#include <fstream>
+#include <iterator>
+#include <string>
+
+static std::string
+readAll(std::istream &stream) {
+  return std::string(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+}
+
+TEST(InputArchive, empty) {
+  const auto &archive = dfl::common::InputArchive::empty();
+  ASSERT_FALSE(archive.contains("res/inputs.json"));
+  ASSERT_FALSE(archive.exists("res/inputs.json"));
+  ASSERT_TRUE(archive.exists("res/inputs.zip"));
+
+  auto stream = archive.open("res/inputs.json");
+  ASSERT_FALSE(*stream);
+}
+
+TEST(InputArchive, read) {
+  dfl::common::InputArchive archive("res/inputs.zip");
+  ASSERT_TRUE(archive.contains("res/inputs.json"));
+  ASSERT_TRUE(archive.contains("res/dir/data.txt"));
+  ASSERT_TRUE(archive.contains("res/dir/../inputs.json"));
+  ASSERT_TRUE(archive.contains(boost::filesystem::absolute("res/dir/data.txt")));
+  ASSERT_FALSE(archive.contains("inputs.json"));
+  ASSERT_FALSE(archive.contains("res/inputs.zip"));
+  ASSERT_TRUE(archive.exists("res/inputs.zip"));
+  // entries are read from memory
+  ASSERT_FALSE(boost::filesystem::exists("res/inputs.json"));
+
+  auto stream = archive.open("res/dir/data.txt");
+  ASSERT_TRUE(*stream);
+  ASSERT_EQ(readAll(*stream), "0123456789");
+
+  stream = archive.open("res/dir/data.txt");
+  stream->seekg(4);
+  ASSERT_EQ(stream->get(), '4');
+  stream->seekg(-2, std::ios_base::end);
+  ASSERT_EQ(readAll(*stream), "89");
+
+  // files outside the archive are read from disk
+  stream = archive.open("res/inputs.zip");
+  ASSERT_TRUE(*stream);
+  ASSERT_EQ(readAll(*stream).size(), boost::filesystem::file_size("res/inputs.zip"));
+}
+
+TEST(InputArchive, extract) {
+  dfl::common::InputArchive archive("res/inputs.zip");
+  archive.extract("res/inputs.json");
+  archive.extract("res/archive.zip");  // not an entry: left untouched
+
+  ASSERT_TRUE(boost::filesystem::exists("res/inputs.json"));
+  // the extracted entry is dropped from memory and read from the disk
+  ASSERT_FALSE(archive.contains("res/inputs.json"));
+  ASSERT_TRUE(archive.exists("res/inputs.json"));
+  dfl::common::InputArchive reference("res/inputs.zip");
+  std::ifstream file("res/inputs.json", std::ios::binary);
+  auto stream = reference.open("res/inputs.json");
+  ASSERT_EQ(readAll(file), readAll(*stream));
+  file.close();
+  boost::filesystem::remove("res/inputs.json");
+}
+
+TEST(InputArchive, extractDirectory) {
+  dfl::common::InputArchive archive("res/inputs.zip");
+  // the directories of an entry are created when it is extracted
+  archive.extract("res/dir/data.txt");
+  ASSERT_FALSE(archive.contains("res/dir/data.txt"));
+  std::ifstream file("res/dir/data.txt", std::ios::binary);
+  ASSERT_EQ(readAll(file), "0123456789");
+  file.close();
+  boost::filesystem::remove_all("res/dir");
+}
+
+TEST(InputArchive, extractFailure) {
+  dfl::common::InputArchive archive("res/inputs.zip");
+  // a directory stands where the entry should be written
+  boost::filesystem::create_directories("res/inputs.json");
+  ASSERT_THROW_DYNAWO(archive.extract("res/inputs.json"), DYN::Error::GENERAL, dfl::KeyError_t::FileCreationFailed);
+  // the entry is kept, to be read from memory
+  ASSERT_TRUE(archive.contains("res/inputs.json"));
+  boost::filesystem::remove_all("res/inputs.json");
+}
+
+TEST(InputArchive, release) {
+  dfl::common::InputArchive archive("res/inputs.zip");
+  archive.release("res/inputs.json");
+  archive.release("res/archive.zip");  // not an entry: nothing to release
+
+  ASSERT_FALSE(archive.contains("res/inputs.json"));
+  ASSERT_FALSE(boost::filesystem::exists("res/inputs.json"));
+  ASSERT_TRUE(archive.contains("res/dir/data.txt"));
+}
+
+TEST(InputArchive, missingArchive) { ASSERT_ANY_THROW(dfl::common::InputArchive("res/missing.zip")); }
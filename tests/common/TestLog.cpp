@@ -0,0 +1,61 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "Log.h"
+#include "Tests.h"
+
+#include <future>
+#include <stdexcept>
+#include <string>
+
+TEST(Log, deferLogs) {
+  auto pending = std::async(std::launch::async, []() {
+    return dfl::common::Log::deferLogs([]() {
+      LOG(info, DynModelFileNotFound, "first.xml");
+      LOG(warn, DynModelFileNotFound, "second.xml");
+      return 42;
+    });
+  });
+  auto deferred = pending.get();
+
+  ASSERT_EQ(deferred.logs.size(), 2);
+  ASSERT_NE(deferred.logs[0].message.find("first.xml"), std::string::npos);
+  ASSERT_EQ(deferred.logs[0].trace, &DYN::Trace::info);
+  ASSERT_NE(deferred.logs[1].message.find("second.xml"), std::string::npos);
+  ASSERT_EQ(deferred.logs[1].trace, &DYN::Trace::warn);
+  ASSERT_EQ(dfl::common::Log::replayLogs(std::move(deferred)), 42);
+}
+
+TEST(Log, deferLogsError) {
+  auto deferred = dfl::common::Log::deferLogs([]() -> int {
+    LOG(info, DynModelFileNotFound, "first.xml");
+    throw std::runtime_error("failure");
+  });
+
+  ASSERT_EQ(deferred.logs.size(), 1);
+  ASSERT_THROW(dfl::common::Log::replayLogs(std::move(deferred)), std::runtime_error);
+}
+
+TEST(Log, deferLogsNested) {
+  auto outer = dfl::common::Log::deferLogs([]() {
+    auto inner = dfl::common::Log::deferLogs([]() {
+      LOG(info, DynModelFileNotFound, "inner.xml");
+      return 0;
+    });
+    // the logs of the outer task are deferred again once the inner task ended
+    LOG(info, DynModelFileNotFound, "outer.xml");
+    return inner;
+  });
+
+  ASSERT_EQ(outer.logs.size(), 1);
+  ASSERT_NE(outer.logs[0].message.find("outer.xml"), std::string::npos);
+  ASSERT_EQ(outer.value->logs.size(), 1);
+  ASSERT_NE(outer.value->logs[0].message.find("inner.xml"), std::string::npos);
+}
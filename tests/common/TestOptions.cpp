@@ -99,6 +99,89 @@ TEST(Options, archiveSA) {
   ASSERT_EQ(options.config().zipArchivePath, "res/archive.zip");
 }
 
+TEST(Options, snapshotCache) {
+  dfl::common::Options options;
+  char argv0[] = {"DynaFlowLauncher"};
+  char argv1[] = {"--network=test1.iidm"};
+  char argv2[] = {"--config=test1.json"};
+  char *argvDefault[] = {argv0, argv1, argv2};
+  auto status = options.parse(3, argvDefault);
+  ASSERT_EQ(dfl::common::Options::Request::RUN_SIMULATION_N, status);
+  ASSERT_TRUE(options.config().snapshotCacheDir.empty());
+
+  dfl::common::Options optionsCache;
+  char argv3[] = {"--snapshot-cache=res/snapshots"};
+  char *argv[] = {argv0, argv1, argv2, argv3};
+  status = optionsCache.parse(4, argv);
+  ASSERT_EQ(dfl::common::Options::Request::RUN_SIMULATION_N, status);
+  ASSERT_EQ(optionsCache.config().snapshotCacheDir, "res/snapshots");
+}
+
+TEST(Options, resultCache) {
+  dfl::common::Options options;
+  char argv0[] = {"DynaFlowLauncher"};
+  char argv1[] = {"--network=test1.iidm"};
+  char argv2[] = {"--config=test1.json"};
+  char argv3[] = {"--contingencies=contingencies.json"};
+  char *argvDefault[] = {argv0, argv1, argv2, argv3};
+  auto status = options.parse(4, argvDefault);
+  ASSERT_EQ(dfl::common::Options::Request::RUN_SIMULATION_SA, status);
+  ASSERT_TRUE(options.config().resultCacheDir.empty());
+  ASSERT_EQ(options.config().resultCacheMaxSize, 1024U);
+  ASSERT_FALSE(options.config().resultCacheDryRun);
+
+  dfl::common::Options optionsCache;
+  char argv4[] = {"--result-cache=res/results"};
+  char argv5[] = {"--result-cache-size=10"};
+  char argv6[] = {"--result-cache-dry-run"};
+  char *argv[] = {argv0, argv1, argv2, argv3, argv4, argv5, argv6};
+  status = optionsCache.parse(7, argv);
+  ASSERT_EQ(dfl::common::Options::Request::RUN_SIMULATION_SA, status);
+  ASSERT_EQ(optionsCache.config().resultCacheDir, "res/results");
+  ASSERT_EQ(optionsCache.config().resultCacheMaxSize, 10U);
+  ASSERT_TRUE(optionsCache.config().resultCacheDryRun);
+}
+
+TEST(Options, checkpoint) {
+  dfl::common::Options options;
+  char argv0[] = {"DynaFlowLauncher"};
+  char argv1[] = {"--network=test1.iidm"};
+  char argv2[] = {"--config=test1.json"};
+  char argv3[] = {"--contingencies=contingencies.json"};
+  char *argvDefault[] = {argv0, argv1, argv2, argv3};
+  auto status = options.parse(4, argvDefault);
+  ASSERT_EQ(dfl::common::Options::Request::RUN_SIMULATION_SA, status);
+  ASSERT_EQ(options.config().checkpointInterval, 0U);
+  ASSERT_FALSE(options.config().resume);
+
+  dfl::common::Options optionsCheckpoint;
+  char argv4[] = {"--checkpoint=100"};
+  char argv5[] = {"--resume"};
+  char *argv[] = {argv0, argv1, argv2, argv3, argv4, argv5};
+  status = optionsCheckpoint.parse(6, argv);
+  ASSERT_EQ(dfl::common::Options::Request::RUN_SIMULATION_SA, status);
+  ASSERT_EQ(optionsCheckpoint.config().checkpointInterval, 100U);
+  ASSERT_TRUE(optionsCheckpoint.config().resume);
+}
+
+TEST(Options, nbThreads) {
+  dfl::common::Options options;
+  char argv0[] = {"DynaFlowLauncher"};
+  char argv1[] = {"--network=test1.iidm"};
+  char argv2[] = {"--config=test1.json"};
+  char *argvDefault[] = {argv0, argv1, argv2};
+  auto status = options.parse(3, argvDefault);
+  ASSERT_EQ(dfl::common::Options::Request::RUN_SIMULATION_N, status);
+  ASSERT_EQ(options.config().nbThreads, 0);
+
+  dfl::common::Options optionsThreads;
+  char argv3[] = {"--nb-threads=4"};
+  char *argv[] = {argv0, argv1, argv2, argv3};
+  status = optionsThreads.parse(4, argv);
+  ASSERT_EQ(dfl::common::Options::Request::RUN_SIMULATION_N, status);
+  ASSERT_EQ(optionsThreads.config().nbThreads, 4);
+}
+
 TEST(Options, nominalLogLevel) {
   dfl::common::Options options;
 
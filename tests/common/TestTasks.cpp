@@ -0,0 +1,93 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "Tasks.h"
+#include "Tests.h"
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+TEST(Tasks, run) {
+  const unsigned int nbTasks = 100;
+  std::vector<unsigned int> results(nbTasks, 0);
+  std::vector<std::function<void()>> tasks;
+  for (unsigned int i = 0; i < nbTasks; ++i) {
+    tasks.push_back([i, &results]() { results[i] = i * i; });
+  }
+
+  for (unsigned int nbThreads : {0U, 1U, 4U, 200U}) {
+    std::fill(results.begin(), results.end(), 0);
+    const auto durations = dfl::common::runTasks(tasks, nbThreads);
+    ASSERT_EQ(durations.size(), nbTasks);
+    for (unsigned int i = 0; i < nbTasks; ++i) {
+      ASSERT_EQ(results[i], i * i);
+      ASSERT_GE(durations[i], 0.);
+    }
+  }
+
+  ASSERT_TRUE(dfl::common::runTasks({}, 4).empty());
+}
+
+TEST(Tasks, error) {
+  std::atomic<unsigned int> nbRun(0);
+  std::vector<std::function<void()>> tasks;
+  for (unsigned int i = 0; i < 10; ++i) {
+    tasks.push_back([i, &nbRun]() {
+      ++nbRun;
+      if (i == 3 || i == 7) {
+        throw std::runtime_error("task " + std::to_string(i));
+      }
+    });
+  }
+
+  // all the tasks run and the error of the first failing task is reported, whatever the number of threads
+  for (unsigned int nbThreads : {1U, 4U}) {
+    nbRun = 0;
+    try {
+      dfl::common::runTasks(tasks, nbThreads);
+      FAIL() << "an exception was expected";
+    } catch (const std::runtime_error &e) {
+      ASSERT_EQ(std::string(e.what()), "task 3");
+    }
+    ASSERT_EQ(nbRun, 10);
+  }
+}
+
+TEST(Tasks, dispatch) {
+  // a single process runs the tasks by decreasing cost, tasks of equal cost keeping their order
+  const std::vector<double> costs{1., 5., 2., 8., 2., 7.};
+  ASSERT_EQ(dfl::common::dispatchTasks(costs, 1), std::vector<std::size_t>({3, 5, 1, 2, 4, 0}));
+  ASSERT_EQ(dfl::common::dispatchTasks(costs, 0), std::vector<std::size_t>({3, 5, 1, 2, 4, 0}));
+
+  // the task at position k is run by the process k modulo 2: the most expensive task of each round goes to the least loaded process
+  auto order = dfl::common::dispatchTasks(costs, 2);
+  ASSERT_EQ(order, std::vector<std::size_t>({3, 5, 2, 1, 4, 0}));
+  std::vector<double> loads(2, 0.);
+  for (std::size_t position = 0; position < order.size(); ++position) {
+    loads[position % 2] += costs[order[position]];
+  }
+  ASSERT_DOUBLE_EQ(loads[0], 12.);
+  ASSERT_DOUBLE_EQ(loads[1], 13.);
+
+  // the last round only reaches the first processes
+  order = dfl::common::dispatchTasks({4., 1., 3., 10.}, 3);
+  ASSERT_EQ(order, std::vector<std::size_t>({3, 0, 2, 1}));
+
+  // every task is dispatched once, whatever the number of processes
+  for (unsigned int nbProcesses : {1U, 2U, 3U, 4U, 10U}) {
+    order = dfl::common::dispatchTasks(costs, nbProcesses);
+    std::sort(order.begin(), order.end());
+    ASSERT_EQ(order, std::vector<std::size_t>({0, 1, 2, 3, 4, 5}));
+  }
+  ASSERT_TRUE(dfl::common::dispatchTasks({}, 4).empty());
+}
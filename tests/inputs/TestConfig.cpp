@@ -106,9 +106,13 @@ TEST(Config, Default) {
   ASSERT_DOUBLE_EQUALS_DYNAWO(100., config.getTfoVoltageLevel());
   ASSERT_EQ(dfl::inputs::Configuration::ActivePowerCompensation::PMAX, config.getActivePowerCompensation());
   ASSERT_DOUBLE_EQUALS_DYNAWO(10., config.getTimeOfEvent());
+  ASSERT_FALSE(config.useSingleEventsParFile());
+  ASSERT_FALSE(config.isCostBasedScenarioOrderingOn());
   ASSERT_DOUBLE_EQUALS_DYNAWO(10., config.getTimeStep());
   ASSERT_DOUBLE_EQUALS_DYNAWO(1., config.getMinTimeStep());
   ASSERT_EQ(config.timeTableStep(), 0);
+  ASSERT_EQ(config.getNbThreads(), 1);
+  ASSERT_FALSE(config.useSingleDiagramFile());
 #if _DEBUG_
   ASSERT_TRUE(config.isChosenOutput(dfl::inputs::Configuration::ChosenOutputEnum::STEADYSTATE));
   ASSERT_TRUE(config.isChosenOutput(dfl::inputs::Configuration::ChosenOutputEnum::CONSTRAINTS));
@@ -145,6 +149,8 @@ TEST(Config, ConfigN) {
   ASSERT_DOUBLE_EQUALS_DYNAWO(2.2, config.getTimeStep());
   ASSERT_DOUBLE_EQUALS_DYNAWO(0.5, config.getMinTimeStep());
   ASSERT_EQ(config.timeTableStep(), 5);
+  ASSERT_EQ(config.getNbThreads(), 4);
+  ASSERT_TRUE(config.useSingleDiagramFile());
   ASSERT_EQ(canonical(config.criteriaFilePath().string()), canonical("myCriteriaFile.crt", prefixConfigFile));
 #if _DEBUG_
   ASSERT_TRUE(config.isChosenOutput(dfl::inputs::Configuration::ChosenOutputEnum::STEADYSTATE));
@@ -185,9 +191,13 @@ TEST(Config, ConfigSA) {
     ASSERT_DOUBLE_EQUALS_DYNAWO(1.2, config.getMinTimeStep());
     ASSERT_DOUBLE_EQUALS_DYNAWO(50, config.getTimeOfEvent());
     if (configFile == "res/config_SA.json") {
+      ASSERT_TRUE(config.useSingleEventsParFile());
+      ASSERT_TRUE(config.isCostBasedScenarioOrderingOn());
       ASSERT_EQ(canonical(config.startingDumpFilePath().string()), canonical("myStartingDumpFile.dmp", prefixConfigFile));
       ASSERT_EQ(canonical(config.criteriaFilePath().string()), canonical("myCriteriaFile.crt", prefixConfigFile));
     } else {
+      ASSERT_FALSE(config.useSingleEventsParFile());
+      ASSERT_FALSE(config.isCostBasedScenarioOrderingOn());
       ASSERT_TRUE(config.startingDumpFilePath().empty());
       ASSERT_TRUE(config.criteriaFilePath().empty());
     }
@@ -269,3 +279,37 @@ TEST(Config, ChosenOutputTest) {
     }
   }
 }
+
+TEST(Config, Archive) {
+  ASSERT_THROW_DYNAWO(dfl::inputs::Configuration config("res/archive/config.json"), DYN::Error::GENERAL, dfl::KeyError_t::ErrorConfigFileRead);
+
+  dfl::common::InputArchive archive("res/config_archive.zip");
+  dfl::inputs::Configuration config("res/archive/config.json", dfl::inputs::Configuration::SimulationKind::STEADY_STATE_CALCULATION, archive);
+  ASSERT_TRUE(config.useInfiniteReactiveLimits());
+  ASSERT_DOUBLE_EQUALS_DYNAWO(63.0, config.getDsoVoltageLevel());
+  ASSERT_DOUBLE_EQUALS_DYNAWO(120, config.getStopTime());
+
+  // the paths of the configuration are resolved as if the archive was extracted
+  ASSERT_TRUE(archive.contains(config.settingFilePaths().front()));
+  ASSERT_TRUE(archive.contains(config.assemblingFilePaths().front()));
+  ASSERT_EQ(config.settingFilePaths().front().filename(), "setting.xml");
+}
+
+TEST(Config, ArchiveDynawoInputs) {
+  dfl::common::InputArchive archive("res/config_archive_dump.zip");
+  dfl::inputs::Configuration config("res/archive_dump/config.json", dfl::inputs::Configuration::SimulationKind::STEADY_STATE_CALCULATION, archive);
+
+  // the starting dump and criteria files are given to Dynawo by path, in N as in SA
+  const auto filepaths = config.dynawoInputFilePaths();
+  ASSERT_EQ(filepaths.size(), 2);
+  ASSERT_EQ(filepaths[0], config.startingDumpFilePath());
+  ASSERT_EQ(filepaths[0].filename(), "initial.dmp");
+  ASSERT_EQ(filepaths[1], config.criteriaFilePath());
+  for (const auto &filepath : filepaths) {
+    ASSERT_TRUE(archive.contains(filepath));
+    archive.extract(filepath);
+    ASSERT_FALSE(archive.contains(filepath));
+    ASSERT_TRUE(boost::filesystem::exists(filepath));
+  }
+  boost::filesystem::remove_all("res/archive_dump");
+}
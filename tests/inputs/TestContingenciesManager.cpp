@@ -0,0 +1,110 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "ContingenciesManager.h"
+#include "Log.h"
+#include "Tests.h"
+
+#include <gtest_dynawo.h>
+
+#include <fstream>
+#include <string>
+
+using Type = dfl::inputs::ContingencyElement::Type;
+
+static std::string
+readError(const std::string &filepath) {
+  try {
+    dfl::inputs::ContingenciesManager manager(filepath);
+  } catch (const DYN::Error &e) {
+    return e.what();
+  }
+  return "";
+}
+
+TEST(ContingenciesManager, empty) {
+  dfl::inputs::ContingenciesManager manager("");
+  ASSERT_TRUE(manager.get().empty());
+}
+
+TEST(ContingenciesManager, nominal) {
+  dfl::inputs::ContingenciesManager manager("res/contingencies.json");
+  const auto &contingencies = manager.get();
+
+  // the contingency with an element of unknown type is dropped
+  ASSERT_EQ(contingencies.size(), 4);
+
+  ASSERT_EQ(contingencies[0].id, "load");
+  ASSERT_EQ(contingencies[0].elements.size(), 1);
+  ASSERT_EQ(contingencies[0].elements[0].id, "LOAD");
+  ASSERT_EQ(contingencies[0].elements[0].type, Type::LOAD);
+
+  // members are read in any order
+  ASSERT_EQ(contingencies[1].id, "line_and_load");
+  ASSERT_EQ(contingencies[1].elements.size(), 2);
+  ASSERT_EQ(contingencies[1].elements[0].id, "LINE \"1\"");
+  ASSERT_EQ(contingencies[1].elements[0].type, Type::BRANCH);
+  ASSERT_EQ(contingencies[1].elements[1].id, "LOAD");
+  ASSERT_EQ(contingencies[1].elements[1].type, Type::LOAD);
+
+  // 3-winding transformers are converted to 3 2-winding transformers
+  ASSERT_EQ(contingencies[2].id, "tfo3w");
+  ASSERT_EQ(contingencies[2].elements.size(), 3);
+  ASSERT_EQ(contingencies[2].elements[0].id, "TFO3W\xc3\xa9_1");
+  ASSERT_EQ(contingencies[2].elements[1].id, "TFO3W\xc3\xa9_2");
+  ASSERT_EQ(contingencies[2].elements[2].id, "TFO3W\xc3\xa9_3");
+  for (const auto &element : contingencies[2].elements) {
+    ASSERT_EQ(element.type, Type::TWO_WINDINGS_TRANSFORMER);
+  }
+
+  ASSERT_EQ(contingencies[3].id, "42");
+  ASSERT_TRUE(contingencies[3].elements.empty());
+}
+
+TEST(ContingenciesManager, malformed) {
+  ASSERT_THROW_DYNAWO(dfl::inputs::ContingenciesManager manager("res/missing_contingencies.json"), DYN::Error::GENERAL,
+                      dfl::KeyError_t::ContingenciesReadError);
+  ASSERT_THROW_DYNAWO(dfl::inputs::ContingenciesManager manager("res/contingencies_syntax_error.json"), DYN::Error::GENERAL,
+                      dfl::KeyError_t::ContingenciesReadError);
+  ASSERT_THROW_DYNAWO(dfl::inputs::ContingenciesManager manager("res/contingencies_missing_id.json"), DYN::Error::GENERAL,
+                      dfl::KeyError_t::ContingenciesReadError);
+  ASSERT_THROW_DYNAWO(dfl::inputs::ContingenciesManager manager("res/contingencies_missing_list.json"), DYN::Error::GENERAL,
+                      dfl::KeyError_t::ContingenciesReadError);
+
+  // errors are reported with the line they occur at
+  ASSERT_NE(readError("res/contingencies_syntax_error.json").find("contingencies_syntax_error.json(6)"), std::string::npos);
+  ASSERT_NE(readError("res/contingencies_missing_id.json").find("contingencies_missing_id.json(5)"), std::string::npos);
+}
+
+TEST(ContingenciesManager, large) {
+  const std::string filepath = "res/contingencies_large.json";
+  const unsigned int nbContingencies = 20000;
+  {
+    std::ofstream file(filepath);
+    file << "{\n  \"contingencies\" : [";
+    for (unsigned int i = 0; i < nbContingencies; ++i) {
+      file << (i == 0 ? "" : ",") << "{\n    \"id\" : \"N-2_" << i << "\",\n    \"elements\" : [ ";
+      file << "{ \"id\" : \"LINE_" << i % 100 << "\", \"type\" : \"LINE\" }, ";
+      file << "{ \"id\" : \"LINE_" << (i + 1) % 100 << "\", \"type\" : \"LINE\" } ]\n  }";
+    }
+    file << "]\n}\n";
+  }
+
+  dfl::inputs::ContingenciesManager manager(filepath);
+  const auto &contingencies = manager.get();
+  ASSERT_EQ(contingencies.size(), nbContingencies);
+  for (unsigned int i = 0; i < nbContingencies; ++i) {
+    ASSERT_EQ(contingencies[i].id, "N-2_" + std::to_string(i));
+    ASSERT_EQ(contingencies[i].elements.size(), 2);
+    ASSERT_EQ(contingencies[i].elements[0].id, "LINE_" + std::to_string(i % 100));
+    ASSERT_EQ(contingencies[i].elements[1].id, "LINE_" + std::to_string((i + 1) % 100));
+  }
+  std::remove(filepath.c_str());
+}
@@ -9,6 +9,7 @@
 //
 
 #include "DynamicDataBaseManager.h"
+#include "DynamicDataBaseSnapshot.h"
 #include "Log.h"
 #include "Tests.h"
 
@@ -30,6 +31,205 @@ TEST(TestDynamicDataBaseManager, base) {
   // The rest is considered covered by the unit tests of the members classes
 }
 
+TEST(TestDynamicDataBaseManager, archive) {
+  dfl::common::InputArchive archive("res/config_archive.zip");
+  dfl::inputs::DynamicDataBaseManager manager(std::vector<boost::filesystem::path>(1, "res/archive/setting.xml"),
+                                              std::vector<boost::filesystem::path>(1, "res/archive/assembling.xml"), archive);
+
+  ASSERT_NO_THROW(manager.setting().getSet("MODELE_1_5P3"));
+  ASSERT_NO_THROW(manager.assembling().getMacroConnection("ToUMeasurement"));
+  ASSERT_EQ(manager.assembling().dynamicAutomatons().size(), 4);
+}
+
+static void
+checkSameSetting(const dfl::inputs::SettingDataBase &setting, const dfl::inputs::SettingDataBase &restored) {
+  for (const char *id : {"MODELE_1_VL4", "MODELE_1_P3", "MODELE_1_5P3", "MODELE_1_IP3", "MODELE_2_GRAFF", "MODELE_2_TZE", "DM_M661", "DM_MUR",
+                         "DM_BRE", "DM_TAILLE", "DM_SALON", "DM_ORGON", "DM_ARDOISE", "DM_MEYM"}) {
+    const auto &set = setting.getSet(id);
+    const auto &restoredSet = restored.getSet(id);
+    ASSERT_EQ(set.id, restoredSet.id);
+    ASSERT_EQ(set.counts.size(), restoredSet.counts.size());
+    for (unsigned int i = 0; i < set.counts.size(); ++i) {
+      ASSERT_EQ(set.counts[i].name, restoredSet.counts[i].name);
+      ASSERT_EQ(set.counts[i].id, restoredSet.counts[i].id);
+    }
+    ASSERT_EQ(set.refs.size(), restoredSet.refs.size());
+    for (unsigned int i = 0; i < set.refs.size(); ++i) {
+      ASSERT_EQ(set.refs[i].id, restoredSet.refs[i].id);
+      ASSERT_EQ(set.refs[i].name, restoredSet.refs[i].name);
+      ASSERT_EQ(set.refs[i].tag, restoredSet.refs[i].tag);
+    }
+    ASSERT_EQ(set.references.size(), restoredSet.references.size());
+    for (unsigned int i = 0; i < set.references.size(); ++i) {
+      ASSERT_TRUE(set.references[i].componentId == restoredSet.references[i].componentId);
+      ASSERT_EQ(set.references[i].name, restoredSet.references[i].name);
+      ASSERT_EQ(set.references[i].origName, restoredSet.references[i].origName);
+      ASSERT_EQ(set.references[i].dataType, restoredSet.references[i].dataType);
+    }
+    ASSERT_EQ(set.doubleParameters.size(), restoredSet.doubleParameters.size());
+    for (unsigned int i = 0; i < set.doubleParameters.size(); ++i) {
+      ASSERT_EQ(set.doubleParameters[i].name, restoredSet.doubleParameters[i].name);
+      ASSERT_DOUBLE_EQ(set.doubleParameters[i].value, restoredSet.doubleParameters[i].value);
+    }
+    ASSERT_EQ(set.boolParameters.size(), restoredSet.boolParameters.size());
+    for (unsigned int i = 0; i < set.boolParameters.size(); ++i) {
+      ASSERT_EQ(set.boolParameters[i].name, restoredSet.boolParameters[i].name);
+      ASSERT_EQ(set.boolParameters[i].value, restoredSet.boolParameters[i].value);
+    }
+    ASSERT_EQ(set.integerParameters.size(), restoredSet.integerParameters.size());
+    for (unsigned int i = 0; i < set.integerParameters.size(); ++i) {
+      ASSERT_EQ(set.integerParameters[i].name, restoredSet.integerParameters[i].name);
+      ASSERT_EQ(set.integerParameters[i].value, restoredSet.integerParameters[i].value);
+    }
+    ASSERT_EQ(set.stringParameters.size(), restoredSet.stringParameters.size());
+    for (unsigned int i = 0; i < set.stringParameters.size(); ++i) {
+      ASSERT_EQ(set.stringParameters[i].name, restoredSet.stringParameters[i].name);
+      ASSERT_EQ(set.stringParameters[i].value, restoredSet.stringParameters[i].value);
+    }
+  }
+  ASSERT_THROW_DYNAWO(restored.getSet("dummy"), DYN::Error::GENERAL, dfl::KeyError_t::UnknownParamSet);
+}
+
+static void
+checkSameMacroConnection(const dfl::inputs::AssemblingDataBase::MacroConnection &macro,
+                         const dfl::inputs::AssemblingDataBase::MacroConnection &restoredMacro) {
+  ASSERT_EQ(macro.id, restoredMacro.id);
+  ASSERT_EQ(macro.network, restoredMacro.network);
+  ASSERT_EQ(macro.indexId, restoredMacro.indexId);
+  ASSERT_EQ(macro.connections.size(), restoredMacro.connections.size());
+  for (unsigned int i = 0; i < macro.connections.size(); ++i) {
+    ASSERT_EQ(macro.connections[i].var1, restoredMacro.connections[i].var1);
+    ASSERT_EQ(macro.connections[i].var2, restoredMacro.connections[i].var2);
+  }
+}
+
+static void
+checkSameAssembling(const dfl::inputs::AssemblingDataBase &assembling, const dfl::inputs::AssemblingDataBase &restored) {
+  ASSERT_EQ(assembling.containsSVC(), restored.containsSVC());
+  for (const char *id : {"ToUMeasurement", "ToControlledShunts", "ModelModelConnection"}) {
+    checkSameMacroConnection(assembling.getMacroConnection(id), restored.getMacroConnection(id));
+    ASSERT_EQ(assembling.hasNetworkMacroConnection(id), restored.hasNetworkMacroConnection(id));
+    if (assembling.hasNetworkMacroConnection(id)) {
+      checkSameMacroConnection(assembling.getMacroConnection(id, true), restored.getMacroConnection(id, true));
+    }
+  }
+  for (const char *id : {"MESURE_MODELE_1_VL4", "GEN1", "MESURE_MODELE_1_VL6", "MESURE_I_VL661", "TAP_VL661", "MESURE_I_SALON", "ORDER_SALON",
+                         "SHUNT_MODELE_VL6", "MESURE_MODELE_2_VL7", "HVDC_LINE", "HVDC_LINE_SIDE1", "HVDC_LINE_SIDE2", "GeneratorId", "GeneratorId2",
+                         "LoadId"}) {
+    ASSERT_TRUE(restored.isSingleAssociation(id));
+    const auto &association = assembling.getSingleAssociation(id);
+    const auto &restoredAssociation = restored.getSingleAssociation(id);
+    ASSERT_EQ(association.id, restoredAssociation.id);
+    ASSERT_EQ(association.bus.is_initialized(), restoredAssociation.bus.is_initialized());
+    if (association.bus) {
+      ASSERT_EQ(association.bus->voltageLevel, restoredAssociation.bus->voltageLevel);
+    }
+    ASSERT_EQ(association.tfo.is_initialized(), restoredAssociation.tfo.is_initialized());
+    if (association.tfo) {
+      ASSERT_EQ(association.tfo->name, restoredAssociation.tfo->name);
+    }
+    ASSERT_EQ(association.line.is_initialized(), restoredAssociation.line.is_initialized());
+    if (association.line) {
+      ASSERT_EQ(association.line->name, restoredAssociation.line->name);
+    }
+    ASSERT_EQ(association.hvdcLine.is_initialized(), restoredAssociation.hvdcLine.is_initialized());
+    if (association.hvdcLine) {
+      ASSERT_EQ(association.hvdcLine->name, restoredAssociation.hvdcLine->name);
+      ASSERT_EQ(association.hvdcLine->converterStation1, restoredAssociation.hvdcLine->converterStation1);
+    }
+    ASSERT_EQ(association.shunt.is_initialized(), restoredAssociation.shunt.is_initialized());
+    if (association.shunt) {
+      ASSERT_EQ(association.shunt->name, restoredAssociation.shunt->name);
+    }
+    ASSERT_EQ(association.generators.size(), restoredAssociation.generators.size());
+    for (unsigned int i = 0; i < association.generators.size(); ++i) {
+      ASSERT_EQ(association.generators[i].name, restoredAssociation.generators[i].name);
+    }
+    ASSERT_EQ(association.loads.size(), restoredAssociation.loads.size());
+    for (unsigned int i = 0; i < association.loads.size(); ++i) {
+      ASSERT_EQ(association.loads[i].name, restoredAssociation.loads[i].name);
+    }
+  }
+  for (const char *name : {"_GEN____1_SM", "GeneratorId1", "GeneratorId_1", "GeneratorId2", "GeneratorId_2", "dummy"}) {
+    ASSERT_EQ(assembling.getSingleAssociationFromGenerator(name), restored.getSingleAssociationFromGenerator(name));
+  }
+  for (const char *name : {"MyHvdc", "dummy"}) {
+    ASSERT_EQ(assembling.getSingleAssociationFromHvdcLine(name), restored.getSingleAssociationFromHvdcLine(name));
+  }
+  for (const char *id : {"SHUNTS_MODELE_1_VL4", "SHUNTS_MODELE_1_VL6"}) {
+    ASSERT_TRUE(restored.isMultipleAssociation(id));
+    ASSERT_EQ(assembling.getMultipleAssociation(id).id, restored.getMultipleAssociation(id).id);
+    ASSERT_EQ(assembling.getMultipleAssociation(id).shunt->voltageLevel, restored.getMultipleAssociation(id).shunt->voltageLevel);
+  }
+  ASSERT_FALSE(restored.isMultipleAssociation("dummy"));
+  ASSERT_EQ(assembling.dynamicAutomatons().size(), restored.dynamicAutomatons().size());
+  for (const auto &automaton : assembling.dynamicAutomatons()) {
+    const auto &restoredAutomaton = restored.dynamicAutomatons().at(automaton.first);
+    ASSERT_EQ(automaton.second.id, restoredAutomaton.id);
+    ASSERT_EQ(automaton.second.lib, restoredAutomaton.lib);
+    ASSERT_EQ(automaton.second.macroConnects.size(), restoredAutomaton.macroConnects.size());
+    for (unsigned int i = 0; i < automaton.second.macroConnects.size(); ++i) {
+      ASSERT_EQ(automaton.second.macroConnects[i].macroConnection, restoredAutomaton.macroConnects[i].macroConnection);
+      ASSERT_EQ(automaton.second.macroConnects[i].id, restoredAutomaton.macroConnects[i].id);
+      ASSERT_EQ(automaton.second.macroConnects[i].mandatory, restoredAutomaton.macroConnects[i].mandatory);
+    }
+  }
+  ASSERT_TRUE(restored.isProperty("MyProp"));
+  ASSERT_EQ(assembling.getProperty("MyProp").devices.size(), restored.getProperty("MyProp").devices.size());
+  for (unsigned int i = 0; i < assembling.getProperty("MyProp").devices.size(); ++i) {
+    ASSERT_EQ(assembling.getProperty("MyProp").devices[i].id, restored.getProperty("MyProp").devices[i].id);
+  }
+}
+
+TEST(TestDynamicDataBaseManager, snapshotCache) {
+  using dfl::inputs::DynamicDataBaseManager;
+  using dfl::inputs::DynamicDataBaseSnapshot;
+
+  boost::filesystem::path cacheDirectory(outputPathResults);
+  cacheDirectory.append("TestDynamicDataBaseManager").append("snapshots");
+  boost::filesystem::remove_all(cacheDirectory);
+
+  const std::vector<boost::filesystem::path> settingFilePaths(1, "res/setting.xml");
+  const std::vector<boost::filesystem::path> assemblingFilePaths(1, "res/assembling.xml");
+  const auto &archive = dfl::common::InputArchive::empty();
+  const auto settingSnapshot =
+      DynamicDataBaseSnapshot::filepath(cacheDirectory, "setting", DynamicDataBaseSnapshot::computeKey("setting", settingFilePaths, archive));
+  const auto assemblingSnapshot =
+      DynamicDataBaseSnapshot::filepath(cacheDirectory, "assembling", DynamicDataBaseSnapshot::computeKey("assembling", assemblingFilePaths, archive));
+  DynamicDataBaseManager manager(settingFilePaths, assemblingFilePaths);
+
+  // first run reads the documents and saves their snapshots
+  DynamicDataBaseManager managerSaved(settingFilePaths, assemblingFilePaths, archive, cacheDirectory);
+  ASSERT_TRUE(boost::filesystem::exists(settingSnapshot));
+  ASSERT_TRUE(boost::filesystem::exists(assemblingSnapshot));
+  checkSameSetting(manager.setting(), managerSaved.setting());
+  checkSameAssembling(manager.assembling(), managerSaved.assembling());
+
+  // next runs restore them, without reading the documents
+  dfl::inputs::SettingDataBase setting({});
+  ASSERT_TRUE(DynamicDataBaseSnapshot::read(settingSnapshot, DynamicDataBaseSnapshot::computeKey("setting", settingFilePaths, archive), setting));
+  checkSameSetting(manager.setting(), setting);
+  dfl::inputs::AssemblingDataBase assembling({});
+  ASSERT_TRUE(
+      DynamicDataBaseSnapshot::read(assemblingSnapshot, DynamicDataBaseSnapshot::computeKey("assembling", assemblingFilePaths, archive), assembling));
+  checkSameAssembling(manager.assembling(), assembling);
+  DynamicDataBaseManager managerRestored(settingFilePaths, assemblingFilePaths, archive, cacheDirectory);
+  checkSameSetting(manager.setting(), managerRestored.setting());
+  checkSameAssembling(manager.assembling(), managerRestored.assembling());
+
+  // a snapshot does not match another key, and a corrupted snapshot is ignored and saved again
+  ASSERT_FALSE(DynamicDataBaseSnapshot::read(settingSnapshot, DynamicDataBaseSnapshot::computeKey("assembling", settingFilePaths, archive), setting));
+  boost::filesystem::resize_file(settingSnapshot, boost::filesystem::file_size(settingSnapshot) / 2);
+  ASSERT_FALSE(DynamicDataBaseSnapshot::read(settingSnapshot, DynamicDataBaseSnapshot::computeKey("setting", settingFilePaths, archive), setting));
+  DynamicDataBaseManager managerCorrupted(settingFilePaths, assemblingFilePaths, archive, cacheDirectory);
+  checkSameSetting(manager.setting(), managerCorrupted.setting());
+  ASSERT_TRUE(DynamicDataBaseSnapshot::read(settingSnapshot, DynamicDataBaseSnapshot::computeKey("setting", settingFilePaths, archive), setting));
+
+  // snapshots of different documents are different
+  ASSERT_NE(DynamicDataBaseSnapshot::computeKey("setting", settingFilePaths, archive),
+            DynamicDataBaseSnapshot::computeKey("setting", std::vector<boost::filesystem::path>(1, "res/setting2.xml"), archive));
+}
+
 size_t dummySize = 0;
 
 static void
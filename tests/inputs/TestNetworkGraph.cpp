@@ -0,0 +1,107 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "NetworkGraph.h"
+#include "Tests.h"
+
+TEST(TestNetworkGraph, base) {
+  auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
+  auto node0 = dfl::inputs::Node::build("0", vl, 0.0, {});
+  auto node1 = dfl::inputs::Node::build("1", vl, 10., {});
+  auto node2 = dfl::inputs::Node::build("2", vl, 4.5, {});
+  auto node3 = dfl::inputs::Node::build("3", vl, 4.5, {});
+
+  auto line = dfl::inputs::Line::build("LINE", node0, node1, "ETE", true, true);
+  auto line2 = dfl::inputs::Line::build("LINE2", node1, node2, "UNDEFINED", true, false);
+  auto tfo = dfl::inputs::Tfo::build("TFO", node0, node1, node2, "UNDEFINED", true, true, true);
+  auto converter = std::make_shared<dfl::inputs::LCCConverter>("LCC", "2", nullptr, 1.);
+  node2->converters.push_back(converter);
+
+  dfl::inputs::NetworkGraph graph({node0, node1, node2});
+
+  ASSERT_EQ(graph.nbNodes(), 3);
+  ASSERT_TRUE(graph.contains(*node0));
+  ASSERT_TRUE(graph.contains(*node2));
+  ASSERT_FALSE(graph.contains(*node3));
+  ASSERT_EQ(node1->index, 1);
+  ASSERT_EQ(graph.node(2), node2);
+
+  ASSERT_EQ(graph.neighbours(0).size(), 3);
+  ASSERT_EQ(graph.neighbours(1).size(), 3);
+  ASSERT_EQ(graph.neighbours(2).size(), 2);
+  ASSERT_EQ(graph.neighbours(0)[0], 1);
+
+  ASSERT_EQ(graph.lines(0).size(), 1);
+  ASSERT_EQ(graph.lines(1).size(), 2);
+  ASSERT_TRUE(graph.lines(2).empty());
+  ASSERT_EQ(graph.line(graph.lines(0)[0]).id, "LINE");
+  ASSERT_EQ(graph.lines(0)[0], graph.lines(1)[0]);
+  ASSERT_EQ(graph.line(graph.lines(1)[1]).id, "LINE2");
+
+  ASSERT_EQ(graph.tfos(0).size(), 1);
+  ASSERT_EQ(graph.tfos(0)[0], graph.tfos(2)[0]);
+  ASSERT_EQ(graph.tfo(graph.tfos(1)[0]).id, "TFO");
+
+  ASSERT_TRUE(graph.converters(0).empty());
+  ASSERT_EQ(graph.converters(2).size(), 1);
+  ASSERT_EQ(graph.converter(graph.converters(2)[0]).converterId, "LCC");
+}
+
+TEST(TestNetworkGraph, compatibility) {
+  auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
+  auto node0 = dfl::inputs::Node::build("0", vl, 0.0, {});
+  auto node1 = dfl::inputs::Node::build("1", vl, 10., {});
+  auto line = dfl::inputs::Line::build("LINE", node0, node1, "ETE", true, true);
+  auto tfo = dfl::inputs::Tfo::build("TFO", node0, node1, "UNDEFINED", true, true);
+
+  std::vector<std::string> lineIds;
+  std::vector<std::string> tfoIds;
+  const auto &graph = dfl::inputs::NetworkGraph::empty();
+  ASSERT_FALSE(graph.contains(*node0));
+  graph.forEachLine(*node0, [&lineIds](const dfl::inputs::Line &line) { lineIds.push_back(line.id); });
+  graph.forEachTfo(*node1, [&tfoIds](const dfl::inputs::Tfo &tfo) { tfoIds.push_back(tfo.id); });
+  ASSERT_EQ(lineIds, std::vector<std::string>{"LINE"});
+  ASSERT_EQ(tfoIds, std::vector<std::string>{"TFO"});
+
+  dfl::inputs::NetworkGraph graph2({node1, node0});
+  lineIds.clear();
+  graph2.forEachLine(*node0, [&lineIds](const dfl::inputs::Line &line) { lineIds.push_back(line.id); });
+  ASSERT_EQ(lineIds, std::vector<std::string>{"LINE"});
+  ASSERT_EQ(node0->index, 1);
+}
+
+TEST(TestNetworkGraph, releaseNodeReferences) {
+  auto vl = std::make_shared<dfl::inputs::VoltageLevel>("VL");
+  auto node0 = dfl::inputs::Node::build("0", vl, 0.0, {});
+  auto node1 = dfl::inputs::Node::build("1", vl, 10., {});
+  auto node2 = dfl::inputs::Node::build("2", vl, 4.5, {});
+  auto line = dfl::inputs::Line::build("LINE", node0, node1, "ETE", true, true);
+  auto tfo = dfl::inputs::Tfo::build("TFO", node1, node2, "UNDEFINED", true, true);
+
+  dfl::inputs::NetworkGraph graph({node0, node1});
+  graph.releaseNodeReferences();
+  ASSERT_TRUE(node0->neighbours.empty());
+  ASSERT_TRUE(node1->lines.empty());
+  ASSERT_TRUE(node1->tfos.empty());
+  // the node not belonging to the graph keeps its references
+  ASSERT_EQ(node2->neighbours.size(), 1);
+
+  ASSERT_EQ(graph.nbNeighbours(*node1), 1);
+  ASSERT_EQ(graph.neighbour(*node1, 0), node0);
+  ASSERT_EQ(graph.nbNeighbours(*node2), 1);
+  ASSERT_EQ(graph.neighbour(*node2, 0), node1);
+
+  std::vector<std::string> lineIds;
+  std::vector<std::string> tfoIds;
+  graph.forEachLine(*node1, [&lineIds](const dfl::inputs::Line &line) { lineIds.push_back(line.id); });
+  graph.forEachTfo(*node1, [&tfoIds](const dfl::inputs::Tfo &tfo) { tfoIds.push_back(tfo.id); });
+  ASSERT_EQ(lineIds, std::vector<std::string>{"LINE"});
+  ASSERT_EQ(tfoIds, std::vector<std::string>{"TFO"});
+}
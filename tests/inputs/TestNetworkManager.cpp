@@ -9,6 +9,7 @@
 //
 
 #include "NetworkManager.h"
+#include "NetworkSnapshot.h"
 #include "Tests.h"
 
 #include <DYNMultiProcessingContext.h>
@@ -125,3 +126,149 @@ TEST(NetworkManager, initialConditions) {
   ASSERT_FALSE(manager3.isFullyConditioned());
   ASSERT_TRUE(manager3.isPartiallyConditioned());
 }
+
+static std::vector<std::shared_ptr<dfl::inputs::Node>> collectNodes(dfl::inputs::NetworkManager &manager) {
+  std::vector<std::shared_ptr<dfl::inputs::Node>> nodes;
+  manager.onNode([&nodes](const std::shared_ptr<dfl::inputs::Node> &node) { nodes.push_back(node); });
+  manager.walkNodes();
+  return nodes;
+}
+
+template<class T>
+static std::vector<std::string> ids(const std::vector<T> &elements) {
+  std::vector<std::string> ret;
+  std::transform(elements.begin(), elements.end(), std::back_inserter(ret), [](const T &element) { return element.id; });
+  return ret;
+}
+
+static std::vector<std::string> neighboursIds(const dfl::inputs::NetworkGraph &graph, const dfl::inputs::Node &node) {
+  std::vector<std::string> ret;
+  for (std::size_t i = 0; i < graph.nbNeighbours(node); ++i) {
+    ret.push_back(graph.neighbour(node, i)->id);
+  }
+  return ret;
+}
+
+static std::vector<std::string> linesIds(const dfl::inputs::NetworkGraph &graph, const dfl::inputs::Node &node) {
+  std::vector<std::string> ret;
+  graph.forEachLine(node, [&ret](const dfl::inputs::Line &line) { ret.push_back(line.id); });
+  return ret;
+}
+
+static std::vector<std::string> tfosIds(const dfl::inputs::NetworkGraph &graph, const dfl::inputs::Node &node) {
+  std::vector<std::string> ret;
+  graph.forEachTfo(node, [&ret](const dfl::inputs::Tfo &tfo) { ret.push_back(tfo.id); });
+  return ret;
+}
+
+static std::vector<std::string> convertersIds(const dfl::inputs::NetworkGraph &graph, const dfl::inputs::Node &node) {
+  std::vector<std::string> ret;
+  graph.forEachConverter(node, [&ret](const dfl::inputs::Converter &converter) { ret.push_back(converter.converterId); });
+  return ret;
+}
+
+static void checkSameNodeTree(dfl::inputs::NetworkManager &manager, dfl::inputs::NetworkManager &other) {
+  ASSERT_EQ(manager.getBusRegulationMap(), other.getBusRegulationMap());
+  ASSERT_EQ(manager.isFullyConditioned(), other.isFullyConditioned());
+  ASSERT_EQ(manager.isPartiallyConditioned(), other.isPartiallyConditioned());
+  ASSERT_EQ(manager.getSlackNode().is_initialized(), other.getSlackNode().is_initialized());
+  ASSERT_EQ(manager.getHvdcLine().size(), other.getHvdcLine().size());
+  for (unsigned int i = 0; i < manager.getHvdcLine().size(); ++i) {
+    ASSERT_TRUE(hvdcLineEqual(*manager.getHvdcLine()[i], *other.getHvdcLine()[i]));
+  }
+
+  auto nodes = collectNodes(manager);
+  auto otherNodes = collectNodes(other);
+  ASSERT_EQ(nodes.size(), otherNodes.size());
+  for (unsigned int i = 0; i < nodes.size(); ++i) {
+    const auto &node = *nodes[i];
+    const auto &otherNode = *otherNodes[i];
+    ASSERT_EQ(node.id, otherNode.id);
+    ASSERT_EQ(node.voltageLevel.lock()->id, otherNode.voltageLevel.lock()->id);
+    ASSERT_EQ(neighboursIds(manager.graph(), node), neighboursIds(other.graph(), otherNode));
+    ASSERT_EQ(ids(node.shunts), ids(otherNode.shunts));
+    ASSERT_EQ(ids(node.loads), ids(otherNode.loads));
+    ASSERT_EQ(ids(node.generators), ids(otherNode.generators));
+    ASSERT_EQ(ids(node.svarcs), ids(otherNode.svarcs));
+    ASSERT_EQ(ids(node.danglingLines), ids(otherNode.danglingLines));
+    ASSERT_EQ(ids(node.busBarSections), ids(otherNode.busBarSections));
+    ASSERT_EQ(linesIds(manager.graph(), node), linesIds(other.graph(), otherNode));
+    ASSERT_EQ(tfosIds(manager.graph(), node), tfosIds(other.graph(), otherNode));
+    ASSERT_EQ(convertersIds(manager.graph(), node), convertersIds(other.graph(), otherNode));
+    // the graph is the only store of the topology
+    ASSERT_TRUE(node.neighbours.empty());
+    ASSERT_TRUE(node.lines.empty());
+  }
+}
+
+TEST(NetworkManager, buildTreeMultipleThreads) {
+  using dfl::inputs::NetworkManager;
+
+  for (const char *file : {"res/IEEE14.iidm", "res/HvdcDangling.iidm", "res/Generators.iidm", "res/initial_conditions_partially_OK.iidm"}) {
+    NetworkManager manager(file);
+    NetworkManager managerThreads(file, 4);
+    checkSameNodeTree(manager, managerThreads);
+  }
+}
+
+TEST(NetworkManager, snapshotCache) {
+  using dfl::inputs::NetworkManager;
+  using dfl::inputs::NetworkSnapshot;
+
+  boost::filesystem::path cacheDirectory(outputPathResults);
+  cacheDirectory.append("TestNetworkManager").append("snapshots");
+  boost::filesystem::remove_all(cacheDirectory);
+
+  for (const char *file : {"res/IEEE14.iidm", "res/HvdcDangling.iidm", "res/Generators.iidm", "res/initial_conditions_partially_OK.iidm"}) {
+    const auto snapshotFilepath = NetworkSnapshot::filepath(cacheDirectory, NetworkSnapshot::computeKey(file));
+    NetworkManager manager(file);
+
+    // first run builds the node tree and saves its snapshot
+    NetworkManager managerSaved(file, 1, cacheDirectory);
+    ASSERT_FALSE(managerSaved.isRestoredFromSnapshot());
+    ASSERT_TRUE(boost::filesystem::exists(snapshotFilepath));
+    checkSameNodeTree(manager, managerSaved);
+
+    // next runs restore it
+    NetworkManager managerRestored(file, 1, cacheDirectory);
+    ASSERT_TRUE(managerRestored.isRestoredFromSnapshot());
+    checkSameNodeTree(manager, managerRestored);
+    auto nodes = collectNodes(manager);
+    auto restoredNodes = collectNodes(managerRestored);
+    for (unsigned int i = 0; i < nodes.size(); ++i) {
+      ASSERT_EQ(nodes[i]->getBusesConnectedByVoltageLevel(), restoredNodes[i]->getBusesConnectedByVoltageLevel());
+      ASSERT_EQ(nodes[i]->isBusConnected(), restoredNodes[i]->isBusConnected());
+    }
+    ASSERT_TRUE(managerRestored.dataInterface());
+
+    // a corrupted snapshot is ignored and saved again
+    boost::filesystem::resize_file(snapshotFilepath, boost::filesystem::file_size(snapshotFilepath) / 2);
+    NetworkManager managerCorrupted(file, 1, cacheDirectory);
+    ASSERT_FALSE(managerCorrupted.isRestoredFromSnapshot());
+    checkSameNodeTree(manager, managerCorrupted);
+    NetworkManager managerRestoredAgain(file, 1, cacheDirectory);
+    ASSERT_TRUE(managerRestoredAgain.isRestoredFromSnapshot());
+  }
+
+  // snapshots of different network files are different
+  ASSERT_NE(NetworkSnapshot::computeKey("res/IEEE14.iidm"), NetworkSnapshot::computeKey("res/Generators.iidm"));
+}
+
+TEST(NetworkManager, switchTopology) {
+  using dfl::inputs::NetworkManager;
+
+  for (const char *file : {"res/IEEE14.iidm", "res/HvdcDangling.iidm", "res/IEEE14_disconnected_shunts.iidm"}) {
+    NetworkManager manager(file);
+    auto serviceManager = manager.dataInterface()->getServiceManager();
+
+    for (const auto &node : collectNodes(manager)) {
+      auto vl = node->voltageLevel.lock();
+      ASSERT_TRUE(vl->switchTopology.contains(node->id));
+      auto busesConnected = node->getBusesConnectedByVoltageLevel();
+      auto expectedBusesConnected = serviceManager->getBusesConnectedBySwitch(node->id, vl->id);
+      std::sort(busesConnected.begin(), busesConnected.end());
+      std::sort(expectedBusesConnected.begin(), expectedBusesConnected.end());
+      ASSERT_EQ(expectedBusesConnected, busesConnected);
+    }
+  }
+}
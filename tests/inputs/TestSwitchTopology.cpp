@@ -0,0 +1,57 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "SwitchTopology.h"
+#include "Tests.h"
+
+TEST(SwitchTopology, base) {
+  using dfl::inputs::SwitchTopology;
+
+  SwitchTopology topology;
+  for (const char *bus : {"0", "1", "2", "3", "4", "5"}) {
+    topology.addBus(bus);
+  }
+  topology.connect("0", "1");
+  topology.connect("3", "1");
+  topology.connect("4", "5");
+  topology.connect("5", "4");
+  topology.connect("6", "2");  // bus not registered yet
+  topology.build();
+
+  ASSERT_EQ(3, topology.nbComponents());
+  ASSERT_TRUE(topology.contains("6"));
+  ASSERT_FALSE(topology.contains("7"));
+
+  ASSERT_EQ(topology.component("0"), topology.component("1"));
+  ASSERT_EQ(topology.component("0"), topology.component("3"));
+  ASSERT_EQ(topology.component("4"), topology.component("5"));
+  ASSERT_EQ(topology.component("2"), topology.component("6"));
+  ASSERT_NE(topology.component("0"), topology.component("4"));
+  ASSERT_NE(topology.component("0"), topology.component("2"));
+
+  ASSERT_EQ(std::vector<std::string>({"1", "3"}), topology.busesConnected("0"));
+  ASSERT_EQ(std::vector<std::string>({"0", "1"}), topology.busesConnected("3"));
+  ASSERT_EQ(std::vector<std::string>({"4"}), topology.busesConnected("5"));
+  ASSERT_EQ(std::vector<std::string>({"6"}), topology.busesConnected("2"));
+}
+
+TEST(SwitchTopology, noSwitch) {
+  using dfl::inputs::SwitchTopology;
+
+  SwitchTopology topology;
+  topology.addBus("0");
+  topology.addBus("1");
+  topology.addBus("0");
+  topology.build();
+
+  ASSERT_EQ(2, topology.nbComponents());
+  ASSERT_TRUE(topology.busesConnected("0").empty());
+  ASSERT_TRUE(topology.busesConnected("1").empty());
+}
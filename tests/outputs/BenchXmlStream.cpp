@@ -0,0 +1,182 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  BenchXmlStream.cpp
+ *
+ * @brief Benchmark of the streaming writers of the DYD and PAR files
+ *
+ * Compares the export of the whole collections with the streaming writers, exporting the elements one at a time as they did first
+ * and by batches. Only built when DYNAFLOW_LAUNCHER_BUILD_BENCHMARKS is ON.
+ */
+
+#include "DydCommon.h"
+#include "DydStream.h"
+#include "OutputsConstants.h"
+#include "ParCommon.h"
+#include "ParStream.h"
+#include "Tests.h"
+
+#include <DYDDynamicModelsCollectionFactory.h>
+#include <DYDMacroConnectFactory.h>
+#include <DYDXmlExporter.h>
+#include <PARParametersSetCollectionFactory.h>
+#include <PARParametersSetFactory.h>
+#include <PARXmlExporter.h>
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <sstream>
+
+testing::Environment *initXmlEnvironment();
+
+testing::Environment *const env = initXmlEnvironment();
+
+namespace bench {
+
+/// @brief Number of loads of the network, each one having a black box model, a macro connection, a connection and a parameters set
+static const unsigned int nbLoads = 200000;
+/// @brief Number of runs of each export, the best duration being kept
+static const unsigned int nbRuns = 3;
+
+/**
+ * @brief Id of an element, the elements being added in an order different from the order of their ids
+ *
+ * @param prefix the prefix of the id
+ * @param index the index of the element
+ * @returns the id
+ */
+static std::string
+elementId(const std::string &prefix, unsigned int index) {
+  return prefix + "_" + std::to_string((index * 7919) % nbLoads);
+}
+
+static std::unique_ptr<dynamicdata::BlackBoxModel>
+buildModel(unsigned int i) {
+  return dfl::outputs::helper::buildBlackBoxStaticId(elementId("LOAD", i), elementId("LOAD", i), "DYNModelLoadRestorativeWithLimits", "BenchXmlStream.par",
+                                                     elementId("SET", i));
+}
+
+static std::shared_ptr<parameters::ParametersSet>
+buildSet(unsigned int i) {
+  auto set = parameters::ParametersSetFactory::newParametersSet(elementId("SET", i));
+  set->addParameter(dfl::outputs::helper::buildParameter("load_Alpha", 1.5 * i));
+  set->addReference(dfl::outputs::helper::buildReference("load_P0Pu", "p0_pu", "DOUBLE"));
+  return set;
+}
+
+/**
+ * @brief Measure the best duration of an export
+ *
+ * @param exportFile the export, writing the file into the given stream
+ * @param file the file written by the last run
+ * @returns the best duration over the runs
+ */
+static std::chrono::milliseconds
+measure(const std::function<void(std::ostream &)> &exportFile, std::string &file) {
+  auto best = std::chrono::milliseconds::max();
+  for (unsigned int i = 0; i < nbRuns; ++i) {
+    std::ostringstream out;
+    auto start = std::chrono::steady_clock::now();
+    exportFile(out);
+    best = std::min(best, std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start));
+    file = out.str();
+  }
+  return best;
+}
+
+/**
+ * @brief Export the DYD file with a streaming writer, all the elements being added at each pass as Dyd does
+ *
+ * @param out the stream to write into
+ * @param batchSize the maximum number of elements exported at once
+ */
+static void
+streamDyd(std::ostream &out, std::size_t batchSize) {
+  dfl::outputs::DydStream stream(out, batchSize);
+  do {
+    for (unsigned int i = 0; i < nbLoads; ++i) {
+      stream.addModel(elementId("LOAD", i), [i]() { return buildModel(i); });
+      stream.addMacroConnect(dynamicdata::MacroConnectFactory::newMacroConnect("LOAD_NETWORK_CONNECTOR", elementId("LOAD", i), "NETWORK"));
+      stream.addConnect(elementId("LOAD", i), "load_switchOffSignal1", "NETWORK", elementId("BUS", i) + "_switchOff");
+    }
+  } while (stream.nextPass());
+}
+
+/**
+ * @brief Export the PAR file with a streaming writer
+ *
+ * @param out the stream to write into
+ * @param batchSize the maximum number of sets exported at once
+ */
+static void
+streamPar(std::ostream &out, std::size_t batchSize) {
+  dfl::outputs::ParStream stream(out, batchSize);
+  for (unsigned int i = 0; i < nbLoads; ++i) {
+    stream.addParametersSet(elementId("SET", i), [i]() { return buildSet(i); });
+  }
+  stream.write();
+}
+
+}  // namespace bench
+
+TEST(BenchXmlStream, dyd) {
+  std::string collectionFile;
+  auto collectionDuration = bench::measure(
+      [](std::ostream &out) {
+        auto collection = dynamicdata::DynamicModelsCollectionFactory::newCollection();
+        for (unsigned int i = 0; i < bench::nbLoads; ++i) {
+          collection->addModel(bench::buildModel(i));
+          collection->addMacroConnect(
+              dynamicdata::MacroConnectFactory::newMacroConnect("LOAD_NETWORK_CONNECTOR", bench::elementId("LOAD", i), "NETWORK"));
+          collection->addConnect(bench::elementId("LOAD", i), "load_switchOffSignal1", "NETWORK", bench::elementId("BUS", i) + "_switchOff");
+        }
+        dynamicdata::XmlExporter exporter;
+        exporter.exportToStream(collection, out, dfl::outputs::constants::xmlEncoding);
+      },
+      collectionFile);
+
+  std::string elementFile;
+  auto elementDuration = bench::measure([](std::ostream &out) { bench::streamDyd(out, 1); }, elementFile);
+  std::string batchFile;
+  auto batchDuration = bench::measure([](std::ostream &out) { bench::streamDyd(out, dfl::outputs::XmlDocumentWriter::defaultBatchSize); }, batchFile);
+
+  ASSERT_EQ(collectionFile, elementFile);
+  ASSERT_EQ(collectionFile, batchFile);
+  std::cout << "DYD file of " << bench::nbLoads << " loads, " << collectionFile.size() << " bytes: whole collection " << collectionDuration.count()
+            << "ms, stream by element " << elementDuration.count() << "ms, stream by batch of " << dfl::outputs::XmlDocumentWriter::defaultBatchSize
+            << " elements " << batchDuration.count() << "ms" << std::endl;
+}
+
+TEST(BenchXmlStream, par) {
+  std::string collectionFile;
+  auto collectionDuration = bench::measure(
+      [](std::ostream &out) {
+        auto collection = parameters::ParametersSetCollectionFactory::newCollection();
+        for (unsigned int i = 0; i < bench::nbLoads; ++i) {
+          collection->addParametersSet(bench::buildSet(i));
+        }
+        parameters::XmlExporter exporter;
+        exporter.exportToStream(std::move(collection), out, dfl::outputs::constants::xmlEncoding);
+      },
+      collectionFile);
+
+  std::string elementFile;
+  auto elementDuration = bench::measure([](std::ostream &out) { bench::streamPar(out, 1); }, elementFile);
+  std::string batchFile;
+  auto batchDuration = bench::measure([](std::ostream &out) { bench::streamPar(out, dfl::outputs::XmlDocumentWriter::defaultBatchSize); }, batchFile);
+
+  ASSERT_EQ(collectionFile, elementFile);
+  ASSERT_EQ(collectionFile, batchFile);
+  std::cout << "PAR file of " << bench::nbLoads << " sets, " << collectionFile.size() << " bytes: whole collection " << collectionDuration.count()
+            << "ms, stream by set " << elementDuration.count() << "ms, stream by batch of " << dfl::outputs::XmlDocumentWriter::defaultBatchSize
+            << " sets " << batchDuration.count() << "ms" << std::endl;
+}
@@ -116,6 +116,108 @@ TEST(Diagram, writeWithCurveAndDefaultPoints) {
   testMultiplesFilesEquality(generators, outputDirectory, basename, prefixDir);
 }
 
+TEST(Diagram, writeShared) {
+  using dfl::algo::GeneratorDefinition;
+
+  std::string basename = "TestDiagram";
+  std::string prefixDir = "Shared";
+  boost::filesystem::path outputDirectory(outputPathResults);
+  outputDirectory.append(basename);
+
+  if (!boost::filesystem::exists(outputDirectory)) {
+    boost::filesystem::create_directories(outputDirectory);
+  }
+  outputDirectory.append(prefixDir + dfl::common::constants::diagramDirectorySuffix);
+  const std::string bus1 = "BUS_1";
+
+  dfl::algo::ReactiveDiagramPool diagrams;
+  auto diagram = diagrams.get({GeneratorDefinition::ReactiveCurvePoint(2., 22., 220.), GeneratorDefinition::ReactiveCurvePoint(1., 11., 110.)}, 1., 10., 11.,
+                              110.);
+  ASSERT_EQ(diagrams.get({GeneratorDefinition::ReactiveCurvePoint(1., 11., 110.), GeneratorDefinition::ReactiveCurvePoint(2., 22., 220.)}, 1., 10., 11., 110.),
+            diagram);
+  std::vector<GeneratorDefinition> generators = {
+      GeneratorDefinition("G3", GeneratorDefinition::ModelType::DIAGRAM_PQ_SIGNALN, "03", diagram, 1., 10., 11., 110., 0, 100, bus1),
+      GeneratorDefinition("G1", GeneratorDefinition::ModelType::DIAGRAM_PQ_SIGNALN, "01", diagram, 1., 10., 11., 110., 0, 100, bus1),
+      GeneratorDefinition("G0", GeneratorDefinition::ModelType::SIGNALN_RECTANGULAR, "00", diagram, 1., 10., 11., 110., 0, 100, bus1)};
+
+  dfl::algo::HVDCLineDefinitions defs;
+  dfl::outputs::Diagram DiagramWriter(dfl::outputs::Diagram::DiagramDefinition(basename, outputDirectory.generic_string(), generators, defs));
+
+  DiagramWriter.write();
+
+  // the shared diagram is written once, named after the generator with the smallest id among the generators using a diagram file
+  boost::filesystem::path outputDir(outputDirectory);
+  ASSERT_TRUE(boost::filesystem::exists(boost::filesystem::path(outputDir).append(dfl::outputs::constants::diagramFilename("G1"))));
+  ASSERT_FALSE(boost::filesystem::exists(boost::filesystem::path(outputDir).append(dfl::outputs::constants::diagramFilename("G3"))));
+  ASSERT_FALSE(boost::filesystem::exists(boost::filesystem::path(outputDir).append(dfl::outputs::constants::diagramFilename("G0"))));
+  ASSERT_EQ(dfl::algo::nameReactiveDiagrams(generators).at(diagram.get()), "G1");
+}
+
+TEST(Diagram, writeSingleFile) {
+  using dfl::algo::GeneratorDefinition;
+  using dfl::algo::HVDCDefinition;
+
+  std::string basename = "TestDiagram";
+  std::string prefixDir = "Single";
+  boost::filesystem::path outputDirectory(outputPathResults);
+  outputDirectory.append(basename);
+
+  if (!boost::filesystem::exists(outputDirectory)) {
+    boost::filesystem::create_directories(outputDirectory);
+  }
+  outputDirectory.append(prefixDir + dfl::common::constants::diagramDirectorySuffix);
+  const std::string bus1 = "BUS_1";
+
+  std::vector<GeneratorDefinition> generators = {GeneratorDefinition("G0", GeneratorDefinition::ModelType::REMOTE_DIAGRAM_PQ_SIGNALN, "00",
+                                                                     {
+                                                                         GeneratorDefinition::ReactiveCurvePoint(1., 11., 110.),
+                                                                         GeneratorDefinition::ReactiveCurvePoint(3., 33., 330.),
+                                                                         GeneratorDefinition::ReactiveCurvePoint(4., 44., 440.),
+                                                                         GeneratorDefinition::ReactiveCurvePoint(2., 22., 220.),
+                                                                     },
+                                                                     1., 10., -11., 110., 0, 100, bus1),
+                                                 GeneratorDefinition("G1", GeneratorDefinition::ModelType::SIGNALN_INFINITE, "01", {}, -20., -2., 22., 220.,
+                                                                     0, 100, bus1),
+                                                 GeneratorDefinition("G2", GeneratorDefinition::ModelType::PROP_DIAGRAM_PQ_SIGNALN, "02",
+                                                                     {
+                                                                         GeneratorDefinition::ReactiveCurvePoint(8., 44., 440.),
+                                                                         GeneratorDefinition::ReactiveCurvePoint(7., 44., 440.),
+                                                                         GeneratorDefinition::ReactiveCurvePoint(10., 987., 2394.43),
+                                                                         GeneratorDefinition::ReactiveCurvePoint(6., 44., 31.),
+                                                                         GeneratorDefinition::ReactiveCurvePoint(5., 42., 49.),
+                                                                         GeneratorDefinition::ReactiveCurvePoint(59.8, 484., 440.),
+                                                                         GeneratorDefinition::ReactiveCurvePoint(1., 11., 110.),
+                                                                         GeneratorDefinition::ReactiveCurvePoint(2., 22., 220.),
+                                                                         GeneratorDefinition::ReactiveCurvePoint(3., 33., 330.),
+                                                                         GeneratorDefinition::ReactiveCurvePoint(4., 44., 440.),
+                                                                         GeneratorDefinition::ReactiveCurvePoint(2.7, 22., 220.),
+                                                                     },
+                                                                     3., 30., 33., 330., 0, 100, bus1)};
+
+  dfl::algo::VSCDefinition vscStation3("VSCStation3", 53, -53, 50, 23, {});
+  dfl::algo::VSCDefinition vscStation4("VSCStation4", 54, -54, 50, 24, {});
+  dfl::algo::HVDCLineDefinitions::HvdcLineMap map{
+      std::make_pair("2",
+                     HVDCDefinition("HVDCVSCLine2", dfl::inputs::HvdcLine::ConverterType::VSC, "VSCStation3", "_BUS___13_TN", false, "VSCStation4",
+                                    "_BUS___14_TN", false, HVDCDefinition::Position::BOTH_IN_MAIN_COMPONENT, HVDCDefinition::HVDCModel::HvdcPVDanglingDiagramPQ,
+                                    {}, 0., vscStation3, vscStation4, boost::none, boost::none, false, 320, 322, 0.125, {0.01, 0.01}, true)),
+  };
+  dfl::algo::HVDCLineDefinitions defs{map};
+
+  dfl::outputs::Diagram DiagramWriter(dfl::outputs::Diagram::DiagramDefinition(basename, outputDirectory.generic_string(), generators, defs, true));
+
+  DiagramWriter.write();
+
+  // the tables of all the elements are gathered in a single file, with the same names as in the per element files
+  const std::string filename = dfl::outputs::constants::diagramTablesFilename(basename);
+  boost::filesystem::path reference("reference");
+  reference.append(basename).append(prefixDir + dfl::common::constants::diagramDirectorySuffix).append(filename);
+  boost::filesystem::path outputDir(outputDirectory);
+  dfl::test::checkFilesEqual(boost::filesystem::path(outputDir).append(filename).generic_string(), reference.generic_string());
+  ASSERT_FALSE(boost::filesystem::exists(boost::filesystem::path(outputDir).append(dfl::outputs::constants::diagramFilename("G0"))));
+  ASSERT_FALSE(boost::filesystem::exists(boost::filesystem::path(outputDir).append(dfl::outputs::constants::diagramFilename("VSCStation3"))));
+}
+
 TEST(Diagram, writeEmpty) {
   using dfl::algo::GeneratorDefinition;
 
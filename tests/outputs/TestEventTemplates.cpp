@@ -0,0 +1,189 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "Contingencies.h"
+#include "DydEvent.h"
+#include "EventTemplates.h"
+#include "Log.h"
+#include "ParEvent.h"
+#include "Tests.h"
+
+#include <boost/filesystem.hpp>
+#include <gtest_dynawo.h>
+
+testing::Environment *initXmlEnvironment();
+
+testing::Environment *const env = initXmlEnvironment();
+
+using ElementType = dfl::inputs::ContingencyElement::Type;
+
+static const double timeOfEvent = 80.;
+
+/**
+ * @brief Check that the event files stamped from the templates are the same as the ones of DydEvent and ParEvent
+ *
+ * @param basename the basename of the event files
+ * @param contingency the contingency
+ * @param networkElements set of contingencies elements using network cpp model
+ */
+static void
+checkContingency(const std::string &basename, const dfl::inputs::Contingency &contingency, const std::unordered_set<std::string> &networkElements) {
+  boost::filesystem::path outputPath(outputPathResults);
+  outputPath.append("TestEventTemplates");
+  if (!boost::filesystem::exists(outputPath)) {
+    boost::filesystem::create_directories(outputPath);
+  }
+  const std::string dydFilepath = (outputPath / (basename + ".dyd")).generic_string();
+  const std::string parFilepath = (outputPath / (basename + ".par")).generic_string();
+  const std::string dydReferenceFilepath = (outputPath / (basename + "_reference.dyd")).generic_string();
+  const std::string parReferenceFilepath = (outputPath / (basename + "_reference.par")).generic_string();
+
+  dfl::outputs::EventTemplates eventTemplates(timeOfEvent);
+  eventTemplates.writeDyd(basename, dydFilepath, contingency, networkElements);
+  eventTemplates.writePar(parFilepath, contingency, networkElements);
+
+  dfl::outputs::DydEvent dyd(dfl::outputs::DydEvent::DydEventDefinition(basename, dydReferenceFilepath, contingency, networkElements));
+  dyd.write();
+  dfl::outputs::ParEvent par(dfl::outputs::ParEvent::ParEventDefinition(basename, parReferenceFilepath, contingency, networkElements, timeOfEvent));
+  par.write();
+
+  dfl::test::checkFilesEqual(dydFilepath, dydReferenceFilepath);
+  dfl::test::checkFilesEqual(parFilepath, parReferenceFilepath);
+}
+
+TEST(TestEventTemplates, reference) {
+  std::string basename = "TestDydEvent";
+
+  boost::filesystem::path outputPath(outputPathResults);
+  outputPath.append("TestEventTemplates");
+  if (!boost::filesystem::exists(outputPath)) {
+    boost::filesystem::create_directories(outputPath);
+  }
+
+  auto contingency = dfl::inputs::Contingency("TestContingency");
+  contingency.elements.emplace_back("TestBranch", ElementType::BRANCH);
+  contingency.elements.emplace_back("TestGenerator", ElementType::GENERATOR);
+  contingency.elements.emplace_back("TestLoad", ElementType::LOAD);
+  contingency.elements.emplace_back("TestHvdcLine", ElementType::HVDC_LINE);
+  contingency.elements.emplace_back("TestShuntCompensator", ElementType::SHUNT_COMPENSATOR);
+  contingency.elements.emplace_back("TestStaticVarCompensator", ElementType::STATIC_VAR_COMPENSATOR);
+  contingency.elements.emplace_back("TestGeneratorNetwork", ElementType::GENERATOR);
+  contingency.elements.emplace_back("TestLoadNetwork", ElementType::LOAD);
+  contingency.elements.emplace_back("TestStaticVarCompensatorNetwork", ElementType::STATIC_VAR_COMPENSATOR);
+
+  std::unordered_set<std::string> networkElements;
+  networkElements.insert("TestGeneratorNetwork");
+  networkElements.insert("TestLoadNetwork");
+  networkElements.insert("TestStaticVarCompensatorNetwork");
+
+  // same DYD as the one of DydEvent
+  dfl::outputs::EventTemplates eventTemplates(timeOfEvent);
+  const std::string dydFilepath = (outputPath / (basename + ".dyd")).generic_string();
+  eventTemplates.writeDyd(basename, dydFilepath, contingency, networkElements);
+  boost::filesystem::path dydReference("reference");
+  dydReference.append(basename);
+  dydReference.append(basename + ".dyd");
+  dfl::test::checkFilesEqual(dydFilepath, dydReference.generic_string());
+
+  // same PAR as the one of ParEvent
+  basename = "TestParEvent";
+  auto parContingency = dfl::inputs::Contingency("TestContingency");
+  parContingency.elements.emplace_back("TestBranch", ElementType::BRANCH);
+  parContingency.elements.emplace_back("TestGenerator", ElementType::GENERATOR);
+  parContingency.elements.emplace_back("TestShuntCompensator", ElementType::SHUNT_COMPENSATOR);
+  parContingency.elements.emplace_back("TestGeneratorNetwork", ElementType::GENERATOR);
+  parContingency.elements.emplace_back("TestLoadNetwork", ElementType::LOAD);
+  parContingency.elements.emplace_back("TestStaticVarCompensatorNetwork", ElementType::STATIC_VAR_COMPENSATOR);
+  const std::string parFilepath = (outputPath / (basename + ".par")).generic_string();
+  eventTemplates.writePar(parFilepath, parContingency, networkElements);
+  boost::filesystem::path parReference("reference");
+  parReference.append(basename);
+  parReference.append(basename + ".par");
+  dfl::test::checkFilesEqual(parFilepath, parReference.generic_string());
+}
+
+TEST(TestEventTemplates, allTypes) {
+  auto contingency = dfl::inputs::Contingency("AllTypes");
+  contingency.elements.emplace_back("Z_LINE", ElementType::LINE);
+  contingency.elements.emplace_back("A_TFO", ElementType::TWO_WINDINGS_TRANSFORMER);
+  contingency.elements.emplace_back("M_TFO3W", ElementType::THREE_WINDINGS_TRANSFORMER);
+  contingency.elements.emplace_back("B_DANGLING", ElementType::DANGLING_LINE);
+  contingency.elements.emplace_back("Y_BUSBAR", ElementType::BUSBAR_SECTION);
+  contingency.elements.emplace_back("C_HVDC", ElementType::HVDC_LINE);
+  contingency.elements.emplace_back("X_SHUNT", ElementType::SHUNT_COMPENSATOR);
+  contingency.elements.emplace_back("D_LOAD", ElementType::LOAD);
+  contingency.elements.emplace_back("W_LOAD_NETWORK", ElementType::LOAD);
+
+  std::unordered_set<std::string> networkElements;
+  networkElements.insert("W_LOAD_NETWORK");
+
+  checkContingency("TestEventTemplates-AllTypes", contingency, networkElements);
+}
+
+TEST(TestEventTemplates, empty) {
+  checkContingency("TestEventTemplates-Empty", dfl::inputs::Contingency("Empty"), {});
+}
+
+TEST(TestEventTemplates, escaped) {
+  // ids escaped by the exporters are written by DydEvent and ParEvent
+  auto contingency = dfl::inputs::Contingency("Escaped");
+  contingency.elements.emplace_back("LINE_<\"&'>", ElementType::LINE);
+  contingency.elements.emplace_back("LOAD_\xc3\xa9", ElementType::LOAD);
+
+  checkContingency("TestEventTemplates-Escaped", contingency, {});
+}
+
+TEST(TestEventTemplates, eventsPar) {
+  boost::filesystem::path outputPath(outputPathResults);
+  outputPath.append("TestEventTemplates");
+  if (!boost::filesystem::exists(outputPath)) {
+    boost::filesystem::create_directories(outputPath);
+  }
+
+  std::vector<dfl::inputs::Contingency> contingencies;
+  contingencies.emplace_back("LineAndGenerator");
+  contingencies.back().elements.emplace_back("LINE", ElementType::LINE);
+  contingencies.back().elements.emplace_back("GENERATOR", ElementType::GENERATOR);
+  contingencies.emplace_back("LineAndLoad");
+  contingencies.back().elements.emplace_back("LINE", ElementType::LINE);
+  contingencies.back().elements.emplace_back("LOAD_NETWORK", ElementType::LOAD);
+  contingencies.emplace_back("Empty");
+
+  std::unordered_set<std::string> networkElements;
+  networkElements.insert("LOAD_NETWORK");
+
+  const std::string parFilepath = (outputPath / "TestEventTemplates_Events.par").generic_string();
+  dfl::outputs::EventTemplates eventTemplates(timeOfEvent);
+  eventTemplates.writeEventsPar(parFilepath, contingencies, networkElements);
+
+  // same PAR as the one of ParEvent for a contingency of all the elements, the set of an element being written once
+  auto allElements = dfl::inputs::Contingency("AllElements");
+  allElements.elements.emplace_back("LINE", ElementType::LINE);
+  allElements.elements.emplace_back("GENERATOR", ElementType::GENERATOR);
+  allElements.elements.emplace_back("LOAD_NETWORK", ElementType::LOAD);
+  const std::string parReferenceFilepath = (outputPath / "TestEventTemplates_Events_reference.par").generic_string();
+  dfl::outputs::ParEvent par(
+      dfl::outputs::ParEvent::ParEventDefinition("TestEventTemplates_Events", parReferenceFilepath, allElements, networkElements, timeOfEvent));
+  par.write();
+
+  dfl::test::checkFilesEqual(parFilepath, parReferenceFilepath);
+}
+
+#ifdef __linux__
+TEST(TestEventTemplates, writeFailure) {
+  // the file is opened but the data written into it is lost, the device being full
+  auto contingency = dfl::inputs::Contingency("Full");
+  contingency.elements.emplace_back("LINE", ElementType::LINE);
+
+  dfl::outputs::EventTemplates eventTemplates(timeOfEvent);
+  ASSERT_THROW_DYNAWO(eventTemplates.writeDyd("Full", "/dev/full", contingency, {}), DYN::Error::GENERAL, dfl::KeyError_t::FileWritingFailed);
+  ASSERT_THROW_DYNAWO(eventTemplates.writePar("/dev/full", contingency, {}), DYN::Error::GENERAL, dfl::KeyError_t::FileWritingFailed);
+}
+#endif
@@ -61,7 +61,7 @@ TEST(TestPar, write) {
   outputPath.append(filename);
   dfl::inputs::Configuration config("res/config_activepowercompensation_p.json");
   dfl::outputs::Par parWriter(dfl::outputs::Par::ParDefinition(basename, config, outputPath.generic_string(), generators, noHvdcDefs,
-                                                               busesToNumberOfRegulationMap, manager, {}, noModels, {}, {}, {}, {}));
+                                                               busesToNumberOfRegulationMap, manager, {}, noModels, {}, {}, {}));
 
   parWriter.write();
 
@@ -106,7 +106,7 @@ TEST(TestPar, writeRemote) {
   outputPath.append(filename);
   dfl::inputs::Configuration config("res/config_activepowercompensation_p.json");
   dfl::outputs::Par parWriter(dfl::outputs::Par::ParDefinition(basename, config, outputPath.generic_string(), generators, noHvdcDefs,
-                                                               busesToNumberOfRegulationMap, manager, {}, noModels, {}, {}, {}, {}));
+                                                               busesToNumberOfRegulationMap, manager, {}, noModels, {}, {}, {}));
 
   parWriter.write();
 
@@ -178,7 +178,7 @@ TEST(TestPar, writeHdvc) {
   outputPath.append(filename);
   dfl::inputs::Configuration config("res/config_activepowercompensation_p.json");
   dfl::outputs::Par parWriter(dfl::outputs::Par::ParDefinition(basename, config, outputPath.generic_string(), {}, hvdcDefs, busesToNumberOfRegulationMap,
-                                                               manager, {}, noModels, {}, {}, {}, {}));
+                                                               manager, {}, noModels, {}, {}, {}));
 
   parWriter.write();
 
@@ -290,10 +290,12 @@ TEST(TestPar, DynModel) {
   auto tfo = dfl::inputs::Tfo::build("TFOId", nodes[0], nodes[1], "SUMMER", true, true);
   auto tfo2 = dfl::inputs::Tfo::build("TFOId2", nodes[0], nodes[1], "SUMMER", true, true);
   dfl::algo::TransformersByIdDefinitions tfosById;
-  tfosById.tfosMap.insert({"TFOId", *tfo});
-  tfosById.tfosMap.insert({"TFOId2", *tfo});
+  tfosById.tfosMap.insert({"TFOId", tfo.get()});
+  tfosById.tfosMap.insert({"TFOId2", tfo.get()});
+  dfl::algo::LinesByIdDefinitions noLines;
+  dfl::algo::DefinitionsIndex definitionsIndex(generators, {}, {}, hvdcDefs, noLines, tfosById);
   dfl::outputs::Par parWriter(dfl::outputs::Par::ParDefinition(basename, config, outputPath.generic_string(), generators, hvdcDefs, noBuses, manager, counters,
-                                                               defs, {}, tfosById, {}, {}));
+                                                               defs, definitionsIndex, {}, {}));
   parWriter.write();
 
   boost::filesystem::path reference("reference");
@@ -340,7 +342,7 @@ TEST(TestPar, writeStaticVarCompensator) {
   outputPath.append(filename);
   dfl::inputs::Configuration config("res/config_activepowercompensation_p.json");
   dfl::outputs::Par parWriter(
-      dfl::outputs::Par::ParDefinition(basename, config, outputPath.generic_string(), {}, noHvdcDefs, noBuses, manager, {}, noModels, {}, {}, svarcs, {}));
+      dfl::outputs::Par::ParDefinition(basename, config, outputPath.generic_string(), {}, noHvdcDefs, noBuses, manager, {}, noModels, {}, svarcs, {}));
 
   parWriter.write();
 
@@ -379,7 +381,7 @@ TEST(TestPar, writeLoad) {
   outputPath.append(filename);
   dfl::inputs::Configuration config("res/config_activepowercompensation_p.json");
   dfl::outputs::Par parWriter(
-      dfl::outputs::Par::ParDefinition(basename, config, outputPath.generic_string(), {}, noHvdcDefs, noBuses, manager, {}, noModels, {}, {}, {}, loads));
+      dfl::outputs::Par::ParDefinition(basename, config, outputPath.generic_string(), {}, noHvdcDefs, noBuses, manager, {}, noModels, {}, {}, loads));
 
   parWriter.write();
 
@@ -429,7 +431,7 @@ TEST(TestPar, writeVRRemote) {
   outputPath.append(filename);
   dfl::inputs::Configuration config("res/config_activepowercompensation_p.json");
   dfl::outputs::Par parWriter(dfl::outputs::Par::ParDefinition(basename, config, outputPath.generic_string(), generators, hvdcDefs,
-                                                               busesToNumberOfRegulationMap, manager, {}, noModels, {}, {}, {}, {}));
+                                                               busesToNumberOfRegulationMap, manager, {}, noModels, {}, {}, {}));
 
   parWriter.write();
 
@@ -538,7 +540,7 @@ TEST(TestPar, startingPointMode) {
     std::string startingPointConfigFilePath = "res/" + startingPointModeFile;
     dfl::inputs::Configuration config(startingPointConfigFilePath);
     dfl::outputs::Par startingPointModeParWriter(dfl::outputs::Par::ParDefinition(basename, config, outputPath.generic_string(), generators, hvdcDefs, noBuses,
-                                                                                  manager, {}, noModels, {}, {}, svarcs, loads));
+                                                                                  manager, {}, noModels, {}, svarcs, loads));
 
     startingPointModeParWriter.write();
 
@@ -0,0 +1,72 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  TestScenarioJournal.cpp
+ *
+ * @brief Scenario journal test file
+ *
+ */
+
+#include "ScenarioJournal.h"
+#include "Tests.h"
+
+#include <fstream>
+
+namespace file = boost::filesystem;
+
+using dfl::outputs::ScenarioJournal;
+
+TEST(ScenarioJournal, appendRead) {
+  file::path directory(outputPathResults);
+  directory.append("TestScenarioJournal");
+  file::create_directories(directory);
+  const file::path filepath = directory / "scenarioJournal.jsonl";
+
+  // results written on several lines, with quotes and special characters, are kept as they are
+  const std::vector<ScenarioJournal::Entry> entries{
+      {"s1", "0001-0123456789abcdef", "<scenarioResults id=\"s1\" status=\"CONVERGENCE\"/>"},
+      {"s2", "0001-fedcba9876543210", "<scenarioResults id=\"s2\" status=\"DIVERGENCE\">\n  <criteriaNonRespected id=\"a;b\\c\"/>\n</scenarioResults>"}};
+  {
+    ScenarioJournal journal(filepath);
+    for (const auto &entry : entries) {
+      journal.append(entry);
+    }
+    // the entries are readable as soon as they are appended
+    ASSERT_EQ(ScenarioJournal::read(filepath).size(), entries.size());
+  }
+  auto readEntries = ScenarioJournal::read(filepath);
+  ASSERT_EQ(readEntries.size(), entries.size());
+  for (std::size_t i = 0; i < entries.size(); ++i) {
+    ASSERT_EQ(readEntries[i].id, entries[i].id);
+    ASSERT_EQ(readEntries[i].key, entries[i].key);
+    ASSERT_EQ(readEntries[i].result, entries[i].result);
+  }
+
+  // an entry cut by an interrupted run is ignored
+  {
+    std::ofstream out(filepath.c_str(), std::ios::binary | std::ios::app);
+    out << "{\"id\":\"s3\",\"key\":\"0001-";
+  }
+  readEntries = ScenarioJournal::read(filepath);
+  ASSERT_EQ(readEntries.size(), entries.size());
+  ASSERT_EQ(readEntries.back().id, "s2");
+
+  // a new journal replaces the previous one
+  {
+    ScenarioJournal journal(filepath);
+    journal.append(entries.back());
+  }
+  readEntries = ScenarioJournal::read(filepath);
+  ASSERT_EQ(readEntries.size(), 1U);
+  ASSERT_EQ(readEntries.front().id, "s2");
+
+  ASSERT_TRUE(ScenarioJournal::read(directory / "missing.jsonl").empty());
+}
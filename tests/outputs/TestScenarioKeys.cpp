@@ -0,0 +1,90 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  TestScenarioKeys.cpp
+ *
+ * @brief Scenario keys test file
+ *
+ */
+
+#include "ScenarioKeys.h"
+#include "Tests.h"
+
+#include <fstream>
+
+namespace file = boost::filesystem;
+
+using dfl::outputs::ScenarioKeys;
+
+/**
+ * @brief Write a file, creating its directory if needed
+ *
+ * @param filepath the file path
+ * @param content the content of the file
+ */
+static void writeFile(const file::path &filepath, const std::string &content) {
+  file::create_directories(filepath.parent_path());
+  std::ofstream out(filepath.c_str(), std::ios::binary);
+  out << content;
+}
+
+/**
+ * @brief Prepare an empty directory for a test
+ *
+ * @param name the name of the test
+ * @returns the directory of the test
+ */
+static file::path testDirectory(const std::string &name) {
+  file::path directory(outputPathResults);
+  directory.append("TestScenarioKeys").append(name);
+  file::remove_all(directory);
+  file::create_directories(directory);
+  return directory;
+}
+
+TEST(ScenarioKeys, compute) {
+  const auto directory = testDirectory("compute");
+  writeFile(directory / "network.iidm", "network");
+  writeFile(directory / "s1.dyd", "events");
+  writeFile(directory / "s2.dyd", "events");
+  writeFile(directory / "s3.dyd", "other events");
+
+  const ScenarioKeys scenarioKeys({directory / "network.iidm"}, {}, {});
+  // the key only depends on the content of the inputs, not on their names
+  ASSERT_EQ(scenarioKeys.compute({directory / "s1.dyd"}), scenarioKeys.compute({directory / "s2.dyd"}));
+  ASSERT_NE(scenarioKeys.compute({directory / "s1.dyd"}), scenarioKeys.compute({directory / "s3.dyd"}));
+  ASSERT_NE(scenarioKeys.compute({directory / "s1.dyd"}), scenarioKeys.compute({directory / "missing.dyd"}));
+
+  writeFile(directory / "network.iidm", "modified network");
+  const ScenarioKeys modifiedScenarioKeys({directory / "network.iidm"}, {}, {});
+  ASSERT_NE(scenarioKeys.compute({directory / "s1.dyd"}), modifiedScenarioKeys.compute({directory / "s1.dyd"}));
+}
+
+TEST(ScenarioKeys, locations) {
+  const auto directory = testDirectory("locations");
+  writeFile(directory / "network.iidm", "network");
+  writeFile(directory / "run1" / "main.par", "<par value=\"/data/run1/diagrams/G1.txt\"/>");
+  writeFile(directory / "run1" / "s1.dyd", "<event parFile=\"/data/run1/s1.par\"/>");
+  writeFile(directory / "run2" / "main.par", "<par value=\"/other/run2/diagrams/G1.txt\"/>");
+  writeFile(directory / "run2" / "s1.dyd", "<event parFile=\"/other/run2/s1.par\"/>");
+  writeFile(directory / "run3" / "main.par", "<par value=\"/data/run1/diagrams/G2.txt\"/>");
+
+  // the output directories of the runs are not part of the keys, the rest of the generated files is
+  const ScenarioKeys keys1({directory / "network.iidm"}, {directory / "run1" / "main.par"}, {"/data/run1", "/data/run1/network.iidm"});
+  const ScenarioKeys keys2({directory / "network.iidm"}, {directory / "run2" / "main.par"}, {"/other/run2", "/other/network.iidm"});
+  const ScenarioKeys keys3({directory / "network.iidm"}, {directory / "run3" / "main.par"}, {"/data/run1", "/data/run1/network.iidm"});
+  ASSERT_EQ(keys1.compute({directory / "run1" / "s1.dyd"}), keys2.compute({directory / "run2" / "s1.dyd"}));
+  ASSERT_NE(keys1.compute({directory / "run1" / "s1.dyd"}), keys3.compute({directory / "run1" / "s1.dyd"}));
+
+  // the locations are told apart by their place in the list
+  const ScenarioKeys swappedKeys({directory / "network.iidm"}, {directory / "run2" / "main.par"}, {"/other/network.iidm", "/other/run2"});
+  ASSERT_NE(keys1.compute({directory / "run1" / "s1.dyd"}), swappedKeys.compute({directory / "run2" / "s1.dyd"}));
+}
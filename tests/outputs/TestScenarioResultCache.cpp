@@ -0,0 +1,126 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+/**
+ * @file  TestScenarioResultCache.cpp
+ *
+ * @brief Scenario result cache test file
+ *
+ */
+
+#include "ScenarioKeys.h"
+#include "ScenarioResultCache.h"
+#include "Tests.h"
+
+#include <algorithm>
+#include <ctime>
+#include <fstream>
+
+namespace file = boost::filesystem;
+
+using dfl::outputs::ScenarioKeys;
+using dfl::outputs::ScenarioResultCache;
+
+/**
+ * @brief Write a file, creating its directory if needed
+ *
+ * @param filepath the file path
+ * @param content the content of the file
+ */
+static void writeFile(const file::path &filepath, const std::string &content) {
+  file::create_directories(filepath.parent_path());
+  std::ofstream out(filepath.c_str(), std::ios::binary);
+  out << content;
+}
+
+/**
+ * @brief Prepare an empty directory for a test
+ *
+ * @param name the name of the test
+ * @returns the directory of the test
+ */
+static file::path testDirectory(const std::string &name) {
+  file::path directory(outputPathResults);
+  directory.append("TestScenarioResultCache").append(name);
+  file::remove_all(directory);
+  file::create_directories(directory);
+  return directory;
+}
+
+TEST(ScenarioResultCache, storeRestore) {
+  const auto directory = testDirectory("storeRestore");
+  writeFile(directory / "s1.dyd", "events");
+  const file::path outputs = directory / "outputs";
+  writeFile(outputs / "s1" / "outputs" / "finalState" / "outputIIDM.xml", "final state");
+  writeFile(outputs / "constraints" / "constraints_s1.xml", "constraints");
+  writeFile(outputs / "lostEquipments" / "lostEquipments_s1.xml", "lost equipments");
+  writeFile(outputs / "constraints" / "constraints_s1_bis.xml", "constraints of another scenario");
+  writeFile(outputs / "aggregatedResults.xml", "aggregated results");
+
+  // files named after a scenario are only listed for the scenarios asked for
+  const auto outputFiles = ScenarioResultCache::listOutputFiles(outputs, {"s1"});
+  ASSERT_EQ(outputFiles.size(), 1U);
+  auto files = outputFiles.at("s1");
+  std::sort(files.begin(), files.end());
+  ASSERT_EQ(files, std::vector<file::path>({file::path("constraints/constraints_s1.xml"), file::path("lostEquipments/lostEquipments_s1.xml"),
+                                            file::path("s1/outputs/finalState/outputIIDM.xml")}));
+
+  const ScenarioKeys scenarioKeys({}, {}, {});
+  const ScenarioResultCache cache(directory / "cache", 1 << 20);
+  const auto key = scenarioKeys.compute({directory / "s1.dyd"});
+  ASSERT_FALSE(cache.contains(key));
+  const std::string result = "<scenarioResults id=\"s1\" status=\"CONVERGENCE\"/>";
+  cache.store(key, result, outputs, "s1", files);
+  ASSERT_TRUE(cache.contains(key));
+
+  // the output files are restored for a scenario of the same inputs, renamed after it
+  const file::path restoredOutputs = directory / "restoredOutputs";
+  std::string restoredResult;
+  ASSERT_TRUE(cache.restore(key, restoredOutputs, "s2", restoredResult));
+  ASSERT_EQ(restoredResult, result);
+  dfl::test::checkFilesEqual((restoredOutputs / "s2" / "outputs" / "finalState" / "outputIIDM.xml").generic_string(),
+                             (outputs / "s1" / "outputs" / "finalState" / "outputIIDM.xml").generic_string());
+  dfl::test::checkFilesEqual((restoredOutputs / "constraints" / "constraints_s2.xml").generic_string(),
+                             (outputs / "constraints" / "constraints_s1.xml").generic_string());
+  dfl::test::checkFilesEqual((restoredOutputs / "lostEquipments" / "lostEquipments_s2.xml").generic_string(),
+                             (outputs / "lostEquipments" / "lostEquipments_s1.xml").generic_string());
+  ASSERT_FALSE(file::exists(restoredOutputs / "constraints" / "constraints_s2_bis.xml"));
+
+  ASSERT_FALSE(cache.restore(scenarioKeys.compute({}), restoredOutputs, "s3", restoredResult));
+}
+
+TEST(ScenarioResultCache, evict) {
+  const auto directory = testDirectory("evict");
+  writeFile(directory / "s1.dyd", "events 1");
+  writeFile(directory / "s2.dyd", "events 2");
+  writeFile(directory / "s3.dyd", "events 3");
+  const std::string result(100, ' ');
+
+  // the cache can only hold two results
+  const ScenarioKeys scenarioKeys({}, {}, {});
+  const ScenarioResultCache cache(directory / "cache", 250);
+  std::vector<std::string> keys;
+  for (const auto scenarioInput : {"s1.dyd", "s2.dyd", "s3.dyd"}) {
+    keys.push_back(scenarioKeys.compute({directory / scenarioInput}));
+    cache.store(keys.back(), result, directory, scenarioInput, {});
+  }
+  file::last_write_time(directory / "cache" / keys[0], std::time(nullptr) - 30);
+  file::last_write_time(directory / "cache" / keys[1], std::time(nullptr) - 20);
+  file::last_write_time(directory / "cache" / keys[2], std::time(nullptr) - 10);
+
+  // a restored result is the most recently used one
+  std::string restoredResult;
+  ASSERT_TRUE(cache.restore(keys[0], directory / "restoredOutputs", "s1", restoredResult));
+
+  cache.evict();
+  ASSERT_TRUE(cache.contains(keys[0]));
+  ASSERT_FALSE(cache.contains(keys[1]));
+  ASSERT_TRUE(cache.contains(keys[2]));
+}
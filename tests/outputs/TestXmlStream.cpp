@@ -0,0 +1,280 @@
+//
+// Copyright (c) 2025, RTE (http://www.rte-france.com)
+// See AUTHORS.txt
+// All rights reserved.
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, you can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+//
+
+#include "DydCommon.h"
+#include "DydStream.h"
+#include "ParCommon.h"
+#include "Log.h"
+#include "OutputsConstants.h"
+#include "ParStream.h"
+#include "Tests.h"
+
+#include <DYDDynamicModelsCollectionFactory.h>
+#include <DYDMacroConnectFactory.h>
+#include <DYDMacroConnectorFactory.h>
+#include <DYDMacroStaticReferenceFactory.h>
+#include <DYDXmlExporter.h>
+#include <PARParametersSetCollectionFactory.h>
+#include <PARParametersSetFactory.h>
+#include <PARXmlExporter.h>
+#include <gtest_dynawo.h>
+
+#include <sstream>
+
+testing::Environment *initXmlEnvironment();
+
+testing::Environment *const env = initXmlEnvironment();
+
+static const unsigned int nbElements = 100;
+
+/**
+ * @brief Id of an element, the elements being added in an order different from the order of their ids
+ *
+ * @param prefix the prefix of the id
+ * @param index the index of the element
+ * @returns the id, with characters escaped in XML documents
+ */
+static std::string
+elementId(const std::string &prefix, unsigned int index) {
+  return prefix + "_<\"&\xc3\xa9'>_" + std::to_string((index * 37) % nbElements);
+}
+
+/// @brief Watcher of the elements given to a stream, checking that no more than a batch of elements is held before being written
+struct BuildWatcher {
+  /**
+   * @brief Constructor
+   *
+   * @param out the stream the file is written into
+   * @param batchSize the maximum number of elements exported at once by the stream
+   */
+  BuildWatcher(std::ostringstream &out, std::size_t batchSize) : out(out), batchSize(batchSize) {}
+
+  /// @brief Record the build of an element
+  void built() {
+    ++nbBuilt;
+    held();
+  }
+
+  /**
+   * @brief Record the addition of an element, only held by the stream during its pass
+   *
+   * @param elementPass the pass the element is added during
+   */
+  void added(unsigned int elementPass) {
+    if (elementPass == pass) {
+      held();
+    }
+  }
+
+  /// @brief Record an element held by the stream until its batch is written
+  void held() {
+    // the file grows each time a batch is written
+    if (out.tellp() != sizeAtLastWrite) {
+      sizeAtLastWrite = out.tellp();
+      nbHeld = 0;
+    }
+    ++nbHeld;
+    ASSERT_LE(nbHeld, batchSize);
+  }
+
+  std::ostringstream &out;                           ///< stream the file is written into
+  const std::size_t batchSize;                       ///< maximum number of elements exported at once
+  std::ostringstream::pos_type sizeAtLastWrite = 0;  ///< size of the file at the last write
+  std::size_t nbHeld = 0;                            ///< number of elements held since the last write
+  unsigned int nbBuilt = 0;                          ///< number of elements built
+  unsigned int pass = 0;                             ///< current pass of the stream
+};
+
+static std::unique_ptr<dynamicdata::BlackBoxModel>
+buildModel(unsigned int i) {
+  return dfl::outputs::helper::buildBlackBoxStaticId(elementId("LOAD", i), elementId("LOAD", i), "DYNModelLoadRestorativeWithLimits", "TestXmlStream.par",
+                                                     elementId("SET", i));
+}
+
+static std::unique_ptr<dynamicdata::MacroConnector>
+buildMacroConnector(unsigned int i) {
+  auto connector = dynamicdata::MacroConnectorFactory::newMacroConnector(elementId("CONNECTOR", i));
+  connector->addConnect("load_terminal", "@STATIC_ID@@NODE@_ACPIN");
+  return connector;
+}
+
+static std::unique_ptr<dynamicdata::MacroStaticReference>
+buildMacroStaticReference(unsigned int i) {
+  auto macroStaticReference = dynamicdata::MacroStaticReferenceFactory::newMacroStaticReference(elementId("REFERENCE", i));
+  macroStaticReference->addStaticRef("PPu_value", "p");
+  return macroStaticReference;
+}
+
+static std::shared_ptr<parameters::ParametersSet>
+buildSet(unsigned int i) {
+  auto set = parameters::ParametersSetFactory::newParametersSet(elementId("SET", i));
+  set->addParameter(dfl::outputs::helper::buildParameter("load_Alpha", 1.5 * i));
+  set->addReference(dfl::outputs::helper::buildReference("load_P0Pu", "p0_pu", "DOUBLE"));
+  return set;
+}
+
+static std::unique_ptr<parameters::MacroParameterSet>
+buildMacroSet(unsigned int i) {
+  auto macroParameterSet = std::unique_ptr<parameters::MacroParameterSet>(new parameters::MacroParameterSet(elementId("MACRO", i)));
+  macroParameterSet->addParameter(dfl::outputs::helper::buildParameter("load_Beta", 2.5));
+  return macroParameterSet;
+}
+
+/**
+ * @brief Add the elements to a DYD stream, as builders for the elements sorted by id
+ *
+ * @param models the stream to fill
+ * @param watcher the watcher of the builders
+ */
+static void
+addModels(dfl::outputs::DydStream &models, BuildWatcher &watcher) {
+  for (unsigned int i = 0; i < nbElements; ++i) {
+    models.addModel(elementId("LOAD", i), [i, &watcher]() {
+      watcher.built();
+      return buildModel(i);
+    });
+    models.addMacroConnect(dynamicdata::MacroConnectFactory::newMacroConnect(elementId("CONNECTOR", i % 3), elementId("LOAD", i), "NETWORK"));
+    watcher.added(1);
+    models.addConnect(elementId("LOAD", i), "load_switchOffSignal1", "NETWORK", elementId("BUS", i) + "_switchOff");
+    watcher.added(2);
+    if (i % 10 == 0) {
+      models.addMacroConnector(elementId("CONNECTOR", i), [i, &watcher]() {
+        watcher.built();
+        return buildMacroConnector(i);
+      });
+      models.addMacroStaticReference(elementId("REFERENCE", i), [i, &watcher]() {
+        watcher.built();
+        return buildMacroStaticReference(i);
+      });
+    }
+  }
+}
+
+/**
+ * @brief Add the same elements to a DYD collection
+ *
+ * @param models the collection to fill
+ */
+static void
+addModels(dynamicdata::DynamicModelsCollection &models) {
+  for (unsigned int i = 0; i < nbElements; ++i) {
+    models.addModel(buildModel(i));
+    models.addMacroConnect(dynamicdata::MacroConnectFactory::newMacroConnect(elementId("CONNECTOR", i % 3), elementId("LOAD", i), "NETWORK"));
+    models.addConnect(elementId("LOAD", i), "load_switchOffSignal1", "NETWORK", elementId("BUS", i) + "_switchOff");
+    if (i % 10 == 0) {
+      models.addMacroConnector(buildMacroConnector(i));
+      models.addMacroStaticReference(buildMacroStaticReference(i));
+    }
+  }
+}
+
+/**
+ * @brief Add the sets to a PAR stream, as builders
+ *
+ * @param sets the stream to fill
+ * @param watcher the watcher of the builders
+ */
+static void
+addSets(dfl::outputs::ParStream &sets, BuildWatcher &watcher) {
+  for (unsigned int i = 0; i < nbElements; ++i) {
+    sets.addParametersSet(elementId("SET", i), [i, &watcher]() {
+      watcher.built();
+      return buildSet(i);
+    });
+    if (i % 10 == 0) {
+      sets.addMacroParameterSet(elementId("MACRO", i), [i, &watcher]() {
+        watcher.built();
+        return buildMacroSet(i);
+      });
+    }
+  }
+  // a set which is not written after all
+  sets.addParametersSet("SKIPPED", []() { return std::shared_ptr<parameters::ParametersSet>(); });
+}
+
+/**
+ * @brief Add the same sets to a PAR collection
+ *
+ * @param sets the collection to fill
+ */
+static void
+addSets(parameters::ParametersSetCollection &sets) {
+  for (unsigned int i = 0; i < nbElements; ++i) {
+    sets.addParametersSet(buildSet(i));
+    if (i % 10 == 0) {
+      sets.addMacroParameterSet(buildMacroSet(i));
+    }
+  }
+}
+
+TEST(XmlStream, dyd) {
+  auto reference = dynamicdata::DynamicModelsCollectionFactory::newCollection();
+  addModels(*reference);
+  dynamicdata::XmlExporter exporter;
+  std::stringstream referenceOut;
+  exporter.exportToStream(reference, referenceOut, dfl::outputs::constants::xmlEncoding);
+
+  for (std::size_t batchSize : {std::size_t{1}, std::size_t{7}, dfl::outputs::XmlDocumentWriter::defaultBatchSize}) {
+    std::ostringstream out;
+    BuildWatcher watcher(out, batchSize);
+    dfl::outputs::DydStream stream(out, batchSize);
+    addModels(stream, watcher);
+    // the elements sorted by id are only built at the end of the first pass
+    ASSERT_EQ(watcher.nbBuilt, 0u);
+    ASSERT_TRUE(stream.nextPass());
+    ASSERT_EQ(watcher.nbBuilt, nbElements + 2 * nbElements / 10);
+    do {
+      ++watcher.pass;
+      addModels(stream, watcher);
+    } while (stream.nextPass());
+    // the builders are only called once
+    ASSERT_EQ(watcher.nbBuilt, nbElements + 2 * nbElements / 10);
+
+    ASSERT_EQ(out.str(), referenceOut.str());
+  }
+}
+
+TEST(XmlStream, par) {
+  auto reference = parameters::ParametersSetCollectionFactory::newCollection();
+  addSets(*reference);
+  parameters::XmlExporter exporter;
+  std::stringstream referenceOut;
+  exporter.exportToStream(std::move(reference), referenceOut, dfl::outputs::constants::xmlEncoding);
+
+  for (std::size_t batchSize : {std::size_t{1}, std::size_t{7}, dfl::outputs::XmlDocumentWriter::defaultBatchSize}) {
+    std::ostringstream out;
+    BuildWatcher watcher(out, batchSize);
+    dfl::outputs::ParStream stream(out, batchSize);
+    addSets(stream, watcher);
+    ASSERT_EQ(watcher.nbBuilt, 0u);
+    ASSERT_TRUE(stream.hasParametersSet(elementId("SET", 0)));
+    ASSERT_TRUE(stream.hasMacroParametersSet(elementId("MACRO", 0)));
+    ASSERT_FALSE(stream.hasParametersSet(elementId("MACRO", 0)));
+    ASSERT_THROW_DYNAWO(stream.addParametersSet(elementId("SET", 0), []() { return buildSet(0); }), DYN::Error::GENERAL,
+                        dfl::KeyError_t::XmlElementNotUnique);
+    stream.write();
+    ASSERT_EQ(watcher.nbBuilt, nbElements + nbElements / 10);
+
+    ASSERT_EQ(out.str(), referenceOut.str());
+  }
+}
+
+TEST(XmlStream, empty) {
+  std::ostringstream out;
+  dfl::outputs::DydStream stream(out);
+  while (stream.nextPass()) {
+  }
+
+  dynamicdata::XmlExporter exporter;
+  std::stringstream referenceOut;
+  exporter.exportToStream(dynamicdata::DynamicModelsCollectionFactory::newCollection(), referenceOut, dfl::outputs::constants::xmlEncoding);
+
+  ASSERT_EQ(out.str(), referenceOut.str());
+}